@@ -8,9 +8,21 @@
 
 #include "dlstreamer/base/frame.h"
 #include "dlstreamer/memory_mapper.h"
+#include <cstdint>
 
 namespace dlstreamer {
 
+// Statistics reported by caching memory mappers
+struct MemoryMapperCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    double hit_rate() const {
+        return (hits + misses) ? static_cast<double>(hits) / static_cast<double>(hits + misses) : 0.0;
+    }
+};
+
 class BaseMemoryMapper : public MemoryMapper {
   public:
     using MemoryMapper::map;
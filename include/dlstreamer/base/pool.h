@@ -7,10 +7,11 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <vector>
 
 namespace dlstreamer {
@@ -22,36 +23,64 @@ class Pool {
         : _allocator(allocator), _is_available(is_available), _max_pool_size(max_pool_size) {
     }
 
+    // Callers waiting for available object are served in arrival order, so pool shared by several streams
+    // (shared-instance-id) is distributed fairly between them. Returned object wakes up waiters when released
     T get_or_create() {
+        std::unique_lock<std::mutex> lock(_state->mutex);
+        const uint64_t ticket = _next_ticket++;
+        T object;
+        // Object can also be referenced apart from returned pointer (e.g. tensor kept by downstream element), such
+        // reference is released without notification, so availability is re-checked after timeout
+        while (ticket != _serving_ticket || !try_get(object))
+            _state->cond.wait_for(lock, RECHECK_INTERVAL);
+        _serving_ticket++;
+        lock.unlock();
+        _state->cond.notify_all(); // let next caller in order check the pool
 
-        for (;;) {
-            {
-                std::lock_guard<std::mutex> lock(_mutex);
-                for (T &object : _pool) {
-                    if (_is_available(object))
-                        return object;
-                }
-                if (!_max_pool_size || _pool.size() < _max_pool_size) { // allocate new object
-                    T object = _allocator();
-                    _pool.push_back(object);
-                    return object;
-                }
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(1)); // TODO optimize
-        }
+        std::shared_ptr<State> state = _state;
+        return T(object.get(), [state, object](typename T::element_type *) mutable {
+            object = nullptr;
+            { std::lock_guard<std::mutex> guard(state->mutex); }
+            state->cond.notify_all();
+        });
     }
 
     size_t size() {
-        std::lock_guard<std::mutex> lock(_mutex);
+        std::lock_guard<std::mutex> lock(_state->mutex);
         return _pool.size();
     }
 
   private:
+    static constexpr std::chrono::milliseconds RECHECK_INTERVAL{10};
+
+    // Shared with returned objects, which may outlive the pool
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cond;
+    };
+
+    bool try_get(T &result) {
+        for (T &object : _pool) {
+            if (_is_available(object)) {
+                result = object;
+                return true;
+            }
+        }
+        if (!_max_pool_size || _pool.size() < _max_pool_size) { // allocate new object
+            result = _allocator();
+            _pool.push_back(result);
+            return true;
+        }
+        return false;
+    }
+
     std::function<T()> _allocator;
     std::function<bool(T &)> _is_available;
     std::vector<T> _pool;
-    std::mutex _mutex;
+    std::shared_ptr<State> _state = std::make_shared<State>();
     size_t _max_pool_size = 0;
+    uint64_t _next_ticket = 0;
+    uint64_t _serving_ticket = 0;
 };
 
 } // namespace dlstreamer
@@ -66,6 +66,11 @@ class BaseTransform : public BaseElement<Transform> {
         return _pool ? _pool->size() : 0;
     }
 
+    // Maximum number of output frames in pool
+    size_t max_pool_size() const {
+        return static_cast<size_t>(_buffer_pool_size);
+    }
+
   protected:
     ContextPtr _app_context;
     FrameInfo _input_info;
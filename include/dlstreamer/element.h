@@ -80,6 +80,7 @@ using ParamDescVector = std::vector<ParamDesc>;
 enum ElementFlags {
     ELEMENT_FLAG_EXTERNAL_MEMORY = (1 << 0), // internal allocation not supported
     ELEMENT_FLAG_SHARABLE = (1 << 1),
+    ELEMENT_FLAG_MULTIPLE_OUTPUTS = (1 << 2), // process(src) is called with same src until it returns nullptr
 };
 
 static constexpr int32_t ElementDescMagic = 0x34495239;
@@ -9,8 +9,14 @@
 #include "dlstreamer/base/memory_mapper.h"
 #include "dlstreamer/dma/tensor.h"
 #include "dlstreamer/gst/allocator.h"
+#include "dlstreamer/gst/frame.h"
+#include <algorithm>
 #include <gst/allocators/gstdmabuf.h>
 #include <gst/gst.h>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace dlstreamer {
 
@@ -18,23 +24,20 @@ class MemoryMapperAnyToGST : public BaseMemoryMapper {
   public:
     using BaseMemoryMapper::BaseMemoryMapper;
 
-    MemoryMapperAnyToGST(const ContextPtr &input_context, const ContextPtr &output_context, bool use_cache)
-        : BaseMemoryMapper(input_context, output_context), _use_cache(use_cache) {
+    static constexpr size_t DEFAULT_CACHE_CAPACITY = 16;
+
+    MemoryMapperAnyToGST(const ContextPtr &input_context, const ContextPtr &output_context, bool use_cache,
+                         size_t cache_capacity = DEFAULT_CACHE_CAPACITY)
+        : BaseMemoryMapper(input_context, output_context) {
+        if (use_cache)
+            _cache = std::make_shared<Cache>(cache_capacity);
     }
 
     ~MemoryMapperAnyToGST() {
         if (_allocator)
             gst_object_unref(_allocator);
-        if (_use_cache) { // call free() on all cached GstBuffer
-            for (auto &it : _cache) {
-                GstMiniObject *mini_object = &it.second->gst_buffer()->mini_object;
-                if (mini_object->refcount == 0) {
-                    mini_object->free(mini_object);
-                } else {
-                    GST_ERROR("Calling free() on GstBuffer with non-zero refcount");
-                }
-            }
-        }
+        if (_cache)
+            _cache->close();
     }
 
     TensorPtr map(TensorPtr src, AccessMode /*mode*/) override {
@@ -57,27 +60,15 @@ class MemoryMapperAnyToGST : public BaseMemoryMapper {
 
     FramePtr map(FramePtr src, AccessMode mode) override {
         GstFramePtr dst;
-        if (_use_cache) {
-            auto handle = reinterpret_cast<Tensor::handle_t>(src.get()); // TODO
-            auto value = _cache.find(handle);
-            if (value != _cache.end()) {
-                dst = value->second;
-                GstBuffer *buf = dst->gst_buffer();
-                // increase ref-count from 0 to 1
-                DLS_CHECK(buf->mini_object.refcount == 0)
-                gst_buffer_ref(buf);
-            } else {
+        if (_cache) {
+            dst = _cache->acquire(src);
+            if (!dst) {
                 TensorVector tensors;
                 for (auto &tensor : src)
                     tensors.push_back(map(tensor, mode));
                 dst = std::make_shared<GSTFrame>(src->media_type(), src->format(), tensors, false);
-                _cache[handle] = dst;
+                _cache->attach(dst, src);
             }
-            // capture FramePtr in qdata and set dispose function for GstBuffer
-            GstMiniObject *mini_object = &dst->gst_buffer()->mini_object;
-            mini_object->dispose = buffer_dispose_callback;
-            FramePtr *src_ptr = new FramePtr(src);
-            gst_mini_object_set_qdata(mini_object, g_quark_from_string(_quark_name), src_ptr, NULL);
         } else {
             TensorVector tensors;
             for (auto &tensor : src)
@@ -95,10 +86,242 @@ class MemoryMapperAnyToGST : public BaseMemoryMapper {
         return dst;
     }
 
+    // Limits number of idle GstBuffer wrappers kept for re-use, typically to size of pool source frames come from
+    void set_cache_capacity(size_t capacity) {
+        if (_cache)
+            _cache->set_capacity(capacity);
+    }
+
+    // Frees idle GstBuffer wrappers. Wrappers currently used downstream are freed instead of being returned to cache.
+    void clear_cache() {
+        if (_cache)
+            _cache->clear();
+    }
+
+    MemoryMapperCacheStats cache_stats() const {
+        return _cache ? _cache->stats() : MemoryMapperCacheStats();
+    }
+
   protected:
+    /**
+     * GstBuffer wrappers keyed by handle of first source tensor. While wrapper is used downstream it references source
+     * frame. When last reference is dropped, dispose callback returns wrapper to the cache instead of freeing it, and
+     * references to source frame are released, so pool the source frame comes from can re-use it. Number of idle
+     * wrappers is bounded by capacity, least recently released ones are freed first.
+     */
+    class Cache : public std::enable_shared_from_this<Cache> {
+      public:
+        explicit Cache(size_t capacity) : _capacity(std::max<size_t>(capacity, 1)) {
+        }
+
+        GstFramePtr acquire(const FramePtr &src) {
+            Entry *stale = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto it = _index.find(src->tensor(0)->handle());
+                if (it == _index.end()) {
+                    _stats.misses++;
+                    return nullptr;
+                }
+                Entry *entry = *it->second;
+                _idle.erase(it->second);
+                _index.erase(it);
+                if (!entry->matches(src)) {
+                    // handle re-used by allocation of different layout
+                    _stats.misses++;
+                    _stats.evictions++;
+                    stale = entry;
+                } else {
+                    _stats.hits++;
+                    entry->bind(src);
+                    // reference kept by cache for idle buffer is passed to caller
+                    return entry->frame;
+                }
+            }
+            destroy(stale);
+            return nullptr;
+        }
+
+        void attach(const GstFramePtr &frame, const FramePtr &src) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto entry = new Entry{shared_from_this(), frame, nullptr, {}, _generation};
+            for (size_t i = 0; i < src->num_tensors(); i++) {
+                auto tensor = src->tensor(static_cast<int>(i));
+                entry->layout.emplace_back(tensor->handle(), tensor->info().nbytes());
+            }
+            entry->src = src;
+            GstMiniObject *mini_object = &frame->gst_buffer()->mini_object;
+            gst_mini_object_set_qdata(mini_object, entry_quark(), entry, NULL);
+            mini_object->dispose = dispose_callback;
+        }
+
+        void set_capacity(size_t capacity) {
+            std::vector<Entry *> evicted;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _capacity = std::max<size_t>(capacity, 1);
+                shrink_locked(evicted);
+            }
+            for (auto entry : evicted)
+                destroy(entry);
+        }
+
+        void clear() {
+            std::vector<Entry *> evicted;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _generation++;
+                evicted.assign(_idle.begin(), _idle.end());
+                _idle.clear();
+                _index.clear();
+            }
+            for (auto entry : evicted)
+                destroy(entry);
+        }
+
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _closed = true;
+            }
+            clear();
+        }
+
+        MemoryMapperCacheStats stats() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _stats;
+        }
+
+      private:
+        struct Entry {
+            std::shared_ptr<Cache> cache;
+            GstFramePtr frame;
+            FramePtr src; // set while buffer is used downstream
+            std::vector<std::pair<Tensor::handle_t, size_t>> layout;
+            uint64_t generation;
+
+            bool matches(const FramePtr &other) const {
+                if (other->num_tensors() != layout.size())
+                    return false;
+                for (size_t i = 0; i < layout.size(); i++) {
+                    auto tensor = other->tensor(static_cast<int>(i));
+                    if (tensor->handle() != layout[i].first || tensor->info().nbytes() != layout[i].second)
+                        return false;
+                }
+                return true;
+            }
+
+            void bind(const FramePtr &new_src) {
+                src = new_src;
+                for (size_t i = 0; i < layout.size(); i++)
+                    set_source_tensor(i, src->tensor(static_cast<int>(i)));
+            }
+
+            void unbind() {
+                for (size_t i = 0; i < layout.size(); i++)
+                    set_source_tensor(i, nullptr);
+                src = nullptr;
+            }
+
+            void set_source_tensor(size_t index, TensorPtr tensor) {
+                auto dst = ptr_cast<GSTTensor>(frame->tensor(static_cast<int>(index)));
+                GstMemory *mem = dst->gst_memory();
+                if (gst_is_dlstreamer_memory(mem)) {
+                    auto dls_mem = GST_DLSTREAMER_MEMORY_CAST(mem);
+                    dls_mem->mapped_tensor = nullptr;
+                    dls_mem->tensor = tensor;
+                }
+                dst->set_parent(std::move(tensor));
+            }
+        };
+
+        static GQuark entry_quark() {
+            static GQuark quark = g_quark_from_static_string("DLStreamerMapperCacheEntry");
+            return quark;
+        }
+
+        static gboolean dispose_callback(GstMiniObject *obj) {
+            auto entry = static_cast<Entry *>(gst_mini_object_get_qdata(obj, entry_quark()));
+            if (entry && entry->cache->release(entry))
+                return FALSE; // keep GstBuffer alive in cache
+            delete entry;
+            return TRUE;
+        }
+
+        // Called from dispose callback on thread dropped the last reference. Returns false if buffer must be freed.
+        bool release(Entry *entry) {
+            std::vector<Entry *> evicted;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_closed || entry->generation != _generation)
+                    return false;
+
+                // take reference owned by cache, same as GstBufferPool does on buffer release
+                GstBuffer *buf = gst_buffer_ref(entry->frame->gst_buffer());
+                gst_buffer_foreach_meta(
+                    buf,
+                    [](GstBuffer *, GstMeta **meta, gpointer) -> gboolean {
+                        *meta = NULL; // remove meta
+                        return TRUE;
+                    },
+                    NULL);
+                GST_BUFFER_FLAGS(buf) = 0;
+                GST_BUFFER_PTS(buf) = GST_CLOCK_TIME_NONE;
+                GST_BUFFER_DTS(buf) = GST_CLOCK_TIME_NONE;
+                GST_BUFFER_DURATION(buf) = GST_CLOCK_TIME_NONE;
+                GST_BUFFER_OFFSET(buf) = GST_BUFFER_OFFSET_NONE;
+                GST_BUFFER_OFFSET_END(buf) = GST_BUFFER_OFFSET_NONE;
+                entry->unbind();
+
+                auto handle = entry->layout.front().first;
+                auto it = _index.find(handle);
+                if (it != _index.end()) {
+                    evicted.push_back(*it->second);
+                    _idle.erase(it->second);
+                    _index.erase(it);
+                    _stats.evictions++;
+                }
+                _idle.push_front(entry);
+                _index[handle] = _idle.begin();
+                shrink_locked(evicted);
+            }
+            for (auto evicted_entry : evicted)
+                destroy(evicted_entry);
+            return true;
+        }
+
+        void shrink_locked(std::vector<Entry *> &evicted) {
+            while (_idle.size() > _capacity) {
+                Entry *entry = _idle.back();
+                _index.erase(entry->layout.front().first);
+                _idle.pop_back();
+                evicted.push_back(entry);
+                _stats.evictions++;
+            }
+        }
+
+        // Frees idle buffer, must be called without lock held
+        static void destroy(Entry *entry) {
+            if (!entry)
+                return;
+            GstBuffer *buf = entry->frame->gst_buffer();
+            buf->mini_object.dispose = NULL;
+            gst_mini_object_set_qdata(&buf->mini_object, entry_quark(), NULL, NULL);
+            gst_buffer_unref(buf);
+            delete entry;
+        }
+
+        mutable std::mutex _mutex;
+        size_t _capacity;
+        uint64_t _generation = 0;
+        bool _closed = false;
+        std::list<Entry *> _idle; // most recently released first
+        std::unordered_map<Tensor::handle_t, std::list<Entry *>::iterator> _index;
+        MemoryMapperCacheStats _stats;
+    };
+
     GstAllocator *_allocator = nullptr;
-    bool _use_cache = false;
-    std::map<Tensor::handle_t, GstFramePtr> _cache;
+    std::shared_ptr<Cache> _cache;
     static auto constexpr _quark_name = "FramePtr";
 
     static void qdata_destroy_callback(gpointer data) {
@@ -106,24 +329,6 @@ class MemoryMapperAnyToGST : public BaseMemoryMapper {
         if (src_ptr)
             delete src_ptr;
     }
-
-    static gboolean buffer_dispose_callback(GstMiniObject *obj) {
-        GstBuffer *buf = reinterpret_cast<GstBuffer *>(obj);
-        // remove captured FramePtr
-        auto quark = g_quark_from_string(_quark_name);
-        FramePtr *src_ptr = reinterpret_cast<FramePtr *>(gst_mini_object_get_qdata(&buf->mini_object, quark));
-        if (src_ptr)
-            delete src_ptr;
-
-        // remove meta
-        gpointer state = NULL;
-        while (GstMeta *meta = gst_buffer_iterate_meta(buf, &state)) {
-            gst_buffer_remove_meta(buf, meta);
-        }
-
-        // return FALSE to keep GstBuffer alive in _cache
-        return FALSE;
-    }
 };
 
 } // namespace dlstreamer
@@ -0,0 +1,47 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef __GST_ANALYTICS_PARAM_MTD__
+#define __GST_ANALYTICS_PARAM_MTD__
+
+#include <gst/analytics/analytics-meta-prelude.h>
+#include <gst/analytics/gstanalyticsmeta.h>
+#include <gst/gst.h>
+
+#if _MSC_VER
+#define GST_ANALYTICS_META_API GST_API_EXPORT
+#endif
+
+G_BEGIN_DECLS
+
+/**
+ * GstAnalyticsParamMtd:
+ * @id: Instance identifier.
+ * @meta: Instance of #GstAnalyticsRelationMeta where the analysis-metadata
+ * identified by @id is stored.
+ *
+ * Handle to #GstStructure holding inference result of a region (detection tensor, raw tensor, etc.), same as
+ * param of #GstVideoRegionOfInterestMeta. Param is related to object detection metadata of its region with
+ * GST_ANALYTICS_REL_TYPE_CONTAIN and GST_ANALYTICS_REL_TYPE_IS_PART_OF relations.
+ * This type is generally expected to be allocated on the stack.
+ */
+typedef struct _GstAnalyticsMtd GstAnalyticsParamMtd;
+
+GST_ANALYTICS_META_API
+GstAnalyticsMtdType gst_analytics_param_mtd_get_mtd_type(void);
+
+GST_ANALYTICS_META_API
+GstStructure *gst_analytics_param_mtd_get_params(const GstAnalyticsParamMtd *handle);
+
+GST_ANALYTICS_META_API
+gboolean gst_analytics_relation_meta_add_param_mtd(GstAnalyticsRelationMeta *instance, GstStructure *params,
+                                                   GstAnalyticsParamMtd *param_mtd);
+
+GST_ANALYTICS_META_API
+guint gst_analytics_param_mtd_attach_roi_metas(GstBuffer *buffer);
+
+G_END_DECLS
+#endif // __GST_ANALYTICS_PARAM_MTD__
@@ -0,0 +1,420 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file gva_binary_format.h
+ * @brief Compact binary serialization of per-frame inference results produced by gvametaconvert format=binary.
+ *
+ * The format carries the same information as the JSON produced by gvametaconvert (frame resolution, timestamp,
+ * source, tags, objects with detection, tracking id and classification results, raw tensors including keypoints) but
+ * stores numbers in binary form and tensor data as raw bytes. Header is self-contained and has no GStreamer dependency,
+ * so it may be used by consumers of published metadata (MQTT/Kafka subscribers, files) as a reader library.
+ *
+ * Stream of records, each record describes one frame. All multi-byte values are little-endian.
+ * @code
+ *   Record         := magic "DLSM" | version:u8 | flags:u8 (reserved, 0) | reserved:u16 | size:u32 | Frame (size bytes)
+ *   Frame          := fields:u8 | [timestamp:uvar] | [width:uvar height:uvar] | [source:str] | [tags:str]
+ *                     | count:uvar Object* | count:uvar Tensor*
+ *   Object         := fields:u8 | x:svar y:svar w:svar h:svar | region_id:svar | [parent_id:svar] | [object_id:svar]
+ *                     | [label:str] | [Detection] | count:uvar Classification* | count:uvar Tensor*
+ *   Detection      := fields:u8 | x_min:f32 x_max:f32 y_min:f32 y_max:f32 | [confidence:f32] | [label_id:svar]
+ *   Classification := fields:u8 | attribute:str | label:str | [model:str] | [confidence:f32] | [label_id:svar]
+ *   Tensor         := fields:u8 | name:str | [model:str] | [layer:str] | [format:str] | [label:str] | [confidence:f32]
+ *                     | [label_id:svar] | [encoding:str] | precision:u8 | layout:u8 | count:uvar dims:uvar*
+ *                     | data:bytes
+ *
+ *   uvar  - unsigned LEB128 varint, svar - zigzag encoded signed LEB128 varint, f32 - IEEE 754 single precision,
+ *   str   - uvar length followed by UTF-8 bytes, bytes - uvar length followed by raw bytes,
+ *   [...] - present only if corresponding bit is set in 'fields' of enclosing structure.
+ * @endcode
+ * Version is increased on any incompatible layout change; 'size' allows to skip records without parsing them.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace dlstreamer {
+namespace binary_meta {
+
+constexpr char MAGIC[4] = {'D', 'L', 'S', 'M'};
+constexpr uint8_t VERSION = 1;
+constexpr size_t RECORD_HEADER_SIZE = 12;
+
+enum FrameFields : uint8_t {
+    FRAME_HAS_TIMESTAMP = 1 << 0,
+    FRAME_HAS_RESOLUTION = 1 << 1,
+    FRAME_HAS_SOURCE = 1 << 2,
+    FRAME_HAS_TAGS = 1 << 3,
+};
+
+enum ObjectFields : uint8_t {
+    OBJECT_HAS_PARENT_ID = 1 << 0,
+    OBJECT_HAS_OBJECT_ID = 1 << 1,
+    OBJECT_HAS_LABEL = 1 << 2,
+    OBJECT_HAS_DETECTION = 1 << 3,
+};
+
+enum ResultFields : uint8_t {
+    RESULT_HAS_CONFIDENCE = 1 << 0,
+    RESULT_HAS_LABEL_ID = 1 << 1,
+    RESULT_HAS_MODEL = 1 << 2,
+    RESULT_HAS_LAYER = 1 << 3,
+    RESULT_HAS_FORMAT = 1 << 4,
+    RESULT_HAS_LABEL = 1 << 5,
+    RESULT_HAS_ENCODING = 1 << 6,
+};
+
+struct Detection {
+    float x_min = 0, x_max = 0, y_min = 0, y_max = 0;
+    std::optional<float> confidence;
+    std::optional<int32_t> label_id;
+};
+
+struct Classification {
+    std::string attribute;
+    std::string label;
+    std::optional<std::string> model;
+    std::optional<float> confidence;
+    std::optional<int32_t> label_id;
+};
+
+struct Tensor {
+    std::string name;
+    std::optional<std::string> model;
+    std::optional<std::string> layer;
+    std::optional<std::string> format;
+    std::optional<std::string> label;
+    std::optional<float> confidence;
+    std::optional<int32_t> label_id;
+    std::optional<std::string> encoding; // compact mask encoding ("bitmask" or "rle") of data, see mask_codec.h
+    uint8_t precision = 0;               // GVAPrecision value
+    uint8_t layout = 0;    // GVALayout value
+    std::vector<uint32_t> dims;
+    // Raw tensor data. When produced by Reader points into the parsed record buffer (no copy), so it is valid only
+    // while that buffer is alive.
+    const uint8_t *data = nullptr;
+    size_t data_size = 0;
+};
+
+struct Object {
+    int32_t x = 0, y = 0, w = 0, h = 0;
+    int32_t region_id = 0;
+    std::optional<int32_t> parent_id;
+    std::optional<int32_t> object_id;
+    std::optional<std::string> label;
+    std::optional<Detection> detection;
+    std::vector<Classification> classifications;
+    std::vector<Tensor> tensors;
+};
+
+struct Frame {
+    std::optional<uint64_t> timestamp;
+    std::optional<uint32_t> width;
+    std::optional<uint32_t> height;
+    std::optional<std::string> source;
+    std::optional<std::string> tags; // JSON text as supplied to gvametaconvert
+    std::vector<Object> objects;
+    std::vector<Tensor> tensors;
+};
+
+/**
+ * @brief Appends encoded values to byte vector. Record is started by begin_record() and completed by end_record(),
+ * which patches payload size into the header, so frames are serialized in a single pass without intermediate objects.
+ */
+class Writer {
+  public:
+    explicit Writer(std::vector<uint8_t> &out) : _out(out) {
+    }
+
+    void begin_record() {
+        _record_start = _out.size();
+        bytes(MAGIC, sizeof(MAGIC));
+        u8(VERSION);
+        u8(0);
+        u8(0);
+        u8(0);
+        u32(0); // payload size, patched in end_record()
+    }
+
+    void end_record() {
+        size_t payload = _out.size() - _record_start - RECORD_HEADER_SIZE;
+        if (payload > UINT32_MAX)
+            throw std::length_error("Binary metadata record exceeds 4 GiB");
+        for (int i = 0; i < 4; ++i)
+            _out[_record_start + 8 + i] = static_cast<uint8_t>(payload >> (8 * i));
+    }
+
+    void u8(uint8_t v) {
+        _out.push_back(v);
+    }
+
+    void u32(uint32_t v) {
+        for (int i = 0; i < 4; ++i)
+            _out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+
+    void uvar(uint64_t v) {
+        while (v >= 0x80) {
+            _out.push_back(static_cast<uint8_t>(v) | 0x80);
+            v >>= 7;
+        }
+        _out.push_back(static_cast<uint8_t>(v));
+    }
+
+    void svar(int64_t v) {
+        uvar((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+    }
+
+    void f32(float v) {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        u32(bits);
+    }
+
+    void str(const char *s, size_t size) {
+        uvar(size);
+        bytes(s, size);
+    }
+
+    void str(const std::string &s) {
+        str(s.data(), s.size());
+    }
+
+    void blob(const void *data, size_t size) {
+        uvar(size);
+        bytes(data, size);
+    }
+
+  private:
+    void bytes(const void *data, size_t size) {
+        if (!size)
+            return;
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        _out.insert(_out.end(), p, p + size);
+    }
+
+    std::vector<uint8_t> &_out;
+    size_t _record_start = 0;
+};
+
+/**
+ * @brief Decodes records from memory. Strings are copied, tensor data is referenced in place.
+ */
+class Reader {
+  public:
+    /**
+     * @brief Parses one record at the beginning of [data, data + size)
+     * @return number of bytes consumed, 0 if buffer doesn't contain complete record yet
+     * @throw std::runtime_error if data is not a valid record
+     */
+    static size_t read_record(const uint8_t *data, size_t size, Frame &frame) {
+        if (size < RECORD_HEADER_SIZE)
+            return 0;
+        if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+            throw std::runtime_error("Binary metadata: bad record magic");
+        if (data[4] != VERSION)
+            throw std::runtime_error("Binary metadata: unsupported version " + std::to_string(data[4]));
+        uint32_t payload = 0;
+        for (int i = 0; i < 4; ++i)
+            payload |= static_cast<uint32_t>(data[8 + i]) << (8 * i);
+        if (size - RECORD_HEADER_SIZE < payload)
+            return 0;
+
+        Reader reader(data + RECORD_HEADER_SIZE, payload);
+        frame = reader.frame();
+        if (reader._pos != reader._size)
+            throw std::runtime_error("Binary metadata: trailing bytes in record");
+        return RECORD_HEADER_SIZE + payload;
+    }
+
+  private:
+    Reader(const uint8_t *data, size_t size) : _data(data), _size(size) {
+    }
+
+    void require(size_t n) const {
+        if (_size - _pos < n)
+            throw std::runtime_error("Binary metadata: truncated record");
+    }
+
+    uint8_t u8() {
+        require(1);
+        return _data[_pos++];
+    }
+
+    uint32_t u32() {
+        require(4);
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i)
+            v |= static_cast<uint32_t>(_data[_pos + i]) << (8 * i);
+        _pos += 4;
+        return v;
+    }
+
+    uint64_t uvar() {
+        uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = u8();
+            v |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80))
+                return v;
+        }
+        throw std::runtime_error("Binary metadata: malformed varint");
+    }
+
+    int32_t svar() {
+        uint64_t v = uvar();
+        return static_cast<int32_t>(static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1));
+    }
+
+    float f32() {
+        uint32_t bits = u32();
+        float v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    size_t length() {
+        uint64_t n = uvar();
+        require(n);
+        return static_cast<size_t>(n);
+    }
+
+    std::string str() {
+        size_t n = length();
+        std::string s(reinterpret_cast<const char *>(_data + _pos), n);
+        _pos += n;
+        return s;
+    }
+
+    size_t count() {
+        // Every element takes at least one byte, so count can't exceed remaining size
+        uint64_t n = uvar();
+        require(n);
+        return static_cast<size_t>(n);
+    }
+
+    Detection detection() {
+        Detection d;
+        uint8_t fields = u8();
+        d.x_min = f32();
+        d.x_max = f32();
+        d.y_min = f32();
+        d.y_max = f32();
+        if (fields & RESULT_HAS_CONFIDENCE)
+            d.confidence = f32();
+        if (fields & RESULT_HAS_LABEL_ID)
+            d.label_id = svar();
+        return d;
+    }
+
+    Classification classification() {
+        Classification c;
+        uint8_t fields = u8();
+        c.attribute = str();
+        c.label = str();
+        if (fields & RESULT_HAS_MODEL)
+            c.model = str();
+        if (fields & RESULT_HAS_CONFIDENCE)
+            c.confidence = f32();
+        if (fields & RESULT_HAS_LABEL_ID)
+            c.label_id = svar();
+        return c;
+    }
+
+    Tensor tensor() {
+        Tensor t;
+        uint8_t fields = u8();
+        t.name = str();
+        if (fields & RESULT_HAS_MODEL)
+            t.model = str();
+        if (fields & RESULT_HAS_LAYER)
+            t.layer = str();
+        if (fields & RESULT_HAS_FORMAT)
+            t.format = str();
+        if (fields & RESULT_HAS_LABEL)
+            t.label = str();
+        if (fields & RESULT_HAS_CONFIDENCE)
+            t.confidence = f32();
+        if (fields & RESULT_HAS_LABEL_ID)
+            t.label_id = svar();
+        if (fields & RESULT_HAS_ENCODING)
+            t.encoding = str();
+        t.precision = u8();
+        t.layout = u8();
+        size_t ndims = count();
+        t.dims.reserve(ndims);
+        for (size_t i = 0; i < ndims; ++i)
+            t.dims.push_back(static_cast<uint32_t>(uvar()));
+        t.data_size = length();
+        t.data = _data + _pos;
+        _pos += t.data_size;
+        return t;
+    }
+
+    std::vector<Tensor> tensors() {
+        std::vector<Tensor> res(count());
+        for (auto &t : res)
+            t = tensor();
+        return res;
+    }
+
+    Object object() {
+        Object o;
+        uint8_t fields = u8();
+        o.x = svar();
+        o.y = svar();
+        o.w = svar();
+        o.h = svar();
+        o.region_id = svar();
+        if (fields & OBJECT_HAS_PARENT_ID)
+            o.parent_id = svar();
+        if (fields & OBJECT_HAS_OBJECT_ID)
+            o.object_id = svar();
+        if (fields & OBJECT_HAS_LABEL)
+            o.label = str();
+        if (fields & OBJECT_HAS_DETECTION)
+            o.detection = detection();
+        o.classifications.resize(count());
+        for (auto &c : o.classifications)
+            c = classification();
+        o.tensors = tensors();
+        return o;
+    }
+
+    Frame frame() {
+        Frame f;
+        uint8_t fields = u8();
+        if (fields & FRAME_HAS_TIMESTAMP)
+            f.timestamp = uvar();
+        if (fields & FRAME_HAS_RESOLUTION) {
+            f.width = static_cast<uint32_t>(uvar());
+            f.height = static_cast<uint32_t>(uvar());
+        }
+        if (fields & FRAME_HAS_SOURCE)
+            f.source = str();
+        if (fields & FRAME_HAS_TAGS)
+            f.tags = str();
+        f.objects.resize(count());
+        for (auto &o : f.objects)
+            o = object();
+        f.tensors = tensors();
+        return f;
+    }
+
+    const uint8_t *_data;
+    size_t _size;
+    size_t _pos = 0;
+};
+
+} // namespace binary_meta
+} // namespace dlstreamer
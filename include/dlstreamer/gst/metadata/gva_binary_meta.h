@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file gva_binary_meta.h
+ * @brief This file contains helper functions to control _GstGVABinaryMeta instances
+ */
+
+#ifndef __GVA_BINARY_META_H__
+#define __GVA_BINARY_META_H__
+
+#include <gst/gst.h>
+
+#define GVA_BINARY_META_API_NAME "GstGVABinaryMetaAPI"
+#define GVA_BINARY_META_IMPL_NAME "GstGVABinaryMeta"
+
+#if _MSC_VER
+#define DLS_EXPORT __declspec(dllexport)
+#else
+#define DLS_EXPORT __attribute__((visibility("default")))
+#endif
+
+G_BEGIN_DECLS
+
+typedef struct _GstGVABinaryMeta GstGVABinaryMeta;
+
+/**
+ * @brief This struct represents binary serialized metadata (see gva_binary_format.h) and contains instance of parent
+ * GstMeta and message bytes
+ */
+struct _GstGVABinaryMeta {
+    GstMeta meta;    /**< parent GstMeta */
+    GBytes *message; /**< serialized record(s) */
+};
+
+/**
+ * @brief This function registers, if needed, and returns GstMetaInfo for _GstGVABinaryMeta
+ * @return const GstMetaInfo* for registered type
+ */
+DLS_EXPORT const GstMetaInfo *gst_gva_binary_meta_get_info(void);
+
+/**
+ * @brief This function registers, if needed, and returns a GType for api "GstGVABinaryMetaAPI"
+ * @return GType type
+ */
+DLS_EXPORT GType gst_gva_binary_meta_api_get_type(void);
+
+/**
+ * @def GST_GVA_BINARY_META_INFO
+ * @brief This macro calls gst_gva_binary_meta_get_info
+ * @return const GstMetaInfo* for registered type
+ */
+#define GST_GVA_BINARY_META_INFO (gst_gva_binary_meta_get_info())
+
+/**
+ * @def GST_GVA_BINARY_META_GET
+ * @brief This macro retrieves ptr to _GstGVABinaryMeta instance for passed buf
+ * @param buf GstBuffer* of which metadata is retrieved
+ * @return _GstGVABinaryMeta* instance attached to buf
+ */
+#define GST_GVA_BINARY_META_GET(buf) ((GstGVABinaryMeta *)gst_buffer_get_meta(buf, gst_gva_binary_meta_api_get_type()))
+
+/**
+ * @def GST_GVA_BINARY_META_ADD
+ * @brief This macro attaches new _GstGVABinaryMeta instance to passed buf
+ * @param buf GstBuffer* to which metadata will be attached
+ * @return _GstGVABinaryMeta* of the newly added instance attached to buf
+ */
+#define GST_GVA_BINARY_META_ADD(buf)                                                                                   \
+    ((GstGVABinaryMeta *)gst_buffer_add_meta(buf, gst_gva_binary_meta_get_info(), NULL))
+
+/**
+ * @brief This function sets message field of _GstGVABinaryMeta, taking additional reference to message
+ * @param meta _GstGVABinaryMeta* to set message
+ * @param message GBytes with serialized metadata
+ * @return void
+ */
+DLS_EXPORT void gst_gva_binary_meta_set_message(GstGVABinaryMeta *meta, GBytes *message);
+
+G_END_DECLS
+
+#endif /* __GVA_BINARY_META_H__ */
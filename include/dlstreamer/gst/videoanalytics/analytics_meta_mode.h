@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file analytics_meta_mode.h
+ * @brief This file contains switch between storing regions in both GstVideoRegionOfInterestMeta and
+ * GstAnalyticsRelationMeta and storing them in GstAnalyticsRelationMeta only
+ */
+
+#pragma once
+
+#include <gst/gst.h>
+
+/**
+ * @brief Environment variable setting default analytics-meta-only mode of the process, "1" or "true"
+ */
+#define GVA_ANALYTICS_META_ONLY_ENV "GVA_ANALYTICS_META_ONLY"
+
+/**
+ * @brief Type of GstContext selecting analytics-meta-only mode for a pipeline. Context set on pipeline with
+ * gst_element_set_context() is propagated by GstBin to all elements of the pipeline, including ones added later
+ */
+#define GVA_ANALYTICS_META_CONTEXT_TYPE "gva.analytics-meta"
+
+/**
+ * @brief Boolean field of GVA_ANALYTICS_META_CONTEXT_TYPE context, TRUE to store regions in analytics metadata only
+ */
+#define GVA_ANALYTICS_META_CONTEXT_ONLY_FIELD "only"
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Default mode of the process, used by elements without GVA_ANALYTICS_META_CONTEXT_TYPE context
+ * @return TRUE if GVA_ANALYTICS_META_ONLY environment variable is set to "1" or "true"
+ */
+static inline gboolean gva_analytics_meta_only_default(void) {
+    const gchar *value = g_getenv(GVA_ANALYTICS_META_ONLY_ENV);
+    return value && (g_strcmp0(value, "1") == 0 || g_ascii_strcasecmp(value, "true") == 0);
+}
+
+/**
+ * @brief Create context selecting analytics-meta-only mode, to be set on pipeline
+ * @param only TRUE to store regions in GstAnalyticsRelationMeta only
+ * @return new GstContext, unref with gst_context_unref() after setting
+ */
+static inline GstContext *gva_analytics_meta_context_new(gboolean only) {
+    GstContext *context = gst_context_new(GVA_ANALYTICS_META_CONTEXT_TYPE, TRUE);
+    GstStructure *structure = gst_context_writable_structure(context);
+    gst_structure_set(structure, GVA_ANALYTICS_META_CONTEXT_ONLY_FIELD, G_TYPE_BOOLEAN, only, NULL);
+    return context;
+}
+
+/**
+ * @brief Mode of element: taken from GVA_ANALYTICS_META_CONTEXT_TYPE context set on element (usually propagated from
+ * pipeline), process default otherwise. Elements query it once on start rather than per buffer
+ * @param element element to check, NULL for process default
+ * @return TRUE if regions are stored in GstAnalyticsRelationMeta only
+ */
+static inline gboolean gva_analytics_meta_only(GstElement *element) {
+    GstContext *context = element ? gst_element_get_context(element, GVA_ANALYTICS_META_CONTEXT_TYPE) : NULL;
+    if (!context)
+        return gva_analytics_meta_only_default();
+
+    gboolean only = FALSE;
+    gst_structure_get_boolean(gst_context_get_structure(context), GVA_ANALYTICS_META_CONTEXT_ONLY_FIELD, &only);
+    gst_context_unref(context);
+    return only;
+}
+
+G_END_DECLS
+
+#ifdef __cplusplus
+
+namespace GVA {
+
+/**
+ * @brief Environment variable setting default analytics-meta-only mode of the process, "1" or "true"
+ */
+constexpr const char *ANALYTICS_META_ONLY_ENV = GVA_ANALYTICS_META_ONLY_ENV;
+
+/**
+ * @brief Check if regions are stored in GstAnalyticsRelationMeta only by default. In this mode elements adding regions
+ * don't attach GstVideoRegionOfInterestMeta, region params (tensors) are stored as GstAnalyticsParamMtd related to
+ * GstAnalyticsODMtd of region. Readers work in both modes: params of region are taken from its
+ * GstVideoRegionOfInterestMeta if it is attached, from GstAnalyticsParamMtd otherwise. Elements follow mode of their
+ * pipeline, see analytics_meta_only(GstElement *)
+ * @return true if GVA_ANALYTICS_META_ONLY environment variable is set to "1" or "true"
+ */
+inline bool analytics_meta_only() {
+    static const bool enabled = gva_analytics_meta_only_default();
+    return enabled;
+}
+
+/**
+ * @brief Check if element stores regions in GstAnalyticsRelationMeta only, see gva_analytics_meta_only()
+ * @param element element to check
+ * @return true if mode is selected by context of element's pipeline, or by process default without context
+ */
+inline bool analytics_meta_only(GstElement *element) {
+    return gva_analytics_meta_only(element);
+}
+
+} // namespace GVA
+
+#endif
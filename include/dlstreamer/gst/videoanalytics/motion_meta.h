@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @file motion_meta.h
+ * @brief This file contains marker of frames analyzed by motion detection, to distinguish frames without motion from
+ * frames motion detection didn't run on
+ */
+
+#pragma once
+
+#include <gst/gst.h>
+
+/**
+ * @brief Name of GstCustomMeta attached by gvamotiondetect to every frame it analyzed, with or without motion. Motion
+ * regions themselves are GstAnalyticsODMtd of "motion" type
+ */
+#define GVA_MOTION_META_NAME "GvaMotionMeta"
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Register GVA_MOTION_META_NAME custom meta, called by element attaching it. Readers don't need registration
+ */
+static inline void gva_motion_meta_register(void) {
+    static const gchar *tags[] = {NULL};
+    if (!gst_meta_get_info(GVA_MOTION_META_NAME))
+        gst_meta_register_custom(GVA_MOTION_META_NAME, tags, NULL, NULL, NULL);
+}
+
+/**
+ * @brief Mark buffer as analyzed by motion detection
+ * @param buffer writable buffer
+ */
+static inline void gva_buffer_add_motion_meta(GstBuffer *buffer) {
+    if (!gst_buffer_get_custom_meta(buffer, GVA_MOTION_META_NAME))
+        gst_buffer_add_custom_meta(buffer, GVA_MOTION_META_NAME);
+}
+
+/**
+ * @brief Check if buffer was analyzed by motion detection
+ * @param buffer buffer to check
+ * @return TRUE if motion detection ran on the frame, its motion regions (if any) are attached
+ */
+static inline gboolean gva_buffer_has_motion_meta(GstBuffer *buffer) {
+    return gst_buffer_get_custom_meta(buffer, GVA_MOTION_META_NAME) != NULL;
+}
+
+G_END_DECLS
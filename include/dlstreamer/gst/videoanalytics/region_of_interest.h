@@ -13,6 +13,7 @@
 #pragma once
 
 #include "../metadata/gstanalyticskeypointsmtd.h"
+#include "../metadata/gstanalyticsparammtd.h"
 #include "tensor.h"
 
 #include <cstdint>
@@ -152,7 +153,10 @@ class RegionOfInterest {
         if (!s) {
             throw std::invalid_argument("GVA::RegionOfInterest::add_tensor: tensor structure is nullptr");
         }
-        gst_video_region_of_interest_meta_add_param(_gst_meta, s);
+        if (_gst_meta)
+            gst_video_region_of_interest_meta_add_param(_gst_meta, s);
+        else
+            add_param_mtd(s);
 
         GstAnalyticsMtd tensor_mtd;
         if (tensor.convert_to_meta(&tensor_mtd, &_od_meta, _od_meta.meta)) {
@@ -218,32 +222,32 @@ class RegionOfInterest {
     /**
      * @brief Construct RegionOfInterest from analytics metadata and video metadata
      * @param od_meta Object detection analytics metadata
-     * @param meta Video region of interest metadata containing additional parameters
+     * @param meta Video region of interest metadata containing additional parameters, nullptr if region is stored in
+     * analytics metadata only and its parameters are GstAnalyticsParamMtd related to od_meta
      */
     RegionOfInterest(GstAnalyticsODMtd od_meta, GstVideoRegionOfInterestMeta *meta)
         : _gst_meta(meta), _detection(nullptr), _od_meta(od_meta) {
 
-        if (not _gst_meta)
+        if (not _gst_meta and not _od_meta.meta)
             throw std::invalid_argument("GVA::RegionOfInterest: meta is nullptr");
 
-        _tensors.reserve(g_list_length(meta->params));
-
-        for (GList *l = meta->params; l; l = g_list_next(l)) {
-            GstStructure *s = GST_STRUCTURE(l->data);
-            const char *type = gst_structure_get_string(s, "type");
-            if (not gst_structure_has_name(s, "object_id") && not gst_structure_has_name(s, "keypoints") &&
-                (type == nullptr || strcmp(type, "classification_result") != 0)) {
-                _tensors.emplace_back(s);
-                if (_tensors.back().is_detection())
-                    _detection = &_tensors.back();
-            }
+        if (_gst_meta) {
+            _tensors.reserve(g_list_length(meta->params));
+            for (GList *l = meta->params; l; l = g_list_next(l))
+                add_param_tensor(GST_STRUCTURE(l->data));
         }
 
-        // append tensors converted from metadata
+        // append tensors converted from metadata, and params if there is no video region of interest metadata
+        const GstAnalyticsMtdType param_type = gst_analytics_param_mtd_get_mtd_type();
         gpointer state = NULL;
         GstAnalyticsMtd handle;
         while (gst_analytics_relation_meta_get_direct_related(od_meta.meta, od_meta.id, GST_ANALYTICS_REL_TYPE_CONTAIN,
                                                               GST_ANALYTICS_MTD_TYPE_ANY, &state, &handle)) {
+            if (gst_analytics_mtd_get_mtd_type(&handle) == param_type) {
+                if (!_gst_meta)
+                    add_param_tensor(gst_analytics_param_mtd_get_params(&handle));
+                continue;
+            }
             GstStructure *s = GVA::Tensor::convert_to_tensor(handle);
             if (s != nullptr) {
                 auto shared_s = std::shared_ptr<GstStructure>(s, gst_structure_free);
@@ -251,6 +255,12 @@ class RegionOfInterest {
                 _converted_structures.push_back(shared_s);
             }
         }
+
+        // pointer is taken after all tensors are added as vector may reallocate
+        for (Tensor &tensor : _tensors) {
+            if (tensor.is_detection())
+                _detection = &tensor;
+        }
     }
 
     /**
@@ -316,10 +326,23 @@ class RegionOfInterest {
 
     /**
      * @brief Get list of parameters attached to this RegionOfInterest
-     * @return GList pointer to parameters
+     * @return GList pointer to parameters, owned by RegionOfInterest if region is stored in analytics metadata only
      */
     GList *get_params() const {
-        return _gst_meta->params;
+        if (_gst_meta)
+            return _gst_meta->params;
+
+        GList *params = nullptr;
+        gpointer state = nullptr;
+        GstAnalyticsParamMtd param_mtd;
+        while (gst_analytics_relation_meta_get_direct_related(_od_meta.meta, _od_meta.id,
+                                                              GST_ANALYTICS_REL_TYPE_CONTAIN,
+                                                              gst_analytics_param_mtd_get_mtd_type(), &state,
+                                                              &param_mtd)) {
+            params = g_list_prepend(params, gst_analytics_param_mtd_get_params(&param_mtd));
+        }
+        _params_list = std::shared_ptr<GList>(g_list_reverse(params), g_list_free);
+        return _params_list.get();
     }
 
     /**
@@ -328,7 +351,20 @@ class RegionOfInterest {
      * @return GstStructure pointer to the parameter, or nullptr if not found
      */
     GstStructure *get_param(const char *name) const {
-        return gst_video_region_of_interest_meta_get_param(_gst_meta, name);
+        if (_gst_meta)
+            return gst_video_region_of_interest_meta_get_param(_gst_meta, name);
+
+        gpointer state = nullptr;
+        GstAnalyticsParamMtd param_mtd;
+        while (gst_analytics_relation_meta_get_direct_related(_od_meta.meta, _od_meta.id,
+                                                              GST_ANALYTICS_REL_TYPE_CONTAIN,
+                                                              gst_analytics_param_mtd_get_mtd_type(), &state,
+                                                              &param_mtd)) {
+            GstStructure *params = gst_analytics_param_mtd_get_params(&param_mtd);
+            if (params && gst_structure_has_name(params, name))
+                return params;
+        }
+        return nullptr;
     }
 
     /**
@@ -336,7 +372,10 @@ class RegionOfInterest {
      * @param s GstStructure to add as parameter
      */
     void add_param(GstStructure *s) {
-        gst_video_region_of_interest_meta_add_param(_gst_meta, s);
+        if (_gst_meta)
+            gst_video_region_of_interest_meta_add_param(_gst_meta, s);
+        else
+            add_param_mtd(s);
 
         GVA::Tensor tensor(s);
         GstAnalyticsMtd tensor_mtd;
@@ -356,18 +395,45 @@ class RegionOfInterest {
 
     /**
      * @brief Internal function, don't use or use with caution.
-     * @return pointer to underlying GstVideoRegionOfInterestMeta
+     * @return pointer to underlying GstVideoRegionOfInterestMeta, nullptr if region is stored in analytics metadata
+     * only
      */
     GstVideoRegionOfInterestMeta *_meta() const {
-        assert(_gst_meta != nullptr);
         return _gst_meta;
     }
 
   protected:
+    void add_param_tensor(GstStructure *s) {
+        if (!s)
+            return;
+        const char *type = gst_structure_get_string(s, "type");
+        // these params duplicate analytics metadata and are read from it
+        if (not gst_structure_has_name(s, "object_id") && not gst_structure_has_name(s, "keypoints") &&
+            (type == nullptr || strcmp(type, "classification_result") != 0)) {
+            _tensors.emplace_back(s);
+        }
+    }
+
+    void add_param_mtd(GstStructure *s) {
+        GstAnalyticsParamMtd param_mtd;
+        if (!gst_analytics_relation_meta_add_param_mtd(_od_meta.meta, s, &param_mtd)) {
+            throw std::runtime_error("Failed to add param metadata");
+        }
+        if (!gst_analytics_relation_meta_set_relation(_od_meta.meta, GST_ANALYTICS_REL_TYPE_CONTAIN, _od_meta.id,
+                                                      param_mtd.id)) {
+            throw std::runtime_error("Failed to set relation between object detection metadata and param metadata");
+        }
+        if (!gst_analytics_relation_meta_set_relation(_od_meta.meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF, param_mtd.id,
+                                                      _od_meta.id)) {
+            throw std::runtime_error("Failed to set relation between param metadata and object detection metadata");
+        }
+    }
+
     /**
      * @brief GstVideoRegionOfInterestMeta containing fields filled with detection result (produced by gvadetect
      * element in Gstreamer pipeline) and all the additional tensors, describing detection and other inference
-     * results (produced by gvainference, gvadetect, gvaclassify in Gstreamer pipeline)
+     * results (produced by gvainference, gvadetect, gvaclassify in Gstreamer pipeline). nullptr if region is stored in
+     * analytics metadata only
      */
     GstVideoRegionOfInterestMeta *_gst_meta;
     /**
@@ -381,6 +447,11 @@ class RegionOfInterest {
      */
     std::vector<std::shared_ptr<GstStructure>> _converted_structures;
 
+    /**
+     * @brief list of parameters returned by get_params() if region is stored in analytics metadata only
+     */
+    mutable std::shared_ptr<GList> _params_list;
+
     /**
      * @brief last added detection Tensor instance, defined as Tensor with name set to "detection"
      */
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "analytics_meta_mode.h"
 #include "region_of_interest.h"
 
 #include "../metadata/gva_json_meta.h"
@@ -19,10 +20,12 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gst/analytics/analytics.h>
@@ -172,8 +175,7 @@ class VideoFrame {
         std::vector<std::string> json_messages;
         GstGVAJSONMeta *meta = NULL;
         gpointer state = NULL;
-        GType meta_api_type = g_type_from_name(GVA_JSON_META_API_NAME);
-        while ((meta = (GstGVAJSONMeta *)gst_buffer_iterate_meta_filtered(buffer, &state, meta_api_type))) {
+        while ((meta = (GstGVAJSONMeta *)gst_buffer_iterate_meta_filtered(buffer, &state, json_meta_api_type()))) {
             json_messages.emplace_back(meta->message);
         }
         return json_messages;
@@ -189,6 +191,7 @@ class VideoFrame {
      * @param confidence detection confidence
      * @param normalized if False, bounding box coordinates are pixel coordinates in range from 0 to image width/height.
     if True, bounding box coordinates normalized to [0,1] range.
+     * Region is stored in analytics metadata only if GVA_ANALYTICS_META_ONLY environment variable is set
      * @return new RegionOfInterest instance
      */
     RegionOfInterest add_region(double x, double y, double w, double h, std::string label = std::string(),
@@ -235,6 +238,12 @@ class VideoFrame {
             throw std::runtime_error("Failed to add detection data to meta");
         }
 
+        if (analytics_meta_only()) {
+            RegionOfInterest region(od_mtd, nullptr);
+            region.add_tensor(Tensor(detection));
+            return region;
+        }
+
         GstVideoRegionOfInterestMeta *meta = gst_buffer_add_video_region_of_interest_meta(
             buffer, label.c_str(), double_to_uint(_x), double_to_uint(_y), double_to_uint(_w), double_to_uint(_h));
         meta->id = od_mtd.id;
@@ -274,14 +283,19 @@ class VideoFrame {
     }
 
     /**
-     * @brief Remove RegionOfInterest
+     * @brief Remove RegionOfInterest. Regions stored in analytics metadata only can't be removed, as
+     * GstAnalyticsRelationMeta doesn't support removal
      * @param roi the RegionOfInterest to remove
      */
     void remove_region(const RegionOfInterest &roi) {
         if (!gst_buffer_is_writable(buffer))
             throw std::runtime_error("Buffer is not writable.");
 
-        if (!gst_buffer_remove_meta(buffer, (GstMeta *)roi._meta())) {
+        GstVideoRegionOfInterestMeta *meta = roi._meta();
+        if (!meta)
+            throw std::runtime_error("GVA::VideoFrame: RegionOfInterest stored in analytics metadata can't be removed");
+
+        if (!gst_buffer_remove_meta(buffer, (GstMeta *)meta)) {
             throw std::out_of_range("GVA::VideoFrame: RegionOfInterest doesn't belong to this frame");
         }
     }
@@ -293,8 +307,7 @@ class VideoFrame {
     void remove_tensor(const Tensor &tensor) {
         GstGVATensorMeta *meta = NULL;
         gpointer state = NULL;
-        GType meta_api_type = g_type_from_name("GstGVATensorMetaAPI");
-        while ((meta = (GstGVATensorMeta *)gst_buffer_iterate_meta_filtered(buffer, &state, meta_api_type))) {
+        while ((meta = (GstGVATensorMeta *)gst_buffer_iterate_meta_filtered(buffer, &state, tensor_meta_api_type()))) {
             if (meta->data == tensor._structure) {
                 if (!gst_buffer_is_writable(buffer))
                     throw std::runtime_error("Buffer is not writable.");
@@ -331,6 +344,51 @@ class VideoFrame {
         return (val < min) ? min : ((val > max) ? max : static_cast<int>(val));
     }
 
+    // API types are registered once per process and never change, name lookup is repeated only until registration
+    static GType tensor_meta_api_type() {
+        static std::atomic<GType> type{0};
+        if (!type)
+            type = g_type_from_name(GVA_TENSOR_META_API_NAME);
+        return type;
+    }
+
+    static GType json_meta_api_type() {
+        static std::atomic<GType> type{0};
+        if (!type)
+            type = g_type_from_name(GVA_JSON_META_API_NAME);
+        return type;
+    }
+
+    /**
+     * @brief GstVideoRegionOfInterestMeta of buffer by id, built in single pass over buffer metas so enumeration of N
+     * regions costs O(N) instead of scanning buffer metas for each region. Index is built for each enumeration and
+     * not kept between calls: metas can be removed from buffer bypassing remove_region(), and kept pointers would
+     * dangle
+     */
+    using RoiMetaIndex = std::unordered_map<gint, GstVideoRegionOfInterestMeta *>;
+
+    RoiMetaIndex build_roi_meta_index() const {
+        RoiMetaIndex index;
+        GstVideoRegionOfInterestMeta *meta = NULL;
+        gpointer state = NULL;
+        while ((meta = (GstVideoRegionOfInterestMeta *)gst_buffer_iterate_meta_filtered(
+                    buffer, &state, GST_VIDEO_REGION_OF_INTEREST_META_API_TYPE))) {
+            // same as gst_buffer_get_video_region_of_interest_meta_id(), first meta with given id wins
+            index.emplace(meta->id, meta);
+        }
+        return index;
+    }
+
+    // Region added in analytics-meta-only mode has params related to its object detection metadata. Checked when mode
+    // is selected for pipeline by context rather than for process
+    static bool has_param_mtd(GstAnalyticsODMtd &od_mtd) {
+        gpointer state = NULL;
+        GstAnalyticsMtd param_mtd;
+        return gst_analytics_relation_meta_get_direct_related(od_mtd.meta, od_mtd.id, GST_ANALYTICS_REL_TYPE_CONTAIN,
+                                                              gst_analytics_param_mtd_get_mtd_type(), &state,
+                                                              &param_mtd);
+    }
+
     std::vector<RegionOfInterest> get_regions() const {
         GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
 
@@ -338,25 +396,19 @@ class VideoFrame {
             return {};
         }
 
-        // Count regions to pre-allocate vector capacity
-        gpointer state = NULL;
-        GstAnalyticsODMtd od_mtd;
-        size_t count = 0;
-        while (
-            gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
-            ++count;
-        }
+        const RoiMetaIndex roi_meta_index = build_roi_meta_index();
 
-        // Pre-allocate vector to avoid reallocation during emplace_back
         std::vector<RegionOfInterest> regions;
-        regions.reserve(count);
-
-        // Construct RegionOfInterest objects
-        state = NULL;
-        while (
-            gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
-            GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_get_video_region_of_interest_meta_id(buffer, od_mtd.id);
-            if (!roi_meta) {
+        regions.reserve(roi_meta_index.size());
+
+        gpointer state = NULL;
+        GstAnalyticsODMtd od_mtd;
+        const GstAnalyticsMtdType od_mtd_type = gst_analytics_od_mtd_get_mtd_type();
+        while (gst_analytics_relation_meta_iterate(relation_meta, &state, od_mtd_type, &od_mtd)) {
+            auto indexed = roi_meta_index.find(od_mtd.id);
+            GstVideoRegionOfInterestMeta *roi_meta = indexed != roi_meta_index.end() ? indexed->second : nullptr;
+            // region without video region of interest meta keeps its params in analytics meta
+            if (!roi_meta && !analytics_meta_only() && !has_param_mtd(od_mtd)) {
                 throw std::runtime_error(
                     "GVA::VideoFrame: Failed to get video region of interest meta for object detection metadata");
             }
@@ -371,8 +423,7 @@ class VideoFrame {
         std::vector<Tensor> tensors;
         GstGVATensorMeta *meta = NULL;
         gpointer state = NULL;
-        GType meta_api_type = g_type_from_name("GstGVATensorMetaAPI");
-        while ((meta = (GstGVATensorMeta *)gst_buffer_iterate_meta_filtered(buffer, &state, meta_api_type)))
+        while ((meta = (GstGVATensorMeta *)gst_buffer_iterate_meta_filtered(buffer, &state, tensor_meta_api_type())))
             tensors.emplace_back(meta->data);
         return tensors;
     }
@@ -311,6 +311,7 @@ class SourceIdentifierMetadata : public DictionaryProxy {
         static constexpr auto stream_id = "stream_id";     // intptr_t
         static constexpr auto roi_id = "roi_id";           // int
         static constexpr auto object_id = "object_id";     // int
+        static constexpr auto last_roi = "last_roi";       // bool, last ROI of frame split into several batches
     };
     using DictionaryProxy::DictionaryProxy;
 
@@ -11,7 +11,9 @@
 #include <dlstreamer/context.h>
 #include <dlstreamer/utils.h>
 #include <list>
+#include <mutex>
 #include <numeric>
+#include <unordered_map>
 
 namespace dlstreamer {
 
@@ -50,47 +52,129 @@ class MemoryMapperChain final : public MemoryMapper {
     std::vector<MemoryMapperPtr> _chain;
 };
 
+namespace detail {
+
+// Least-recently-used map from source handle to mapped object. Entry matches only if source size is same, as handle
+// (pointer, fd, surface id) may be re-used by another allocation after source was freed.
+template <typename T>
+class MapperLruCache {
+  public:
+    explicit MapperLruCache(size_t capacity) : _capacity(std::max<size_t>(capacity, 1)) {
+    }
+
+    T get(Tensor::handle_t handle, size_t size, MemoryMapperCacheStats &stats) {
+        auto it = _index.find(handle);
+        if (it == _index.end() || it->second->size != size) {
+            stats.misses++;
+            return nullptr;
+        }
+        _entries.splice(_entries.begin(), _entries, it->second);
+        stats.hits++;
+        return it->second->value;
+    }
+
+    void put(Tensor::handle_t handle, size_t size, T value, MemoryMapperCacheStats &stats) {
+        auto it = _index.find(handle);
+        if (it != _index.end()) {
+            _entries.erase(it->second);
+            _index.erase(it);
+        }
+        _entries.push_front({handle, size, std::move(value)});
+        _index[handle] = _entries.begin();
+        shrink(stats);
+    }
+
+    void set_capacity(size_t capacity, MemoryMapperCacheStats &stats) {
+        _capacity = std::max<size_t>(capacity, 1);
+        shrink(stats);
+    }
+
+    void clear() {
+        _entries.clear();
+        _index.clear();
+    }
+
+    size_t size() const {
+        return _entries.size();
+    }
+
+  private:
+    struct Entry {
+        Tensor::handle_t handle;
+        size_t size;
+        T value;
+    };
+
+    void shrink(MemoryMapperCacheStats &stats) {
+        while (_entries.size() > _capacity) {
+            _index.erase(_entries.back().handle);
+            _entries.pop_back();
+            stats.evictions++;
+        }
+    }
+
+    size_t _capacity;
+    std::list<Entry> _entries; // most recently used first
+    std::unordered_map<Tensor::handle_t, typename std::list<Entry>::iterator> _index;
+};
+
+} // namespace detail
+
+/**
+ * @brief Memory mapper caching objects returned by wrapped mapper, keyed by handle of source tensor (first tensor for
+ * frames). Number of cached tensors and frames is bounded by capacity, typically size of pool the source objects are
+ * allocated from, and least recently used entries are evicted first. Safe to use from multiple threads.
+ */
 class MemoryMapperCache final : public MemoryMapper {
   public:
-    MemoryMapperCache(MemoryMapperPtr mapper) : _mapper(mapper) {
+    static constexpr size_t DEFAULT_CAPACITY = 32;
+
+    MemoryMapperCache(MemoryMapperPtr mapper, size_t capacity = DEFAULT_CAPACITY)
+        : _mapper(mapper), _tensors_cache(capacity), _frames_cache(capacity) {
         DLS_CHECK(mapper);
     }
 
     TensorPtr map(TensorPtr src, dlstreamer::AccessMode mode) override {
         auto handle = src->handle();
-        auto value = _tensors_cache.find(handle);
-        // std::string mem1 = memory_type_to_string(_mapper->input_context()->memory_type());
-        // std::string mem2 = memory_type_to_string(_mapper->output_context()->memory_type());
-        if (value != _tensors_cache.end()) {
-            // printf("- using cache %s->%s, %p->%p\n", mem1.data(), mem2.data(), (void*)handle, value->second.get());
-            return value->second;
-        } else {
-            auto dst = _mapper->map(src, mode);
-            // printf("- new map %s->%s, %p->%p\n", mem1.data(), mem2.data(), (void*)handle, dst.get());
-            auto dst_casted = std::dynamic_pointer_cast<BaseTensor>(dst);
-            if (dst_casted)
-                dst_casted->set_parent(nullptr);
-            _tensors_cache[handle] = dst;
-            return dst;
+        auto size = src->info().nbytes();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (auto value = _tensors_cache.get(handle, size, _stats))
+                return value;
         }
+
+        // Map without holding the lock, concurrent misses on same handle keep the latest result
+        auto dst = _mapper->map(src, mode);
+        auto dst_casted = std::dynamic_pointer_cast<BaseTensor>(dst);
+        if (dst_casted)
+            dst_casted->set_parent(nullptr);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tensors_cache.put(handle, size, dst, _stats);
+        return dst;
     }
 
     FramePtr map(FramePtr src, dlstreamer::AccessMode mode) override {
-        auto tensor0 = src->tensor(0);
-        auto handle = tensor0->handle();
-        auto value = _frames_cache.find(handle);
-        if (value != _frames_cache.end()) {
-            value->second->metadata().clear(); // remove all metadata
-            // printf("Re-using frame %s\n", memory_type_to_string(value->second->memory_type()));
-            return value->second;
-        } else {
-            auto dst = _mapper->map(src, mode);
-            auto dst_casted = std::dynamic_pointer_cast<BaseFrame>(dst);
-            if (dst_casted)
-                dst_casted->set_parent(nullptr);
-            _frames_cache[handle] = dst;
-            return dst;
+        auto handle = src->tensor(0)->handle();
+        size_t size = 0;
+        for (auto &tensor : src)
+            size += tensor->info().nbytes();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (auto value = _frames_cache.get(handle, size, _stats)) {
+                value->metadata().clear(); // remove all metadata
+                return value;
+            }
         }
+
+        auto dst = _mapper->map(src, mode);
+        auto dst_casted = std::dynamic_pointer_cast<BaseFrame>(dst);
+        if (dst_casted)
+            dst_casted->set_parent(nullptr);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _frames_cache.put(handle, size, dst, _stats);
+        return dst;
     }
 
     ContextPtr input_context() const override {
@@ -101,10 +185,31 @@ class MemoryMapperCache final : public MemoryMapper {
         return _mapper->output_context();
     }
 
+    // Limits number of cached tensors and frames, for example when size of source pool becomes known
+    void set_capacity(size_t capacity) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tensors_cache.set_capacity(capacity, _stats);
+        _frames_cache.set_capacity(capacity, _stats);
+    }
+
+    // Drops all cached objects, must be called when source pool or memory layout changes
+    void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tensors_cache.clear();
+        _frames_cache.clear();
+    }
+
+    MemoryMapperCacheStats stats() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stats;
+    }
+
   private:
     MemoryMapperPtr _mapper;
-    std::map<Tensor::handle_t, TensorPtr> _tensors_cache;
-    std::map<Tensor::handle_t, FramePtr> _frames_cache;
+    mutable std::mutex _mutex;
+    detail::MapperLruCache<TensorPtr> _tensors_cache;
+    detail::MapperLruCache<FramePtr> _frames_cache;
+    MemoryMapperCacheStats _stats;
 };
 
 /**
@@ -112,9 +217,9 @@ class MemoryMapperCache final : public MemoryMapper {
  * with input context equal to first element in specified vector and output context equal to last element in specified
  * vector of context objects.
  * @param context_chain Vector of context objects defining mapping sequence
- * @param use_cache If true, the returned mapper cashes internally all mapped TensorPtr and FramePtr objects to avoid
- * mapping operation on same TensorPtr/FramePtr multiple times. This optimization is useful for case mapper works on
- * pool of limited number TensorPtr/FramePtr objects.
+ * @param use_cache If true, the returned mapper caches internally recently mapped TensorPtr and FramePtr objects (up to
+ * MemoryMapperCache::DEFAULT_CAPACITY) to avoid mapping operation on same TensorPtr/FramePtr multiple times. This
+ * optimization is useful for case mapper works on pool of limited number TensorPtr/FramePtr objects.
  */
 static inline MemoryMapperPtr create_mapper(std::vector<ContextPtr> context_chain, bool use_cache = false) {
     DLS_CHECK(context_chain.size() >= 2)
@@ -155,6 +155,62 @@ class Tensor:
 
         return None
 
+    ## @brief Get compact encoding of mask stored in tensor data
+    #  @return "bitmask", "rle" or None if data is not encoded
+    def encoding(self) -> str | None:
+        return self["encoding"]
+
+    ## @brief Get segmentation mask, decoding it if tensor data is stored in compact encoding. Bitmask is expanded to
+    # float32 array of 0.0/1.0 values, RLE mask is expanded to int64 array of class indices
+    #  @return flat numpy.ndarray with the same elements as data() of not encoded mask, None if data can't be read
+    def mask(self) -> numpy.ndarray | None:
+        encoding = self.encoding()
+        if encoding is None:
+            return self.data()
+
+        data = self.data()
+        if data is None:
+            return None
+        dims = self.dims()
+        if encoding == "rle":
+            # first of semantic mask dims is batch dimension of model output, mask of one frame is encoded
+            dims = dims[1:]
+        size = int(numpy.prod(dims))
+        if encoding == "bitmask":
+            if data.size * 8 < size:
+                raise ValueError("Bitmask is too short for mask dims")
+            return numpy.unpackbits(data, count=size, bitorder="little").astype(
+                numpy.float32
+            )
+        if encoding == "rle":
+            return self.__decode_rle(data, size)
+        raise ValueError("Unsupported mask encoding: {}".format(encoding))
+
+    @staticmethod
+    def __decode_rle(data: numpy.ndarray, size: int) -> numpy.ndarray:
+        # runs are (zigzag varint value, varint length) pairs, varint ends at byte with high bit cleared
+        if data.size == 0 or data[-1] & 0x80:
+            raise ValueError("Malformed RLE mask")
+        ends = numpy.flatnonzero((data & 0x80) == 0)
+        starts = numpy.concatenate(([0], ends[:-1] + 1))
+        varint_index = numpy.repeat(numpy.arange(ends.size), ends - starts + 1)
+        shifts = (7 * (numpy.arange(data.size) - starts[varint_index])).astype(
+            numpy.uint64
+        )
+        varints = numpy.bitwise_or.reduceat(
+            (data & 0x7F).astype(numpy.uint64) << shifts, starts
+        )
+        if varints.size % 2:
+            raise ValueError("Malformed RLE mask")
+        zigzag = varints[0::2]
+        values = (zigzag >> numpy.uint64(1)).astype(numpy.int64) ^ -(
+            zigzag & numpy.uint64(1)
+        ).astype(numpy.int64)
+        lengths = varints[1::2].astype(numpy.int64)
+        if lengths.sum() != size:
+            raise ValueError("RLE mask runs don't match mask dims")
+        return numpy.repeat(values, lengths)
+
     ## @brief Get name as a string
     #  @return Tensor instance's name
     def name(self) -> str:
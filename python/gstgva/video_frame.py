@@ -81,6 +81,43 @@ class VideoFrame:
     def regions(self):
         return RegionOfInterest._iterate(self.__buffer)
 
+    ## @brief Get bounding boxes, labels and confidences of all regions as one structured numpy array. Unlike regions(),
+    #  RegionOfInterest and Tensor objects are not created, so it is cheap to call for frames with many objects
+    #  @return numpy array with fields "id", "x", "y", "w", "h", "confidence" and "label"
+    def regions_array(self) -> numpy.ndarray:
+        rows = []
+        labels = {}
+        relation_meta = GstAnalytics.buffer_get_analytics_relation_meta(self.__buffer)
+        if relation_meta is not None:
+            for od_mtd in relation_meta:
+                if type(od_mtd) != GstAnalytics.ODMtd:
+                    continue
+                success, x, y, w, h, _, confidence = od_mtd.get_oriented_location()
+                if not success:
+                    raise RuntimeError(
+                        "VideoFrame:regions_array: Failed to get oriented location from analytics metadata"
+                    )
+                label_quark = od_mtd.get_obj_type()
+                if label_quark not in labels:
+                    labels[label_quark] = (
+                        GLib.quark_to_string(label_quark) if label_quark else ""
+                    )
+                rows.append((od_mtd.id, x, y, w, h, confidence, labels[label_quark]))
+
+        label_length = max([len(label) for label in labels.values()], default=0)
+        dtype = numpy.dtype(
+            [
+                ("id", numpy.int32),
+                ("x", numpy.int32),
+                ("y", numpy.int32),
+                ("w", numpy.int32),
+                ("h", numpy.int32),
+                ("confidence", numpy.float32),
+                ("label", "U{}".format(max(label_length, 1))),
+            ]
+        )
+        return numpy.array(rows, dtype=dtype)
+
     ## @brief Get Tensor objects attached to VideoFrame
     #  @return iterator of Tensor objects attached to VideoFrame
     def tensors(self):
@@ -275,6 +312,35 @@ class VideoFrame:
                 )
                 raise e
 
+    ## @brief Get image planes wrapped by numpy.ndarray without copying buffer data. Plane i has shape
+    #  (height, width, pixel_stride) of its components and respects plane offset and stride, so padding of decoded
+    #  frames is skipped. Arrays are valid only inside of the context
+    #  @return list of numpy array instances, one per plane
+    @contextmanager
+    def planes(self, flag: Gst.MapFlags = Gst.MapFlags.READ) -> List[numpy.ndarray]:
+        finfo = self.__video_info.finfo
+        meta = self.video_meta()
+        with gst_buffer_data(self.__buffer, flag) as data:
+            planes = []
+            for plane in range(finfo.n_planes):
+                # first component stored in the plane defines its subsampling
+                comp = next(c for c in range(finfo.n_components) if finfo.plane[c] == plane)
+                width = -((-self.__video_info.width) >> finfo.w_sub[comp])
+                height = -((-self.__video_info.height) >> finfo.h_sub[comp])
+                pixel_stride = finfo.pixel_stride[comp]
+                offset = meta.offset[plane] if meta else self.__video_info.offset[plane]
+                stride = meta.stride[plane] if meta else self.__video_info.stride[plane]
+                planes.append(
+                    numpy.ndarray(
+                        (height, width, pixel_stride),
+                        dtype=numpy.uint8,
+                        buffer=data,
+                        offset=offset,
+                        strides=(stride, pixel_stride, 1),
+                    )
+                )
+            yield planes
+
     def __is_bounded(self, x, y, w, h):
         return (
             x >= 0
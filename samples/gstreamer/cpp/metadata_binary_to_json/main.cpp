@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+// Converts binary metadata records (gvametaconvert format=binary) into JSON Lines with the same schema as
+// gvametaconvert format=json produces.
+
+#include "gva_binary_format.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+namespace bm = dlstreamer::binary_meta;
+
+namespace {
+
+// Values of GVAPrecision / GVALayout (gva_tensor_meta.h)
+const char *precision_to_string(uint8_t precision) {
+    switch (precision) {
+    case 10:
+        return "FP32";
+    case 11:
+        return "FP16";
+    case 12:
+        return "BF16";
+    case 13:
+        return "FP64";
+    case 20:
+        return "Q78";
+    case 30:
+        return "I16";
+    case 39:
+        return "U4";
+    case 40:
+        return "U8";
+    case 41:
+        return "BOOL";
+    case 49:
+        return "I4";
+    case 50:
+        return "I8";
+    case 60:
+        return "U16";
+    case 70:
+        return "I32";
+    case 71:
+        return "BIN";
+    case 72:
+        return "I64";
+    case 73:
+        return "U64";
+    case 74:
+        return "U32";
+    case 80:
+        return "CUSTOM";
+    default:
+        return "UNSPECIFIED";
+    }
+}
+
+const char *layout_to_string(uint8_t layout) {
+    switch (layout) {
+    case 1:
+        return "NCHW";
+    case 2:
+        return "NHWC";
+    case 193:
+        return "NC";
+    default:
+        return "ANY";
+    }
+}
+
+template <typename T>
+json data_to_json(const bm::Tensor &tensor) {
+    json array = json::array();
+    size_t count = tensor.data_size / sizeof(T);
+    for (size_t i = 0; i < count; ++i) {
+        T value;
+        std::memcpy(&value, tensor.data + i * sizeof(T), sizeof(T));
+        array.push_back(value);
+    }
+    return array;
+}
+
+json tensor_to_json(const bm::Tensor &tensor) {
+    json res = json::object();
+    res["precision"] = precision_to_string(tensor.precision);
+    res["layout"] = layout_to_string(tensor.layout);
+    if (!tensor.dims.empty())
+        res["dims"] = tensor.dims;
+    if (!tensor.name.empty())
+        res["name"] = tensor.name;
+    if (tensor.model)
+        res["model_name"] = *tensor.model;
+    if (tensor.layer)
+        res["layer_name"] = *tensor.layer;
+    if (tensor.format)
+        res["format"] = *tensor.format;
+    if (tensor.label)
+        res["label"] = *tensor.label;
+    if (tensor.confidence)
+        res["confidence"] = *tensor.confidence;
+    if (tensor.label_id)
+        res["label_id"] = *tensor.label_id;
+    // Encoded masks are kept as raw encoded bytes
+    if (tensor.encoding)
+        res["encoding"] = *tensor.encoding;
+    // Same interpretation of raw data as gvametaconvert json
+    if (tensor.precision == 40)
+        res["data"] = data_to_json<uint8_t>(tensor);
+    else if (tensor.precision == 72)
+        res["data"] = data_to_json<int64_t>(tensor);
+    else
+        res["data"] = data_to_json<float>(tensor);
+    return res;
+}
+
+json object_to_json(const bm::Object &object) {
+    json res = json::object();
+    res["x"] = object.x;
+    res["y"] = object.y;
+    res["w"] = object.w;
+    res["h"] = object.h;
+    res["region_id"] = object.region_id;
+    if (object.parent_id)
+        res["parent_id"] = *object.parent_id;
+    if (object.object_id)
+        res["id"] = *object.object_id;
+    if (object.label)
+        res["roi_type"] = *object.label;
+    if (object.detection) {
+        const bm::Detection &d = *object.detection;
+        json detection = {{"bounding_box",
+                           {{"x_min", d.x_min}, {"x_max", d.x_max}, {"y_min", d.y_min}, {"y_max", d.y_max}}}};
+        if (d.confidence)
+            detection["confidence"] = *d.confidence;
+        if (d.label_id)
+            detection["label_id"] = *d.label_id;
+        if (object.label)
+            detection["label"] = *object.label;
+        res["detection"] = detection;
+    }
+    for (const auto &c : object.classifications) {
+        json classification = {{"label", c.label}};
+        if (c.model)
+            classification["model"] = {{"name", *c.model}};
+        if (c.confidence)
+            classification["confidence"] = *c.confidence;
+        if (c.label_id)
+            classification["label_id"] = *c.label_id;
+        res[c.attribute] = classification;
+    }
+    if (!object.tensors.empty()) {
+        res["tensors"] = json::array();
+        for (const auto &t : object.tensors)
+            res["tensors"].push_back(tensor_to_json(t));
+    }
+    return res;
+}
+
+json frame_to_json(const bm::Frame &frame) {
+    json res = json::object();
+    if (frame.width && frame.height)
+        res["resolution"] = {{"width", *frame.width}, {"height", *frame.height}};
+    if (frame.source)
+        res["source"] = *frame.source;
+    if (frame.timestamp)
+        res["timestamp"] = *frame.timestamp;
+    if (frame.tags && json::accept(*frame.tags))
+        res["tags"] = json::parse(*frame.tags);
+    if (!frame.objects.empty()) {
+        res["objects"] = json::array();
+        for (const auto &o : frame.objects)
+            res["objects"].push_back(object_to_json(o));
+    }
+    if (!frame.tensors.empty()) {
+        res["tensors"] = json::array();
+        for (const auto &t : frame.tensors)
+            res["tensors"].push_back(tensor_to_json(t));
+    }
+    return res;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    if (argc > 3 || (argc > 1 && (!strcmp(argv[1], "-h") || !strcmp(argv[1], "--help")))) {
+        std::cerr << "Usage: " << argv[0] << " [INPUT|-] [OUTPUT]\n"
+                  << "Converts binary metadata records written by gvametapublish file-format=binary (or received from "
+                     "MQTT/Kafka) into JSON Lines. Reads stdin and writes stdout by default.\n";
+        return 1;
+    }
+
+    std::vector<uint8_t> input;
+    if (argc < 2 || !strcmp(argv[1], "-")) {
+        input.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+    } else {
+        std::ifstream file(argv[1], std::ios::binary);
+        if (!file) {
+            std::cerr << "Cannot open " << argv[1] << "\n";
+            return 1;
+        }
+        input.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::ofstream output_file;
+    if (argc == 3) {
+        output_file.open(argv[2]);
+        if (!output_file) {
+            std::cerr << "Cannot open " << argv[2] << "\n";
+            return 1;
+        }
+    }
+    std::ostream &out = argc == 3 ? output_file : std::cout;
+
+    size_t offset = 0;
+    size_t records = 0;
+    try {
+        while (offset < input.size()) {
+            bm::Frame frame;
+            size_t consumed = bm::Reader::read_record(input.data() + offset, input.size() - offset, frame);
+            if (!consumed) {
+                std::cerr << "Incomplete record at offset " << offset << "\n";
+                return 1;
+            }
+            out << frame_to_json(frame).dump() << "\n";
+            offset += consumed;
+            records++;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Failed to parse record at offset " << offset << ": " << e.what() << "\n";
+        return 1;
+    }
+    std::cerr << "Converted " << records << " records\n";
+    return 0;
+}
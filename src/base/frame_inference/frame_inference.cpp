@@ -71,8 +71,8 @@ std::optional<PreprocessBackend> FrameInferenceParams::preprocess_backend_from_s
 namespace {
 
 void log_params(const FrameInferenceParams &params, spdlog::logger &log) {
-    log.info("FrameInference parameters: model={}, device={}, batch-size={}, preprocess-backend={}", params.model_path,
-             params.device, params.batch_size, params.preprocess_be);
+    log.info("FrameInference parameters: model={}, device={}, batch-size={}, preprocess-backend={}, instance-id={}",
+             params.model_path, params.device, params.batch_size, params.preprocess_be, params.instance_id);
 }
 
 // FIXME: move to transform.h?
@@ -206,7 +206,7 @@ void FrameInference::init_inference_backend(const FrameInferenceParams &params)
 
     backend_params->set(param::logger_name, params.logger_name);
 
-    _ov_backend = std::make_unique<OpenVinoBackend>(backend_params, _input_info);
+    _ov_backend = OpenVinoBackend::acquire(params.instance_id, backend_params, _input_info);
     _log->info("initialized inference backend, model input={} output={}",
                frame_info_to_string(_ov_backend->get_model_input()),
                frame_info_to_string(_ov_backend->get_model_output()));
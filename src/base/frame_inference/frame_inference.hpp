@@ -39,6 +39,9 @@ struct FrameInferenceParams {
     uint32_t nireq = 0;
     PreprocessBackend preprocess_be;
 
+    // Instances with same non-empty id and same model parameters share compiled model and infer requests
+    std::string instance_id;
+
     std::string logger_name;
 
     // FIXME: depends on GST
@@ -67,7 +70,7 @@ class FrameInference final {
     void flush();
 
   private:
-    std::unique_ptr<class OpenVinoBackend> _ov_backend;
+    std::shared_ptr<class OpenVinoBackend> _ov_backend;
 
     ContextPtr _app_context;
     MemoryMapperPtr _input_mapper;
@@ -8,6 +8,7 @@
 
 #include "dlstreamer_logger.h"
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
 #include <queue>
 
@@ -21,7 +22,7 @@ class SafeQueue {
             std::unique_lock<std::mutex> lock(mutex_);
             queue_.push_back(t);
         }
-        condition_.notify_one();
+        condition_.notify_all();
     }
 
     void push_front(T t) {
@@ -30,7 +31,7 @@ class SafeQueue {
             std::unique_lock<std::mutex> lock(mutex_);
             queue_.push_front(t);
         }
-        condition_.notify_one();
+        condition_.notify_all();
     }
 
     T &front() {
@@ -42,18 +43,20 @@ class SafeQueue {
         return queue_.front();
     }
 
+    // Waiters are served in arrival order, so threads of different streams sharing one queue get free items
+    // round-robin instead of in whatever order they happen to wake up
     T pop() {
         auto task = itt::Task("infer_requests_queue:SafeQueue:pop");
         T value;
         {
             std::unique_lock<std::mutex> lock(mutex_);
-            while (queue_.empty()) {
-                condition_.wait(lock);
-            }
+            const uint64_t ticket = next_ticket_++;
+            condition_.wait(lock, [&] { return !queue_.empty() && ticket == serving_ticket_; });
+            ++serving_ticket_;
             value = queue_.front();
             queue_.pop_front();
         }
-        condition_.notify_one();
+        condition_.notify_all();
         return value;
     }
 
@@ -75,6 +78,8 @@ class SafeQueue {
     std::deque<T> queue_;
     mutable std::mutex mutex_;
     std::condition_variable condition_;
+    uint64_t next_ticket_ = 0;
+    uint64_t serving_ticket_ = 0;
 };
 
 } // namespace dlstreamer
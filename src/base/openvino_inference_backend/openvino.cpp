@@ -11,8 +11,10 @@
 #include "dlstreamer/openvino/context.h"
 #include "dlstreamer/openvino/tensor.h"
 #include "dlstreamer/openvino/utils.h"
+#include "dlstreamer/utils.h"
 #include "infer_requests_queue.hpp"
 
+#include <map>
 #include <queue>
 
 #include "dlstreamer/element.h"
@@ -53,12 +55,15 @@ class OpenVinoInference {
         if (!complete_cb)
             throw std::invalid_argument("complete_cb cannot be empty");
 
-        std::unique_lock<std::mutex> lk(_requests_mutex);
-        ++_requests_processing;
-
         auto tensors = map_frames_to_tensors(frames);
         size_t idx = 0;
         for (auto frame_tensors : tensors) { // TODO: need to understand which frame maps to which tensors
+            {
+                // Don't hold the lock while waiting for free request, otherwise streams sharing this instance would
+                // be serialized in mutex acquisition order instead of fair order of the requests queue
+                std::lock_guard<std::mutex> lk(_requests_mutex);
+                ++_requests_processing;
+            }
             auto batch_request = get_free_infer_request();
             set_input(frame_tensors, batch_request->infer_request);
             // Not accurate
@@ -419,6 +424,51 @@ OpenVinoBackend::OpenVinoBackend(DictionaryCPtr params, FrameInfo &input_info)
 
 OpenVinoBackend::~OpenVinoBackend() = default;
 
+std::shared_ptr<OpenVinoBackend> OpenVinoBackend::acquire(const std::string &instance_id, DictionaryCPtr params,
+                                                          FrameInfo &input_info) {
+    auto task = itt::Task("openvino:OpenVinoBackend:acquire");
+    if (instance_id.empty())
+        return std::make_shared<OpenVinoBackend>(params, input_info);
+
+    // Backend is shared only if all parameters affecting compiled model match
+    std::string key = instance_id;
+    for (auto name : {param::model, param::device, param::config}) {
+        key += '|';
+        key += params->get<std::string>(name, std::string());
+    }
+    key += fmt::format("|{}|{}|{}", params->get<int>(param::batch_size, 0), params->get<int>(param::nireq, 0),
+                       frame_info_to_string(input_info));
+
+    // Model is compiled under lock of its key only, so elements with other models or ids are created concurrently
+    struct Instance {
+        std::mutex mutex;
+        std::weak_ptr<OpenVinoBackend> backend;
+    };
+    static std::map<std::string, std::shared_ptr<Instance>> instances;
+    static std::mutex instances_mutex;
+
+    std::shared_ptr<Instance> instance;
+    {
+        std::lock_guard<std::mutex> lock(instances_mutex);
+        // Drop entries of released backends nobody is creating
+        for (auto it = instances.begin(); it != instances.end();) {
+            bool unused = it->second.use_count() == 1 && it->second->backend.expired();
+            it = unused ? instances.erase(it) : std::next(it);
+        }
+        auto &entry = instances[key];
+        if (!entry)
+            entry = std::make_shared<Instance>();
+        instance = entry;
+    }
+
+    std::lock_guard<std::mutex> lock(instance->mutex);
+    if (auto backend = instance->backend.lock())
+        return backend;
+    auto backend = std::make_shared<OpenVinoBackend>(params, input_info);
+    instance->backend = backend;
+    return backend;
+}
+
 void OpenVinoBackend::infer_async(FrameVector frames, InferenceCompleteCallback complete_cb) {
     _impl->infer(std::move(frames), std::move(complete_cb));
 }
@@ -21,6 +21,11 @@ class OpenVinoBackend {
     OpenVinoBackend(DictionaryCPtr params, FrameInfo &input_info);
     ~OpenVinoBackend();
 
+    // Returns backend shared by all callers passing same instance id, model, device, config and input info.
+    // Empty instance id always creates private backend.
+    static std::shared_ptr<OpenVinoBackend> acquire(const std::string &instance_id, DictionaryCPtr params,
+                                                    FrameInfo &input_info);
+
     void infer_async(FrameVector frames, InferenceCompleteCallback complete_cb);
 
     const std::string &get_model_name() const;
@@ -74,9 +74,20 @@ class PostProcLabel : public BaseTransformInplace {
         }
         tensor = src->tensor(_layer_index);
         float *data = tensor->data<float>();
-        const auto data_size = tensor->info().size();
+        auto data_size = tensor->info().size();
         DLS_CHECK(data)
 
+        // Batched tensor split by batch_split, process only slice of this batch item
+        auto source_id_meta = find_metadata<SourceIdentifierMetadata>(*frame);
+        const auto &shape = tensor->info().shape;
+        if (source_id_meta && source_id_meta->try_get(SourceIdentifierMetadata::key::batch_index) && shape.size() > 1 &&
+            shape[0] > 1) {
+            const size_t batch_index = source_id_meta->batch_index();
+            DLS_CHECK(batch_index < shape[0])
+            data_size /= shape[0];
+            data += batch_index * data_size;
+        }
+
         double confidence = -1;
         int label_id = -1;
         std::string label;
@@ -7,6 +7,7 @@
 #include "batch_split.h"
 #include "dlstreamer/gst/frame.h"
 #include "dlstreamer/image_metadata.h"
+#include "roi_split.h"
 
 using namespace dlstreamer;
 
@@ -97,26 +98,45 @@ static GstFlowReturn batch_split_transform_ip(GstBaseTransform *base, GstBuffer
 
     FrameInfo info; // TODO
     GSTFrame buffer(buf, info);
+    std::vector<DictionaryPtr> source_metas;
+    size_t num_affine_metas = 0;
     for (auto &meta : buffer.metadata()) {
-        if (meta->name() != SourceIdentifierMetadata::name)
-            continue;
+        if (meta->name() == SourceIdentifierMetadata::name)
+            source_metas.push_back(meta);
+        else if (meta->name() == AffineTransformInfoMetadata::name)
+            num_affine_metas++;
+    }
+    // If there is one AffineTransformInfoMetadata per batch item, each output buffer keeps only its own one
+    const bool split_affine_metas = source_metas.size() > 1 && num_affine_metas == source_metas.size();
+
+    for (size_t i = 0; i < source_metas.size(); i++) {
+        auto &meta = source_metas[i];
 
         // Create new buffer (without GstMemory copy)
         GstBuffer *dst_buff = gst_buffer_copy(buf);
 
-        // Set PTS
-        GST_BUFFER_PTS(dst_buff) = meta->get<intptr_t>(SourceIdentifierMetadata::key::pts);
+        // Set PTS. Batch of ROIs from one frame (roi_cropscale_batch) has no PTS in metadata and keeps buffer PTS
+        if (meta->try_get(SourceIdentifierMetadata::key::pts))
+            GST_BUFFER_PTS(dst_buff) = meta->get<intptr_t>(SourceIdentifierMetadata::key::pts);
 
         // Metadata
         {
             GSTFrame dst_buff_dls(dst_buff, info);
             auto &metadata = dst_buff_dls.metadata();
-            // Remove all SourceIdentifierMetadata
-            metadata.erase(std::remove_if(metadata.begin(), metadata.end(),
-                                          [](const DictionaryPtr &dict) {
-                                              return dict->name() == SourceIdentifierMetadata::name;
-                                          }),
-                           metadata.end());
+            // Remove all SourceIdentifierMetadata and AffineTransformInfoMetadata of other batch items. Affine metas
+            // are stored in order of batch items
+            size_t affine_index = 0;
+            for (auto it = metadata.begin(); it != metadata.end();) {
+                const std::string name = (*it)->name();
+                bool remove = false;
+                if (name == SourceIdentifierMetadata::name) {
+                    remove = true;
+                } else if (split_affine_metas && name == AffineTransformInfoMetadata::name) {
+                    remove = affine_index != i;
+                    affine_index++;
+                }
+                it = remove ? metadata.erase(it) : it + 1;
+            }
 
             // Add only one SourceIdentifierMetadata
             auto dst_meta = metadata.add(SourceIdentifierMetadata::name);
@@ -126,11 +146,23 @@ static GstFlowReturn batch_split_transform_ip(GstBaseTransform *base, GstBuffer
         }
 
         // Call pad_push on corresponding transform
-        auto stream_id = meta->get<intptr_t>(SourceIdentifierMetadata::key::stream_id);
-        GstBaseTransform *tran = reinterpret_cast<GstBaseTransform *>(stream_id); // stream_id = GstBaseTransform*
-        if (!tran) {
-            GST_ERROR_OBJECT(base, "stream_id not specified");
-            throw std::runtime_error("No stream_id in SourceIdentifierMetadata");
+        GstBaseTransform *tran = nullptr;
+        if (meta->try_get(SourceIdentifierMetadata::key::stream_id)) {
+            auto stream_id = meta->get<intptr_t>(SourceIdentifierMetadata::key::stream_id);
+            tran = reinterpret_cast<GstBaseTransform *>(stream_id); // stream_id = GstBaseTransform*
+            if (!tran) {
+                GST_ERROR_OBJECT(base, "stream_id not specified");
+                throw std::runtime_error("No stream_id in SourceIdentifierMetadata");
+            }
+        } else {
+            // Batch of ROIs from one frame, push on own pad and mark last ROI as roi_split does. ROIs of frame may be
+            // spread over several batches, then only last item of last batch is marked
+            tran = base;
+            const bool last_roi = meta->try_get(SourceIdentifierMetadata::key::last_roi)
+                                      ? meta->get<bool>(SourceIdentifierMetadata::key::last_roi)
+                                      : i == source_metas.size() - 1;
+            if (last_roi)
+                gst_buffer_set_flags(dst_buff, static_cast<GstBufferFlags>(DLS_BUFFER_FLAG_LAST_ROI_ON_FRAME));
         }
         GstFlowReturn ret = gst_pad_push(GST_BASE_TRANSFORM_SRC_PAD(tran), dst_buff);
         if (ret != GST_FLOW_OK) {
@@ -276,6 +276,11 @@ class GvaInferencePrivate final {
         case PROP_PRE_PROC_BACKEND:
             _properties.preprocessing_backend = g_value_get_string(value);
             break;
+        case PROP_MODEL_INSTANCE_ID: {
+            const gchar *id = g_value_get_string(value);
+            _properties.model_instance_id = id ? id : "";
+            break;
+        }
         default:
             // FIXME: once all propreties are implemented
             // G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
@@ -331,7 +336,6 @@ class GvaInferencePrivate final {
             dls::FrameInferenceParams params;
             prepeare_inference_params(params);
 
-            // TODO: shared instance
             _inference =
                 std::make_shared<dls::FrameInference>(params, _gst_context, _input_info.memory_type, _input_info);
         } catch (...) {
@@ -346,6 +350,7 @@ class GvaInferencePrivate final {
         params.device = _properties.device;
         params.batch_size = _properties.batch_size;
         params.nireq = _properties.nireq;
+        params.instance_id = _properties.model_instance_id;
         // FIXME
         params.ov_config_str = _properties.ie_config;
         params.ov_config_map = Utils::stringToMap(_properties.ie_config);
@@ -452,6 +457,7 @@ class GvaInferencePrivate final {
         std::string model_proc_path;
         std::string ie_config;
         std::string preprocessing_backend;
+        std::string model_instance_id;
         guint batch_size = 0;
         guint nireq = 0;
     } _properties;
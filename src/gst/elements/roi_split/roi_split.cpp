@@ -142,13 +142,8 @@ static GstFlowReturn roi_split_transform_ip(GstBaseTransform *base, GstBuffer *b
         auto meta = GST_GVA_TENSOR_META_ADD(roi_buf);
         gst_structure_set_name(meta->data, dlstreamer::SourceIdentifierMetadata::name);
 
+        // ROI meta is absent if regions are stored in analytics metadata only
         roi_meta = gst_buffer_get_video_region_of_interest_meta_id(buf, od_mtd.id);
-        if (!roi_meta) {
-            GST_ERROR_OBJECT(self, "Failed to get ROI meta by id %u", od_mtd.id);
-            gst_buffer_unref(roi_buf);
-            return GST_FLOW_ERROR;
-        }
-
         GVA::RegionOfInterest gva_roi(od_mtd, roi_meta);
         gst_structure_set(meta->data, dlstreamer::SourceIdentifierMetadata::key::roi_id, G_TYPE_INT,
                           gva_roi.region_id(), dlstreamer::SourceIdentifierMetadata::key::object_id, G_TYPE_INT,
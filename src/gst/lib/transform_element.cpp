@@ -114,9 +114,10 @@ class GstDlsTransform {
         _logger = log::init_logger(GST_CAT_DEFAULT, nullptr);
         _gst_context = std::make_shared<GSTContext>(&base->element);
 #if !(_MSC_VER)
-        _gst_mapper = std::make_shared<MemoryMapperAnyToGST>(nullptr, _gst_context);
+        // Output frames come from bounded pool, so GstBuffer wrappers are cached and re-used instead of allocated and
+        // mapped on every frame
+        _gst_mapper = std::make_shared<MemoryMapperAnyToGST>(nullptr, _gst_context, true);
 #endif
-        //_gst_mapper = std::make_shared<MemoryMapperCache>(_gst_mapper);
         if (_class_data->desc->params) {
             for (auto const &param : *_class_data->desc->params) {
                 _params->set(param.name, param.default_value);
@@ -141,6 +142,15 @@ class GstDlsTransform {
         return (_element != nullptr);
     }
 
+    gboolean stop() {
+        GST_DEBUG_OBJECT(_base, "stop");
+        log_mapper_cache_stats();
+        if (_gst_mapper)
+            _gst_mapper->clear_cache();
+        _pending_input = nullptr;
+        return TRUE;
+    }
+
     gboolean create_instance() {
         if (_element)
             return true;
@@ -219,9 +229,25 @@ class GstDlsTransform {
             init_function();
         }
 
+        // Number of GstBuffer wrappers in use or idle is bounded by number of output frames in transform pool
+        auto base_transform = dynamic_cast<BaseTransform *>(_transform);
+        if (_gst_mapper && base_transform)
+            _gst_mapper->set_cache_capacity(base_transform->max_pool_size());
+
         _transform_initialized = true;
     }
 
+    void log_mapper_cache_stats() {
+        if (!_gst_mapper)
+            return;
+        auto stats = _gst_mapper->cache_stats();
+        if (stats.hits + stats.misses)
+            GST_INFO_OBJECT(_base,
+                            "GstBuffer wrapper cache: hits=%" G_GUINT64_FORMAT " misses=%" G_GUINT64_FORMAT
+                            " evictions=%" G_GUINT64_FORMAT " hit rate=%.1f%%",
+                            stats.hits, stats.misses, stats.evictions, stats.hit_rate() * 100);
+    }
+
     void log_frame_info(GstDebugLevel level, std::string_view msg, const FrameInfo &info) {
         if (level <= _gst_debug_min) {
             auto str = frame_info_to_string(info);
@@ -256,11 +282,13 @@ class GstDlsTransform {
     DictionaryPtr _params = std::make_shared<BaseDictionary>();
 
     std::string _shared_instance_id;
-    MemoryMapperPtr _gst_mapper;
+    std::shared_ptr<MemoryMapperAnyToGST> _gst_mapper;
     FrameInfo _input_info;
     FrameInfo _output_info;
     GstVideoInfo _input_video_info = {};
     GstVideoInfo _output_video_info = {};
+    // Input of ELEMENT_FLAG_MULTIPLE_OUTPUTS element which may produce more output frames
+    GstFramePtr _pending_input;
 
     std::shared_ptr<spdlog::logger> _logger;
 };
@@ -405,6 +433,10 @@ gboolean GstDlsTransform::set_caps(GstCaps *incaps, GstCaps *outcaps) {
     std::lock_guard<std::mutex> guard(_mutex);
     GST_DEBUG_OBJECT(_base, "set_caps");
 
+    // Cached GstBuffer wrappers were created for previous caps
+    if (_gst_mapper)
+        _gst_mapper->clear_cache();
+
     _input_info = gst_caps_to_frame_info(incaps);
     _output_info = gst_caps_to_frame_info(outcaps);
     if (_input_info.media_type == MediaType::Image)
@@ -440,18 +472,33 @@ GstFlowReturn GstDlsTransform::generate_output(GstBuffer **outbuf) {
     ITT_TASK(trans->element.object.name);
     GST_DEBUG_OBJECT(_base, "generate_output");
 
-    if (!_base->queued_buf)
+    const bool multiple_outputs = _class_data->desc->flags & ELEMENT_FLAG_MULTIPLE_OUTPUTS;
+    if (_base->queued_buf)
+        _pending_input = nullptr; // new input, outputs of previous one were aborted (e.g. by flush)
+    else if (!_pending_input)
         return GST_FLOW_OK;
 
 #ifdef CATCH_EXCEPTIONS
     try {
 #endif
-        GstBuffer *input = _base->queued_buf;
-        GstFramePtr in = gst_buffer_to_frame(input, _input_info, &_input_video_info, true, _gst_context);
-        _base->queued_buf = nullptr; // GSTFrame took ownership
+        GstFramePtr in = _pending_input;
+        if (!in) {
+            in = gst_buffer_to_frame(_base->queued_buf, _input_info, &_input_video_info, true, _gst_context);
+            _base->queued_buf = nullptr; // GSTFrame took ownership
+        }
+        GstBuffer *input = in->gst_buffer();
 
         FramePtr out = _transform->process(in);
 
+        // GstBaseTransform calls generate_output() again while it returns output buffer, so next output frame of
+        // same input is requested until element returns nullptr
+        if (multiple_outputs) {
+            const bool first_output = !_pending_input;
+            _pending_input = out ? in : nullptr;
+            if (!out && !first_output)
+                return GST_FLOW_OK;
+        }
+
         if (!out) { // send gap event?
             // auto gap_event = gst_event_new_gap(GST_BUFFER_PTS(input), GST_BUFFER_DURATION(input));
             // if (!gst_pad_push_event(_base->srcpad, gap_event))
@@ -461,7 +508,7 @@ GstFlowReturn GstDlsTransform::generate_output(GstBuffer **outbuf) {
             *outbuf = gst_buffer_ref(input);
         } else {
             // map Frame to GSTFrame and get GSTFrame
-            *outbuf = ptr_cast<GSTFrame>(_gst_mapper->map(out))->gst_buffer();
+            *outbuf = ptr_cast<GSTFrame>(_gst_mapper->map(out, AccessMode::ReadWrite))->gst_buffer();
             // copy timestamps and metadata
             DLS_CHECK(gst_buffer_copy_into(*outbuf, input, GST_BUFFER_COPY_METADATA, 0, static_cast<gsize>(-1)))
         }
@@ -623,6 +670,7 @@ void GstDlsTransformClass::init(gpointer g_class, gpointer class_data) {
     self->default_transform_caps = base_transform_class->transform_caps;
 
     base_transform_class->start = Callback<&GstDlsTransform::start>::fn;
+    base_transform_class->stop = Callback<&GstDlsTransform::stop>::fn;
     base_transform_class->set_caps = Callback<&GstDlsTransform::set_caps>::fn;
     base_transform_class->transform_caps = Callback<&GstDlsTransform::transform_caps>::fn;
     base_transform_class->query = Callback<&GstDlsTransform::query>::fn;
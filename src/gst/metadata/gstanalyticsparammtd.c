@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "dlstreamer/gst/metadata/gstanalyticsparammtd.h"
+
+#include <gst/analytics/analytics.h>
+#include <gst/video/gstvideometa.h>
+
+/**
+ * SECTION:gstanalyticsparammtd
+ * @title: GstAnalyticsParamMtd
+ * @short_description: An analytics metadata holding #GstStructure param of a region inside a
+ * #GstAnalyticsRelationMeta
+ * @symbols:
+ * - GstAnalyticsParamMtd
+ * @see_also: #GstAnalyticsODMtd, #GstAnalyticsRelationMeta
+ *
+ * This type of metadata keeps region params in #GstAnalyticsRelationMeta, so regions can be described without
+ * #GstVideoRegionOfInterestMeta. Each instance owns its #GstStructure, copies of relation meta get copies of it.
+ */
+
+typedef struct _GstAnalyticsParamData GstAnalyticsParamData;
+
+struct _GstAnalyticsParamData {
+    GstStructure *params;
+};
+
+static gboolean gst_analytics_param_mtd_meta_transform(GstBuffer *transbuf, GstAnalyticsMtd *transmtd,
+                                                       GstBuffer *buffer, GQuark type, gpointer data) {
+    (void)transbuf;
+    (void)buffer;
+    (void)type;
+    (void)data;
+
+    // Relation meta data is copied bytewise, so copy must not share structure with original
+    GstAnalyticsParamData *param_data =
+        (GstAnalyticsParamData *)gst_analytics_relation_meta_get_mtd_data(transmtd->meta, transmtd->id);
+    if (param_data && param_data->params)
+        param_data->params = gst_structure_copy(param_data->params);
+
+    return TRUE;
+}
+
+static void gst_analytics_param_mtd_meta_clear(GstBuffer *buffer, GstAnalyticsMtd *mtd) {
+    (void)buffer;
+
+    GstAnalyticsParamData *param_data =
+        (GstAnalyticsParamData *)gst_analytics_relation_meta_get_mtd_data(mtd->meta, mtd->id);
+    if (param_data && param_data->params) {
+        gst_structure_free(param_data->params);
+        param_data->params = NULL;
+    }
+}
+
+static const GstAnalyticsMtdImpl param_impl = {
+    "param", gst_analytics_param_mtd_meta_transform, gst_analytics_param_mtd_meta_clear, {NULL}};
+
+/**
+ * gst_analytics_param_mtd_get_mtd_type:
+ *
+ * Get an id identifying #GstAnalyticsParamMtd type.
+ *
+ * Returns: opaque id of #GstAnalyticsMtd type
+ */
+GstAnalyticsMtdType gst_analytics_param_mtd_get_mtd_type(void) {
+    return (GstAnalyticsMtdType)&param_impl;
+}
+
+/**
+ * gst_analytics_param_mtd_get_params:
+ * @handle: instance handle
+ *
+ * Get param structure. Structure stays owned by metadata and can be modified in place.
+ *
+ * Returns: (transfer none): param structure, NULL if the call failed
+ */
+GstStructure *gst_analytics_param_mtd_get_params(const GstAnalyticsParamMtd *handle) {
+    g_return_val_if_fail(handle, NULL);
+    g_return_val_if_fail(handle->meta != NULL, NULL);
+
+    GstAnalyticsParamData *param_data =
+        (GstAnalyticsParamData *)gst_analytics_relation_meta_get_mtd_data(handle->meta, handle->id);
+    g_return_val_if_fail(param_data != NULL, NULL);
+
+    return param_data->params;
+}
+
+/**
+ * gst_analytics_relation_meta_add_param_mtd:
+ * @instance: Instance of #GstAnalyticsRelationMeta where to add param
+ * @params: (transfer full): param structure, ownership is taken same as by
+ * gst_video_region_of_interest_meta_add_param()
+ * @param_mtd: (out) (not nullable): Handle updated to newly added param metadata.
+ *
+ * Add param metadata to @instance. Relations to region are set by caller.
+ *
+ * Returns: TRUE on success, otherwise FALSE.
+ */
+gboolean gst_analytics_relation_meta_add_param_mtd(GstAnalyticsRelationMeta *instance, GstStructure *params,
+                                                   GstAnalyticsParamMtd *param_mtd) {
+    g_return_val_if_fail(instance, FALSE);
+    g_return_val_if_fail(params != NULL, FALSE);
+
+    GstAnalyticsParamData *param_data = (GstAnalyticsParamData *)gst_analytics_relation_meta_add_mtd(
+        instance, &param_impl, sizeof(GstAnalyticsParamData), param_mtd);
+    g_return_val_if_fail(param_data != NULL, FALSE);
+
+    param_data->params = params;
+
+    return TRUE;
+}
+
+/**
+ * gst_analytics_param_mtd_attach_roi_metas:
+ * @buffer: writable buffer
+ *
+ * Compatibility for consumers reading #GstVideoRegionOfInterestMeta only: attaches #GstVideoRegionOfInterestMeta
+ * to every object detection metadata of @buffer that doesn't have one (same id). Params of region are copied to
+ * the new meta, parent_id is set from GST_ANALYTICS_REL_TYPE_IS_PART_OF relation to parent region.
+ *
+ * Returns: number of attached #GstVideoRegionOfInterestMeta
+ */
+guint gst_analytics_param_mtd_attach_roi_metas(GstBuffer *buffer) {
+    g_return_val_if_fail(buffer, 0);
+
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+    if (!relation_meta)
+        return 0;
+
+    GHashTable *attached_ids = g_hash_table_new(g_direct_hash, g_direct_equal);
+    gpointer state = NULL;
+    GstVideoRegionOfInterestMeta *roi_meta = NULL;
+    while ((roi_meta = (GstVideoRegionOfInterestMeta *)gst_buffer_iterate_meta_filtered(
+                buffer, &state, GST_VIDEO_REGION_OF_INTEREST_META_API_TYPE))) {
+        g_hash_table_add(attached_ids, GINT_TO_POINTER(roi_meta->id));
+    }
+
+    guint attached = 0;
+    GstAnalyticsODMtd od_mtd;
+    state = NULL;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
+        if (g_hash_table_contains(attached_ids, GINT_TO_POINTER(od_mtd.id)))
+            continue;
+
+        gint x, y, w, h;
+        if (!gst_analytics_od_mtd_get_location(&od_mtd, &x, &y, &w, &h, NULL))
+            continue;
+
+        roi_meta = gst_buffer_add_video_region_of_interest_meta_id(buffer, gst_analytics_od_mtd_get_obj_type(&od_mtd),
+                                                                   MAX(x, 0), MAX(y, 0), MAX(w, 0), MAX(h, 0));
+        roi_meta->id = od_mtd.id;
+
+        GstAnalyticsODMtd parent_mtd;
+        if (gst_analytics_relation_meta_get_direct_related(relation_meta, od_mtd.id, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                           gst_analytics_od_mtd_get_mtd_type(), NULL, &parent_mtd))
+            roi_meta->parent_id = parent_mtd.id;
+
+        gpointer param_state = NULL;
+        GstAnalyticsParamMtd param_mtd;
+        while (gst_analytics_relation_meta_get_direct_related(relation_meta, od_mtd.id, GST_ANALYTICS_REL_TYPE_CONTAIN,
+                                                              gst_analytics_param_mtd_get_mtd_type(), &param_state,
+                                                              &param_mtd)) {
+            GstStructure *params = gst_analytics_param_mtd_get_params(&param_mtd);
+            if (params)
+                gst_video_region_of_interest_meta_add_param(roi_meta, gst_structure_copy(params));
+        }
+        ++attached;
+    }
+
+    g_hash_table_destroy(attached_ids);
+    return attached;
+}
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "dlstreamer/gst/metadata/gva_binary_meta.h"
+
+#define UNUSED(x) (void)(x)
+
+DLS_EXPORT GType gst_gva_binary_meta_api_get_type(void) {
+    static GType type;
+    static const gchar *tags[] = {NULL};
+
+    if (g_once_init_enter(&type)) {
+        GType _type = gst_meta_api_type_register(GVA_BINARY_META_API_NAME, tags);
+        g_once_init_leave(&type, _type);
+    }
+    return type;
+}
+
+gboolean gst_gva_binary_meta_init(GstMeta *meta, gpointer params, GstBuffer *buffer) {
+    UNUSED(params);
+    UNUSED(buffer);
+
+    GstGVABinaryMeta *binary_meta = (GstGVABinaryMeta *)meta;
+    binary_meta->message = NULL;
+    return TRUE;
+}
+
+void gst_gva_binary_meta_free(GstMeta *meta, GstBuffer *buffer) {
+    UNUSED(buffer);
+
+    GstGVABinaryMeta *binary_meta = (GstGVABinaryMeta *)meta;
+    if (binary_meta->message) {
+        g_bytes_unref(binary_meta->message);
+        binary_meta->message = NULL;
+    }
+}
+
+gboolean gst_gva_binary_meta_transform(GstBuffer *dest_buf, GstMeta *src_meta, GstBuffer *src_buf, GQuark type,
+                                       gpointer data) {
+    UNUSED(src_buf);
+    UNUSED(type);
+    UNUSED(data);
+
+    g_return_val_if_fail(gst_buffer_is_writable(dest_buf), FALSE);
+
+    GstGVABinaryMeta *dst = GST_GVA_BINARY_META_ADD(dest_buf);
+    GstGVABinaryMeta *src = (GstGVABinaryMeta *)src_meta;
+
+    // GBytes is immutable, so message is shared between buffers instead of copied
+    gst_gva_binary_meta_set_message(dst, src->message);
+    return TRUE;
+}
+
+DLS_EXPORT const GstMetaInfo *gst_gva_binary_meta_get_info(void) {
+    static const GstMetaInfo *meta_info = NULL;
+
+    if (g_once_init_enter(&meta_info)) {
+        const GstMetaInfo *meta = gst_meta_register(
+            gst_gva_binary_meta_api_get_type(), GVA_BINARY_META_IMPL_NAME, sizeof(GstGVABinaryMeta),
+            (GstMetaInitFunction)gst_gva_binary_meta_init, (GstMetaFreeFunction)gst_gva_binary_meta_free,
+            (GstMetaTransformFunction)gst_gva_binary_meta_transform);
+        g_once_init_leave(&meta_info, meta);
+    }
+    return meta_info;
+}
+
+DLS_EXPORT void gst_gva_binary_meta_set_message(GstGVABinaryMeta *meta, GBytes *message) {
+    GBytes *old = meta->message;
+    meta->message = message ? g_bytes_ref(message) : NULL;
+    if (old)
+        g_bytes_unref(old);
+}
@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/trace_recorder.h"
+
+#include <gst/gst.h>
+#include <gst/gsttracer.h>
+
+#include <vector>
+
+#define ELEMENT_DESCRIPTION "Per-frame timeline of pipeline elements in Chrome trace (Perfetto) format"
+#define DEFAULT_LOCATION "gvatrace.json"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_GVA_TRACE (gst_gva_trace_get_type())
+#define GST_GVA_TRACE(obj) (G_TYPE_CHECK_INSTANCE_CAST((obj), GST_TYPE_GVA_TRACE, GstGvaTrace))
+
+typedef struct _GstGvaTrace GstGvaTrace;
+typedef struct _GstGvaTraceClass GstGvaTraceClass;
+
+struct _GstGvaTrace {
+    GstTracer parent;
+};
+
+struct _GstGvaTraceClass {
+    GstTracerClass parent_class;
+};
+
+G_GNUC_INTERNAL GType gst_gva_trace_get_type(void);
+
+G_END_DECLS
+
+GST_DEBUG_CATEGORY_STATIC(gst_gva_trace_debug);
+#define GST_CAT_DEFAULT gst_gva_trace_debug
+
+#define _do_init GST_DEBUG_CATEGORY_INIT(gst_gva_trace_debug, "gvatrace", 0, "gvatrace tracer");
+#define gst_gva_trace_parent_class parent_class
+
+G_DEFINE_TYPE_WITH_CODE(GstGvaTrace, gst_gva_trace, GST_TYPE_TRACER, _do_init);
+
+namespace {
+
+// Interned element name and registered stream are cached on element and pad
+GQuark name_quark() {
+    static GQuark quark = g_quark_from_static_string("gvatrace-name");
+    return quark;
+}
+
+GQuark stream_quark() {
+    static GQuark quark = g_quark_from_static_string("gvatrace-stream");
+    return quark;
+}
+
+struct PushSpan {
+    const char *name;
+    uint64_t begin_ns;
+    TraceRecorder::Context context;
+};
+
+// Pushes nest when element pushes downstream from its chain function
+thread_local std::vector<PushSpan> push_spans;
+
+const char *element_name(GstElement *element) {
+    auto name = static_cast<const char *>(g_object_get_qdata(G_OBJECT(element), name_quark()));
+    if (!name) {
+        gchar *element_name = gst_element_get_name(element);
+        name = TraceRecorder::Instance().Intern(element_name);
+        g_free(element_name);
+        g_object_set_qdata(G_OBJECT(element), name_quark(), const_cast<char *>(name));
+    }
+    return name;
+}
+
+uint32_t pad_stream(GstPad *pad) {
+    gpointer cached = g_object_get_qdata(G_OBJECT(pad), stream_quark());
+    if (cached)
+        return GPOINTER_TO_UINT(cached) - 1;
+
+    uint32_t stream = TraceRecorder::NO_STREAM;
+    gchar *stream_id = gst_pad_get_stream_id(pad);
+    if (stream_id) {
+        stream = TraceRecorder::Instance().RegisterStream(stream_id);
+        g_free(stream_id);
+        g_object_set_qdata(G_OBJECT(pad), stream_quark(), GUINT_TO_POINTER(stream + 1));
+    }
+    return stream;
+}
+
+void on_pad_push_pre(GObject *self, GstClockTime ts, GstPad *pad, GstBuffer *buffer) {
+    (void)self;
+    (void)ts;
+
+    // Time spent in push is time of downstream element processing the buffer
+    const char *name = nullptr;
+    GstPad *peer = gst_pad_get_peer(pad);
+    if (peer) {
+        GstElement *element = gst_pad_get_parent_element(peer);
+        if (element) {
+            name = element_name(element);
+            gst_object_unref(element);
+        }
+        gst_object_unref(peer);
+    }
+
+    TraceRecorder::Context context;
+    context.stream = pad_stream(pad);
+    context.frame = buffer ? GST_BUFFER_PTS(buffer) : TraceRecorder::NO_FRAME;
+    push_spans.push_back({name, TraceRecorder::NowNs(), context});
+}
+
+void on_pad_push_post(GObject *self, GstClockTime ts, GstPad *pad, GstFlowReturn res) {
+    (void)self;
+    (void)ts;
+    (void)pad;
+    (void)res;
+
+    if (push_spans.empty())
+        return;
+    const PushSpan span = push_spans.back();
+    push_spans.pop_back();
+    if (span.name)
+        TraceRecorder::Instance().Record(span.name, nullptr, span.begin_ns, TraceRecorder::NowNs(), span.context);
+}
+
+void on_pad_push_event_pre(GObject *self, GstClockTime ts, GstPad *pad, GstEvent *event) {
+    (void)self;
+    (void)ts;
+
+    // New stream on pad, it is registered on the next buffer
+    if (GST_EVENT_TYPE(event) == GST_EVENT_STREAM_START)
+        g_object_set_qdata(G_OBJECT(pad), stream_quark(), nullptr);
+}
+
+void on_element_change_state_post(GObject *self, GstClockTime ts, GstElement *element, GstStateChange transition,
+                                  GstStateChangeReturn result) {
+    (void)ts;
+    (void)result;
+
+    // Trace of stopped pipeline is written without waiting for process exit, top-level bin is pipeline
+    if (transition != GST_STATE_CHANGE_PAUSED_TO_READY || GST_OBJECT_PARENT(element))
+        return;
+    if (!TraceRecorder::Instance().Flush())
+        GST_WARNING_OBJECT(self, "Couldn't write trace of %s", GST_OBJECT_NAME(element));
+}
+
+} // namespace
+
+static void gst_gva_trace_constructed(GObject *object) {
+    G_OBJECT_CLASS(parent_class)->constructed(object);
+
+    gchar *params = nullptr;
+    g_object_get(object, "params", &params, NULL);
+
+    gchar *location = g_strdup(DEFAULT_LOCATION);
+    if (params) {
+        gchar *tmp = g_strdup_printf("gvatrace,%s", params);
+        GstStructure *params_struct = gst_structure_from_string(tmp, NULL);
+        g_free(tmp);
+        if (params_struct) {
+            const gchar *value = gst_structure_get_string(params_struct, "location");
+            if (value) {
+                g_free(location);
+                location = g_strdup(value);
+            }
+            gst_structure_free(params_struct);
+        }
+        g_free(params);
+    }
+
+    // Libraries loaded later (plugins with inference elements) enable their recorders from environment
+    // Path set in environment takes precedence over tracer params
+    g_setenv(TraceRecorder::ENV_VARIABLE, location, FALSE);
+    TraceRecorder::Instance().Enable(g_getenv(TraceRecorder::ENV_VARIABLE));
+    GST_INFO_OBJECT(object, "Trace is written to %s", g_getenv(TraceRecorder::ENV_VARIABLE));
+    g_free(location);
+}
+
+static void gst_gva_trace_class_init(GstGvaTraceClass *klass) {
+    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+
+    gobject_class->constructed = gst_gva_trace_constructed;
+}
+
+static void gst_gva_trace_init(GstGvaTrace *self) {
+    GstTracer *tracer = GST_TRACER(self);
+    gst_tracing_register_hook(tracer, "pad-push-pre", G_CALLBACK(on_pad_push_pre));
+    gst_tracing_register_hook(tracer, "pad-push-post", G_CALLBACK(on_pad_push_post));
+    gst_tracing_register_hook(tracer, "pad-push-event-pre", G_CALLBACK(on_pad_push_event_pre));
+    gst_tracing_register_hook(tracer, "element-change-state-post", G_CALLBACK(on_element_change_state_post));
+}
+
+static gboolean plugin_init(GstPlugin *plugin) {
+    if (!gst_tracer_register(plugin, "gvatrace", gst_gva_trace_get_type()))
+        return FALSE;
+    return TRUE;
+}
+
+GST_PLUGIN_DEFINE(GST_VERSION_MAJOR, GST_VERSION_MINOR, gvatrace, ELEMENT_DESCRIPTION, plugin_init, PLUGIN_VERSION,
+                  PLUGIN_LICENSE, PACKAGE_NAME, GST_PACKAGE_ORIGIN)
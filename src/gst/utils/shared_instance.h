@@ -33,26 +33,34 @@ class SharedInstance {
         }
     };
 
+    // Returns element previously registered with same id, otherwise initializes and registers passed element.
+    // Shared element is called concurrently from streaming threads of all elements with same id.
+    // Initialization (model compilation) is serialized per id only, elements with different ids initialize in parallel.
     ElementPtr init_or_reuse(const InstanceId &id, ElementPtr element, std::function<void()> init) {
-        // This code path is work in progress and not active in DLStreamer architecture 1.0
-        assert(false);
+        std::shared_ptr<Entry> entry;
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            auto &shared_entry = _shared_elements[id];
+            if (!shared_entry)
+                shared_entry = std::make_shared<Entry>();
+            entry = shared_entry;
+        }
 
-        std::lock_guard<std::mutex> guard(_mutex);
-        auto it = _shared_elements.find(id);
-        if (it != _shared_elements.end()) {
-            return it->second;
-        } else {
+        std::lock_guard<std::mutex> guard(entry->mutex);
+        if (!entry->element) {
             if (init)
                 init();
-            _shared_elements.insert({id, element});
-            return element;
+            entry->element = element;
         }
+        return entry->element;
     }
 
     void clean_up() {
         std::lock_guard<std::mutex> guard(_mutex);
         for (auto it = _shared_elements.cbegin(); it != _shared_elements.cend();) {
-            if (it->second.use_count() == 1) { // no other references
+            // entry isn't referenced by init_or_reuse in progress and its element has no other references
+            const auto &entry = it->second;
+            if (entry.use_count() == 1 && (!entry->element || entry->element.use_count() == 1)) {
                 it = _shared_elements.erase(it);
             } else {
                 ++it;
@@ -65,7 +73,12 @@ class SharedInstance {
     }
 
   private:
-    std::map<InstanceId, ElementPtr> _shared_elements;
+    struct Entry {
+        std::mutex mutex;
+        ElementPtr element;
+    };
+
+    std::map<InstanceId, std::shared_ptr<Entry>> _shared_elements;
     std::mutex _mutex;
 };
 
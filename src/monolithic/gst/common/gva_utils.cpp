@@ -9,9 +9,32 @@
 #include <inference_backend/image.h>
 #include <inference_backend/logger.h>
 
+#include <atomic>
 #include <cassert>
 #include <string>
-#include <thread>
+
+namespace {
+
+struct WritableBufferCounters {
+    std::atomic<guint64> metadata_copies{0};
+    std::atomic<guint64> deep_copies{0};
+};
+
+WritableBufferCounters &writable_buffer_counters() {
+    static WritableBufferCounters counters;
+    return counters;
+}
+
+bool has_unshareable_memory(GstBuffer *buffer) {
+    const guint n_memory = gst_buffer_n_memory(buffer);
+    for (guint i = 0; i < n_memory; ++i) {
+        if (GST_MEMORY_FLAG_IS_SET(gst_buffer_peek_memory(buffer, i), GST_MEMORY_FLAG_NO_SHARE))
+            return true;
+    }
+    return false;
+}
+
+} // namespace
 
 gboolean get_object_id(GstVideoRegionOfInterestMeta *meta, int *id) {
     GstStructure *object_id = gst_video_region_of_interest_meta_get_param(meta, "object_id");
@@ -63,23 +86,42 @@ void set_od_id(GstAnalyticsODMtd od_mtd, gint id) {
     }
 }
 
-void gva_buffer_check_and_make_writable(GstBuffer **buffer, const char *called_function_name) {
+void gva_buffer_make_metadata_writable(GstBuffer **buffer, const char *called_function_name) {
     assert(called_function_name);
 
-    ITT_TASK(std::string(__FUNCTION__) + called_function_name);
+    TraceTask task(__FUNCTION__, called_function_name);
 
     if (!(buffer and *buffer)) {
         GST_ERROR("%s: Buffer is null.", called_function_name);
         return;
     }
+    if (gst_buffer_is_writable(*buffer))
+        return;
 
-    if (!gst_buffer_is_writable(*buffer)) {
-        GST_WARNING("%s: Buffer is not writable.", called_function_name);
-        /* Waits for a bit to give a buffer time to become writable */
-        std::this_thread::sleep_for(std::chrono::microseconds(100));
-    }
-    if (!gst_buffer_is_writable(*buffer)) {
-        GST_WARNING("%s: Making a writable buffer requires buffer copy.", called_function_name);
-        *buffer = gst_buffer_make_writable(*buffer);
+    // Other references (tee branches, queued copies) are not waited for: copying the shell is cheaper than a stall
+    GST_DEBUG("%s: Buffer is not writable, copying its metadata.", called_function_name);
+    GstBuffer *copy = gva_buffer_copy_metadata(*buffer);
+    gst_buffer_unref(*buffer);
+    *buffer = copy;
+}
+
+GstBuffer *gva_buffer_copy_metadata(GstBuffer *buffer) {
+    g_return_val_if_fail(buffer, nullptr);
+
+    // Memory is only shared if it allows it, memory owned by allocators forbidding it is copied by GStreamer
+    if (has_unshareable_memory(buffer)) {
+        GST_WARNING("Buffer memory can't be shared, making a writable buffer requires memory copy.");
+        writable_buffer_counters().deep_copies++;
+    } else {
+        writable_buffer_counters().metadata_copies++;
     }
+    return gst_buffer_copy(buffer);
+}
+
+GvaWritableBufferStats gva_buffer_writable_stats(void) {
+    const WritableBufferCounters &counters = writable_buffer_counters();
+    GvaWritableBufferStats stats;
+    stats.metadata_copies = counters.metadata_copies.load();
+    stats.deep_copies = counters.deep_copies.load();
+    return stats;
 }
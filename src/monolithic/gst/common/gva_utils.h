@@ -21,7 +21,18 @@ void set_object_id(GstVideoRegionOfInterestMeta *meta, gint id);
 gboolean get_od_id(GstAnalyticsODMtd od_mtd, int *id);
 void set_od_id(GstAnalyticsODMtd od_mtd, gint id);
 
-void gva_buffer_check_and_make_writable(GstBuffer **buffer, const char *called_function_name);
+/* Counters of buffers made writable, collected over all elements of the library since process start */
+typedef struct _GvaWritableBufferStats {
+    guint64 metadata_copies; /* buffer shell and metas copied, memory shared */
+    guint64 deep_copies;     /* memory copied, it can't be shared (GST_MEMORY_FLAG_NO_SHARE) */
+} GvaWritableBufferStats;
+
+/* Makes buffer writable for adding or changing metas without waiting. If buffer is shared, it is replaced by copy of
+ * its shell and metas referencing the same memory, so memory of the copy must not be written */
+void gva_buffer_make_metadata_writable(GstBuffer **buffer, const char *called_function_name);
+/* Returns new buffer with flags, timestamps and metas of buffer, sharing its memory unless memory forbids sharing */
+GstBuffer *gva_buffer_copy_metadata(GstBuffer *buffer);
+GvaWritableBufferStats gva_buffer_writable_stats(void);
 
 G_END_DECLS
 
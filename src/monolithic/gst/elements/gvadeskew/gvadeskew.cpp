@@ -5,7 +5,10 @@
  ******************************************************************************/
 
 #include "gvadeskew.h"
+#include "region_of_interest.h"
+
 #include <fstream>
+#include <gst/analytics/analytics.h>
 #include <gst/gst.h>
 #include <gst/video/gstvideometa.h>
 #include <gst/video/video.h>
@@ -271,75 +274,76 @@ static GstFlowReturn gst_gvadeskew_transform_frame(GstVideoFilter *filter, GstVi
     GstGvaDeskew *self = GST_GVADESKEW(filter);
     cv::Mat K = self->K.empty() ? DEFAULT_INTRINSICS : self->K;
 
-    GstMeta *meta;
+    // Regions are enumerated by object detection metadata, ROI meta is absent if regions are stored in analytics
+    // metadata only
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(inframe->buffer);
+    GstAnalyticsODMtd od_mtd;
     gpointer state = NULL;
-    while ((meta = gst_buffer_iterate_meta(inframe->buffer, &state))) {
-        if (meta->info->api == GST_VIDEO_REGION_OF_INTEREST_META_API_TYPE) {
-            GstVideoRegionOfInterestMeta *roi_meta = (GstVideoRegionOfInterestMeta *)meta;
-            for (GList *l = roi_meta->params; l != NULL; l = l->next) {
-                GstStructure *structure = (GstStructure *)l->data;
-                if (g_strcmp0(gst_structure_get_name(structure), "detection") == 0) {
-                    // 1. Extract normalized ROI coordinates
-                    double x_min = 0, x_max = 0, y_min = 0, y_max = 0;
-                    gst_structure_get_double(structure, "x_min", &x_min);
-                    gst_structure_get_double(structure, "x_max", &x_max);
-                    gst_structure_get_double(structure, "y_min", &y_min);
-                    gst_structure_get_double(structure, "y_max", &y_max);
-
-                    int roi_x = static_cast<int>(x_min * width);
-                    int roi_y = static_cast<int>(y_min * height);
-                    int roi_w = static_cast<int>((x_max - x_min) * width);
-                    int roi_h = static_cast<int>((y_max - y_min) * height);
-
-                    // 2. Extract extra_params_json
-                    std::vector<float> translation, rotation, dimension;
-                    if (gst_structure_has_field(structure, "extra_params_json")) {
-                        const GValue *val = gst_structure_get_value(structure, "extra_params_json");
-                        if (G_VALUE_HOLDS_STRING(val)) {
-                            const gchar *json_str = g_value_get_string(val);
-                            if (json_str && strlen(json_str) > 0) {
-                                try {
-                                    nlohmann::json root = nlohmann::json::parse(json_str);
-                                    if (root.contains("translation") && root["translation"].is_array())
-                                        for (const auto &v : root["translation"])
-                                            translation.push_back(v.get<float>());
-                                    if (root.contains("rotation") && root["rotation"].is_array())
-                                        for (const auto &v : root["rotation"])
-                                            rotation.push_back(v.get<float>());
-                                    if (root.contains("dimension") && root["dimension"].is_array())
-                                        for (const auto &v : root["dimension"])
-                                            dimension.push_back(v.get<float>());
-                                } catch (const std::exception &e) {
-                                    g_print("gvadeskew: Failed to parse extra_params_json: %s\n", e.what());
-                                }
-                            }
-                        }
+    while (relation_meta &&
+           gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
+        GVA::RegionOfInterest region(od_mtd,
+                                     gst_buffer_get_video_region_of_interest_meta_id(inframe->buffer, od_mtd.id));
+        GstStructure *structure = region.get_param("detection");
+        if (!structure)
+            continue;
+
+        // 1. Extract normalized ROI coordinates
+        double x_min = 0, x_max = 0, y_min = 0, y_max = 0;
+        gst_structure_get_double(structure, "x_min", &x_min);
+        gst_structure_get_double(structure, "x_max", &x_max);
+        gst_structure_get_double(structure, "y_min", &y_min);
+        gst_structure_get_double(structure, "y_max", &y_max);
+
+        int roi_x = static_cast<int>(x_min * width);
+        int roi_y = static_cast<int>(y_min * height);
+        int roi_w = static_cast<int>((x_max - x_min) * width);
+        int roi_h = static_cast<int>((y_max - y_min) * height);
+
+        // 2. Extract extra_params_json
+        std::vector<float> translation, rotation, dimension;
+        if (gst_structure_has_field(structure, "extra_params_json")) {
+            const GValue *val = gst_structure_get_value(structure, "extra_params_json");
+            if (G_VALUE_HOLDS_STRING(val)) {
+                const gchar *json_str = g_value_get_string(val);
+                if (json_str && strlen(json_str) > 0) {
+                    try {
+                        nlohmann::json root = nlohmann::json::parse(json_str);
+                        if (root.contains("translation") && root["translation"].is_array())
+                            for (const auto &v : root["translation"])
+                                translation.push_back(v.get<float>());
+                        if (root.contains("rotation") && root["rotation"].is_array())
+                            for (const auto &v : root["rotation"])
+                                rotation.push_back(v.get<float>());
+                        if (root.contains("dimension") && root["dimension"].is_array())
+                            for (const auto &v : root["dimension"])
+                                dimension.push_back(v.get<float>());
+                    } catch (const std::exception &e) {
+                        g_print("gvadeskew: Failed to parse extra_params_json: %s\n", e.what());
                     }
+                }
+            }
+        }
 
-                    // 3. Only process if all params are present and ROI is valid
-                    if (translation.size() == 3 && rotation.size() == 4 && dimension.size() == 3 && roi_w > 0 &&
-                        roi_h > 0 && roi_x >= 0 && roi_y >= 0 && roi_x + roi_w <= width && roi_y + roi_h <= height) {
-
-                        // --- Draw the closest face quadrangle using helpers ---
-                        std::vector<cv::Point2f> face_points;
-                        if (get_closest_face_points(translation, rotation, dimension, K, face_points)) {
-                            bool all_inside = true;
-                            for (const auto &pt : face_points) {
-                                if (pt.x < 0 || pt.x >= width || pt.y < 0 || pt.y >= height) {
-                                    all_inside = false;
-                                    break;
-                                }
-                            }
-                            if (all_inside) {
-                                cv::Rect destinationRect(roi_x, roi_y, roi_w, roi_h);
-                                deskewAndPasteFace(output, translation, rotation, dimension, K, face_points,
-                                                   destinationRect);
-                            }
-                        } else {
-                            g_print("gvadeskew: Failed to get closest face points\n");
-                        }
+        // 3. Only process if all params are present and ROI is valid
+        if (translation.size() == 3 && rotation.size() == 4 && dimension.size() == 3 && roi_w > 0 && roi_h > 0 &&
+            roi_x >= 0 && roi_y >= 0 && roi_x + roi_w <= width && roi_y + roi_h <= height) {
+
+            // --- Draw the closest face quadrangle using helpers ---
+            std::vector<cv::Point2f> face_points;
+            if (get_closest_face_points(translation, rotation, dimension, K, face_points)) {
+                bool all_inside = true;
+                for (const auto &pt : face_points) {
+                    if (pt.x < 0 || pt.x >= width || pt.y < 0 || pt.y >= height) {
+                        all_inside = false;
+                        break;
                     }
                 }
+                if (all_inside) {
+                    cv::Rect destinationRect(roi_x, roi_y, roi_w, roi_h);
+                    deskewAndPasteFace(output, translation, rotation, dimension, K, face_points, destinationRect);
+                }
+            } else {
+                g_print("gvadeskew: Failed to get closest face points\n");
             }
         }
     }
@@ -10,7 +10,9 @@
 #include "gst/analytics/gstanalyticsclassificationmtd.h"
 #include "gst/gstclock.h"
 #include "gst/gstinfo.h"
+#include "gva_utils.h"
 #include "utils.h"
+#include <dlstreamer/gst/metadata/gstanalyticsparammtd.h>
 #include <gst/gst.h>
 #include <gstanalyticskeypointsmtd.h>
 
@@ -203,6 +205,13 @@ gboolean copy_one_gst_analytics_mtd(GstAnalyticsRelationMeta *dst, const GstAnal
             GST_ERROR("Failed to add GstAnalyticsTrackingMtd to GstAnalyticsRelationMeta");
             return FALSE;
         }
+    } else if (mtd_type == gst_analytics_param_mtd_get_mtd_type()) {
+        // Params of region stored in analytics metadata only. Detection coordinates are normalized, no scaling needed
+        GstStructure *params = gst_analytics_param_mtd_get_params(mtd);
+        if (!params || !gst_analytics_relation_meta_add_param_mtd(dst, gst_structure_copy(params), new_mtd)) {
+            GST_ERROR("Failed to add GstAnalyticsParamMtd to GstAnalyticsRelationMeta");
+            return FALSE;
+        }
     } else if (mtd_type == gst_analytics_keypoint_mtd_get_mtd_type()) {
         return FALSE; // Keypoint mtds are copied as part of keypoint group mtd
     } else if (mtd_type == gst_analytics_segmentation_mtd_get_mtd_type()) {
@@ -397,9 +406,8 @@ GstFlowReturn gst_gva_meta_aggregate_fill_queues(GstGvaMetaAggregate *gvametaagg
             eos = FALSE;
         buf = gst_aggregator_pad_peek_buffer(bpad);
         if (buf) {
-            if (!gst_buffer_is_writable(buf)) {
-                buf = gst_buffer_make_writable(buf);
-            }
+            /* Metas of the buffer are aggregated in place, its memory is not written */
+            gva_buffer_make_metadata_writable(&buf, __func__);
             GstClockTime start_time, end_time;
 
             start_time = GST_BUFFER_TIMESTAMP(buf);
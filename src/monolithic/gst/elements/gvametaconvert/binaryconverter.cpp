@@ -0,0 +1,322 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "binaryconverter.h"
+#include "gva_binary_format.h"
+#include "gva_utils.h"
+#include "mask_codec.h"
+#include "video_frame.h"
+#include <utils.h>
+
+#include <memory>
+#include <vector>
+
+GST_DEBUG_CATEGORY_STATIC(gst_binary_converter_debug);
+#define GST_CAT_DEFAULT gst_binary_converter_debug
+
+using namespace dlstreamer::binary_meta;
+
+namespace {
+
+constexpr size_t INITIAL_RECORD_CAPACITY = 512;
+
+void write_tensor(Writer &writer, const GVA::Tensor &tensor) {
+    const std::string model = tensor.model_name();
+    const std::string layer = tensor.layer_name();
+    const std::string format = tensor.format();
+    const std::string label = tensor.is_detection() ? std::string() : tensor.label();
+    const std::string encoding = tensor.get_string(MaskCodec::ENCODING_FIELD);
+
+    uint8_t fields = 0;
+    if (!model.empty())
+        fields |= RESULT_HAS_MODEL;
+    if (!layer.empty())
+        fields |= RESULT_HAS_LAYER;
+    if (!format.empty())
+        fields |= RESULT_HAS_FORMAT;
+    if (!label.empty())
+        fields |= RESULT_HAS_LABEL;
+    if (tensor.has_field("confidence"))
+        fields |= RESULT_HAS_CONFIDENCE;
+    if (tensor.has_field("label_id"))
+        fields |= RESULT_HAS_LABEL_ID;
+    if (!encoding.empty())
+        fields |= RESULT_HAS_ENCODING;
+
+    writer.u8(fields);
+    writer.str(tensor.name());
+    if (fields & RESULT_HAS_MODEL)
+        writer.str(model);
+    if (fields & RESULT_HAS_LAYER)
+        writer.str(layer);
+    if (fields & RESULT_HAS_FORMAT)
+        writer.str(format);
+    if (fields & RESULT_HAS_LABEL)
+        writer.str(label);
+    if (fields & RESULT_HAS_CONFIDENCE)
+        writer.f32(static_cast<float>(tensor.confidence()));
+    if (fields & RESULT_HAS_LABEL_ID)
+        writer.svar(tensor.get_int("label_id"));
+    if (fields & RESULT_HAS_ENCODING)
+        writer.str(encoding);
+    writer.u8(static_cast<uint8_t>(tensor.precision()));
+    writer.u8(static_cast<uint8_t>(tensor.layout()));
+
+    const std::vector<guint> dims = tensor.has_field("dims") ? tensor.dims() : std::vector<guint>();
+    writer.uvar(dims.size());
+    for (guint dim : dims)
+        writer.uvar(dim);
+
+    // Raw blob is copied as is, without per-element conversion
+    gsize size = 0;
+    const void *data = gva_get_tensor_data(tensor.gst_structure(), &size);
+    writer.blob(data, data ? size : 0);
+}
+
+void write_classification(Writer &writer, const char *attribute, const char *label, const char *model,
+                          const double *confidence, const int *label_id) {
+    uint8_t fields = 0;
+    if (model)
+        fields |= RESULT_HAS_MODEL;
+    if (confidence)
+        fields |= RESULT_HAS_CONFIDENCE;
+    if (label_id)
+        fields |= RESULT_HAS_LABEL_ID;
+    writer.u8(fields);
+    writer.str(attribute, strlen(attribute));
+    writer.str(label ? label : "", label ? strlen(label) : 0);
+    if (model)
+        writer.str(model, strlen(model));
+    if (confidence)
+        writer.f32(static_cast<float>(*confidence));
+    if (label_id)
+        writer.svar(*label_id);
+}
+
+/**
+ * Writes ROI in the same shape as jsonconverter's convert_roi_detection: rectangle, ids, detection result,
+ * classification results and (optionally) tensors.
+ */
+void write_roi(GstGvaMetaConvert *converter, Writer &writer, GVA::RegionOfInterest &roi) {
+    GstStructure *detection = nullptr;
+    std::vector<GstStructure *> classifications;
+    GList *params = roi.get_params();
+    size_t params_count = 0;
+    for (GList *l = params; l; l = g_list_next(l), ++params_count) {
+        GstStructure *s = GST_STRUCTURE(l->data);
+        if (gst_structure_has_name(s, "detection")) {
+            if (gst_structure_has_field(s, "x_min") && gst_structure_has_field(s, "x_max") &&
+                gst_structure_has_field(s, "y_min") && gst_structure_has_field(s, "y_max"))
+                detection = s;
+        } else if (gst_structure_has_field(s, "label") && gst_structure_has_field(s, "model_name")) {
+            classifications.push_back(s);
+        }
+    }
+
+    const auto rect = roi.rect();
+    const gint object_id = roi.object_id();
+    const gint parent_id = roi.parent_id();
+    const std::string label = roi.label();
+
+    uint8_t fields = 0;
+    if (parent_id >= 0)
+        fields |= OBJECT_HAS_PARENT_ID;
+    if (object_id != 0)
+        fields |= OBJECT_HAS_OBJECT_ID;
+    if (!label.empty())
+        fields |= OBJECT_HAS_LABEL;
+    if (detection)
+        fields |= OBJECT_HAS_DETECTION;
+
+    writer.u8(fields);
+    writer.svar(rect.x);
+    writer.svar(rect.y);
+    writer.svar(rect.w);
+    writer.svar(rect.h);
+    writer.svar(roi.region_id());
+    if (fields & OBJECT_HAS_PARENT_ID)
+        writer.svar(parent_id);
+    if (fields & OBJECT_HAS_OBJECT_ID)
+        writer.svar(object_id);
+    if (fields & OBJECT_HAS_LABEL)
+        writer.str(label);
+
+    if (detection) {
+        double x_min = 0, x_max = 0, y_min = 0, y_max = 0, confidence = 0;
+        int label_id = 0;
+        gst_structure_get(detection, "x_min", G_TYPE_DOUBLE, &x_min, "x_max", G_TYPE_DOUBLE, &x_max, "y_min",
+                          G_TYPE_DOUBLE, &y_min, "y_max", G_TYPE_DOUBLE, &y_max, NULL);
+        uint8_t dfields = 0;
+        if (gst_structure_get_double(detection, "confidence", &confidence))
+            dfields |= RESULT_HAS_CONFIDENCE;
+        if (gst_structure_get_int(detection, "label_id", &label_id))
+            dfields |= RESULT_HAS_LABEL_ID;
+        writer.u8(dfields);
+        writer.f32(static_cast<float>(x_min));
+        writer.f32(static_cast<float>(x_max));
+        writer.f32(static_cast<float>(y_min));
+        writer.f32(static_cast<float>(y_max));
+        if (dfields & RESULT_HAS_CONFIDENCE)
+            writer.f32(static_cast<float>(confidence));
+        if (dfields & RESULT_HAS_LABEL_ID)
+            writer.svar(label_id);
+    }
+
+    writer.uvar(classifications.size());
+    for (GstStructure *s : classifications) {
+        const gchar *attribute = gst_structure_get_string(s, "attribute_name");
+        if (!attribute)
+            attribute = gst_structure_get_name(s);
+        double confidence;
+        int label_id;
+        bool has_confidence = gst_structure_get_double(s, "confidence", &confidence);
+        bool has_label_id = gst_structure_get_int(s, "label_id", &label_id);
+        write_classification(writer, attribute, gst_structure_get_string(s, "label"),
+                             gst_structure_get_string(s, "model_name"), has_confidence ? &confidence : nullptr,
+                             has_label_id ? &label_id : nullptr);
+    }
+
+    if (converter->add_tensor_data) {
+        writer.uvar(params_count);
+        for (GList *l = params; l; l = g_list_next(l))
+            write_tensor(writer, GVA::Tensor(GST_STRUCTURE(l->data)));
+    } else {
+        writer.uvar(0);
+    }
+}
+
+/**
+ * Writes full-frame classification results as an object covering the whole frame, as jsonconverter does.
+ */
+void write_frame_classification(GstGvaMetaConvert *converter, Writer &writer, std::vector<GVA::Tensor> &tensors) {
+    std::vector<GVA::Tensor *> classifications;
+    for (auto &tensor : tensors)
+        if (tensor.has_field("label") || tensor.has_field("label_id"))
+            classifications.push_back(&tensor);
+
+    writer.u8(0);
+    writer.svar(0);
+    writer.svar(0);
+    writer.svar(converter->info->width);
+    writer.svar(converter->info->height);
+    writer.svar(0);
+
+    writer.uvar(classifications.size());
+    for (GVA::Tensor *tensor : classifications) {
+        const std::string label = tensor->label();
+        const std::string model_name = tensor->model_name();
+        const std::string attribute =
+            tensor->has_field("attribute_name") ? tensor->get_string("attribute_name") : tensor->name();
+        double confidence = tensor->has_field("confidence") ? tensor->confidence() : 0;
+        int label_id = tensor->has_field("label_id") ? tensor->get_int("label_id") : 0;
+        write_classification(writer, attribute.c_str(), label.c_str(),
+                             model_name.empty() ? nullptr : model_name.c_str(),
+                             tensor->has_field("confidence") ? &confidence : nullptr,
+                             tensor->has_field("label_id") ? &label_id : nullptr);
+    }
+
+    if (converter->add_tensor_data) {
+        writer.uvar(tensors.size());
+        for (const auto &tensor : tensors)
+            write_tensor(writer, tensor);
+    } else {
+        writer.uvar(0);
+    }
+}
+
+void write_frame(GstGvaMetaConvert *converter, GstBuffer *buffer, std::vector<GVA::RegionOfInterest> &regions,
+                 std::vector<GVA::Tensor> &tensors, const std::vector<GVA::Tensor *> &raw_tensors, Writer &writer) {
+    GstSegment converter_segment = converter->base_gvametaconvert.segment;
+    GstClockTime timestamp = gst_segment_to_stream_time(&converter_segment, GST_FORMAT_TIME, buffer->pts);
+
+    uint8_t fields = FRAME_HAS_RESOLUTION;
+    if (timestamp != G_MAXUINT64)
+        fields |= FRAME_HAS_TIMESTAMP;
+    if (converter->source)
+        fields |= FRAME_HAS_SOURCE;
+    if (converter->tags)
+        fields |= FRAME_HAS_TAGS;
+
+    writer.begin_record();
+    writer.u8(fields);
+    if (fields & FRAME_HAS_TIMESTAMP)
+        writer.uvar(timestamp);
+    writer.uvar(converter->info->width);
+    writer.uvar(converter->info->height);
+    if (fields & FRAME_HAS_SOURCE)
+        writer.str(converter->source, strlen(converter->source));
+    if (fields & FRAME_HAS_TAGS)
+        writer.str(converter->tags, strlen(converter->tags));
+
+    writer.uvar(regions.size() + (tensors.empty() ? 0 : 1));
+    for (auto &roi : regions)
+        write_roi(converter, writer, roi);
+    if (!tensors.empty())
+        write_frame_classification(converter, writer, tensors);
+
+    writer.uvar(raw_tensors.size());
+    for (const GVA::Tensor *tensor : raw_tensors)
+        write_tensor(writer, *tensor);
+    writer.end_record();
+}
+
+} // namespace
+
+gboolean to_binary(GstGvaMetaConvert *converter, GstBuffer *buffer) {
+    GST_DEBUG_CATEGORY_INIT(gst_binary_converter_debug, "binaryconverter", 0, "Binary converter");
+
+    if (!converter) {
+        GST_ERROR("Failed convert to binary: GvaMetaConvert is null");
+        return FALSE;
+    }
+
+    if (!buffer) {
+        GST_ERROR_OBJECT(converter, "Failed convert to binary: GstBuffer is null");
+        return FALSE;
+    }
+
+    if (!converter->info) {
+        GST_WARNING_OBJECT(converter, "Binary format is supported for video streams only");
+        return TRUE;
+    }
+
+    try {
+        GVA::VideoFrame video_frame(buffer, converter->info);
+        std::vector<GVA::RegionOfInterest> regions = video_frame.regions();
+        std::vector<GVA::Tensor> tensors = video_frame.tensors();
+        std::vector<GVA::Tensor *> raw_tensors;
+        if (converter->add_tensor_data) {
+            for (auto &tensor : tensors)
+                if (!tensor.has_field("type"))
+                    raw_tensors.push_back(&tensor);
+        }
+
+        if (regions.empty() && tensors.empty() && !converter->add_empty_detection_results) {
+            GST_DEBUG_OBJECT(converter, "No detections found. Not posting binary message");
+            return TRUE;
+        }
+
+        // Serialize straight into heap storage which is then owned by GBytes, so the record is never copied
+        auto record = std::make_unique<std::vector<uint8_t>>();
+        record->reserve(INITIAL_RECORD_CAPACITY);
+        Writer writer(*record);
+        write_frame(converter, buffer, regions, tensors, raw_tensors, writer);
+
+        GST_DEBUG_OBJECT(converter, "Binary message: %zu bytes", record->size());
+        auto *storage = record.release();
+        GBytes *bytes = g_bytes_new_with_free_func(
+            storage->data(), storage->size(),
+            [](gpointer data) { delete static_cast<std::vector<uint8_t> *>(data); }, storage);
+
+        GstGVABinaryMeta *meta = GST_GVA_BINARY_META_ADD(buffer);
+        gst_gva_binary_meta_set_message(meta, bytes);
+        g_bytes_unref(bytes);
+    } catch (const std::exception &e) {
+        GST_ERROR_OBJECT(converter, "%s", Utils::createNestedErrorMsg(e).c_str());
+        return FALSE;
+    }
+    return TRUE;
+}
@@ -0,0 +1,18 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "gstgvametaconvert.h"
+#include "gva_binary_meta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+gboolean to_binary(GstGvaMetaConvert *converter, GstBuffer *buffer);
+
+#ifdef __cplusplus
+} /* extern C */
+#endif /* __cplusplus */
@@ -6,6 +6,8 @@
 
 #include "convert_tensor.h"
 
+#include "mask_codec.h"
+
 using json = nlohmann::json;
 
 template <typename T>
@@ -85,8 +87,20 @@ json convert_tensor(const GVA::Tensor &s_tensor) {
         jobject.push_back(json::object_t::value_type("label_id", s_tensor.get_int("label_id")));
     }
 
+    const std::string encoding_value = s_tensor.get_string(MaskCodec::ENCODING_FIELD);
+    if (!encoding_value.empty()) {
+        jobject.push_back(json::object_t::value_type(MaskCodec::ENCODING_FIELD, encoding_value));
+    }
+
     json data_array;
-    if (s_tensor.precision() == GVA::Tensor::Precision::U8) {
+    if (encoding_value == MaskCodec::RLE) {
+        // RLE masks are published as flat list of (value, length) pairs
+        const std::vector<uint8_t> data = s_tensor.data<uint8_t>();
+        for (const auto &run : MaskCodec::decodeRleRuns(data.data(), data.size())) {
+            data_array += run.first;
+            data_array += run.second;
+        }
+    } else if (s_tensor.precision() == GVA::Tensor::Precision::U8) {
         const std::vector<uint8_t> data = s_tensor.data<uint8_t>();
         for (const auto &val : data) {
             data_array += val;
@@ -55,6 +55,7 @@ GHashTable *get_converters() {
 
     g_hash_table_insert(converters, GINT_TO_POINTER(GST_GVA_METACONVERT_JSON), (gpointer)to_json);
     g_hash_table_insert(converters, GINT_TO_POINTER(GST_GVA_METACONVERT_DUMP_DETECTION), (gpointer)dump_detection);
+    g_hash_table_insert(converters, GINT_TO_POINTER(GST_GVA_METACONVERT_BINARY), (gpointer)to_binary);
 
     return converters;
 }
\ No newline at end of file
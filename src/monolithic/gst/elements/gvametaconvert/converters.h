@@ -10,6 +10,7 @@
 #include <gst/gst.h>
 #include <string.h>
 
+#include "binaryconverter.h"
 #include "gstgvametaconvert.h"
 #include "jsonconverter.h"
 
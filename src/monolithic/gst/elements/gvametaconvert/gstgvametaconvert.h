@@ -32,6 +32,7 @@ typedef gboolean (*convert_function_type)(GstGvaMetaConvert *converter, GstBuffe
 typedef enum {
     GST_GVA_METACONVERT_JSON,
     GST_GVA_METACONVERT_DUMP_DETECTION,
+    GST_GVA_METACONVERT_BINARY,
 } GstGVAMetaconvertFormatType;
 
 struct _GstGvaMetaConvert {
@@ -17,6 +17,8 @@ const gchar *file_format_to_string(FileFormat format) {
         return FILE_FORMAT_JSON_NAME;
     case GVA_META_PUBLISH_JSON_LINES:
         return FILE_FORMAT_JSON_LINES_NAME;
+    case GVA_META_PUBLISH_BINARY:
+        return FILE_FORMAT_BINARY_NAME;
     default:
         return UNKNOWN_VALUE_NAME;
     }
@@ -29,6 +31,8 @@ GType gva_metapublish_file_format_get_type(void) {
          FILE_FORMAT_JSON_NAME},
         {GVA_META_PUBLISH_JSON_LINES, "each line is valid JSON with inference results per frame",
          FILE_FORMAT_JSON_LINES_NAME},
+        {GVA_META_PUBLISH_BINARY, "concatenated binary records produced by gvametaconvert format=binary",
+         FILE_FORMAT_BINARY_NAME},
         {0, nullptr, nullptr}};
 
     if (!gva_metapublish_file_format_type) {
@@ -37,3 +41,34 @@ GType gva_metapublish_file_format_get_type(void) {
 
     return gva_metapublish_file_format_type;
 }
+
+GType gva_metapublish_drop_policy_get_type(void) {
+    static GType gva_metapublish_drop_policy_type = 0;
+    static const GEnumValue drop_policy_types[] = {
+        {GVA_META_PUBLISH_DROP_OLDEST, "drop the oldest queued messages when the queue is full",
+         DROP_POLICY_OLDEST_NAME},
+        {GVA_META_PUBLISH_DROP_NEWEST, "drop incoming messages when the queue is full", DROP_POLICY_NEWEST_NAME},
+        {0, nullptr, nullptr}};
+
+    if (!gva_metapublish_drop_policy_type) {
+        gva_metapublish_drop_policy_type = g_enum_register_static("GvaMetaPublishDropPolicy", drop_policy_types);
+    }
+
+    return gva_metapublish_drop_policy_type;
+}
+
+GType gva_metapublish_key_mode_get_type(void) {
+    static GType gva_metapublish_key_mode_type = 0;
+    static const GEnumValue key_mode_types[] = {
+        {GVA_META_PUBLISH_KEY_NONE, "messages are not keyed and are spread over partitions", KEY_MODE_NONE_NAME},
+        {GVA_META_PUBLISH_KEY_STREAM_ID, "messages are keyed by stream-id, so each stream keeps its partition",
+         KEY_MODE_STREAM_ID_NAME},
+        {GVA_META_PUBLISH_KEY_CUSTOM, "messages are keyed by value of 'key' property", KEY_MODE_CUSTOM_NAME},
+        {0, nullptr, nullptr}};
+
+    if (!gva_metapublish_key_mode_type) {
+        gva_metapublish_key_mode_type = g_enum_register_static("GvaMetaPublishKeyMode", key_mode_types);
+    }
+
+    return gva_metapublish_key_mode_type;
+}
@@ -11,7 +11,15 @@
 GST_EXPORT GstStaticPadTemplate gva_meta_publish_sink_template;
 GST_EXPORT GstStaticPadTemplate gva_meta_publish_src_template;
 
-typedef enum { GVA_META_PUBLISH_JSON = 1, GVA_META_PUBLISH_JSON_LINES = 2 } FileFormat;
+typedef enum { GVA_META_PUBLISH_JSON = 1, GVA_META_PUBLISH_JSON_LINES = 2, GVA_META_PUBLISH_BINARY = 3 } FileFormat;
+
+typedef enum { GVA_META_PUBLISH_DROP_OLDEST = 1, GVA_META_PUBLISH_DROP_NEWEST = 2 } DropPolicy;
+
+typedef enum {
+    GVA_META_PUBLISH_KEY_NONE = 1,
+    GVA_META_PUBLISH_KEY_STREAM_ID = 2,
+    GVA_META_PUBLISH_KEY_CUSTOM = 3
+} KeyMode;
 
 // File specific constants
 constexpr auto STDOUT = "stdout";
@@ -27,6 +35,14 @@ constexpr auto PUBLISH_METHOD_KAFKA_NAME = "kafka";
 
 constexpr auto FILE_FORMAT_JSON_NAME = "json";
 constexpr auto FILE_FORMAT_JSON_LINES_NAME = "json-lines";
+constexpr auto FILE_FORMAT_BINARY_NAME = "binary";
+
+constexpr auto DROP_POLICY_OLDEST_NAME = "drop-oldest";
+constexpr auto DROP_POLICY_NEWEST_NAME = "drop-newest";
+
+constexpr auto KEY_MODE_NONE_NAME = "none";
+constexpr auto KEY_MODE_STREAM_ID_NAME = "stream-id";
+constexpr auto KEY_MODE_CUSTOM_NAME = "custom";
 
 // Broker specific constants
 constexpr auto DEFAULT_ADDRESS = "";
@@ -40,7 +56,28 @@ constexpr auto DEFAULT_SIGNAL_HANDOFFS = false;
 constexpr auto DEFAULT_MAX_CONNECT_ATTEMPTS = 1;
 constexpr auto DEFAULT_MAX_RECONNECT_INTERVAL = 30;
 
+// Publish queue constants
+constexpr auto DEFAULT_MAX_INFLIGHT = 10;
+constexpr auto DEFAULT_BATCH_SIZE = 1;
+constexpr auto DEFAULT_BATCH_TIMEOUT = 100;
+constexpr auto DEFAULT_MAX_QUEUE_SIZE = 1000;
+constexpr auto DEFAULT_SPILL_FILE = "";
+constexpr auto DEFAULT_MAX_SPILL_SIZE = 0; // megabytes, unlimited
+constexpr auto DEFAULT_DROP_POLICY = GVA_META_PUBLISH_DROP_OLDEST;
+
+// Kafka producer constants, defaults match librdkafka defaults
+constexpr auto DEFAULT_KEY_MODE = GVA_META_PUBLISH_KEY_NONE;
+constexpr auto DEFAULT_KEY = "";
+constexpr auto DEFAULT_LINGER_MS = 5;
+constexpr auto DEFAULT_KAFKA_BATCH_SIZE = 1000000;
+
 GST_EXPORT const gchar *file_format_to_string(FileFormat format);
 
 GST_EXPORT GType gva_metapublish_file_format_get_type(void);
 #define GST_TYPE_GVA_METAPUBLISH_FILE_FORMAT (gva_metapublish_file_format_get_type())
+
+GST_EXPORT GType gva_metapublish_drop_policy_get_type(void);
+#define GST_TYPE_GVA_METAPUBLISH_DROP_POLICY (gva_metapublish_drop_policy_get_type())
+
+GST_EXPORT GType gva_metapublish_key_mode_get_type(void);
+#define GST_TYPE_GVA_METAPUBLISH_KEY_MODE (gva_metapublish_key_mode_get_type())
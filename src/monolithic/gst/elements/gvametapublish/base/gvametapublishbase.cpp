@@ -7,9 +7,13 @@
 #include "gvametapublishbase.hpp"
 #include "common.hpp"
 
+#include <gva_binary_meta.h>
 #include <gva_json_meta.h>
 #include <utils.h>
 
+#include <cstring>
+#include <string>
+
 GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_base_debug_category);
 #define GST_CAT_DEFAULT gva_meta_publish_base_debug_category
 
@@ -64,23 +68,56 @@ class GvaMetaPublishBasePrivate {
             GST_DEBUG_OBJECT(_base, "Signal handoffs");
             g_signal_emit(_base, gst_interpret_signals[SIGNAL_HANDOFF], 0, buf);
         }
-        if (!json_meta || !json_meta->message) {
-            GST_DEBUG_OBJECT(_base, "No JSON metadata");
+        auto binary_meta = GST_GVA_BINARY_META_GET(buf);
+        if (!(json_meta && json_meta->message) && !(binary_meta && binary_meta->message)) {
+            GST_DEBUG_OBJECT(_base, "No JSON or binary metadata");
             return GST_FLOW_OK;
         }
 
         GvaMetaPublishBaseClass *klass = GVA_META_PUBLISH_BASE_GET_CLASS(_base);
-        if (!klass->publish(GVA_META_PUBLISH_BASE(_base), std::string(json_meta->message))) {
+        gboolean published;
+        if (klass->publish_bytes) {
+            // Binary message is shared with publisher as is. JSON message is owned by buffer meta and is copied once,
+            // so publisher doesn't keep video buffer alive while message is being delivered.
+            GBytes *message = json_meta && json_meta->message
+                                  ? g_bytes_new(json_meta->message, strlen(json_meta->message))
+                                  : g_bytes_ref(binary_meta->message);
+            published = klass->publish_bytes(GVA_META_PUBLISH_BASE(_base), message,
+                                             _stream_id.empty() ? nullptr : _stream_id.c_str());
+            g_bytes_unref(message);
+        } else {
+            // Message is passed as is, publisher copies it only if it needs the payload after return
+            const gchar *message = nullptr;
+            gsize size = 0;
+            if (json_meta && json_meta->message) {
+                message = json_meta->message;
+                size = strlen(json_meta->message);
+            } else {
+                message = static_cast<const gchar *>(g_bytes_get_data(binary_meta->message, &size));
+            }
+            published = klass->publish(GVA_META_PUBLISH_BASE(_base), message, size);
+        }
+        if (!published) {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Failed to publish message"), (NULL));
             return GST_FLOW_ERROR;
         }
         return GST_FLOW_OK;
     }
 
+    void sink_event(GstEvent *event) {
+        if (GST_EVENT_TYPE(event) != GST_EVENT_STREAM_START)
+            return;
+        const gchar *stream_id = nullptr;
+        gst_event_parse_stream_start(event, &stream_id);
+        _stream_id = stream_id ? stream_id : "";
+        GST_DEBUG_OBJECT(_base, "Stream id: %s", _stream_id.c_str());
+    }
+
   private:
     GstBaseTransform *_base;
 
     bool _signal_handoffs = false;
+    std::string _stream_id;
 };
 
 /* class initialization */
@@ -158,6 +195,10 @@ static void gva_meta_publish_base_class_init(GvaMetaPublishBaseClass *klass) {
     base_transform_class->transform_ip = [](GstBaseTransform *base, GstBuffer *buf) {
         return GVA_META_PUBLISH_BASE(base)->impl->transform_ip(buf);
     };
+    base_transform_class->sink_event = [](GstBaseTransform *base, GstEvent *event) {
+        GVA_META_PUBLISH_BASE(base)->impl->sink_event(event);
+        return GST_BASE_TRANSFORM_CLASS(gva_meta_publish_base_parent_class)->sink_event(base, event);
+    };
 
     g_object_class_install_property(
         gobject_class, PROP_SIGNAL_HANDOFFS,
@@ -9,8 +9,6 @@
 #include "gvametapublish_export.h"
 #include <gst/base/gstbasetransform.h>
 
-#include <string>
-
 G_BEGIN_DECLS
 
 #define GST_TYPE_GVA_META_PUBLISH_BASE (gva_meta_publish_base_get_type())
@@ -32,7 +30,11 @@ struct GvaMetaPublishBaseClass {
     GstBaseTransformClass base;
 
     void (*handoff)(GstElement *element, GstBuffer *buf);
-    gboolean (*publish)(GvaMetaPublishBase *self, const std::string &message);
+    // 'message' is owned by buffer meta and valid only during the call, binary message may contain zero bytes
+    gboolean (*publish)(GvaMetaPublishBase *self, const gchar *message, gsize size);
+    // Optional zero-copy alternative to 'publish'. Publisher takes its own reference on 'message' if it needs the
+    // payload after return. 'stream_id' is stream-id of the sink pad, NULL if not known yet.
+    gboolean (*publish_bytes)(GvaMetaPublishBase *self, GBytes *message, const gchar *stream_id);
 };
 
 GVAMETAPUBLISH_EXPORTS GType gva_meta_publish_base_get_type(void);
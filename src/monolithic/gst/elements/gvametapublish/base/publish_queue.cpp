@@ -0,0 +1,357 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "publish_queue.hpp"
+
+#include <gva_binary_format.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+bool is_binary_record(std::string_view message) {
+    constexpr size_t magic_size = sizeof(dlstreamer::binary_meta::MAGIC);
+    return message.size() >= magic_size &&
+           std::memcmp(message.data(), dlstreamer::binary_meta::MAGIC, magic_size) == 0;
+}
+
+// Spill record: payload size, number of messages, binary flag, creation time, payload
+struct SpillHeader {
+    uint32_t size;
+    uint32_t messages;
+    uint32_t binary;
+    int64_t created;
+};
+
+} // namespace
+
+constexpr std::chrono::milliseconds PublishQueue::RETRY_INTERVAL;
+constexpr std::chrono::milliseconds PublishQueue::MAX_RETRY_INTERVAL;
+
+PublishQueue::PublishQueue(const Config &config, SendFunction send) : _config(config), _send(std::move(send)) {
+    _config.max_inflight = std::max(1u, _config.max_inflight);
+    _config.batch_size = std::max(1u, _config.batch_size);
+    _config.max_queue_size = std::max(1u, _config.max_queue_size);
+}
+
+PublishQueue::~PublishQueue() {
+    stop(std::chrono::milliseconds(0));
+}
+
+bool PublishQueue::start() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_running)
+        return true;
+
+    if (!_config.spill_file.empty()) {
+        _spill.open(_config.spill_file, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!_spill.is_open())
+            return false;
+        _spill_read_pos = 0;
+        _spill_count = 0;
+        _spill_size = 0;
+    }
+
+    _running = true;
+    _stopping = false;
+    _retry_at = Clock::now();
+    _retry_interval = RETRY_INTERVAL;
+    _worker = std::thread(&PublishQueue::run, this);
+    return true;
+}
+
+void PublishQueue::stop(std::chrono::milliseconds flush_timeout) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running)
+            return;
+        _stopping = true;
+        _flush_deadline = Clock::now() + flush_timeout;
+    }
+    _cv.notify_all();
+    if (_worker.joinable())
+        _worker.join();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _running = false;
+    _dropped += _open.messages;
+    _open = Batch();
+    do {
+        for (const auto &batch : _queue)
+            _dropped += batch.messages;
+        _queue.clear();
+        refill_locked();
+    } while (!_queue.empty());
+    if (_spill.is_open())
+        _spill.close();
+}
+
+bool PublishQueue::push(std::string_view message) {
+    bool accepted = true;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_open.messages) {
+            _open.created = Clock::now();
+            _open.binary = is_binary_record(message);
+            _open.payload.reserve(message.size() * _config.batch_size + _config.batch_size);
+        } else if (!_open.binary) {
+            _open.payload += '\n';
+        }
+        _open.payload += message;
+        _open.messages++;
+
+        if (_open.messages < _config.batch_size)
+            return true;
+
+        uint64_t dropped_before = _dropped;
+        seal_locked();
+        accepted = _dropped == dropped_before;
+    }
+    _cv.notify_one();
+    return accepted;
+}
+
+void PublishQueue::set_connected(bool connected) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _connected = connected;
+        if (connected) {
+            _retry_at = Clock::now();
+            _retry_interval = RETRY_INTERVAL;
+        }
+    }
+    _cv.notify_one();
+}
+
+void PublishQueue::on_complete(uint64_t id, bool success) {
+    {
+        std::lock_guard<std::mutex> send_lock(_send_mutex);
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _inflight.find(id);
+        if (it == _inflight.end())
+            return;
+        Batch batch = std::move(it->second);
+        _inflight.erase(it);
+
+        if (success) {
+            double latency_ms = std::chrono::duration<double, std::milli>(Clock::now() - batch.created).count();
+            _latency_sum_ms += latency_ms;
+            _latency_count++;
+            _latency_max_ms = std::max(_latency_max_ms, latency_ms);
+            _published += batch.messages;
+            _retry_interval = RETRY_INTERVAL;
+        } else {
+            // Failed payload goes ahead of queued ones, but may overtake payloads that are still in flight
+            _failed++;
+            _queue.push_front(std::move(batch));
+            backoff_locked();
+        }
+    }
+    _cv.notify_one();
+}
+
+PublishQueue::Stats PublishQueue::stats() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Stats stats;
+    stats.queue_depth = _queue.size() + (_open.messages ? 1 : 0);
+    stats.spilled = _spill_count;
+    stats.inflight = _inflight.size();
+    stats.published = _published;
+    stats.failed = _failed;
+    stats.dropped = _dropped;
+    stats.latency_avg_ms = _latency_count ? _latency_sum_ms / _latency_count : 0.0;
+    stats.latency_max_ms = _latency_max_ms;
+    return stats;
+}
+
+void PublishQueue::run() {
+    const auto batch_timeout = std::chrono::milliseconds(_config.batch_timeout_ms);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        auto now = Clock::now();
+        if (_open.messages && (_stopping || now - _open.created >= batch_timeout))
+            seal_locked();
+        refill_locked();
+
+        bool can_send = _connected && now >= _retry_at && !_queue.empty() && _inflight.size() < _config.max_inflight;
+        if (can_send) {
+            Batch batch = std::move(_queue.front());
+            _queue.pop_front();
+            lock.unlock();
+
+            bool sent;
+            {
+                std::lock_guard<std::mutex> send_lock(_send_mutex);
+                uint64_t id = 0;
+                sent = _send(batch.payload, id);
+                lock.lock();
+                if (sent)
+                    _inflight.emplace(id, std::move(batch));
+            }
+            if (!sent) {
+                _failed++;
+                _queue.push_front(std::move(batch));
+                backoff_locked();
+            }
+            continue;
+        }
+
+        if (_stopping) {
+            bool drained = _queue.empty() && !_spill_count && !_open.messages;
+            if (drained || !_connected || now >= _flush_deadline)
+                break;
+        }
+
+        // Sleep until something is pushed or completed, or until the nearest deadline
+        auto wake_at = Clock::time_point::max();
+        if (_open.messages)
+            wake_at = std::min(wake_at, _open.created + batch_timeout);
+        if (!_queue.empty() && now < _retry_at)
+            wake_at = std::min(wake_at, _retry_at);
+        if (_stopping)
+            wake_at = std::min(wake_at, _flush_deadline);
+        if (wake_at == Clock::time_point::max())
+            _cv.wait(lock);
+        else
+            _cv.wait_until(lock, wake_at);
+    }
+}
+
+void PublishQueue::seal_locked() {
+    Batch batch = std::move(_open);
+    _open = Batch();
+    enqueue_locked(std::move(batch));
+}
+
+bool PublishQueue::enqueue_locked(Batch &&batch) {
+    // Once anything is spilled new payloads go to spill file as well to keep publishing order
+    if (_spill_count || _queue.size() >= _config.max_queue_size) {
+        if (_spill.is_open() && spill_locked(batch))
+            return true;
+
+        if (_config.drop_policy == GVA_META_PUBLISH_DROP_NEWEST) {
+            _dropped += batch.messages;
+            return false;
+        }
+        if (!_queue.empty()) {
+            _dropped += _queue.front().messages;
+            _queue.pop_front();
+        }
+    }
+    _queue.push_back(std::move(batch));
+    return true;
+}
+
+void PublishQueue::backoff_locked() {
+    _retry_at = Clock::now() + _retry_interval;
+    _retry_interval = std::min(2 * _retry_interval, MAX_RETRY_INTERVAL);
+}
+
+bool PublishQueue::spill_locked(const Batch &batch) {
+    const uint64_t record_size = sizeof(SpillHeader) + batch.payload.size();
+    if (_config.max_spill_size) {
+        if (record_size > _config.max_spill_size) {
+            // Doesn't fit even into empty file
+            _dropped += batch.messages;
+            return true;
+        }
+        while (_spill_size + record_size > _config.max_spill_size) {
+            if (!drop_spilled_locked())
+                return false;
+        }
+        // Dropped records stay in the file until their space exceeds the limit
+        if (static_cast<uint64_t>(_spill_read_pos) > _config.max_spill_size)
+            compact_spill_locked();
+    }
+
+    SpillHeader header;
+    header.size = static_cast<uint32_t>(batch.payload.size());
+    header.messages = batch.messages;
+    header.binary = batch.binary;
+    header.created = batch.created.time_since_epoch().count();
+
+    _spill.clear();
+    _spill.seekp(0, std::ios::end);
+    _spill.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    _spill.write(batch.payload.data(), batch.payload.size());
+    _spill.flush();
+    if (!_spill)
+        return false;
+    _spill_count++;
+    _spill_size += record_size;
+    return true;
+}
+
+bool PublishQueue::drop_spilled_locked() {
+    if (!_spill_count)
+        return false;
+    SpillHeader header;
+    _spill.clear();
+    _spill.seekg(_spill_read_pos);
+    _spill.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!_spill)
+        return false;
+    _spill_read_pos += static_cast<std::streamoff>(sizeof(header) + header.size);
+    _spill_size -= sizeof(header) + header.size;
+    _spill_count--;
+    _dropped += header.messages;
+    return true;
+}
+
+void PublishQueue::compact_spill_locked() {
+    std::string records(_spill_size, '\0');
+    _spill.clear();
+    _spill.seekg(_spill_read_pos);
+    _spill.read(&records[0], records.size());
+    const bool read = static_cast<bool>(_spill);
+
+    _spill.close();
+    _spill.open(_config.spill_file, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    _spill_read_pos = 0;
+    if (read)
+        _spill.write(records.data(), records.size());
+    if (!read || !_spill) {
+        // Records can't be kept, they are lost as with damaged file
+        _spill_count = 0;
+        _spill_size = 0;
+    }
+}
+
+void PublishQueue::refill_locked() {
+    while (_spill_count && _queue.size() < _config.max_queue_size) {
+        SpillHeader header;
+        Batch batch;
+        _spill.clear();
+        _spill.seekg(_spill_read_pos);
+        _spill.read(reinterpret_cast<char *>(&header), sizeof(header));
+        if (_spill) {
+            batch.payload.resize(header.size);
+            _spill.read(&batch.payload[0], header.size);
+        }
+        if (!_spill) {
+            // Spill file is damaged, nothing else can be read from it
+            _spill_count = 0;
+            _spill_size = 0;
+            break;
+        }
+        batch.messages = header.messages;
+        batch.binary = header.binary;
+        batch.created = Clock::time_point(Clock::duration(header.created));
+        _spill_read_pos = _spill.tellg();
+        _spill_count--;
+        _spill_size -= sizeof(header) + header.size;
+        _queue.push_back(std::move(batch));
+    }
+
+    if (!_spill_count && _spill.is_open() && _spill_read_pos != std::streampos(0)) {
+        // Everything is read back, start the file over
+        _spill.close();
+        _spill.open(_config.spill_file, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        _spill_read_pos = 0;
+    }
+}
@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "gvametapublish_export.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+/**
+ * Broker-agnostic publishing queue.
+ *
+ * Messages pushed from the streaming thread are coalesced into payloads (up to batch_size messages or batch_timeout_ms
+ * since the first one) and handed to the broker client from a worker thread, keeping at most max_inflight payloads
+ * unacknowledged. While the broker is unreachable payloads wait in a bounded memory queue and, if spill_file is set,
+ * overflow to disk, where the oldest payloads are dropped beyond max_spill_size. When there is no room left messages
+ * are dropped according to drop_policy, so push() never blocks on the broker. Queue starts disconnected, payloads are
+ * sent after set_connected(true). Rejected and failed payloads are retried with exponential backoff.
+ *
+ * JSON messages in one payload are separated by new line (JSON Lines), binary records are concatenated as is.
+ */
+class GVAMETAPUBLISH_EXPORTS PublishQueue {
+  public:
+    struct Config {
+        uint32_t max_inflight = DEFAULT_MAX_INFLIGHT;
+        uint32_t batch_size = DEFAULT_BATCH_SIZE;
+        uint32_t batch_timeout_ms = DEFAULT_BATCH_TIMEOUT;
+        uint32_t max_queue_size = DEFAULT_MAX_QUEUE_SIZE; // payloads kept in memory
+        std::string spill_file;
+        uint64_t max_spill_size = 0; // bytes, oldest spilled payloads are dropped beyond it; 0 for unlimited
+        DropPolicy drop_policy = DEFAULT_DROP_POLICY;
+    };
+
+    struct Stats {
+        uint64_t queue_depth = 0; // payloads waiting in memory, including not yet complete one
+        uint64_t spilled = 0;     // payloads waiting in spill file
+        uint64_t inflight = 0;    // payloads sent but not acknowledged
+        uint64_t published = 0;   // messages acknowledged by broker
+        uint64_t failed = 0;      // payload send attempts rejected or failed, such payloads are retried
+        uint64_t dropped = 0;     // messages dropped because of full queue or spill file, or on stop
+        double latency_avg_ms = 0.0; // from push of the first message in payload to acknowledge
+        double latency_max_ms = 0.0;
+    };
+
+    // Hands payload over to broker client and sets id which is later reported to on_complete(). Returns false if
+    // client didn't accept the payload, in this case it is retried with backoff.
+    using SendFunction = std::function<bool(const std::string &payload, uint64_t &id)>;
+
+    PublishQueue(const Config &config, SendFunction send);
+    ~PublishQueue();
+
+    PublishQueue(const PublishQueue &) = delete;
+    PublishQueue &operator=(const PublishQueue &) = delete;
+
+    // Opens spill file if configured and starts worker thread
+    bool start();
+    // Waits up to flush_timeout while queued payloads are handed to broker client and stops worker thread.
+    // Payloads left in the queue are counted as dropped.
+    void stop(std::chrono::milliseconds flush_timeout);
+
+    // Returns false if message or older queued messages were dropped
+    bool push(std::string_view message);
+    void set_connected(bool connected);
+    void on_complete(uint64_t id, bool success);
+
+    Stats stats() const;
+
+    // Delay before the first retry, doubled on each consecutive failure up to MAX_RETRY_INTERVAL
+    static constexpr std::chrono::milliseconds RETRY_INTERVAL{500};
+    static constexpr std::chrono::milliseconds MAX_RETRY_INTERVAL{30000};
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Batch {
+        std::string payload;
+        uint32_t messages = 0;
+        bool binary = false;
+        Clock::time_point created;
+    };
+
+    void run();
+    void seal_locked();
+    bool enqueue_locked(Batch &&batch);
+    void backoff_locked();
+    bool spill_locked(const Batch &batch);
+    bool drop_spilled_locked();
+    void compact_spill_locked();
+    void refill_locked();
+
+    Config _config;
+    SendFunction _send;
+
+    mutable std::mutex _mutex;
+    // Held while payload is being handed to client, so completion can't overtake registration of in-flight payload
+    std::mutex _send_mutex;
+    std::condition_variable _cv;
+    std::thread _worker;
+    bool _running = false;
+    bool _stopping = false;
+    Clock::time_point _flush_deadline;
+    bool _connected = false;
+    Clock::time_point _retry_at;
+    std::chrono::milliseconds _retry_interval = RETRY_INTERVAL;
+
+    Batch _open;
+    std::deque<Batch> _queue;
+    std::unordered_map<uint64_t, Batch> _inflight;
+
+    std::fstream _spill;
+    std::streampos _spill_read_pos = 0;
+    uint64_t _spill_count = 0;
+    uint64_t _spill_size = 0; // bytes of records not read back yet
+
+    uint64_t _published = 0;
+    uint64_t _failed = 0;
+    uint64_t _dropped = 0;
+    double _latency_sum_ms = 0.0;
+    uint64_t _latency_count = 0;
+    double _latency_max_ms = 0.0;
+};
@@ -52,11 +52,12 @@ class GvaMetaPublishFilePrivate {
         }
     }
 
-    bool write_message(const std::string &message) {
+    bool write_message(const gchar *message, gsize size) {
         if (!_output_file)
             return false;
         write_message_prefix();
-        fputs(message.c_str(), _output_file);
+        // Binary records may contain zero bytes
+        fwrite(message, 1, size, _output_file);
         write_message_suffix();
         fflush(_output_file);
         return true;
@@ -69,7 +70,8 @@ class GvaMetaPublishFilePrivate {
         if (_file_format == GVA_META_PUBLISH_JSON && ftello(_output_file) > 0) {
             fputs("]", _output_file);
         }
-        fputs("\n", _output_file);
+        if (_file_format != GVA_META_PUBLISH_BINARY)
+            fputs("\n", _output_file);
         // For any pathfile we initialized w/ fopen(), invoke corresponding fclose()
         if (_file_path != STDOUT) {
             if (fclose(_output_file) != 0) {
@@ -90,6 +92,10 @@ class GvaMetaPublishFilePrivate {
             }
             // File will be an array of JSON objects. Start the array with '['
             fputs("[", _output_file);
+        } else if (_file_format == GVA_META_PUBLISH_BINARY) {
+            if (!(_output_file = fopen(_file_path.c_str(), "ab"))) {
+                return false;
+            }
         } else { // GVA_META_PUBLISH_JSON_LINES
             if (!(_output_file = fopen(_file_path.c_str(), "a+"))) {
                 return false;
@@ -125,8 +131,8 @@ class GvaMetaPublishFilePrivate {
         return true;
     }
 
-    gboolean publish(const std::string &message) {
-        if (!write_message(message)) {
+    gboolean publish(const gchar *message, gsize size) {
+        if (!write_message(message, size)) {
             GST_ERROR_OBJECT(_base, "Error writing inference to file.");
             return false;
         }
@@ -221,8 +227,8 @@ static void gva_meta_publish_file_class_init(GvaMetaPublishFileClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_FILE(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_FILE(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
-        return GVA_META_PUBLISH_FILE(base)->impl->publish(message);
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const gchar *message, gsize size) {
+        return GVA_META_PUBLISH_FILE(base)->impl->publish(message, size);
     };
 
     gst_element_class_set_static_metadata(GST_ELEMENT_CLASS(klass), "File metadata publisher", "Metadata",
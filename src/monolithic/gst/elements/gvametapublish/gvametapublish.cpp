@@ -47,6 +47,19 @@ enum {
     PROP_PASSWORD,
     PROP_JSON_CONFIG_FILE,
     PROP_SIGNAL_HANDOFFS,
+    PROP_MQTT_MAX_INFLIGHT,
+    PROP_MQTT_BATCH_SIZE,
+    PROP_MQTT_BATCH_TIMEOUT,
+    PROP_MQTT_MAX_QUEUE_SIZE,
+    PROP_MQTT_SPILL_FILE,
+    PROP_MQTT_MAX_SPILL_SIZE,
+    PROP_MQTT_DROP_POLICY,
+    PROP_MQTT_STATS,
+    PROP_KAFKA_KEY_MODE,
+    PROP_KAFKA_KEY,
+    PROP_KAFKA_LINGER_MS,
+    PROP_KAFKA_BATCH_SIZE,
+    PROP_KAFKA_STATS,
 };
 
 class GvaMetaPublishPrivate {
@@ -101,6 +114,39 @@ class GvaMetaPublishPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             _json_config_file = g_value_get_string(value);
             break;
+        case PROP_MQTT_MAX_INFLIGHT:
+            _mqtt_max_inflight = g_value_get_uint(value);
+            break;
+        case PROP_MQTT_BATCH_SIZE:
+            _mqtt_batch_size = g_value_get_uint(value);
+            break;
+        case PROP_MQTT_BATCH_TIMEOUT:
+            _mqtt_batch_timeout = g_value_get_uint(value);
+            break;
+        case PROP_MQTT_MAX_QUEUE_SIZE:
+            _mqtt_max_queue_size = g_value_get_uint(value);
+            break;
+        case PROP_MQTT_SPILL_FILE:
+            _mqtt_spill_file = g_value_get_string(value);
+            break;
+        case PROP_MQTT_MAX_SPILL_SIZE:
+            _mqtt_max_spill_size = g_value_get_uint(value);
+            break;
+        case PROP_MQTT_DROP_POLICY:
+            _mqtt_drop_policy = static_cast<DropPolicy>(g_value_get_enum(value));
+            break;
+        case PROP_KAFKA_KEY_MODE:
+            _kafka_key_mode = static_cast<KeyMode>(g_value_get_enum(value));
+            break;
+        case PROP_KAFKA_KEY:
+            _kafka_key = g_value_get_string(value);
+            break;
+        case PROP_KAFKA_LINGER_MS:
+            _kafka_linger_ms = g_value_get_uint(value);
+            break;
+        case PROP_KAFKA_BATCH_SIZE:
+            _kafka_batch_size = g_value_get_uint(value);
+            break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(G_OBJECT(_base), prop_id, pspec);
             break;
@@ -142,6 +188,47 @@ class GvaMetaPublishPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             g_value_set_string(value, _json_config_file.c_str());
             break;
+        case PROP_MQTT_MAX_INFLIGHT:
+            g_value_set_uint(value, _mqtt_max_inflight);
+            break;
+        case PROP_MQTT_BATCH_SIZE:
+            g_value_set_uint(value, _mqtt_batch_size);
+            break;
+        case PROP_MQTT_BATCH_TIMEOUT:
+            g_value_set_uint(value, _mqtt_batch_timeout);
+            break;
+        case PROP_MQTT_MAX_QUEUE_SIZE:
+            g_value_set_uint(value, _mqtt_max_queue_size);
+            break;
+        case PROP_MQTT_SPILL_FILE:
+            g_value_set_string(value, _mqtt_spill_file.c_str());
+            break;
+        case PROP_MQTT_MAX_SPILL_SIZE:
+            g_value_set_uint(value, _mqtt_max_spill_size);
+            break;
+        case PROP_MQTT_DROP_POLICY:
+            g_value_set_enum(value, _mqtt_drop_policy);
+            break;
+        case PROP_MQTT_STATS:
+            if (_metapublish && _method == GVA_META_PUBLISH_MQTT)
+                g_object_get_property(G_OBJECT(_metapublish), "stats", value);
+            break;
+        case PROP_KAFKA_KEY_MODE:
+            g_value_set_enum(value, _kafka_key_mode);
+            break;
+        case PROP_KAFKA_KEY:
+            g_value_set_string(value, _kafka_key.c_str());
+            break;
+        case PROP_KAFKA_LINGER_MS:
+            g_value_set_uint(value, _kafka_linger_ms);
+            break;
+        case PROP_KAFKA_BATCH_SIZE:
+            g_value_set_uint(value, _kafka_batch_size);
+            break;
+        case PROP_KAFKA_STATS:
+            if (_metapublish && _method == GVA_META_PUBLISH_KAFKA)
+                g_object_get_property(G_OBJECT(_metapublish), "stats", value);
+            break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(G_OBJECT(_base), prop_id, pspec);
             break;
@@ -170,13 +257,18 @@ class GvaMetaPublishPrivate {
                 g_object_set(_metapublish, "address", _address.c_str(), "client-id", _mqtt_client_id.c_str(), "topic",
                              _topic.c_str(), "max-connect-attempts", _max_connect_attempts, "max-reconnect-interval",
                              _max_reconnect_interval, "username", _username.c_str(), "password", _password.c_str(),
-                             "mqtt-config", _json_config_file.c_str(), nullptr);
+                             "mqtt-config", _json_config_file.c_str(), "max-inflight", _mqtt_max_inflight,
+                             "batch-size", _mqtt_batch_size, "batch-timeout", _mqtt_batch_timeout, "max-queue-size",
+                             _mqtt_max_queue_size, "spill-file", _mqtt_spill_file.c_str(), "max-spill-size",
+                             _mqtt_max_spill_size, "drop-policy", _mqtt_drop_policy, nullptr);
             }
             break;
         case GVA_META_PUBLISH_KAFKA:
             if ((_metapublish = gst_element_factory_make("gvametapublishkafka", nullptr)))
                 g_object_set(_metapublish, "address", _address.c_str(), "topic", _topic.c_str(), "max-connect-attempts",
-                             _max_connect_attempts, "max-reconnect-interval", _max_reconnect_interval, nullptr);
+                             _max_connect_attempts, "max-reconnect-interval", _max_reconnect_interval, "key-mode",
+                             _kafka_key_mode, "key", _kafka_key.c_str(), "linger-ms", _kafka_linger_ms, "batch-size",
+                             _kafka_batch_size, nullptr);
             break;
         default:
             GST_ERROR_OBJECT(_base, "Unknown publish method %d (%s)", _method, method_type_to_string(_method));
@@ -229,6 +321,17 @@ class GvaMetaPublishPrivate {
     std::string _password;
     std::string _json_config_file;
     bool _signal_handoffs = false;
+    uint32_t _mqtt_max_inflight = DEFAULT_MAX_INFLIGHT;
+    uint32_t _mqtt_batch_size = DEFAULT_BATCH_SIZE;
+    uint32_t _mqtt_batch_timeout = DEFAULT_BATCH_TIMEOUT;
+    uint32_t _mqtt_max_queue_size = DEFAULT_MAX_QUEUE_SIZE;
+    std::string _mqtt_spill_file;
+    uint32_t _mqtt_max_spill_size = DEFAULT_MAX_SPILL_SIZE;
+    DropPolicy _mqtt_drop_policy = DEFAULT_DROP_POLICY;
+    KeyMode _kafka_key_mode = DEFAULT_KEY_MODE;
+    std::string _kafka_key;
+    uint32_t _kafka_linger_ms = DEFAULT_LINGER_MS;
+    uint32_t _kafka_batch_size = DEFAULT_KAFKA_BATCH_SIZE;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublish, gva_meta_publish, GST_TYPE_BIN, 0, G_ADD_PRIVATE(GvaMetaPublish);
@@ -354,4 +457,71 @@ static void gva_meta_publish_class_init(GvaMetaPublishClass *klass) {
     g_object_class_install_property(gobject_class, PROP_JSON_CONFIG_FILE,
                                     g_param_spec_string("mqtt-config", "Config", "[method= mqtt] MQTT config file",
                                                         DEFAULT_MQTTCONFIG_FILE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_MAX_INFLIGHT,
+                                    g_param_spec_uint("mqtt-max-inflight", "Max In-flight",
+                                                      "[method= mqtt] Maximum number of payloads sent to broker and "
+                                                      "not yet acknowledged",
+                                                      1, G_MAXUINT16, DEFAULT_MAX_INFLIGHT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_BATCH_SIZE,
+                                    g_param_spec_uint("mqtt-batch-size", "Batch Size",
+                                                      "[method= mqtt] Maximum number of frame messages coalesced into "
+                                                      "one MQTT payload. JSON messages are separated by new line",
+                                                      1, 1000, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_BATCH_TIMEOUT,
+                                    g_param_spec_uint("mqtt-batch-timeout", "Batch Timeout",
+                                                      "[method= mqtt] Maximum time in milliseconds a message waits "
+                                                      "for the batch to fill up before the payload is published",
+                                                      0, 60000, DEFAULT_BATCH_TIMEOUT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_MAX_QUEUE_SIZE,
+                                    g_param_spec_uint("mqtt-max-queue-size", "Max Queue Size",
+                                                      "[method= mqtt] Maximum number of payloads kept in memory while "
+                                                      "broker is slow or unavailable",
+                                                      1, G_MAXINT, DEFAULT_MAX_QUEUE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_SPILL_FILE,
+                                    g_param_spec_string("mqtt-spill-file", "Spill File",
+                                                        "[method= mqtt] Path to file where payloads are spilled when "
+                                                        "in-memory queue is full. If not set, drop policy is applied",
+                                                        DEFAULT_SPILL_FILE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_MAX_SPILL_SIZE,
+                                    g_param_spec_uint("mqtt-max-spill-size", "Max Spill Size",
+                                                      "[method= mqtt] Maximum size of spill file in megabytes. The "
+                                                      "oldest spilled payloads are dropped to stay within it. 0 means "
+                                                      "unlimited",
+                                                      0, G_MAXUINT, DEFAULT_MAX_SPILL_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MQTT_DROP_POLICY,
+                                    g_param_spec_enum("mqtt-drop-policy", "Drop Policy",
+                                                      "[method= mqtt] Which messages to drop when the queue is full",
+                                                      GST_TYPE_GVA_METAPUBLISH_DROP_POLICY, DEFAULT_DROP_POLICY,
+                                                      prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_MQTT_STATS,
+        g_param_spec_boxed("mqtt-stats", "Statistics",
+                           "[method= mqtt] Publish queue statistics: queue-depth, spilled, in-flight, published, "
+                           "failed, dropped, latency-avg and latency-max (milliseconds)",
+                           GST_TYPE_STRUCTURE, static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
+    g_object_class_install_property(gobject_class, PROP_KAFKA_KEY_MODE,
+                                    g_param_spec_enum("kafka-key-mode", "Key Mode",
+                                                      "[method= kafka] How messages are keyed. Messages with the same "
+                                                      "key go to the same partition in order",
+                                                      GST_TYPE_GVA_METAPUBLISH_KEY_MODE, DEFAULT_KEY_MODE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_KAFKA_KEY,
+                                    g_param_spec_string("kafka-key", "Key",
+                                                        "[method= kafka] Message key used with kafka-key-mode=custom",
+                                                        DEFAULT_KEY, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_KAFKA_LINGER_MS,
+                                    g_param_spec_uint("kafka-linger-ms", "Linger",
+                                                      "[method= kafka] Time in milliseconds producer waits for "
+                                                      "messages to fill up a batch before sending it to broker",
+                                                      0, 900000, DEFAULT_LINGER_MS, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_KAFKA_BATCH_SIZE,
+                                    g_param_spec_uint("kafka-batch-size", "Batch Size",
+                                                      "[method= kafka] Maximum size in bytes of messages batched in "
+                                                      "one request to broker",
+                                                      1, G_MAXINT, DEFAULT_KAFKA_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_KAFKA_STATS,
+        g_param_spec_boxed("kafka-stats", "Statistics",
+                           "[method= kafka] Delivery statistics: delivered, failed, latency-avg and latency-max "
+                           "(milliseconds)",
+                           GST_TYPE_STRUCTURE, static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
 }
@@ -72,8 +72,11 @@ static void gva_meta_publish_kafka_class_init(GvaMetaPublishKafkaClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_KAFKA(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_KAFKA(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
-        return GVA_META_PUBLISH_KAFKA(base)->impl->publish(message);
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const gchar *message, gsize size) {
+        return GVA_META_PUBLISH_KAFKA(base)->impl->publish(message, size);
+    };
+    base_metapublish_class->publish_bytes = [](GvaMetaPublishBase *base, GBytes *message, const gchar *stream_id) {
+        return GVA_META_PUBLISH_KAFKA(base)->impl->publish_bytes(message, stream_id);
     };
 
     gst_element_class_set_static_metadata(GST_ELEMENT_CLASS(klass), "Kafka metadata publisher", "Metadata",
@@ -97,6 +100,31 @@ static void gva_meta_publish_kafka_class_init(GvaMetaPublishKafkaClass *klass) {
                           "Maximum time in seconds between reconnection attempts. Initial "
                           "interval is 1 second and will be doubled on each failure up to this maximum interval.",
                           1, 300, DEFAULT_MAX_RECONNECT_INTERVAL, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_KEY_MODE,
+        g_param_spec_enum("key-mode", "Key Mode",
+                          "How messages are keyed. Messages with the same key go to the same partition in order",
+                          GST_TYPE_GVA_METAPUBLISH_KEY_MODE, DEFAULT_KEY_MODE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_KEY,
+        g_param_spec_string("key", "Key", "Message key used with key-mode=custom, e.g. camera name", DEFAULT_KEY,
+                            prm_flags));
+    g_object_class_install_property(gobject_class, PROP_LINGER_MS,
+                                    g_param_spec_uint("linger-ms", "Linger",
+                                                      "Time in milliseconds producer waits for messages to fill up a "
+                                                      "batch before sending it to broker",
+                                                      0, 900000, DEFAULT_LINGER_MS, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "Maximum size in bytes of messages batched in one request to "
+                                                      "broker",
+                                                      1, G_MAXINT, DEFAULT_KAFKA_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_STATS,
+        g_param_spec_boxed("stats", "Statistics",
+                           "Delivery statistics: delivered, failed, latency-avg and latency-max (milliseconds from "
+                           "produce to broker acknowledge)",
+                           GST_TYPE_STRUCTURE, static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
 }
 
 static gboolean plugin_init(GstPlugin *plugin) {
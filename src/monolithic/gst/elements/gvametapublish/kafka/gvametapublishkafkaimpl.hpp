@@ -6,12 +6,15 @@
 
 #pragma once
 
+#include <common.hpp>
 #include <gvametapublishbase.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace {
@@ -25,6 +28,11 @@ enum {
     PROP_TOPIC,
     PROP_MAX_CONNECT_ATTEMPTS,
     PROP_MAX_RECONNECT_INTERVAL,
+    PROP_KEY_MODE,
+    PROP_KEY,
+    PROP_LINGER_MS,
+    PROP_BATCH_SIZE,
+    PROP_STATS,
 };
 
 template <typename ProducerFactory, typename TopicFactory>
@@ -58,6 +66,13 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
             return false;
         if (!set_conf("reconnect.backoff.max.ms", std::to_string(_max_reconnect_interval * MILLISEC_PER_SEC)))
             return false;
+        if (!set_conf("linger.ms", std::to_string(_linger_ms)))
+            return false;
+        if (!set_conf("batch.size", std::to_string(_batch_size)))
+            return false;
+        // Keyed messages of one stream go to one partition, idempotence keeps their order on retries
+        if (_key_mode != GVA_META_PUBLISH_KEY_NONE && !set_conf("enable.idempotence", "true"))
+            return false;
 
         _producer.reset(ProducerFactory::create(producerConfig.get(), error));
         if (!_producer) {
@@ -82,11 +97,30 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
     ~GvaMetaPublishKafkaImpl() override = default;
 
     void dr_cb(RdKafka::Message &message) final {
-        if (message.err() != RdKafka::ERR_NO_ERROR) {
+        // Payload produced without copy is released once producer is done with it
+        if (auto payload = static_cast<GBytes *>(message.msg_opaque()))
+            g_bytes_unref(payload);
+
+        const bool delivered = message.err() == RdKafka::ERR_NO_ERROR;
+        if (!delivered) {
             GST_ERROR_OBJECT(_base, "Message failed to publish to Kafka. Error message: %s", message.errstr().c_str());
         } else {
             GST_DEBUG_OBJECT(_base, "Message successfully published to Kafka");
         }
+
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+        if (!delivered) {
+            _stats.failed++;
+            return;
+        }
+        _stats.delivered++;
+        // Time from produce() to broker acknowledge in microseconds, negative if not available
+        int64_t latency_us = message.latency();
+        if (latency_us >= 0) {
+            _stats.latency_count++;
+            _stats.latency_sum_us += latency_us;
+            _stats.latency_max_us = std::max(_stats.latency_max_us, latency_us);
+        }
     }
 
     void event_cb(RdKafka::Event &event) final {
@@ -108,6 +142,10 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
 
     gboolean start() {
         _connection_attempt = 1;
+        {
+            std::lock_guard<std::mutex> lock(_stats_mutex);
+            _stats = Stats();
+        }
 
         if (!init_kafka_producer()) {
             GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND, ("Failed to start"), ("Failed to initialize Kafka producer"));
@@ -126,23 +164,57 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
             auto queue_size = _producer->outq_len();
             if (queue_size > 0) {
                 GST_ERROR_OBJECT(_base, "%d messages were not delivered", queue_size);
+                // Purged messages are reported to dr_cb, which releases their payloads
+                _producer->purge(RdKafka::Producer::PURGE_QUEUE | RdKafka::Producer::PURGE_INFLIGHT);
+                _producer->poll(0);
             }
         } else {
             GST_DEBUG_OBJECT(_base, "Successfully flushed Kafka producer.");
         }
 
+        Stats stats = get_stats_snapshot();
+        GST_INFO_OBJECT(_base,
+                        "Kafka delivery stats: delivered %" G_GUINT64_FORMAT ", failed %" G_GUINT64_FORMAT
+                        ", latency avg %.3f ms, max %.3f ms",
+                        stats.delivered, stats.failed, stats.latency_avg_ms(), stats.latency_max_us / 1000.0);
         return true;
     }
 
-    gboolean publish(const std::string &message) {
+    gboolean publish(const gchar *message, gsize size) {
         if (!_producer) {
             GST_ERROR_OBJECT(_base, "Producer handler is null. Cannot publish message.");
             return false;
         }
         _producer->poll(0);
         if (_producer->produce(_kafka_topic.get(), RdKafka::Topic::PARTITION_UA, RdKafka::Producer::MSG_COPY,
-                               (void *)const_cast<char *>(message.c_str()), message.size(), nullptr, nullptr)) {
+                               const_cast<gchar *>(message), size, message_key(nullptr), nullptr)) {
+
+            std::string error;
+            _producer->fatal_error(error);
+            GST_ERROR_OBJECT(_base, "Failed to publish message: %s", error.c_str());
+            return false;
+        }
+
+        GST_DEBUG_OBJECT(_base, "Kafka message sent.");
+        return true;
+    }
+
+    // Produces message without copying it: producer keeps reference on payload until delivery report
+    gboolean publish_bytes(GBytes *message, const gchar *stream_id) {
+        if (!_producer) {
+            GST_ERROR_OBJECT(_base, "Producer handler is null. Cannot publish message.");
+            return false;
+        }
+        _producer->poll(0);
 
+        gsize size = 0;
+        gconstpointer data = g_bytes_get_data(message, &size);
+        const std::string *key = message_key(stream_id);
+        GBytes *payload = g_bytes_ref(message);
+        if (_producer->produce(_kafka_topic.get(), RdKafka::Topic::PARTITION_UA, 0, const_cast<gpointer>(data), size,
+                               key ? key->data() : nullptr, key ? key->size() : 0, payload)) {
+            // Producer doesn't take ownership of payload if produce() fails
+            g_bytes_unref(payload);
             std::string error;
             _producer->fatal_error(error);
             GST_ERROR_OBJECT(_base, "Failed to publish message: %s", error.c_str());
@@ -167,6 +239,21 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         case PROP_MAX_RECONNECT_INTERVAL:
             g_value_set_uint(value, _max_reconnect_interval);
             break;
+        case PROP_KEY_MODE:
+            g_value_set_enum(value, _key_mode);
+            break;
+        case PROP_KEY:
+            g_value_set_string(value, _key.c_str());
+            break;
+        case PROP_LINGER_MS:
+            g_value_set_uint(value, _linger_ms);
+            break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _batch_size);
+            break;
+        case PROP_STATS:
+            g_value_take_boxed(value, get_stats());
+            break;
         default:
             return false;
         }
@@ -187,19 +274,79 @@ class GvaMetaPublishKafkaImpl : public RdKafka::DeliveryReportCb, public RdKafka
         case PROP_MAX_RECONNECT_INTERVAL:
             _max_reconnect_interval = g_value_get_uint(value);
             break;
+        case PROP_KEY_MODE:
+            _key_mode = static_cast<KeyMode>(g_value_get_enum(value));
+            break;
+        case PROP_KEY:
+            _key = g_value_get_string(value);
+            break;
+        case PROP_LINGER_MS:
+            _linger_ms = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_SIZE:
+            _batch_size = g_value_get_uint(value);
+            break;
         default:
             return false;
         }
         return true;
     }
 
+    GstStructure *get_stats() const {
+        Stats stats = get_stats_snapshot();
+        return gst_structure_new("kafka-stats", "delivered", G_TYPE_UINT64, stats.delivered, "failed", G_TYPE_UINT64,
+                                 stats.failed, "latency-avg", G_TYPE_DOUBLE, stats.latency_avg_ms(), "latency-max",
+                                 G_TYPE_DOUBLE, stats.latency_max_us / 1000.0, nullptr);
+    }
+
   protected:
+    struct Stats {
+        uint64_t delivered = 0;
+        uint64_t failed = 0;
+        uint64_t latency_count = 0;
+        int64_t latency_sum_us = 0;
+        int64_t latency_max_us = 0;
+
+        double latency_avg_ms() const {
+            return latency_count ? latency_sum_us / 1000.0 / latency_count : 0.0;
+        }
+    };
+
+    Stats get_stats_snapshot() const {
+        std::lock_guard<std::mutex> lock(_stats_mutex);
+        return _stats;
+    }
+
+    // Returns key of the message according to key mode, nullptr if message is not keyed
+    const std::string *message_key(const gchar *stream_id) {
+        switch (_key_mode) {
+        case GVA_META_PUBLISH_KEY_STREAM_ID:
+            if (!stream_id)
+                return nullptr;
+            if (_stream_key != stream_id)
+                _stream_key = stream_id;
+            return &_stream_key;
+        case GVA_META_PUBLISH_KEY_CUSTOM:
+            return _key.empty() ? nullptr : &_key;
+        default:
+            return nullptr;
+        }
+    }
+
     GvaMetaPublishBase *_base;
 
     std::string _address;
     std::string _topic;
     uint32_t _max_connect_attempts = 0;
     uint32_t _max_reconnect_interval = 0;
+    KeyMode _key_mode = DEFAULT_KEY_MODE;
+    std::string _key;
+    std::string _stream_key;
+    uint32_t _linger_ms = DEFAULT_LINGER_MS;
+    uint32_t _batch_size = DEFAULT_KAFKA_BATCH_SIZE;
+
+    mutable std::mutex _stats_mutex;
+    Stats _stats;
 
     std::unique_ptr<RdKafka::Producer> _producer;
     std::unique_ptr<RdKafka::Topic> _kafka_topic;
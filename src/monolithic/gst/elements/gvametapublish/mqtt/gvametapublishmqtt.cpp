@@ -12,13 +12,18 @@ using json = nlohmann::json;
 #include "gvametapublishmqtt.hpp"
 
 #include <common.hpp>
+#include <publish_queue.hpp>
 #include <safe_arithmetic.hpp>
 
 #include <MQTTAsync.h>
 #include <uuid/uuid.h>
 
+#include <condition_variable>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
 
 GST_DEBUG_CATEGORY_STATIC(gva_meta_publish_mqtt_debug_category);
@@ -34,6 +39,9 @@ std::string generate_client_id() {
     return uuid;
 }
 
+// Time given to publish queued messages when element stops, before disconnect
+constexpr auto QUEUE_FLUSH_TIMEOUT = std::chrono::seconds(5);
+
 } // namespace
 
 /* Properties */
@@ -47,6 +55,14 @@ enum {
     PROP_USERNAME,
     PROP_PASSWORD,
     PROP_JSON_CONFIG_FILE,
+    PROP_MAX_INFLIGHT,
+    PROP_BATCH_SIZE,
+    PROP_BATCH_TIMEOUT,
+    PROP_MAX_QUEUE_SIZE,
+    PROP_SPILL_FILE,
+    PROP_MAX_SPILL_SIZE,
+    PROP_DROP_POLICY,
+    PROP_STATS,
 };
 
 class GvaMetaPublishMqttPrivate {
@@ -54,18 +70,23 @@ class GvaMetaPublishMqttPrivate {
     // MQTT CALLBACKS
     void on_connect_success(MQTTAsync_successData * /*response*/) {
         GST_DEBUG_OBJECT(_base, "Successfully connected to MQTT");
+        if (_queue)
+            _queue->set_connected(true);
     }
 
     void on_connect_failure(MQTTAsync_failureData *response) {
         char error_message[256];
         snprintf(error_message, sizeof(error_message), "Connect failed, rc %d\n", response ? response->code : 0);
         GST_WARNING_OBJECT(_base, "%s", error_message);
-        try_reconnect();
+        request_reconnect();
     }
 
     void on_connection_lost(char *cause) {
         GST_WARNING_OBJECT(_base, "Connection to MQTT lost. Cause: %s. Attempting to reconnect", cause);
-        try_reconnect();
+        // Messages are kept in publish queue until connection is restored
+        if (_queue)
+            _queue->set_connected(false);
+        request_reconnect();
     }
 
     int on_message_arrived(char * /*topicName*/, int /*topicLen*/, MQTTAsync_message * /*message*/) {
@@ -75,12 +96,16 @@ class GvaMetaPublishMqttPrivate {
     void on_delivery_complete(MQTTAsync_token /*token*/) {
     }
 
-    void on_send_success(MQTTAsync_successData * /*response*/) {
+    void on_send_success(MQTTAsync_successData *response) {
         GST_DEBUG_OBJECT(_base, "Message successfully published to MQTT");
+        if (_queue && response)
+            _queue->on_complete(response->token, true);
     }
 
-    void on_send_failure(MQTTAsync_failureData * /*response*/) {
-        GST_ERROR_OBJECT(_base, "Message failed to publish to MQTT");
+    void on_send_failure(MQTTAsync_failureData *response) {
+        GST_WARNING_OBJECT(_base, "Message failed to publish to MQTT, it will be retried");
+        if (_queue && response)
+            _queue->on_complete(response->token, false);
     }
 
     void on_disconnect_success(MQTTAsync_successData * /*response*/) {
@@ -91,21 +116,52 @@ class GvaMetaPublishMqttPrivate {
         GST_ERROR_OBJECT(_base, "Failed to disconnect from MQTT.");
     }
 
-    void try_reconnect() {
-        if (_connection_attempt == _max_connect_attempts) {
-            GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND,
-                              ("Failed to connect to MQTT after maximum configured attempts."), (nullptr));
-            return;
+    // Called from paho callbacks, which must not block: reconnection waits in reconnect thread
+    void request_reconnect() {
+        {
+            std::lock_guard<std::mutex> lock(_reconnect_mutex);
+            _reconnect_requested = true;
         }
-        _connection_attempt++;
-        _sleep_time = std::min(2 * _sleep_time, _max_reconnect_interval);
+        _reconnect_cv.notify_one();
+    }
 
-        std::this_thread::sleep_for(std::chrono::seconds(_sleep_time));
-        GST_DEBUG_OBJECT(_base, "Attempt %d to connect to MQTT.", _connection_attempt);
-        auto c = MQTTAsync_connect(_client, &_connect_options);
-        if (c != MQTTASYNC_SUCCESS) {
-            GST_ERROR_OBJECT(_base, "Failed to start connection attempt to MQTT. Error code %d.", c);
+    void reconnect_loop() {
+        std::unique_lock<std::mutex> lock(_reconnect_mutex);
+        while (true) {
+            _reconnect_cv.wait(lock, [this] { return _reconnect_requested || _reconnect_stopping; });
+            if (_reconnect_stopping)
+                return;
+            _reconnect_requested = false;
+
+            if (_connection_attempt == _max_connect_attempts) {
+                GST_ELEMENT_ERROR(_base, RESOURCE, NOT_FOUND,
+                                  ("Failed to connect to MQTT after maximum configured attempts."), (nullptr));
+                continue;
+            }
+            _connection_attempt++;
+            _sleep_time = std::min(2 * _sleep_time, _max_reconnect_interval);
+
+            // Stop interrupts the wait
+            if (_reconnect_cv.wait_for(lock, std::chrono::seconds(_sleep_time), [this] { return _reconnect_stopping; }))
+                return;
+            lock.unlock();
+            GST_DEBUG_OBJECT(_base, "Attempt %d to connect to MQTT.", _connection_attempt);
+            auto c = MQTTAsync_connect(_client, &_connect_options);
+            if (c != MQTTASYNC_SUCCESS) {
+                GST_ERROR_OBJECT(_base, "Failed to start connection attempt to MQTT. Error code %d.", c);
+            }
+            lock.lock();
+        }
+    }
+
+    void stop_reconnect_thread() {
+        {
+            std::lock_guard<std::mutex> lock(_reconnect_mutex);
+            _reconnect_stopping = true;
         }
+        _reconnect_cv.notify_one();
+        if (_reconnect_thread.joinable())
+            _reconnect_thread.join();
     }
 
   public:
@@ -148,6 +204,9 @@ class GvaMetaPublishMqttPrivate {
     }
 
     ~GvaMetaPublishMqttPrivate() {
+        // Queue worker and reconnect thread use the client, so they have to be stopped first
+        _queue.reset();
+        stop_reconnect_thread();
         MQTTAsync_destroy(&_client);
         GST_DEBUG("Successfully freed MQTT client.");
     }
@@ -204,6 +263,35 @@ class GvaMetaPublishMqttPrivate {
         if (j.contains("ssl_private_key_pwd") && !j["ssl_private_key_pwd"].is_null()) {
             _ssl_private_key_pwd = j["ssl_private_key_pwd"].get<std::string>();
         }
+        if (j.contains("max-inflight") && !j["max-inflight"].is_null()) {
+            _queue_config.max_inflight = j["max-inflight"].get<uint32_t>();
+        }
+        if (j.contains("batch-size") && !j["batch-size"].is_null()) {
+            _queue_config.batch_size = j["batch-size"].get<uint32_t>();
+        }
+        if (j.contains("batch-timeout") && !j["batch-timeout"].is_null()) {
+            _queue_config.batch_timeout_ms = j["batch-timeout"].get<uint32_t>();
+        }
+        if (j.contains("max-queue-size") && !j["max-queue-size"].is_null()) {
+            _queue_config.max_queue_size = j["max-queue-size"].get<uint32_t>();
+        }
+        if (j.contains("spill-file") && !j["spill-file"].is_null()) {
+            _queue_config.spill_file = j["spill-file"].get<std::string>();
+        }
+        if (j.contains("max-spill-size") && !j["max-spill-size"].is_null()) {
+            _max_spill_size_mb = j["max-spill-size"].get<uint32_t>();
+        }
+        if (j.contains("drop-policy") && !j["drop-policy"].is_null()) {
+            auto policy = j["drop-policy"].get<std::string>();
+            if (policy == DROP_POLICY_OLDEST_NAME) {
+                _queue_config.drop_policy = GVA_META_PUBLISH_DROP_OLDEST;
+            } else if (policy == DROP_POLICY_NEWEST_NAME) {
+                _queue_config.drop_policy = GVA_META_PUBLISH_DROP_NEWEST;
+            } else {
+                g_printerr("Unknown drop-policy in JSON configuration file: %s\n", policy.c_str());
+                return false;
+            }
+        }
 
         return true;
     }
@@ -273,6 +361,20 @@ class GvaMetaPublishMqttPrivate {
             _connect_options.ssl = &sslOptions;
         }
 
+        // Messages are published from the queue worker, so slow or unavailable broker doesn't block streaming thread
+        _queue_config.max_spill_size = static_cast<uint64_t>(_max_spill_size_mb) * 1024 * 1024;
+        _queue.reset(new PublishQueue(_queue_config, [this](const std::string &payload, uint64_t &id) {
+            return send_payload(payload, id);
+        }));
+        if (!_queue->start()) {
+            GST_ERROR_OBJECT(_base, "Failed to open spill file '%s'", _queue_config.spill_file.c_str());
+            return false;
+        }
+
+        _reconnect_requested = false;
+        _reconnect_stopping = false;
+        _reconnect_thread = std::thread(&GvaMetaPublishMqttPrivate::reconnect_loop, this);
+
         auto c = MQTTAsync_connect(_client, &_connect_options);
         if (c != MQTTASYNC_SUCCESS) {
             GST_ERROR_OBJECT(_base, "Failed to start connection attempt to MQTT. Error code %d.", c);
@@ -282,10 +384,17 @@ class GvaMetaPublishMqttPrivate {
         return true;
     }
 
-    gboolean publish(const std::string &message) {
+    gboolean publish(const gchar *message, gsize size) {
+        // Queue appends message to its batch payload, so it is copied once
+        if (!_queue->push(std::string_view(message, size)))
+            GST_DEBUG_OBJECT(_base, "MQTT publish queue is full, message dropped");
+        return true;
+    }
+
+    bool send_payload(const std::string &payload, uint64_t &id) {
         MQTTAsync_message mqtt_message = MQTTAsync_message_initializer;
-        mqtt_message.payload = const_cast<char *>(message.c_str());
-        mqtt_message.payloadlen = safe_convert<int>(message.size());
+        mqtt_message.payload = const_cast<char *>(payload.data());
+        mqtt_message.payloadlen = safe_convert<int>(payload.size());
         mqtt_message.retained = FALSE;
 
         // TODO Validate message is JSON
@@ -308,14 +417,23 @@ class GvaMetaPublishMqttPrivate {
 
         auto c = MQTTAsync_sendMessage(_client, _topic.c_str(), &mqtt_message, &ro);
         if (c != MQTTASYNC_SUCCESS) {
-            GST_ERROR_OBJECT(_base, "Message was not accepted for publication. Error code %d.", c);
-            return true;
+            GST_WARNING_OBJECT(_base, "Message was not accepted for publication. Error code %d.", c);
+            return false;
         }
+        id = ro.token;
         GST_DEBUG_OBJECT(_base, "MQTT message sent.");
         return true;
     }
 
     gboolean stop() {
+        if (_queue) {
+            _queue->stop(QUEUE_FLUSH_TIMEOUT);
+            auto stats = _queue->stats();
+            if (stats.dropped)
+                GST_WARNING_OBJECT(_base, "%" G_GUINT64_FORMAT " messages were not published to MQTT", stats.dropped);
+        }
+        stop_reconnect_thread();
+
         if (!MQTTAsync_isConnected(_client)) {
             GST_DEBUG_OBJECT(_base, "MQTT client is not connected. Nothing to disconnect");
             return true;
@@ -356,6 +474,27 @@ class GvaMetaPublishMqttPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             _json_config_file = g_value_get_string(value);
             break;
+        case PROP_MAX_INFLIGHT:
+            _queue_config.max_inflight = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_SIZE:
+            _queue_config.batch_size = g_value_get_uint(value);
+            break;
+        case PROP_BATCH_TIMEOUT:
+            _queue_config.batch_timeout_ms = g_value_get_uint(value);
+            break;
+        case PROP_MAX_QUEUE_SIZE:
+            _queue_config.max_queue_size = g_value_get_uint(value);
+            break;
+        case PROP_SPILL_FILE:
+            _queue_config.spill_file = g_value_get_string(value);
+            break;
+        case PROP_MAX_SPILL_SIZE:
+            _max_spill_size_mb = g_value_get_uint(value);
+            break;
+        case PROP_DROP_POLICY:
+            _queue_config.drop_policy = static_cast<DropPolicy>(g_value_get_enum(value));
+            break;
         default:
             return false;
         }
@@ -389,12 +528,47 @@ class GvaMetaPublishMqttPrivate {
         case PROP_JSON_CONFIG_FILE: // Handle JSON configuration file property
             g_value_set_string(value, _json_config_file.c_str());
             break;
+        case PROP_MAX_INFLIGHT:
+            g_value_set_uint(value, _queue_config.max_inflight);
+            break;
+        case PROP_BATCH_SIZE:
+            g_value_set_uint(value, _queue_config.batch_size);
+            break;
+        case PROP_BATCH_TIMEOUT:
+            g_value_set_uint(value, _queue_config.batch_timeout_ms);
+            break;
+        case PROP_MAX_QUEUE_SIZE:
+            g_value_set_uint(value, _queue_config.max_queue_size);
+            break;
+        case PROP_SPILL_FILE:
+            g_value_set_string(value, _queue_config.spill_file.c_str());
+            break;
+        case PROP_MAX_SPILL_SIZE:
+            g_value_set_uint(value, _max_spill_size_mb);
+            break;
+        case PROP_DROP_POLICY:
+            g_value_set_enum(value, _queue_config.drop_policy);
+            break;
+        case PROP_STATS:
+            g_value_take_boxed(value, get_stats());
+            break;
         default:
             return false;
         }
         return true;
     }
 
+    GstStructure *get_stats() const {
+        PublishQueue::Stats stats;
+        if (_queue)
+            stats = _queue->stats();
+        return gst_structure_new("mqtt-stats", "queue-depth", G_TYPE_UINT64, stats.queue_depth, "spilled",
+                                 G_TYPE_UINT64, stats.spilled, "in-flight", G_TYPE_UINT64, stats.inflight, "published",
+                                 G_TYPE_UINT64, stats.published, "failed", G_TYPE_UINT64, stats.failed, "dropped",
+                                 G_TYPE_UINT64, stats.dropped, "latency-avg", G_TYPE_DOUBLE, stats.latency_avg_ms,
+                                 "latency-max", G_TYPE_DOUBLE, stats.latency_max_ms, nullptr);
+    }
+
   private:
     GvaMetaPublishBase *_base;
 
@@ -423,6 +597,16 @@ class GvaMetaPublishMqttPrivate {
     MQTTAsync_disconnectOptions _disconnect_options;
     uint32_t _connection_attempt;
     uint32_t _sleep_time;
+
+    PublishQueue::Config _queue_config;
+    uint32_t _max_spill_size_mb = DEFAULT_MAX_SPILL_SIZE;
+    std::unique_ptr<PublishQueue> _queue;
+
+    std::thread _reconnect_thread;
+    std::mutex _reconnect_mutex;
+    std::condition_variable _reconnect_cv;
+    bool _reconnect_requested = false;
+    bool _reconnect_stopping = false;
 };
 
 G_DEFINE_TYPE_EXTENDED(GvaMetaPublishMqtt, gva_meta_publish_mqtt, GST_TYPE_GVA_META_PUBLISH_BASE, 0,
@@ -505,8 +689,8 @@ static void gva_meta_publish_mqtt_class_init(GvaMetaPublishMqttClass *klass) {
     base_transform_class->start = [](GstBaseTransform *base) { return GVA_META_PUBLISH_MQTT(base)->impl->start(); };
     base_transform_class->stop = [](GstBaseTransform *base) { return GVA_META_PUBLISH_MQTT(base)->impl->stop(); };
 
-    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const std::string &message) {
-        return GVA_META_PUBLISH_MQTT(base)->impl->publish(message);
+    base_metapublish_class->publish = [](GvaMetaPublishBase *base, const gchar *message, gsize size) {
+        return GVA_META_PUBLISH_MQTT(base)->impl->publish(message, size);
     };
 
     gst_element_class_set_static_metadata(GST_ELEMENT_CLASS(klass), "Mqtt metadata publisher", "Metadata",
@@ -549,6 +733,48 @@ static void gva_meta_publish_mqtt_class_init(GvaMetaPublishMqttClass *klass) {
                                     g_param_spec_string("mqtt-config", "Config", "[method= mqtt] MQTT config file",
                                                         DEFAULT_MQTTCONFIG_FILE, prm_flags));
 
+    g_object_class_install_property(gobject_class, PROP_MAX_INFLIGHT,
+                                    g_param_spec_uint("max-inflight", "Max In-flight",
+                                                      "Maximum number of payloads sent to broker and not yet "
+                                                      "acknowledged",
+                                                      1, G_MAXUINT16, DEFAULT_MAX_INFLIGHT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_SIZE,
+                                    g_param_spec_uint("batch-size", "Batch Size",
+                                                      "Maximum number of frame messages coalesced into one MQTT "
+                                                      "payload. JSON messages are separated by new line",
+                                                      1, 1000, DEFAULT_BATCH_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_BATCH_TIMEOUT,
+                                    g_param_spec_uint("batch-timeout", "Batch Timeout",
+                                                      "Maximum time in milliseconds a message waits for the batch to "
+                                                      "fill up before the payload is published",
+                                                      0, 60000, DEFAULT_BATCH_TIMEOUT, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_QUEUE_SIZE,
+                                    g_param_spec_uint("max-queue-size", "Max Queue Size",
+                                                      "Maximum number of payloads kept in memory while broker is "
+                                                      "slow or unavailable",
+                                                      1, G_MAXINT, DEFAULT_MAX_QUEUE_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_SPILL_FILE,
+                                    g_param_spec_string("spill-file", "Spill File",
+                                                        "Path to file where payloads are spilled when in-memory queue "
+                                                        "is full. If not set, drop-policy is applied instead",
+                                                        DEFAULT_SPILL_FILE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_MAX_SPILL_SIZE,
+                                    g_param_spec_uint("max-spill-size", "Max Spill Size",
+                                                      "Maximum size of spill file in megabytes. The oldest spilled "
+                                                      "payloads are dropped to stay within it. 0 means unlimited",
+                                                      0, G_MAXUINT, DEFAULT_MAX_SPILL_SIZE, prm_flags));
+    g_object_class_install_property(gobject_class, PROP_DROP_POLICY,
+                                    g_param_spec_enum("drop-policy", "Drop Policy",
+                                                      "Which messages to drop when the queue is full",
+                                                      GST_TYPE_GVA_METAPUBLISH_DROP_POLICY, DEFAULT_DROP_POLICY,
+                                                      prm_flags));
+    g_object_class_install_property(
+        gobject_class, PROP_STATS,
+        g_param_spec_boxed("stats", "Statistics",
+                           "Publish queue statistics: queue-depth, spilled, in-flight, published, failed, dropped, "
+                           "latency-avg and latency-max (milliseconds from frame message to broker acknowledge)",
+                           GST_TYPE_STRUCTURE, static_cast<GParamFlags>(G_PARAM_READABLE | G_PARAM_STATIC_STRINGS)));
+
     // Override the state change function
     GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
     element_class->change_state = gva_meta_publish_mqtt_change_state;
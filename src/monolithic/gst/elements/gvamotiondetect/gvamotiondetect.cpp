@@ -24,8 +24,12 @@
 // Explicit OpenCL headers removed: element now uses only generic OpenCV UMat (which may internally use OpenCL).
 #include <algorithm>
 #include <cmath> // for std::lround
+#include <cstdlib>
 #include <vector>
 
+#include "motion_mask.h"
+
+#include <dlstreamer/gst/videoanalytics/motion_meta.h>
 #include <dlstreamer/gst/videoanalytics/video_frame.h> // analytics meta types (GstAnalyticsRelationMeta, GstAnalyticsODMtd)
 #include <string>
 
@@ -86,7 +90,7 @@ struct _GstGvaMotionDetect {
 
     /* Motion detection previous frame state */
     cv::UMat prev_small_gray;
-    cv::UMat prev_luma;
+    MotionCpuState *cpu; // system-memory path state
 
     /* Grid detection parameters (properties) */
     int block_size;
@@ -464,6 +468,7 @@ static gboolean gst_gva_motion_detect_set_caps(GstBaseTransform *trans, GstCaps
     // Reset tracking state on caps change (resolution may differ)
     self->tracked_rois.clear();
     self->block_state.release();
+    self->cpu->prev_small.release();
     return TRUE;
 }
 // Helper to attach motion ROIs and associated analytics metadata (aggregated in a single relation meta)
@@ -582,6 +587,16 @@ static void gst_gva_motion_detect_attach_rois(GstGvaMotionDetect *self, GstBuffe
     }
 }
 
+// Marks frame as analyzed even if no motion is found, so downstream (e.g. adaptive-interval of inference elements)
+// tells static scene from frames motion detection didn't run on
+static void gst_gva_motion_detect_mark_analyzed(GstGvaMotionDetect *self, GstBuffer *buf) {
+    if (!gst_buffer_is_writable(buf)) {
+        GST_WARNING_OBJECT(self, "Buffer not writable; skipping motion meta");
+        return;
+    }
+    gva_buffer_add_motion_meta(buf);
+}
+
 // Helper to merge overlapping motion rectangles in-place (simple O(n^2))
 static void gst_gva_motion_detect_merge_rois(std::vector<MotionRect> &rois) {
     if (rois.empty())
@@ -619,25 +634,16 @@ static void gst_gva_motion_detect_merge_rois(std::vector<MotionRect> &rois) {
 }
 
 // ------------------- Motion Mask & Block Scan Helpers -------------------
-// Build motion mask (absdiff -> blur -> threshold -> morphology) from current small frame and previous small frame.
-static void md_build_motion_mask(const cv::UMat &curr_small, const cv::UMat &prev_small_gray, cv::UMat &morph_small,
-                                 int pixel_diff_threshold) {
-    int PIXEL_DIFF_THR = std::max(1, std::min(pixel_diff_threshold, 255));
-    cv::UMat diff_small;
-    cv::absdiff(curr_small, prev_small_gray, diff_small);
-    cv::UMat blurred_small;
-    cv::GaussianBlur(diff_small, blurred_small, cv::Size(3, 3), 0);
-    cv::UMat thresh_small;
-    cv::threshold(blurred_small, thresh_small, PIXEL_DIFF_THR, 255, cv::THRESH_BINARY);
-    cv::UMat tmp;
-    cv::Mat ksmall = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
-    cv::morphologyEx(thresh_small, tmp, cv::MORPH_OPEN, ksmall);
-    cv::dilate(tmp, morph_small, ksmall, cv::Point(-1, -1), 1);
+// Number of non-zero pixels of a 0/1 mask inside rectangle, from its integral image
+static inline int md_block_count(const cv::Mat &mask_integral, const cv::Rect &r) {
+    const int *top = mask_integral.ptr<int>(r.y);
+    const int *bottom = mask_integral.ptr<int>(r.y + r.height);
+    return bottom[r.x + r.width] - bottom[r.x] - top[r.x + r.width] + top[r.x];
 }
 
-// Scan blocks with temporal agreement counters (used for CPU/system-memory path). Populates rois.
-// Unified block scan honoring confirm_frames property.
-static void md_scan_blocks(GstGvaMotionDetect *self, const cv::UMat &morph_small, int width, int height, int small_w,
+// Scan blocks with temporal agreement counters. Populates rois.
+// Unified block scan honoring confirm_frames property. Expects integral image of 0/1 motion mask.
+static void md_scan_blocks(GstGvaMotionDetect *self, const cv::Mat &mask_integral, int width, int height, int small_w,
                            int small_h, std::vector<MotionRect> &rois) {
     double min_rel_area = self->min_rel_area;
     if (min_rel_area < 0.0)
@@ -652,7 +658,6 @@ static void md_scan_blocks(GstGvaMotionDetect *self, const cv::UMat &morph_small
     int block_small_h = std::max(4, (int)std::round(block_full / scale_y));
     double change_thr = std::max(0.0, std::min(1.0, self->motion_threshold));
     int required = std::max(1, self->confirm_frames);
-    cv::Mat morph_cpu = morph_small.getMat(cv::ACCESS_READ);
     if (required > 1) {
         int grid_rows = (small_h + block_small_h - 1) / block_small_h;
         int grid_cols = (small_w + block_small_w - 1) / block_small_w;
@@ -667,8 +672,7 @@ static void md_scan_blocks(GstGvaMotionDetect *self, const cv::UMat &morph_small
                 if (w_small < 4)
                     break;
                 cv::Rect r_small(bx, by, w_small, h_small);
-                cv::Mat sub = morph_cpu(r_small);
-                int changed = cv::countNonZero(sub);
+                int changed = md_block_count(mask_integral, r_small);
                 double ratio = (double)changed / (double)(r_small.width * r_small.height);
                 unsigned char &state = self->block_state.at<unsigned char>(gy, gx);
                 if (ratio >= change_thr) {
@@ -709,8 +713,7 @@ static void md_scan_blocks(GstGvaMotionDetect *self, const cv::UMat &morph_small
                 if (w_small < 4)
                     break;
                 cv::Rect r_small(bx, by, w_small, h_small);
-                cv::Mat sub = morph_cpu(r_small);
-                int changed = cv::countNonZero(sub);
+                int changed = md_block_count(mask_integral, r_small);
                 double ratio = (double)changed / (double)(r_small.width * r_small.height);
                 if (ratio < change_thr)
                     continue;
@@ -746,50 +749,51 @@ static GstFlowReturn gst_gva_motion_detect_transform_ip(GstBaseTransform *trans,
         int height = GST_VIDEO_INFO_HEIGHT(&self->vinfo);
         if (!width || !height)
             return GST_FLOW_OK;
-        // Map Y plane (system memory) or fallback to VA luma if buffer is VAMemory
+        // Downscale (software) to working size ~320 wide
+        int target_w = std::min(320, width);
+        double scale = (double)target_w / (double)width;
+        int small_w = target_w;
+        int small_h = std::max(1, (int)std::lround(height * scale));
+        MotionCpuState &st = *self->cpu;
+        // Map Y plane (system memory) and downscale straight from mapped memory, or fallback to VA luma if buffer is
+        // VAMemory
         GstVideoFrame vframe;
-        cv::UMat curr_luma;
         gboolean mapped = gst_video_frame_map(&vframe, &self->vinfo, buf, GST_MAP_READ);
         if (mapped) {
             guint8 *y_data = (guint8 *)GST_VIDEO_FRAME_PLANE_DATA(&vframe, 0);
             int y_stride = GST_VIDEO_FRAME_PLANE_STRIDE(&vframe, 0);
             cv::Mat y_mat(height, width, CV_8UC1, y_data, y_stride);
             try {
-                y_mat.copyTo(curr_luma);
-            } catch (...) {
+                cv::resize(y_mat, st.curr_small, cv::Size(small_w, small_h), 0, 0, cv::INTER_LINEAR);
+            } catch (const cv::Exception &e) {
+                GST_WARNING_OBJECT(self, "CPU mode: luma resize failed: %s", e.what());
                 gst_video_frame_unmap(&vframe);
                 return GST_FLOW_OK;
             }
             gst_video_frame_unmap(&vframe);
         } else {
+            cv::UMat curr_luma;
             VASurfaceID sid_cpu = gva_motion_detect_get_surface(self, buf);
             if (sid_cpu == VA_INVALID_SURFACE || !gva_motion_detect_map_luma(self, sid_cpu, width, height, curr_luma)) {
                 GST_DEBUG_OBJECT(self, "CPU mode: unable to map frame (system or VA); skipping frame");
                 return GST_FLOW_OK;
             }
+            cv::resize(curr_luma, st.curr_small, cv::Size(small_w, small_h), 0, 0, cv::INTER_LINEAR);
         }
-        // Downscale (software) to working size ~320 wide
-        int target_w = std::min(320, width);
-        double scale = (double)target_w / (double)width;
-        int small_w = target_w;
-        int small_h = std::max(1, (int)std::lround(height * scale));
-        cv::UMat curr_small;
-        cv::resize(curr_luma, curr_small, cv::Size(small_w, small_h), 0, 0, cv::INTER_LINEAR);
-        if (self->prev_small_gray.empty()) {
-            curr_small.copyTo(self->prev_small_gray);
-            curr_luma.copyTo(self->prev_luma);
+        if (st.prev_small.empty() || st.prev_small.size() != st.curr_small.size()) {
+            cv::swap(st.prev_small, st.curr_small);
             return GST_FLOW_OK;
         }
-        cv::UMat morph_small;
-        md_build_motion_mask(curr_small, self->prev_small_gray, morph_small, self->pixel_diff_threshold);
+        md_build_motion_mask_cpu(st, self->pixel_diff_threshold);
         std::vector<MotionRect> rois;
-        md_scan_blocks(self, morph_small, width, height, small_w, small_h, rois);
+        md_scan_blocks(self, st.mask_integral, width, height, small_w, small_h, rois);
         if (!rois.empty()) {
             gst_gva_motion_detect_merge_rois(rois);
             gst_gva_motion_detect_process_and_attach(self, buf, rois, width, height);
         }
-        curr_small.copyTo(self->prev_small_gray);
-        curr_luma.copyTo(self->prev_luma);
+        gst_gva_motion_detect_mark_analyzed(self, buf);
+        // Current frame becomes previous one; the old previous buffer is reused for the next frame
+        cv::swap(st.prev_small, st.curr_small);
         return GST_FLOW_OK;
     }
     // Acquire VA display via peer query if not yet set.
@@ -886,7 +890,6 @@ static GstFlowReturn gst_gva_motion_detect_transform_ip(GstBaseTransform *trans,
     // If first frame, store and exit
     if (self->prev_small_gray.empty()) {
         curr_small.copyTo(self->prev_small_gray);
-        curr_luma.copyTo(self->prev_luma);
         self->prev_sid = sid;
         ++self->frame_index;
         return GST_FLOW_OK;
@@ -894,16 +897,18 @@ static GstFlowReturn gst_gva_motion_detect_transform_ip(GstBaseTransform *trans,
 
     cv::UMat morph_small;
     md_build_motion_mask(curr_small, self->prev_small_gray, morph_small, self->pixel_diff_threshold);
+    cv::Mat mask_integral;
+    md_mask_integral(morph_small, mask_integral);
     std::vector<MotionRect> rois;
-    md_scan_blocks(self, morph_small, width, height, small_w, small_h, rois);
+    md_scan_blocks(self, mask_integral, width, height, small_w, small_h, rois);
     if (!rois.empty()) {
         gst_gva_motion_detect_merge_rois(rois);
         gst_gva_motion_detect_process_and_attach(self, buf, rois, width, height);
     }
+    gst_gva_motion_detect_mark_analyzed(self, buf);
 
     // Update previous frames
     curr_small.copyTo(self->prev_small_gray);
-    curr_luma.copyTo(self->prev_luma);
     self->prev_sid = sid;
     ++self->frame_index;
     return GST_FLOW_OK;
@@ -915,6 +920,8 @@ static void gst_gva_motion_detect_finalize(GObject *obj) {
         vaDestroySurfaces(self->va_dpy, &self->scaled_sid, 1);
         self->scaled_sid = VA_INVALID_SURFACE;
     }
+    delete self->cpu;
+    self->cpu = nullptr;
     g_mutex_clear(&self->meta_mutex);
     G_OBJECT_CLASS(gst_gva_motion_detect_parent_class)->finalize(obj);
 }
@@ -925,6 +932,7 @@ static void gst_gva_motion_detect_class_init(GstGvaMotionDetectClass *klass) {
     GObjectClass *oclass = G_OBJECT_CLASS(klass);
 
     GST_DEBUG_CATEGORY_INIT(gst_gva_motion_detect_debug, "gvamotiondetect", 0, "GVA motion detect filter");
+    gva_motion_meta_register();
 
     gst_element_class_set_static_metadata(
         eclass, "Motion detect (auto GPU/CPU)", "Filter/Video",
@@ -1021,6 +1029,7 @@ static void gst_gva_motion_detect_init(GstGvaMotionDetect *self) {
     self->scaled_sid = VA_INVALID_SURFACE;
     self->scaled_w = 0;
     self->scaled_h = 0;
+    self->cpu = new MotionCpuState();
     // Debug environment parsing (simple, no logging here to avoid early flood)
     const gchar *env_dbg = g_getenv("GVA_MD_PRINT");
     self->debug_enabled = (env_dbg && env_dbg[0] != '\0' && g_strcmp0(env_dbg, "0") != 0);
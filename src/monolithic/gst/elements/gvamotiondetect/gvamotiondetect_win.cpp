@@ -21,6 +21,7 @@
 #include <opencv2/imgproc.hpp>
 #include <vector>
 
+#include <dlstreamer/gst/videoanalytics/motion_meta.h>
 #include <dlstreamer/gst/videoanalytics/video_frame.h>
 
 // Linux parity helper: round normalized coordinates to 3 decimal places to reduce metadata verbosity.
@@ -76,7 +77,6 @@ struct _GstGvaMotionDetect {
     int pixel_diff_threshold; // per-pixel luma diff threshold (1..255)
     double min_rel_area;      // minimum relative area (0..0.25) for a motion rectangle
     cv::UMat prev_small_gray;
-    cv::UMat prev_luma;
     cv::Mat block_state; // CV_8U agreement counters
     struct Track {
         int x, y, w, h;
@@ -405,6 +405,16 @@ static void gst_gva_motion_detect_attach_metadata(GstGvaMotionDetect *self, GstB
     g_mutex_unlock(&self->meta_mutex);
 }
 
+// Marks frame as analyzed even if no motion is found, so downstream (e.g. adaptive-interval of inference elements)
+// tells static scene from frames motion detection didn't run on
+static void gst_gva_motion_detect_mark_analyzed(GstGvaMotionDetect *self, GstBuffer *buf) {
+    if (!gst_buffer_is_writable(buf)) {
+        GST_WARNING_OBJECT(self, "Buffer not writable; skipping motion meta");
+        return;
+    }
+    gva_buffer_add_motion_meta(buf);
+}
+
 static GstFlowReturn gst_gva_motion_detect_transform_ip(GstBaseTransform *t, GstBuffer *buf) {
     GstGvaMotionDetect *self = GST_GVA_MOTION_DETECT(t);
     ++self->frame_index;
@@ -432,7 +442,6 @@ static GstFlowReturn gst_gva_motion_detect_transform_ip(GstBaseTransform *t, Gst
     cv::resize(curr_luma, curr_small, cv::Size(small_w, small_h));
     if (self->prev_small_gray.empty()) {
         curr_small.copyTo(self->prev_small_gray);
-        curr_luma.copyTo(self->prev_luma);
         return GST_FLOW_OK;
     }
     // Build motion mask via helper (parity with Linux pipeline)
@@ -487,8 +496,8 @@ static GstFlowReturn gst_gva_motion_detect_transform_ip(GstBaseTransform *t, Gst
     }
     // Attach metadata now that tracks updated
     gst_gva_motion_detect_attach_metadata(self, buf, width, height);
+    gst_gva_motion_detect_mark_analyzed(self, buf);
     curr_small.copyTo(self->prev_small_gray);
-    curr_luma.copyTo(self->prev_luma);
     return GST_FLOW_OK;
 }
 
@@ -503,6 +512,7 @@ static void gst_gva_motion_detect_class_init(GstGvaMotionDetectClass *klass) {
     GstBaseTransformClass *bclass = GST_BASE_TRANSFORM_CLASS(klass);
     GObjectClass *oclass = G_OBJECT_CLASS(klass);
     GST_DEBUG_CATEGORY_INIT(gst_gva_motion_detect_debug_win, "gvamotiondetect", 0, "Motion detect (Windows)");
+    gva_motion_meta_register();
     gst_element_class_set_static_metadata(eclass, "Motion detect (software)", "Filter/Video",
                                           "Windows software motion detection", "dlstreamer");
     static GstStaticPadTemplate sink_templ =
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+// Motion mask helpers shared by the VA (UMat) and system-memory (cv::Mat) paths of gvamotiondetect. Both paths must
+// produce the same 0/1 mask for the same frames, see tests/unit_tests/check/components/motion_mask.
+
+#pragma once
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+// Working buffers of the system-memory path. Kept in plain cv::Mat (no UMat/OpenCL round trips) and reused between
+// frames to avoid per-frame allocations.
+struct MotionCpuState {
+    cv::Mat curr_small;    // downscaled luma of current frame
+    cv::Mat prev_small;    // downscaled luma of previous frame
+    cv::Mat mask;          // 0/1 thresholded blurred difference
+    cv::Mat eroded;        // mask after 3x3 erosion
+    cv::Mat morph;         // mask after opening + dilation
+    cv::Mat mask_integral; // CV_32S integral image of morph, used for O(1) per-block counts
+};
+
+// Build motion mask (absdiff -> blur -> threshold -> morphology) from current small frame and previous small frame.
+// Output mask holds 0/1 values so that its integral image directly gives changed pixel counts.
+inline void md_build_motion_mask(const cv::UMat &curr_small, const cv::UMat &prev_small_gray, cv::UMat &morph_small,
+                                 int pixel_diff_threshold) {
+    int PIXEL_DIFF_THR = std::max(1, std::min(pixel_diff_threshold, 255));
+    cv::UMat diff_small;
+    cv::absdiff(curr_small, prev_small_gray, diff_small);
+    cv::UMat blurred_small;
+    cv::GaussianBlur(diff_small, blurred_small, cv::Size(3, 3), 0);
+    cv::UMat thresh_small;
+    cv::threshold(blurred_small, thresh_small, PIXEL_DIFF_THR, 1, cv::THRESH_BINARY);
+    cv::UMat tmp;
+    cv::Mat ksmall = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+    cv::morphologyEx(thresh_small, tmp, cv::MORPH_OPEN, ksmall);
+    cv::dilate(tmp, morph_small, ksmall, cv::Point(-1, -1), 1);
+}
+
+// BORDER_REFLECT_101 index mapping (same border mode as cv::GaussianBlur default)
+inline int md_reflect101(int i, int n) {
+    if (n == 1)
+        return 0;
+    if (i < 0)
+        return -i;
+    if (i >= n)
+        return 2 * n - i - 2;
+    return i;
+}
+
+// Absolute difference of one row followed by horizontal [1 2 1] pass. Plain loops over contiguous arrays are
+// auto-vectorized by the compiler.
+inline void md_diff_row(const uint8_t *curr, const uint8_t *prev, int w, uint8_t *diff, uint16_t *out) {
+    for (int x = 0; x < w; ++x)
+        diff[x] = (uint8_t)std::abs((int)curr[x] - (int)prev[x]);
+    if (w == 1) {
+        out[0] = (uint16_t)(4 * diff[0]);
+        return;
+    }
+    out[0] = (uint16_t)(2 * diff[0] + 2 * diff[1]);
+    for (int x = 1; x < w - 1; ++x)
+        out[x] = (uint16_t)(diff[x - 1] + 2 * diff[x] + diff[x + 1]);
+    out[w - 1] = (uint16_t)(2 * diff[w - 2] + 2 * diff[w - 1]);
+}
+
+// CPU variant of md_build_motion_mask for system-memory input. Difference, 3x3 Gaussian blur and threshold are fused
+// into a single pass over the downscaled luma: each stripe of rows keeps a rolling window of three horizontally
+// blurred difference rows, so each source row is differenced once and no diff/blur intermediate image is produced.
+// Stripes are processed in parallel. Morphology runs on the small 0/1 mask (opening + dilation equals 3x3 erosion
+// followed by 5x5 dilation) and the integral image of the result is produced for block counting.
+inline void md_build_motion_mask_cpu(MotionCpuState &st, int pixel_diff_threshold) {
+    const cv::Mat &curr = st.curr_small;
+    const cv::Mat &prev = st.prev_small;
+    const int w = curr.cols;
+    const int h = curr.rows;
+    // cv::GaussianBlur 3x3 rounds (sum + 8) >> 4, cv::threshold is strict '>' comparison
+    const int thr = std::max(1, std::min(pixel_diff_threshold, 255));
+    const int sum_thr = thr * 16 + 8;
+    st.mask.create(h, w, CV_8UC1);
+
+    const int stripe_rows = 32;
+    const int nstripes = std::max(1, (h + stripe_rows - 1) / stripe_rows);
+    cv::parallel_for_(
+        cv::Range(0, h),
+        [&](const cv::Range &range) {
+            std::vector<uint8_t> diff(w);
+            std::vector<uint16_t> buf(3 * (size_t)w);
+            uint16_t *above = buf.data();
+            uint16_t *center = above + w;
+            uint16_t *below = center + w;
+            auto load_row = [&](int y, uint16_t *out) {
+                y = md_reflect101(y, h);
+                md_diff_row(curr.ptr<uint8_t>(y), prev.ptr<uint8_t>(y), w, diff.data(), out);
+            };
+            load_row(range.start - 1, above);
+            load_row(range.start, center);
+            for (int y = range.start; y < range.end; ++y) {
+                load_row(y + 1, below);
+                uint8_t *dst = st.mask.ptr<uint8_t>(y);
+                for (int x = 0; x < w; ++x)
+                    dst[x] = (above[x] + 2 * center[x] + below[x]) >= sum_thr ? 1 : 0;
+                std::swap(above, center);
+                std::swap(center, below);
+            }
+        },
+        nstripes);
+
+    static const cv::Mat kerode = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+    static const cv::Mat kdilate = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(5, 5));
+    cv::erode(st.mask, st.eroded, kerode);
+    cv::dilate(st.eroded, st.morph, kdilate);
+    cv::integral(st.morph, st.mask_integral, CV_32S);
+}
+
+// Integral image of (GPU-built) 0/1 motion mask for md_scan_blocks
+inline void md_mask_integral(const cv::UMat &morph_small, cv::Mat &mask_integral) {
+    cv::integral(morph_small.getMat(cv::ACCESS_READ), mask_integral, CV_32S);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -7,6 +7,7 @@
 #include <Python.h>
 #include <gst/gst.h>
 
+#include "analytics_meta_mode.h"
 #include "gstgvapython.h"
 #include "gva_caps.h"
 #include "python_callback_c.h"
@@ -20,13 +21,16 @@
 GST_DEBUG_CATEGORY_STATIC(gst_gva_python_debug_category);
 #define GST_CAT_DEFAULT gst_gva_python_debug_category
 
-enum { PROP_0, PROP_MODULE, PROP_CLASS, PROP_FUNCTION, PROP_ARGUMENT, PROP_KW_ARGUMENT };
+enum { PROP_0, PROP_MODULE, PROP_CLASS, PROP_FUNCTION, PROP_ARGUMENT, PROP_KW_ARGUMENT, PROP_BATCH_SIZE };
 
 #define DEFAULT_MODULE ""
 #define DEFAULT_CLASS ""
 #define DEFAULT_FUNCTION "process_frame"
 #define DEFAULT_ARGUMENT "[]"
 #define DEFAULT_KW_ARGUMENT "{}"
+#define DEFAULT_MIN_BATCH_SIZE 1
+#define DEFAULT_MAX_BATCH_SIZE 1024
+#define DEFAULT_BATCH_SIZE 1
 
 #ifdef NDEBUG
 #define LOG_PYTHON_ERROR(ELEMENT, ...) GST_ERROR_OBJECT(ELEMENT, __VA_ARGS__)
@@ -41,6 +45,8 @@ static void gst_gva_python_set_property(GObject *object, guint property_id, cons
 static void gst_gva_python_get_property(GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 static gboolean gst_gva_python_set_caps(GstBaseTransform *trans, GstCaps *incaps, GstCaps *outcaps);
 static gboolean gst_gva_python_start(GstBaseTransform *trans);
+static gboolean gst_gva_python_stop(GstBaseTransform *trans);
+static gboolean gst_gva_python_sink_event(GstBaseTransform *trans, GstEvent *event);
 static void gst_gva_python_dispose(GObject *object);
 static void gst_gva_python_finalize(GObject *object);
 
@@ -80,6 +86,8 @@ static void gst_gva_python_class_init(GstGvaPythonClass *klass) {
     gobject_class->dispose = gst_gva_python_dispose;
     gobject_class->finalize = gst_gva_python_finalize;
     base_transform_class->start = GST_DEBUG_FUNCPTR(gst_gva_python_start);
+    base_transform_class->stop = GST_DEBUG_FUNCPTR(gst_gva_python_stop);
+    base_transform_class->sink_event = GST_DEBUG_FUNCPTR(gst_gva_python_sink_event);
     base_transform_class->set_caps = GST_DEBUG_FUNCPTR(gst_gva_python_set_caps);
     base_transform_class->transform = NULL;
     base_transform_class->transform_ip = GST_DEBUG_FUNCPTR(gst_gva_python_transform_ip);
@@ -115,6 +123,15 @@ static void gst_gva_python_class_init(GstGvaPythonClass *klass) {
     g_object_class_install_property(gobject_class, PROP_FUNCTION,
                                     g_param_spec_string("function", "Python function name", "Python function name",
                                                         DEFAULT_FUNCTION, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+    g_object_class_install_property(
+        gobject_class, PROP_BATCH_SIZE,
+        g_param_spec_uint("batch-size", "Batch size",
+                          "Number of frames passed to Python function in one call. If greater than 1, function is "
+                          "called with list of frames and returns either single value for all frames or list of "
+                          "values, one per frame. Incomplete batch is processed on EOS or caps change",
+                          DEFAULT_MIN_BATCH_SIZE, DEFAULT_MAX_BATCH_SIZE, DEFAULT_BATCH_SIZE,
+                          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void gst_gva_python_init(GstGvaPython *gvapython) {
@@ -123,6 +140,7 @@ static void gst_gva_python_init(GstGvaPython *gvapython) {
     gvapython->class_name = NULL;
     create_arguments(&gvapython->args, &gvapython->kwargs);
     gvapython->function_name = g_strdup(DEFAULT_FUNCTION);
+    gvapython->batch_size = DEFAULT_BATCH_SIZE;
     gvapython->python_callback = NULL;
 }
 
@@ -150,6 +168,9 @@ void gst_gva_python_get_property(GObject *object, guint property_id, GValue *val
         g_value_set_string(value, argument_string);
         g_free(argument_string);
         break;
+    case PROP_BATCH_SIZE:
+        g_value_set_uint(value, gvapython->batch_size);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -185,6 +206,9 @@ void gst_gva_python_set_property(GObject *object, guint property_id, const GValu
                               ("%s is invalid JSON", g_value_get_string(value)));
         }
         break;
+    case PROP_BATCH_SIZE:
+        gvapython->batch_size = g_value_get_uint(value);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -221,7 +245,8 @@ static gboolean gst_gva_python_start(GstBaseTransform *trans) {
     if (keyword_argument_string && argument_string) {
         gvapython->python_callback =
             create_python_callback(gvapython->module_name, gvapython->class_name, gvapython->function_name,
-                                   argument_string, keyword_argument_string);
+                                   argument_string, keyword_argument_string,
+                                   gva_analytics_meta_only(GST_ELEMENT_CAST(gvapython)));
     }
 
     if (!gvapython->python_callback) {
@@ -236,13 +261,41 @@ static gboolean gst_gva_python_start(GstBaseTransform *trans) {
     return gvapython->python_callback != NULL;
 }
 
+static gboolean gst_gva_python_stop(GstBaseTransform *trans) {
+    GstGvaPython *gvapython = GST_GVA_PYTHON(trans);
+    GST_DEBUG_OBJECT(gvapython, "stop");
+    drop_python_callback_batch(gvapython);
+    return TRUE;
+}
+
 static gboolean gst_gva_python_set_caps(GstBaseTransform *trans, GstCaps *incaps, GstCaps *outcaps) {
     UNUSED(outcaps);
     GstGvaPython *gvapython = GST_GVA_PYTHON(trans);
     GST_DEBUG_OBJECT(gvapython, "set_caps");
+    // Frames of incomplete batch are described by previous caps
+    if (flush_python_callback_batch(gvapython) == GST_FLOW_ERROR)
+        return FALSE;
     return set_python_callback_caps(gvapython->python_callback, incaps);
 }
 
+static gboolean gst_gva_python_sink_event(GstBaseTransform *trans, GstEvent *event) {
+    GstGvaPython *gvapython = GST_GVA_PYTHON(trans);
+    GST_DEBUG_OBJECT(gvapython, "sink_event");
+
+    switch (GST_EVENT_TYPE(event)) {
+    case GST_EVENT_EOS:
+        flush_python_callback_batch(gvapython);
+        break;
+    case GST_EVENT_FLUSH_STOP:
+        drop_python_callback_batch(gvapython);
+        break;
+    default:
+        break;
+    }
+
+    return GST_BASE_TRANSFORM_CLASS(gst_gva_python_parent_class)->sink_event(trans, event);
+}
+
 void gst_gva_python_dispose(GObject *object) {
     GstGvaPython *gvapython = GST_GVA_PYTHON(object);
 
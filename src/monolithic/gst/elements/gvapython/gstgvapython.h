@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -30,6 +30,7 @@ struct _GstGvaPython {
     gchar *function_name;
     void *kwargs;
     void *args;
+    guint batch_size;
     struct PythonCallback *python_callback;
 };
 
@@ -9,9 +9,12 @@
 
 #include "gva_utils.h"
 #include "inference_backend/logger.h"
+#include <dlstreamer/gst/metadata/gstanalyticsparammtd.h>
 
+#include <algorithm>
 #include <dlfcn.h>
 #include <gmodule.h>
+#include <string>
 #ifdef _MSC_VER
 #include <pygobject.h>
 #else
@@ -43,19 +46,6 @@ PyObject *extractClass(PyObjectWrapper &pluginModule, const char *class_name, co
     return PyObject_CallFunctionObjArgs(class_type, NULL);
 }
 
-gboolean callPython(GstBuffer *buffer, GstCaps *caps, PyObjectWrapper &py_frame_class, PyObjectWrapper &py_function) {
-    DECL_WRAPPER(py_buffer, pyg_boxed_new(buffer->mini_object.type, buffer, FALSE /*copy_boxed*/, FALSE /*own_ref*/));
-    DECL_WRAPPER(py_caps, pyg_boxed_new(caps->mini_object.type, caps, FALSE /*copy_boxed*/, FALSE /*own_ref*/));
-    DECL_WRAPPER(frame, PyObject_CallFunctionObjArgs(py_frame_class, (PyObject *)py_buffer, Py_None,
-                                                     (PyObject *)py_caps, nullptr));
-    DECL_WRAPPER(args, Py_BuildValue("(O)", (PyObject *)frame));
-    PyObjectWrapper result(PyObject_CallObject(py_function, args));
-
-    if (((PyObject *)result) == nullptr) {
-        throw std::runtime_error("Error in Python function");
-    }
-    return (PyObject_IsTrue(result) == 1) ? 1 : 0;
-}
 } // namespace
 
 // This function safely imports a Python module from a given file path using Python's importlib.
@@ -207,9 +197,9 @@ void PythonContextInitializer::extendPath(const std::string &module_path) {
 }
 
 PythonCallback::PythonCallback(const char *module_path, const char *class_name, const char *function_name,
-                               const char *args_string, const char *kwargs_string) {
+                               const char *args_string, const char *kwargs_string, bool analytics_meta_only)
+    : analytics_meta_only(analytics_meta_only) {
     ITT_TASK(__FUNCTION__);
-    caps_ptr = nullptr;
     if (module_path == nullptr) {
         throw std::invalid_argument("module_path cannot be empty");
     }
@@ -251,37 +241,117 @@ PythonCallback::PythonCallback(const char *module_path, const char *class_name,
     }
 }
 
+PythonCallback::~PythonCallback() {
+    for (GstBuffer *buffer : batch)
+        gst_buffer_unref(buffer);
+}
+
 void PythonCallback::SetCaps(GstCaps *caps) {
     assert(caps && "Expected vaild caps in PythonCallback::SetCaps!");
-    caps_ptr = caps;
-    if (!(PyObject *)py_frame_class) {
-        GstStructure *caps_s = gst_caps_get_structure((const GstCaps *)caps, 0);
-        const gchar *name = gst_structure_get_name(caps_s);
+    GstStructure *caps_s = gst_caps_get_structure((const GstCaps *)caps, 0);
+    const gchar *name = gst_structure_get_name(caps_s);
+    const char *info_from_caps = nullptr;
 
-        if ((g_strrstr(name, "video")) || (g_strrstr(name, "image"))) {
+    if ((g_strrstr(name, "video")) || (g_strrstr(name, "image"))) {
+        if (!(PyObject *)py_frame_class) {
             // Get gstgva.VideoFrame constructor
             DECL_WRAPPER(gva_module, PyImport_ImportModule("gstgva"));
             if (!py_frame_class.reset(PyObject_GetAttrString(gva_module, "VideoFrame"), "videoframe_class")) {
                 throw std::runtime_error("Error getting gstgva.VideoFrame");
             }
         }
+        info_from_caps = "VideoInfoFromCaps";
+    }
 #ifdef AUDIO
-        else if (g_strrstr(name, "audio")) {
+    else if (g_strrstr(name, "audio")) {
+        if (!(PyObject *)py_frame_class) {
             // Get gstgva.audio.AudioFrame constructor
             DECL_WRAPPER(gva_audio_module, PyImport_ImportModule("gstgva.audio"));
             if (!py_frame_class.reset(PyObject_GetAttrString(gva_audio_module, "AudioFrame"), "audioframe_class")) {
                 throw std::runtime_error("Error getting gstgva.audio.AudioFrame");
             }
         }
+        info_from_caps = "AudioInfoFromCaps";
+    }
 #endif
-        else {
-            throw std::runtime_error("Invalid input caps");
-        }
+    else {
+        throw std::runtime_error("Invalid input caps");
+    }
+
+    // Parse caps once instead of doing it in constructor of every frame
+    DECL_WRAPPER(util_module, PyImport_ImportModule("gstgva.util"));
+    DECL_WRAPPER(py_info_from_caps, PyObject_GetAttrString(util_module, info_from_caps));
+    DECL_WRAPPER(py_caps, pyg_boxed_new(caps->mini_object.type, caps, FALSE /*copy_boxed*/, FALSE /*own_ref*/));
+    if (!py_info.reset(PyObject_CallFunctionObjArgs(py_info_from_caps, (PyObject *)py_caps, nullptr))) {
+        throw std::runtime_error("Error getting frame info from caps");
     }
 }
 
+PyObject *PythonCallback::CreateFrame(GstBuffer *buffer) {
+    // Python VideoFrame reads regions through GstVideoRegionOfInterestMeta, so it is attached for regions stored in
+    // analytics metadata only. Buffer is writable: it is transformed in place or is a shallow copy in batch mode.
+    if (analytics_meta_only)
+        gst_analytics_param_mtd_attach_roi_metas(buffer);
+    DECL_WRAPPER(py_buffer, pyg_boxed_new(buffer->mini_object.type, buffer, FALSE /*copy_boxed*/, FALSE /*own_ref*/));
+    return PyObject_CallFunctionObjArgs(py_frame_class, (PyObject *)py_buffer, (PyObject *)py_info, Py_None, nullptr);
+}
+
 gboolean PythonCallback::CallPython(GstBuffer *buffer) {
-    ITT_TASK(module_name.c_str());
-    gboolean result = callPython(buffer, caps_ptr, py_frame_class, py_function);
-    return result;
+    ITT_TASK(module_name);
+    DECL_WRAPPER(frame, CreateFrame(buffer));
+    DECL_WRAPPER(args, Py_BuildValue("(O)", (PyObject *)frame));
+    PyObjectWrapper result(PyObject_CallObject(py_function, args));
+
+    if (((PyObject *)result) == nullptr) {
+        throw std::runtime_error("Error in Python function");
+    }
+    return (PyObject_IsTrue(result) == 1) ? 1 : 0;
+}
+
+std::vector<bool> PythonCallback::CallPython(const std::vector<GstBuffer *> &buffers) {
+    ITT_TASK(module_name);
+    const Py_ssize_t size = static_cast<Py_ssize_t>(buffers.size());
+    DECL_WRAPPER(frames, PyList_New(size));
+    for (Py_ssize_t i = 0; i < size; i++) {
+        PyObject *frame = CreateFrame(buffers[i]);
+        if (!frame) {
+            throw std::runtime_error("Error creating frame");
+        }
+        // PyList_SET_ITEM steals the reference
+        PyList_SET_ITEM((PyObject *)frames, i, frame);
+    }
+    DECL_WRAPPER(args, Py_BuildValue("(O)", (PyObject *)frames));
+    PyObjectWrapper result(PyObject_CallObject(py_function, args));
+
+    if (((PyObject *)result) == nullptr) {
+        throw std::runtime_error("Error in Python function");
+    }
+
+    std::vector<bool> keep(buffers.size(), true);
+    if (PyList_Check(result) || PyTuple_Check(result)) {
+        if (PySequence_Size(result) != size) {
+            throw std::runtime_error("Python function returned " + std::to_string(PySequence_Size(result)) +
+                                     " results for batch of " + std::to_string(size) + " frames");
+        }
+        for (Py_ssize_t i = 0; i < size; i++) {
+            DECL_WRAPPER(item, PySequence_GetItem(result, i));
+            keep[i] = PyObject_IsTrue(item) == 1;
+        }
+    } else {
+        std::fill(keep.begin(), keep.end(), PyObject_IsTrue(result) == 1);
+    }
+    return keep;
+}
+
+size_t PythonCallback::AddToBatch(GstBuffer *buffer) {
+    std::lock_guard<std::mutex> lock(batch_mutex);
+    batch.push_back(buffer);
+    return batch.size();
+}
+
+std::vector<GstBuffer *> PythonCallback::TakeBatch() {
+    std::lock_guard<std::mutex> lock(batch_mutex);
+    std::vector<GstBuffer *> buffers;
+    buffers.swap(batch);
+    return buffers;
 }
@@ -10,19 +10,39 @@
 
 #include <gst/video/video.h>
 
+#include <mutex>
+#include <vector>
+
 class PythonCallback {
     PyObjectWrapper py_function;
     PyObjectWrapper py_frame_class;
+    // VideoInfo or AudioInfo shared by all frames with current caps
+    PyObjectWrapper py_info;
     std::string module_name;
-    GstCaps *caps_ptr;
+    // Regions of pipeline are stored in analytics metadata only
+    bool analytics_meta_only;
+
+    // Buffers waiting for batched call, owned by callback
+    std::vector<GstBuffer *> batch;
+    std::mutex batch_mutex;
+
+    PyObject *CreateFrame(GstBuffer *buf);
 
   public:
     PythonCallback(const char *module_path, const char *class_name, const char *function_name, const char *args_string,
-                   const char *kwargs_string);
+                   const char *kwargs_string, bool analytics_meta_only);
     void SetCaps(GstCaps *caps);
-    ~PythonCallback() = default;
+    ~PythonCallback();
 
     gboolean CallPython(GstBuffer *buf);
+
+    // Calls function with list of frames. Function returns either single value applied to all frames or sequence
+    // of values, one per frame. Returns whether each frame should be passed downstream
+    std::vector<bool> CallPython(const std::vector<GstBuffer *> &buffers);
+
+    // Takes ownership of buffer, returns number of buffers in batch
+    size_t AddToBatch(GstBuffer *buf);
+    std::vector<GstBuffer *> TakeBatch();
 };
 
 class PythonContextInitializer {
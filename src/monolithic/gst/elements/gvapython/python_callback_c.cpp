@@ -135,7 +135,8 @@ gboolean update_arguments(const char *argument, void **args) {
 }
 
 PythonCallback *create_python_callback(const char *module_path, const char *class_name, const char *function_name,
-                                       const char *args_string, const char *keyword_args_string) {
+                                       const char *args_string, const char *keyword_args_string,
+                                       gboolean analytics_meta_only) {
     if (module_path == nullptr || function_name == nullptr) {
         GST_ERROR("module_path, function_name must not be NULL");
         return nullptr;
@@ -152,7 +153,8 @@ PythonCallback *create_python_callback(const char *module_path, const char *clas
 
     try {
         // smart pointers cannot be used because of mixed c and c++ code
-        return new PythonCallback(module_path, class_name, function_name, args_string, keyword_args_string);
+        return new PythonCallback(module_path, class_name, function_name, args_string, keyword_args_string,
+                                  analytics_meta_only);
     } catch (const std::exception &e) {
         GST_ERROR("%s", Utils::createNestedErrorMsg(e).c_str());
         return nullptr;
@@ -180,6 +182,16 @@ GstFlowReturn invoke_python_callback(GstGvaPython *gvapython, GstBuffer *buffer)
         GST_ELEMENT_ERROR(gvapython, RESOURCE, NOT_FOUND, ("Python_callback is not initialized."), (NULL));
         return GST_FLOW_ERROR;
     }
+    if (gvapython->batch_size > 1) {
+        // Shallow copy input buffer instead of increasing ref count, it is pushed downstream after batch is processed
+        size_t queued = gvapython->python_callback->AddToBatch(gst_buffer_copy(buffer));
+        if (queued >= gvapython->batch_size) {
+            GstFlowReturn ret = flush_python_callback_batch(gvapython);
+            if (ret != GST_FLOW_OK)
+                return ret;
+        }
+        return GST_BASE_TRANSFORM_FLOW_DROPPED;
+    }
     auto context_initializer = PythonContextInitializer();
     try {
         if (gvapython->python_callback->CallPython(buffer)) {
@@ -194,6 +206,48 @@ GstFlowReturn invoke_python_callback(GstGvaPython *gvapython, GstBuffer *buffer)
     }
 }
 
+GstFlowReturn flush_python_callback_batch(GstGvaPython *gvapython) {
+    if (gvapython->python_callback == nullptr)
+        return GST_FLOW_OK;
+    std::vector<GstBuffer *> buffers = gvapython->python_callback->TakeBatch();
+    if (buffers.empty())
+        return GST_FLOW_OK;
+
+    std::vector<bool> keep;
+    {
+        auto context_initializer = PythonContextInitializer();
+        try {
+            keep = gvapython->python_callback->CallPython(buffers);
+        } catch (const std::exception &e) {
+            GST_ERROR("%s", Utils::createNestedErrorMsg(e).c_str());
+            log_python_error(gvapython, true);
+        }
+    }
+    if (keep.empty()) {
+        for (GstBuffer *buffer : buffers)
+            gst_buffer_unref(buffer);
+        return GST_FLOW_ERROR;
+    }
+
+    // Python context is released before pushing, so downstream Python elements can acquire it
+    GstFlowReturn ret = GST_FLOW_OK;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        if (!keep[i] || ret != GST_FLOW_OK) {
+            gst_buffer_unref(buffers[i]);
+            continue;
+        }
+        ret = gst_pad_push(GST_BASE_TRANSFORM_SRC_PAD(gvapython), buffers[i]);
+    }
+    return ret;
+}
+
+void drop_python_callback_batch(GstGvaPython *gvapython) {
+    if (gvapython->python_callback == nullptr)
+        return;
+    for (GstBuffer *buffer : gvapython->python_callback->TakeBatch())
+        gst_buffer_unref(buffer);
+}
+
 void delete_python_callback(struct PythonCallback *python_callback) {
     auto context_initializer = PythonContextInitializer();
     try {
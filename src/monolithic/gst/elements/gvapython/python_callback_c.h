@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -16,8 +16,11 @@ typedef struct PythonCallback PythonCallback;
 gboolean set_python_callback_caps(struct PythonCallback *python_callback, GstCaps *caps);
 
 PythonCallback *create_python_callback(const char *module_path, const char *class_name, const char *function_name,
-                                       const char *args_string, const char *kwargs_string);
+                                       const char *args_string, const char *kwargs_string,
+                                       gboolean analytics_meta_only);
 GstFlowReturn invoke_python_callback(GstGvaPython *gvapython, GstBuffer *buffer);
+GstFlowReturn flush_python_callback_batch(GstGvaPython *gvapython);
+void drop_python_callback_batch(GstGvaPython *gvapython);
 void delete_python_callback(struct PythonCallback *python_callback);
 void log_python_error(GstGvaPython *gvapython, gboolean is_fatal);
 
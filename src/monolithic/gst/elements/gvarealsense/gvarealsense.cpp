@@ -15,6 +15,7 @@
  * Key Features:
  * - Registers a GStreamer source element named "realsense".
  * - Supports the "camera" property for device selection.
+ * - Supports the "pcd-format" property selecting ascii, binary or binary_compressed point cloud output.
  * - Initializes and manages a RealSense pipeline using librealsense.
  * - Implements buffer creation callbacks to provide depth and point cloud data.
  * - Handles GStreamer caps negotiation.
@@ -52,6 +53,8 @@
 #include <errno.h>
 #include <string.h>
 
+#include <algorithm>
+
 // Utlities functions:
 gboolean gva_real_sense_is_device_available(gchar *devPath);
 _rsDeviceList detectedDevices;
@@ -66,7 +69,25 @@ enum { LAST_SIGNAL };
 
 #define RS2_VERTEX_RECOER_SEZE 12 // 3 floats (x, y, z) * 4 bytes each
 
-enum { PROP_0, PROP_CAMERA };
+#define DEFAULT_PCD_FORMAT PcdDataFormat::Ascii
+
+enum { PROP_0, PROP_CAMERA, PROP_PCD_FORMAT };
+
+#define GST_TYPE_REAL_SENSE_PCD_FORMAT (gst_real_sense_pcd_format_get_type())
+
+static GType gst_real_sense_pcd_format_get_type(void) {
+    static GType pcd_format_type = 0;
+    static const GEnumValue pcd_formats[] = {
+        {static_cast<gint>(PcdDataFormat::Ascii), "Text, one point per line", "ascii"},
+        {static_cast<gint>(PcdDataFormat::Binary), "Packed XYZRGB records", "binary"},
+        {static_cast<gint>(PcdDataFormat::BinaryCompressed), "LZF compressed fields", "binary_compressed"},
+        {0, NULL, NULL}};
+
+    if (!pcd_format_type) {
+        pcd_format_type = g_enum_register_static("GstRealSensePcdFormat", pcd_formats);
+    }
+    return pcd_format_type;
+}
 
 // Converts RS2 video format to GST video format.
 static GstVideoFormat get_gst_video_format(rs2_format rsFormat);
@@ -141,6 +162,14 @@ static void gst_real_sense_class_init(GstRealSenseClass *klass) {
         g_param_spec_string("camera", "Camera device (/dev/video*)", "Real Sense camera device", NULL,
                             (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY)));
 
+    g_object_class_install_property(
+        gobject_class, PROP_PCD_FORMAT,
+        g_param_spec_enum("pcd-format", "PCD format",
+                          "Encoding of output point cloud: ascii (text), binary (packed XYZRGB records) or "
+                          "binary_compressed (LZF compressed fields, as written by PCL)",
+                          GST_TYPE_REAL_SENSE_PCD_FORMAT, static_cast<gint>(DEFAULT_PCD_FORMAT),
+                          (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY)));
+
     gst_element_class_set_static_metadata(gstelement_class, "Real Sense camera", "Real Sense video",
                                           "Read from Real Sense camera",
                                           "Deep Learning Stream engineering team, Intel Corporation");
@@ -201,6 +230,10 @@ static void gst_real_sense_init(GstRealSense *src) {
 
     gst_base_src_set_format(GST_BASE_SRC(src), GST_FORMAT_TIME);
 
+    src->pcdFormat = DEFAULT_PCD_FORMAT;
+    src->points = new std::vector<PointXYZRGB>();
+    src->alignToDepth = new rs2::align(RS2_STREAM_DEPTH);
+
     if (detectRealSenseDevices(detectedDevices)) {
         GST_INFO("gst_real_sense_init: RealSense devices detected successfully.\n");
     } else {
@@ -222,6 +255,14 @@ static void gst_real_sense_finalize(GObject *object) {
         GST_ERROR("Failed to finalize GstRealSense, object is NULL\n");
         return;
     }
+
+    GstRealSense *src = GST_REAL_SENSE(object);
+    delete src->points;
+    src->points = nullptr;
+    delete src->alignToDepth;
+    src->alignToDepth = nullptr;
+
+    G_OBJECT_CLASS(parent_class)->finalize(object);
 }
 
 /**
@@ -328,6 +369,11 @@ static void gst_real_sense_set_property(GObject *object, guint prop_id, const GV
 
         break;
     }
+    case PROP_PCD_FORMAT:
+        src->pcdFormat = static_cast<PcdDataFormat>(g_value_get_enum(value));
+        GST_INFO("gst_real_sense_set_property: PCD format set to %s\n",
+                 GvaRealSensePcd::formatToString(src->pcdFormat));
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -357,9 +403,14 @@ static void gst_real_sense_get_property(GObject *object, guint prop_id, GValue *
 
     g_return_if_fail(GST_IS_REAL_SENSE(object));
 
+    GstRealSense *src = GST_REAL_SENSE(object);
+
     switch (prop_id) {
     case PROP_CAMERA:
         break;
+    case PROP_PCD_FORMAT:
+        g_value_set_enum(value, static_cast<gint>(src->pcdFormat));
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
         break;
@@ -382,16 +433,66 @@ gboolean gst_real_sense_is_seekable(GstBaseSrc *src) {
     return FALSE;
 }
 
+/**
+ * @brief Converts depth frame and color frame aligned to it into points.
+ *
+ * Depth streams without distortion (all RealSense depth cameras report zero distortion coefficients) are deprojected
+ * by GvaRealSensePcd::deprojectDepth. Otherwise point coordinates are calculated by rs2::pointcloud, which applies
+ * distortion model of the stream.
+ *
+ * @param depth   Depth frame.
+ * @param color   RGB8 color frame aligned to depth, may be empty.
+ * @param points  Output, one point per depth pixel.
+ */
+static void gst_real_sense_deproject(rs2::depth_frame &depth, rs2::video_frame &color, PointXYZRGB *points) {
+    const rs2_intrinsics rsIntrinsics = depth.get_profile().as<rs2::video_stream_profile>().get_intrinsics();
+
+    DepthIntrinsics intrinsics;
+    intrinsics.width = depth.get_width();
+    intrinsics.height = depth.get_height();
+    intrinsics.fx = rsIntrinsics.fx;
+    intrinsics.fy = rsIntrinsics.fy;
+    intrinsics.ppx = rsIntrinsics.ppx;
+    intrinsics.ppy = rsIntrinsics.ppy;
+
+    const guint8 *rgb = nullptr;
+    gsize rgbStride = 0;
+    if (color && color.get_width() == depth.get_width() && color.get_height() == depth.get_height() &&
+        color.get_bytes_per_pixel() == 3) {
+        rgb = reinterpret_cast<const guint8 *>(color.get_data());
+        rgbStride = color.get_stride_in_bytes();
+    }
+
+    GvaRealSensePcd::deprojectDepth(reinterpret_cast<const guint16 *>(depth.get_data()), depth.get_stride_in_bytes(),
+                                    depth.get_units(), intrinsics, rgb, rgbStride, points);
+
+    bool distorted = false;
+    for (float coeff : rsIntrinsics.coeffs)
+        distorted = distorted || coeff != 0.0f;
+    if (rsIntrinsics.model == RS2_DISTORTION_NONE || !distorted)
+        return;
+
+    rs2::pointcloud pc;
+    rs2::points rsPoints = pc.calculate(depth);
+    const rs2::vertex *vertices = rsPoints.get_vertices();
+    const size_t count = std::min<size_t>(rsPoints.size(), static_cast<size_t>(intrinsics.width) * intrinsics.height);
+    for (size_t i = 0; i < count; ++i) {
+        points[i].x = vertices[i].x;
+        points[i].y = vertices[i].y;
+        points[i].z = vertices[i].z;
+    }
+}
+
 /**
  * @brief Captures a depth frame from a RealSense camera, processes it into a point cloud,
  *        and outputs the point cloud data as a GstBuffer.
  *
  * This function is called by the GStreamer pipeline to create a new buffer containing
  * point cloud data derived from the latest depth frame captured by the RealSense camera.
- * It waits for a new set of frames, extracts the depth frame, and calculates the distance
- * to the object at the center of the image. It then generates a point cloud from the depth
- * frame, allocates a buffer of appropriate size, copies the point cloud vertex data into
- * the buffer, and sets the buffer as the output.
+ * It waits for a new set of frames, aligns the color frame to the depth frame and deprojects
+ * depth pixels to points. The PCD header and the points are then written directly to the
+ * output buffer in the format selected by the "pcd-format" property. Binary records have the layout of
+ * PointXYZRGB, so in binary format depth is deprojected straight into the output buffer.
  *
  * @param basesrc  Pointer to the GstBaseSrc element.
  * @param offset   Offset in the stream (unused).
@@ -412,8 +513,20 @@ static GstFlowReturn gst_real_sense_create(GstBaseSrc *basesrc, guint64 offset,
         return GST_FLOW_ERROR;
     }
 
+    if (offset > G_MAXUINT64) {
+        GST_ERROR("gst_real_sense_create: Invalid offset value: %" G_GINT64_FORMAT "\n", offset);
+        return GST_FLOW_ERROR;
+    }
+
     rs2::frameset frames = src->rsPipeline->wait_for_frames();
 
+    // Color of point is taken from the same pixel of color frame aligned to depth
+    try {
+        frames = src->alignToDepth->process(frames);
+    } catch (const rs2::error &e) {
+        GST_ERROR("gst_real_sense_create: Failed to align color frame to depth: %s\n", e.what());
+    }
+
     // Try to get a frame of a depth image
     rs2::depth_frame depth = frames.get_depth_frame();
 
@@ -428,29 +541,21 @@ static GstFlowReturn gst_real_sense_create(GstBaseSrc *basesrc, guint64 offset,
     }
 
     // Get RGB frame if available
-
-    std::vector<PointXYZRGB> pointCloud;
+    rs2::video_frame colorFrame(rs2::frame{});
     try {
-        rs2::video_frame colorFrame = frames.get_color_frame();
+        colorFrame = frames.get_color_frame();
         if (colorFrame) {
             GST_INFO("gst_real_sense_create: Color frame dimensions: width = %u, height = %u\n", colorFrame.get_width(),
                      colorFrame.get_height());
-
-            pointCloud = GvaRealSensePcd::convertToPointXYZRGB(depth, colorFrame);
         }
     } catch (const rs2::error &e) {
         GST_ERROR("gst_real_sense_create: No color frame available: %s\n", e.what());
     }
 
-    if (offset > G_MAXUINT64) {
-        GST_ERROR("gst_real_sense_create: Invalid offset value: %" G_GINT64_FORMAT "\n", offset);
-        return GST_FLOW_ERROR;
-    }
-
-    // Create a point cloud from the depth frame
-    std::string pcdBuffer = GvaRealSensePcd::buildPcdBuffer(pointCloud);
+    const gsize point_count = static_cast<gsize>(width) * height;
 
-    size_t size_to_allocate = pcdBuffer.size();
+    // Buffer is allocated for the largest PCD and shrunk to the written size
+    const gsize size_to_allocate = GvaRealSensePcd::getMaxPcdSize(point_count, src->pcdFormat);
 
     buffer = gst_buffer_new_allocate(NULL, size_to_allocate, NULL);
 
@@ -465,12 +570,25 @@ static GstFlowReturn gst_real_sense_create(GstBaseSrc *basesrc, guint64 offset,
         return GST_FLOW_ERROR;
     }
 
-    memcpy(map.data, pcdBuffer.data(), size_to_allocate);
+    gsize pcd_size = 0;
+    if (src->pcdFormat == PcdDataFormat::Binary) {
+        // Points are written after the header without intermediate point cloud
+        const std::string header = GvaRealSensePcd::getPcdHeader(point_count, point_count, src->pcdFormat);
+        memcpy(map.data, header.data(), header.size());
+        gst_real_sense_deproject(depth, colorFrame, reinterpret_cast<PointXYZRGB *>(map.data + header.size()));
+        pcd_size = header.size() + point_count * sizeof(PointXYZRGB);
+    } else {
+        // Create a point cloud from the depth frame
+        std::vector<PointXYZRGB> &pointCloud = *src->points;
+        pointCloud.resize(point_count);
+        gst_real_sense_deproject(depth, colorFrame, pointCloud.data());
+        pcd_size = GvaRealSensePcd::buildPcd(pointCloud.data(), pointCloud.size(), src->pcdFormat, map.data);
+    }
 
     gst_buffer_unmap(buffer, &map);
 
     // Set buffer as output
-    gst_buffer_set_size(buffer, size_to_allocate);
+    gst_buffer_set_size(buffer, pcd_size);
     *buf = buffer;
 
     return GST_FLOW_OK;
@@ -14,6 +14,7 @@
  *          - URI string for camera source.
  *          - RealSense pipeline and configuration objects.
  *          - GStreamer video format and caps.
+ *          - Output PCD format and reused point cloud storage.
  * - Declares the function to get the GType for the element.
  */
 
@@ -30,6 +31,8 @@
 // Real Sense
 #include <librealsense2/rs.hpp>
 
+#include "gvarealsense_pcd.h"
+
 G_BEGIN_DECLS
 
 #define GST_TYPE_GVAREALSENSE (gst_real_sense_get_type())
@@ -74,6 +77,10 @@ struct _GstRealSense {
     GstCaps *gstCaps = nullptr;
 
     uint64_t frameCount = 0; // Frame counter for debugging
+
+    PcdDataFormat pcdFormat = PcdDataFormat::Ascii; // Encoding of output point clouds
+    std::vector<PointXYZRGB> *points = nullptr;     // Point cloud of the current frame, reused between frames
+    rs2::align *alignToDepth = nullptr;             // Maps color frames to depth frame pixels
 };
 
 struct _GstRealSenseClass {
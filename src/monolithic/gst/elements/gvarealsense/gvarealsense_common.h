@@ -10,9 +10,13 @@
 #include <glib.h>
 #include <gst/gst.h>
 
+// Layout of the point is the record of binary PCD written by GvaRealSensePcd (fields "x y z r g b _")
 struct PointXYZRGB {
     float x, y, z;
     guint8 r, g, b;
+    guint8 padding;
 };
 
+static_assert(sizeof(PointXYZRGB) == 16, "PointXYZRGB must match binary PCD record size");
+
 #endif // __GVAREALSENSE_COMMON_H__
\ No newline at end of file
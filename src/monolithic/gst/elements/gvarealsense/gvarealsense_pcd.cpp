@@ -5,190 +5,633 @@
  ******************************************************************************/
 /*******************************************************************************
  * @file gvarealsense_pcd.cpp
- * @brief Implementation of GvaRealSensePcdFile class for reading and writing PCD files.
+ * @brief Implementation of GvaRealSensePcd class for reading and writing PCD files.
  *
- * This file contains the implementation of the GvaRealSensePcdFile class, which provides
- * static methods to read from and write to PCD (Point Cloud Data) files in ASCII format.
- * The class handles point clouds with XYZ coordinates and RGB color values.
+ * This file contains the implementation of the GvaRealSensePcd class, which provides
+ * static methods to read from and write to PCD (Point Cloud Data) files in ascii, binary
+ * and binary_compressed formats. The class handles point clouds with XYZ coordinates and
+ * RGB color values.
  ******************************************************************************/
 
 #include "gvarealsense_pcd.h"
 #include "gvarealsense_common.h"
-#include <librealsense2/rs.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace {
+
+// Fields written by GvaRealSensePcd, "_" is padding of PointXYZRGB
+struct PcdField {
+    const char *name;
+    gsize offset;
+    gsize size;
+    char type;
+};
+
+const PcdField POINT_FIELDS[] = {
+    {"x", offsetof(PointXYZRGB, x), 4, 'F'}, {"y", offsetof(PointXYZRGB, y), 4, 'F'},
+    {"z", offsetof(PointXYZRGB, z), 4, 'F'}, {"r", offsetof(PointXYZRGB, r), 1, 'U'},
+    {"g", offsetof(PointXYZRGB, g), 1, 'U'}, {"b", offsetof(PointXYZRGB, b), 1, 'U'},
+    {"_", offsetof(PointXYZRGB, padding), 1, 'U'}};
+
+// Longest "x y z r g b" line of ascii data
+constexpr gsize ASCII_MAX_LINE_LENGTH = 3 * 16 + 3 * 4 + 1;
+
+// binary_compressed data starts with compressed and uncompressed size
+constexpr gsize COMPRESSED_SIZES_LENGTH = 2 * sizeof(uint32_t);
+
+/*
+ * LZF compression used by binary_compressed PCD (same format as liblzf used by PCL).
+ * Control byte below 32 starts run of (ctrl + 1) literal bytes. Otherwise, it is back reference: length - 2 in upper 3
+ * bits (7 means the next byte is added), offset - 1 in lower 5 bits and the following byte.
+ */
+constexpr gsize LZF_HASH_LOG = 14;
+constexpr gsize LZF_MAX_LITERAL = 32;
+constexpr gsize LZF_MAX_OFFSET = 1 << 13;
+constexpr gsize LZF_MAX_REFERENCE = (1 << 8) + (1 << 3);
+
+gsize lzfMaxCompressedSize(gsize size) {
+    // Incompressible data is stored as literal runs, one control byte per run
+    return size + size / LZF_MAX_LITERAL + 1;
+}
+
+inline guint32 lzfHash(const guint8 *p) {
+    const guint32 v = (guint32(p[0]) << 16) | (guint32(p[1]) << 8) | p[2];
+    return ((v * 2654435761u) >> (32 - LZF_HASH_LOG)) & ((1u << LZF_HASH_LOG) - 1);
+}
+
+gsize lzfCompress(const guint8 *in, gsize in_size, guint8 *out) {
+    std::vector<gsize> table(1u << LZF_HASH_LOG, G_MAXSIZE);
+    guint8 *op = out;
+    guint8 *literal_ctrl = op++;
+    gsize literals = 0;
+
+    auto flush_literals = [&]() {
+        if (literals) {
+            *literal_ctrl = static_cast<guint8>(literals - 1);
+            literal_ctrl = op++;
+            literals = 0;
+        }
+    };
+    auto add_literal = [&](guint8 byte) {
+        *op++ = byte;
+        if (++literals == LZF_MAX_LITERAL)
+            flush_literals();
+    };
+
+    gsize ip = 0;
+    while (ip + 2 < in_size) {
+        const guint32 hash = lzfHash(in + ip);
+        const gsize ref = table[hash];
+        table[hash] = ip;
+
+        if (ref != G_MAXSIZE && ip - ref - 1 < LZF_MAX_OFFSET && in[ref] == in[ip] && in[ref + 1] == in[ip + 1] &&
+            in[ref + 2] == in[ip + 2]) {
+            const gsize max_length = std::min(LZF_MAX_REFERENCE, in_size - ip);
+            gsize length = 3;
+            while (length < max_length && in[ref + length] == in[ip + length])
+                ++length;
+
+            flush_literals();
+            // Control byte reserved for literals is used by reference
+            op = literal_ctrl;
+            const gsize offset = ip - ref - 1;
+            const gsize encoded_length = length - 2;
+            if (encoded_length < 7) {
+                *op++ = static_cast<guint8>((offset >> 8) + (encoded_length << 5));
+            } else {
+                *op++ = static_cast<guint8>((offset >> 8) + (7 << 5));
+                *op++ = static_cast<guint8>(encoded_length - 7);
+            }
+            *op++ = static_cast<guint8>(offset & 0xff);
+            literal_ctrl = op++;
+
+            ip += length;
+            continue;
+        }
+        add_literal(in[ip++]);
+    }
+    while (ip < in_size)
+        add_literal(in[ip++]);
+
+    if (literals)
+        *literal_ctrl = static_cast<guint8>(literals - 1);
+    else
+        --op; // Unused control byte
+    return static_cast<gsize>(op - out);
+}
+
+void lzfDecompress(const guint8 *in, gsize in_size, guint8 *out, gsize out_size) {
+    const guint8 *ip = in;
+    const guint8 *const in_end = in + in_size;
+    guint8 *op = out;
+    guint8 *const out_end = out + out_size;
+
+    while (ip < in_end) {
+        gsize ctrl = *ip++;
+        if (ctrl < LZF_MAX_LITERAL) {
+            ++ctrl;
+            if (ip + ctrl > in_end || op + ctrl > out_end)
+                throw std::runtime_error("Corrupted binary_compressed PCD data");
+            std::memcpy(op, ip, ctrl);
+            op += ctrl;
+            ip += ctrl;
+            continue;
+        }
+
+        gsize length = ctrl >> 5;
+        if (length == 7) {
+            if (ip >= in_end)
+                throw std::runtime_error("Corrupted binary_compressed PCD data");
+            length += *ip++;
+        }
+        if (ip >= in_end)
+            throw std::runtime_error("Corrupted binary_compressed PCD data");
+        const gsize offset = ((ctrl & 0x1f) << 8) + *ip++ + 1;
+        length += 2;
+        if (offset > static_cast<gsize>(op - out) || op + length > out_end)
+            throw std::runtime_error("Corrupted binary_compressed PCD data");
+        // Reference may overlap bytes being written
+        const guint8 *ref = op - offset;
+        for (gsize i = 0; i < length; ++i)
+            *op++ = *ref++;
+    }
+    if (op != out_end)
+        throw std::runtime_error("Corrupted binary_compressed PCD data: unexpected uncompressed size");
+}
+
+// Layout of point record read from PCD header
+struct PcdLayout {
+    struct Field {
+        std::string name;
+        gsize size = 0;
+        char type = 'F';
+        gsize count = 1;
+        gsize offset = 0;
+    };
+
+    std::vector<Field> fields;
+    gsize record_size = 0;
+    gsize point_count = 0;
+    std::string data;
+};
+
+std::vector<std::string> splitWords(const std::string &line) {
+    std::istringstream iss(line);
+    std::vector<std::string> words;
+    std::string word;
+    while (iss >> word)
+        words.push_back(word);
+    return words;
+}
+
+// Parses header, returns position of point data
+gsize parseHeader(const guint8 *data, gsize size, PcdLayout &layout) {
+    gsize pos = 0;
+    gsize width = 0, height = 1;
+    bool has_points = false;
+    std::vector<std::string> sizes, types, counts;
+
+    while (pos < size) {
+        const guint8 *eol = static_cast<const guint8 *>(std::memchr(data + pos, '\n', size - pos));
+        const gsize line_end = eol ? static_cast<gsize>(eol - data) : size;
+        std::string line(reinterpret_cast<const char *>(data + pos), line_end - pos);
+        pos = std::min(line_end + 1, size);
+
+        std::vector<std::string> words = splitWords(line);
+        if (words.empty() || words[0][0] == '#')
+            continue;
+        const std::string key = words[0];
+        words.erase(words.begin());
+
+        if (key == "FIELDS") {
+            for (const auto &name : words) {
+                PcdLayout::Field field;
+                field.name = name;
+                layout.fields.push_back(field);
+            }
+        } else if (key == "SIZE") {
+            sizes = words;
+        } else if (key == "TYPE") {
+            types = words;
+        } else if (key == "COUNT") {
+            counts = words;
+        } else if (key == "WIDTH" && !words.empty()) {
+            width = std::stoul(words[0]);
+        } else if (key == "HEIGHT" && !words.empty()) {
+            height = std::stoul(words[0]);
+        } else if (key == "POINTS" && !words.empty()) {
+            layout.point_count = std::stoul(words[0]);
+            has_points = true;
+        } else if (key == "DATA") {
+            if (words.empty())
+                throw std::runtime_error("Invalid PCD header: DATA without format");
+            layout.data = words[0];
+            break;
+        }
+    }
+
+    if (layout.data.empty())
+        throw std::runtime_error("Invalid or unsupported PCD file (no DATA header)");
+    if (layout.fields.empty() || sizes.size() != layout.fields.size() || types.size() != layout.fields.size())
+        throw std::runtime_error("Invalid PCD header: FIELDS, SIZE and TYPE don't match");
+    if (!counts.empty() && counts.size() != layout.fields.size())
+        throw std::runtime_error("Invalid PCD header: FIELDS and COUNT don't match");
+
+    for (size_t i = 0; i < layout.fields.size(); ++i) {
+        auto &field = layout.fields[i];
+        field.size = std::stoul(sizes[i]);
+        field.type = types[i][0];
+        field.count = counts.empty() ? 1 : std::stoul(counts[i]);
+        field.offset = layout.record_size;
+        layout.record_size += field.size * field.count;
+    }
+    if (!has_points)
+        layout.point_count = width * height;
+
+    return pos;
+}
+
+template <typename T>
+T readValue(const guint8 *src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    return value;
+}
+
+// Stores value of field, src points to value of the field in file layout
+void setField(PointXYZRGB &point, const PcdLayout::Field &field, const guint8 *src) {
+    float value = 0;
+    if (field.type == 'F' && field.size == 4)
+        value = readValue<float>(src);
+    else if (field.type == 'F' && field.size == 8)
+        value = static_cast<float>(readValue<double>(src));
+    else if (field.size == 1)
+        value = src[0];
+    else if (field.type == 'U' && field.size == 4)
+        value = static_cast<float>(readValue<guint32>(src));
+
+    if (field.name == "x") {
+        point.x = value;
+    } else if (field.name == "y") {
+        point.y = value;
+    } else if (field.name == "z") {
+        point.z = value;
+    } else if (field.name == "r") {
+        point.r = static_cast<guint8>(value);
+    } else if (field.name == "g") {
+        point.g = static_cast<guint8>(value);
+    } else if (field.name == "b") {
+        point.b = static_cast<guint8>(value);
+    } else if ((field.name == "rgb" || field.name == "rgba") && field.size == 4) {
+        // Color packed to 4 bytes as written by PCL
+        const guint32 rgb = readValue<guint32>(src);
+        point.r = static_cast<guint8>((rgb >> 16) & 0xff);
+        point.g = static_cast<guint8>((rgb >> 8) & 0xff);
+        point.b = static_cast<guint8>(rgb & 0xff);
+    }
+}
+
+void readAscii(const guint8 *data, gsize size, const PcdLayout &layout, std::vector<PointXYZRGB> &points) {
+    gsize pos = 0;
+    std::string line;
+    while (pos < size && points.size() < layout.point_count) {
+        const guint8 *eol = static_cast<const guint8 *>(std::memchr(data + pos, '\n', size - pos));
+        const gsize line_end = eol ? static_cast<gsize>(eol - data) : size;
+        // Mapped file is not null-terminated, so line is copied before parsing
+        line.assign(reinterpret_cast<const char *>(data + pos), line_end - pos);
+        pos = line_end + 1;
+
+        const char *token = line.c_str();
+        PointXYZRGB point = {};
+        bool valid = true;
+        for (const auto &field : layout.fields) {
+            for (gsize c = 0; c < field.count && valid; ++c) {
+                char *end = nullptr;
+                // strtod accepts "nan" written for invalid points
+                const double value = std::strtod(token, &end);
+                if (end == token) {
+                    valid = false;
+                    break;
+                }
+                token = end;
+                if (c != 0)
+                    continue;
+
+                // ASCII value is converted to binary representation of the field
+                guint8 binary[8] = {};
+                if (field.type == 'F' && field.size == 8) {
+                    std::memcpy(binary, &value, sizeof(double));
+                } else if (field.type == 'F') {
+                    const float f = static_cast<float>(value);
+                    std::memcpy(binary, &f, sizeof(float));
+                } else if (field.size == 4) {
+                    const guint32 u = static_cast<guint32>(value);
+                    std::memcpy(binary, &u, sizeof(guint32));
+                } else {
+                    binary[0] = static_cast<guint8>(value);
+                }
+                setField(point, field, binary);
+            }
+        }
+        if (valid)
+            points.push_back(point);
+    }
+}
+
+void readBinary(const guint8 *data, gsize size, const PcdLayout &layout, std::vector<PointXYZRGB> &points) {
+    if (layout.point_count > size / std::max<gsize>(layout.record_size, 1))
+        throw std::runtime_error("Invalid PCD file: binary data is shorter than POINTS");
+
+    points.resize(layout.point_count);
+    for (gsize i = 0; i < layout.point_count; ++i) {
+        const guint8 *record = data + i * layout.record_size;
+        PointXYZRGB &point = points[i];
+        point = {};
+        for (const auto &field : layout.fields)
+            setField(point, field, record + field.offset);
+    }
+}
+
+void readBinaryCompressed(const guint8 *data, gsize size, const PcdLayout &layout, std::vector<PointXYZRGB> &points) {
+    if (size < COMPRESSED_SIZES_LENGTH)
+        throw std::runtime_error("Invalid PCD file: no binary_compressed sizes");
+    const guint32 compressed_size = readValue<guint32>(data);
+    const guint32 uncompressed_size = readValue<guint32>(data + sizeof(guint32));
+    if (compressed_size > size - COMPRESSED_SIZES_LENGTH)
+        throw std::runtime_error("Invalid PCD file: compressed data is shorter than declared");
+    if (uncompressed_size != layout.point_count * layout.record_size)
+        throw std::runtime_error("Invalid PCD file: uncompressed size doesn't match POINTS");
+
+    std::vector<guint8> uncompressed(uncompressed_size);
+    lzfDecompress(data + COMPRESSED_SIZES_LENGTH, compressed_size, uncompressed.data(), uncompressed.size());
+
+    // Values of each field are stored together: all x, then all y, ...
+    points.assign(layout.point_count, PointXYZRGB{});
+    for (const auto &field : layout.fields) {
+        const guint8 *values = uncompressed.data() + layout.point_count * field.offset;
+        const gsize stride = field.size * field.count;
+        for (gsize i = 0; i < layout.point_count; ++i)
+            setField(points[i], field, values + i * stride);
+    }
+}
+
+} // namespace
 
 /**
- * @brief Reads a PCD (Point Cloud Data) file in ASCII format and extracts 3D points with RGB color information.
+ * @brief Reads a PCD (Point Cloud Data) file and extracts 3D points with RGB color information.
  *
- * This method opens the specified PCD file, parses its header to determine the number of points,
- * and reads the point data in ASCII format. Each point is expected to have x, y, z coordinates
- * followed by r, g, b color values. The method returns a vector of PointXYZRGB structures
- * containing the parsed data.
+ * The file is memory-mapped, so binary data is converted to points without intermediate copies.
+ * ascii, binary and binary_compressed data are supported. Fields x, y, z and r, g, b (or rgb packed as done by PCL)
+ * are read, other fields are skipped.
  *
  * @param filename The path to the PCD file to read.
  * @return std::vector<PointXYZRGB> A vector containing all points read from the file.
  * @throws std::runtime_error If the file cannot be opened or if the file format is invalid or unsupported.
  */
 std::vector<PointXYZRGB> GvaRealSensePcd::readFile(const std::string &filename) {
-    std::ifstream file(filename);
-    if (!file.is_open())
-        throw std::runtime_error("Cannot open PCD file for reading: " + filename);
-
-    std::string line;
-    size_t point_count = 0;
-    bool header_ended = false;
-    std::vector<PointXYZRGB> points;
-
-    while (std::getline(file, line)) {
-        if (line.substr(0, 6) == "POINTS") {
-            std::istringstream iss(line);
-            std::string dummy;
-            iss >> dummy >> point_count;
-        }
-        if (line == "DATA ascii") {
-            header_ended = true;
-            break;
+    GError *error = nullptr;
+    std::unique_ptr<GMappedFile, decltype(&g_mapped_file_unref)> file(
+        g_mapped_file_new(filename.c_str(), FALSE, &error), g_mapped_file_unref);
+    if (!file) {
+        std::string message = "Cannot open PCD file for reading: " + filename;
+        if (error) {
+            message += std::string(": ") + error->message;
+            g_error_free(error);
         }
+        throw std::runtime_error(message);
     }
 
-    if (!header_ended)
-        throw std::runtime_error("Invalid or unsupported PCD file (no DATA ascii header)");
+    const guint8 *data = reinterpret_cast<const guint8 *>(g_mapped_file_get_contents(file.get()));
+    const gsize size = g_mapped_file_get_length(file.get());
+    if (!data || size == 0)
+        throw std::runtime_error("Empty PCD file: " + filename);
 
-    points.reserve(point_count);
+    return readBuffer(data, size);
+}; // read
 
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        PointXYZRGB pt;
-        int r, g, b;
-        if (!(iss >> pt.x >> pt.y >> pt.z >> r >> g >> b))
-            continue;
-        pt.r = static_cast<gint8>(r);
-        pt.g = static_cast<gint8>(g);
-        pt.b = static_cast<gint8>(b);
-        points.push_back(pt);
+/**
+ * @brief Parses PCD file content held in memory.
+ *
+ * @param data PCD file content.
+ * @param size Size of the content in bytes.
+ * @return std::vector<PointXYZRGB> A vector containing all points.
+ * @throws std::runtime_error If the content is invalid or unsupported.
+ */
+std::vector<PointXYZRGB> GvaRealSensePcd::readBuffer(const guint8 *data, gsize size) {
+    PcdLayout layout;
+    const gsize data_pos = parseHeader(data, size, layout);
+
+    std::vector<PointXYZRGB> points;
+    if (layout.data == "ascii") {
+        points.reserve(layout.point_count);
+        readAscii(data + data_pos, size - data_pos, layout, points);
+    } else if (layout.data == "binary") {
+        readBinary(data + data_pos, size - data_pos, layout, points);
+    } else if (layout.data == "binary_compressed") {
+        readBinaryCompressed(data + data_pos, size - data_pos, layout, points);
+    } else {
+        throw std::runtime_error("Unsupported PCD data format: " + layout.data);
     }
     return points;
-}; // read
+}
 
 /**
  * @brief Writes a point cloud to a PCD (Point Cloud Data) file.
  *
- * This method serializes a vector of PointXYZRGB points into a PCD file format.
- * It generates and writes the appropriate PCD header, then writes each point's
- * coordinates and RGB color values to the file.
+ * This method serializes a vector of PointXYZRGB points into a PCD file in the requested format.
  *
  * @param filename The path to the output PCD file.
  * @param points A vector containing the point cloud data, where each point includes
  *        x, y, z coordinates and r, g, b color components.
+ * @param format Encoding of point data.
  *
- * @throws std::runtime_error If the file cannot be opened for writing or if the PCD header
- *         cannot be generated.
+ * @throws std::runtime_error If the file cannot be opened or written.
  */
-void GvaRealSensePcd::writeFile(const std::string &filename, const std::vector<PointXYZRGB> &points) {
-    std::ofstream file(filename);
+void GvaRealSensePcd::writeFile(const std::string &filename, const std::vector<PointXYZRGB> &points,
+                                PcdDataFormat format) {
+    std::ofstream file(filename, std::ios::binary);
 
     if (!file.is_open())
         throw std::runtime_error("Cannot open PCD file for writing: " + filename);
 
-    std::string header = getPcdHeader(points.size(), points.size());
-    if (header.empty())
-        throw std::runtime_error("Failed to generate PCD header");
+    std::vector<guint8> content(getMaxPcdSize(points.size(), format));
+    const gsize size = buildPcd(points.data(), points.size(), format, content.data());
 
-    // Write the header to the file
-    file << header;
-    for (const auto &pt : points) {
-        file << pt.x << " " << pt.y << " " << pt.z << " " << static_cast<int>(pt.r) << " " << static_cast<int>(pt.g)
-             << " " << static_cast<int>(pt.b) << "\n";
-    }
+    file.write(reinterpret_cast<const char *>(content.data()), static_cast<std::streamsize>(size));
+    if (!file)
+        throw std::runtime_error("Failed to write PCD file: " + filename);
 }; // write
 
 /**
- * @brief Generates the header string for a PCD (Point Cloud Data) file in ASCII format.
+ * @brief Generates the header string for a PCD (Point Cloud Data) file.
  *
- * The header includes metadata such as version, fields (x, y, z, r, g, b), data types, and placeholders
- * for width and point count. The placeholders ("%d") should be replaced with actual values before writing
- * the header to a file.
+ * The header includes metadata such as version, fields (x, y, z, r, g, b and padding "_" of binary records), data
+ * types, width and point count.
  *
- * @return A string containing the PCD file header with placeholders for width and point count.
+ * @return A string containing the PCD file header.
  */
-std::string GvaRealSensePcd::getPcdHeader(guint width, guint pointCount) {
+std::string GvaRealSensePcd::getPcdHeader(guint width, guint pointCount, PcdDataFormat format) {
+    std::string names, sizes, types, counts;
+    for (const auto &field : POINT_FIELDS) {
+        // Padding is only a part of binary records
+        if (format == PcdDataFormat::Ascii && field.name[0] == '_')
+            continue;
+        names += std::string(" ") + field.name;
+        sizes += " " + std::to_string(field.size);
+        types += std::string(" ") + field.type;
+        counts += " 1";
+    }
+
     std::string header = "# .PCD v0.7 - Point Cloud Data file format\n";
     header += "VERSION 0.7\n";
-    header += "FIELDS x y z r g b\n";
-    header += "SIZE 4 4 4 1 1 1\n";
-    header += "TYPE F F F U U U\n";
-    header += "COUNT 1 1 1 1 1 1\n";
+    header += "FIELDS" + names + "\n";
+    header += "SIZE" + sizes + "\n";
+    header += "TYPE" + types + "\n";
+    header += "COUNT" + counts + "\n";
     header += "WIDTH " + std::to_string(width) + "\n";
     header += "HEIGHT 1\n";
     header += "VIEWPOINT 0 0 0 1 0 0 0\n";
     header += "POINTS " + std::to_string(pointCount) + "\n";
-    header += "DATA ascii\n";
+    header += std::string("DATA ") + formatToString(format) + "\n";
     return header;
 } // getPcdHeader
 
+const char *GvaRealSensePcd::formatToString(PcdDataFormat format) {
+    switch (format) {
+    case PcdDataFormat::Binary:
+        return "binary";
+    case PcdDataFormat::BinaryCompressed:
+        return "binary_compressed";
+    case PcdDataFormat::Ascii:
+    default:
+        return "ascii";
+    }
+}
+
+gsize GvaRealSensePcd::getMaxPcdSize(gsize pointCount, PcdDataFormat format) {
+    const gsize header_size = getPcdHeader(pointCount, pointCount, format).size();
+    switch (format) {
+    case PcdDataFormat::Binary:
+        return header_size + pointCount * sizeof(PointXYZRGB);
+    case PcdDataFormat::BinaryCompressed:
+        return header_size + COMPRESSED_SIZES_LENGTH + lzfMaxCompressedSize(pointCount * sizeof(PointXYZRGB));
+    case PcdDataFormat::Ascii:
+    default:
+        // "%.9g" floats and 3-digit colors with separators, terminating null of the last line
+        return header_size + pointCount * ASCII_MAX_LINE_LENGTH + 1;
+    }
+}
+
 /**
- * @brief Converts a RealSense depth frame and corresponding RGB frame into a vector of PointXYZRGB.
+ * @brief Writes PCD (Point Cloud Data) file content for points to caller memory.
  *
- * This function generates a 3D point cloud from the provided depth frame using the RealSense SDK.
- * Each point in the resulting vector contains the 3D coordinates (x, y, z) of a point in space.
- * The RGB color values for each point are not currently set (commented out in the implementation).
+ * Header is written once. Binary points are PointXYZRGB records copied as is, binary_compressed points are
+ * reordered field by field and LZF compressed, ascii points are printed one per line.
  *
- * @param depthFrame The RealSense depth frame containing depth information.
- * @param rgbFrame The RealSense RGB frame containing color information (currently unused).
- * @return std::vector<PointXYZRGB> A vector containing the 3D points (with uninitialized RGB values).
+ * @param points Points to write.
+ * @param pointCount Number of points.
+ * @param format Encoding of point data.
+ * @param data Output memory, at least getMaxPcdSize(pointCount, format) bytes.
+ * @return Number of bytes written.
  */
-std::vector<PointXYZRGB> GvaRealSensePcd::convertToPointXYZRGB(rs2::depth_frame &depthFrame,
-                                                               rs2::video_frame &rgbFrame) {
-    std::vector<PointXYZRGB> pointCloud;
-    rs2::pointcloud pc;
-    rs2::points points = pc.calculate(depthFrame);
+gsize GvaRealSensePcd::buildPcd(const PointXYZRGB *points, gsize pointCount, PcdDataFormat format, guint8 *data) {
+    const std::string header = getPcdHeader(pointCount, pointCount, format);
+    std::memcpy(data, header.data(), header.size());
+    guint8 *out = data + header.size();
 
-    size_t size = points.size();
-    if (size == 0) {
-        GST_ERROR("convertToPointXYZRGB: No points in the point cloud.\n");
-        return pointCloud;
+    switch (format) {
+    case PcdDataFormat::Binary: {
+        std::memcpy(out, points, pointCount * sizeof(PointXYZRGB));
+        return header.size() + pointCount * sizeof(PointXYZRGB);
+    }
+    case PcdDataFormat::BinaryCompressed: {
+        const gsize uncompressed_size = pointCount * sizeof(PointXYZRGB);
+        thread_local std::vector<guint8> fields;
+        fields.resize(uncompressed_size);
+        for (const auto &field : POINT_FIELDS) {
+            guint8 *values = fields.data() + pointCount * field.offset;
+            const guint8 *src = reinterpret_cast<const guint8 *>(points) + field.offset;
+            for (gsize i = 0; i < pointCount; ++i)
+                std::memcpy(values + i * field.size, src + i * sizeof(PointXYZRGB), field.size);
+        }
+        const guint32 compressed_size =
+            static_cast<guint32>(lzfCompress(fields.data(), uncompressed_size, out + COMPRESSED_SIZES_LENGTH));
+        const guint32 uncompressed_size32 = static_cast<guint32>(uncompressed_size);
+        std::memcpy(out, &compressed_size, sizeof(guint32));
+        std::memcpy(out + sizeof(guint32), &uncompressed_size32, sizeof(guint32));
+        return header.size() + COMPRESSED_SIZES_LENGTH + compressed_size;
+    }
+    case PcdDataFormat::Ascii:
+    default: {
+        char *line = reinterpret_cast<char *>(out);
+        for (gsize i = 0; i < pointCount; ++i) {
+            const PointXYZRGB &pt = points[i];
+            line += g_snprintf(line, ASCII_MAX_LINE_LENGTH + 1, "%.9g %.9g %.9g %u %u %u\n", pt.x, pt.y, pt.z,
+                               static_cast<guint>(pt.r), static_cast<guint>(pt.g), static_cast<guint>(pt.b));
+        }
+        return static_cast<gsize>(reinterpret_cast<guint8 *>(line) - data);
     }
-
-    // Access point cloud data
-    const rs2::vertex *vertices = points.get_vertices();
-
-    const uint8_t *rgb_data = reinterpret_cast<const uint8_t *>(rgbFrame.get_data());
-
-    pointCloud.reserve(size);
-    for (size_t i = 0; i < size; ++i) {
-        PointXYZRGB pt;
-        pt.x = vertices[i].x;
-        pt.y = vertices[i].y;
-        pt.z = vertices[i].z;
-        pt.r = static_cast<guint8>(rgb_data[i * 3]);
-        pt.g = static_cast<guint8>(rgb_data[i * 3] + 1);
-        pt.b = static_cast<guint8>(rgb_data[i * 3] + 2);
-        pointCloud.push_back(pt);
     }
-
-    return pointCloud;
 }
 
 /**
- * @brief Builds a PCD (Point Cloud Data) buffer from a vector of PointXYZRGB points.
+ * @brief Converts depth image and RGB image aligned to it into points.
  *
- * This method generates a string representation of the point cloud in PCD format,
- * including the appropriate header and the list of points with their XYZ coordinates
- * and RGB color values. Each point is written as a line in the format:
- * "x y z r g b", where r, g, and b are cast to integers.
+ * Point of pixel (u, v) with depth d is (d * (u - ppx) / fx, d * (v - ppy) / fy, d), pixels without depth give
+ * (0, 0, 0) as rs2::pointcloud does. Per-column factors are computed once, so the row loop has no divisions or
+ * branches and is vectorized by the compiler.
  *
- * @param points A vector of PointXYZRGB structures representing the point cloud data.
- * @return A string containing the complete PCD file content.
+ * @param depth Depth image, 16-bit values in units of depthScale.
+ * @param depthStride Depth row size in bytes.
+ * @param depthScale Depth unit in meters.
+ * @param intrinsics Intrinsics of depth stream.
+ * @param rgb RGB8 image of depth size, or nullptr.
+ * @param rgbStride RGB row size in bytes.
+ * @param points Output, intrinsics.width * intrinsics.height points.
  */
-std::string GvaRealSensePcd::buildPcdBuffer(std::vector<PointXYZRGB> &points) {
-    std::ostringstream oss;
-    oss << getPcdHeader(points.size(), points.size());
+void GvaRealSensePcd::deprojectDepth(const guint16 *depth, gsize depthStride, float depthScale,
+                                     const DepthIntrinsics &intrinsics, const guint8 *rgb, gsize rgbStride,
+                                     PointXYZRGB *points) {
+    const guint width = intrinsics.width;
+    std::vector<float> x_factors(width);
+    for (guint u = 0; u < width; ++u)
+        x_factors[u] = (static_cast<float>(u) - intrinsics.ppx) / intrinsics.fx;
 
-    for (const auto &pt : points) {
-        oss << pt.x << " " << pt.y << " " << pt.z << " " << static_cast<int>(pt.r) << " " << static_cast<int>(pt.g)
-            << " " << static_cast<int>(pt.b) << "\n";
-    }
+    for (guint v = 0; v < intrinsics.height; ++v) {
+        const guint16 *depth_row =
+            reinterpret_cast<const guint16 *>(reinterpret_cast<const guint8 *>(depth) + v * depthStride);
+        const float y_factor = (static_cast<float>(v) - intrinsics.ppy) / intrinsics.fy;
+        const float *x_factor = x_factors.data();
+        PointXYZRGB *row_points = points + static_cast<gsize>(v) * width;
 
-    return oss.str();
+        for (guint u = 0; u < width; ++u) {
+            const float z = static_cast<float>(depth_row[u]) * depthScale;
+            row_points[u].x = z * x_factor[u];
+            row_points[u].y = z * y_factor;
+            row_points[u].z = z;
+        }
+
+        if (rgb) {
+            const guint8 *rgb_row = rgb + v * rgbStride;
+            for (guint u = 0; u < width; ++u) {
+                row_points[u].r = rgb_row[3 * u];
+                row_points[u].g = rgb_row[3 * u + 1];
+                row_points[u].b = rgb_row[3 * u + 2];
+                row_points[u].padding = 0;
+            }
+        } else {
+            for (guint u = 0; u < width; ++u) {
+                row_points[u].r = row_points[u].g = row_points[u].b = 0;
+                row_points[u].padding = 0;
+            }
+        }
+    }
 }
 
 void GvaRealSensePcd::writeRGBFile(const std::string &filename, const std::vector<PointXYZRGB> &points) {
@@ -8,18 +8,20 @@
  * @class GvaRealSensePcd
  * @brief Utility class for reading and writing PCD (Point Cloud Data) files with XYZRGB points.
  *
- * This class provides static methods to read from and write to PCD files in ASCII format,
- * specifically handling point clouds where each point contains x, y, z coordinates and RGB color values.
+ * This class provides static methods to read from and write to PCD files in ascii, binary and binary_compressed
+ * formats, specifically handling point clouds where each point contains x, y, z coordinates and RGB color values.
  *
- * - The `read` method parses a PCD file and returns a vector of PointXYZRGB structures.
- * - The `write` method serializes a vector of PointXYZRGB structures into a PCD file.
+ * - The `readFile` method memory-maps a PCD file and returns a vector of PointXYZRGB structures.
+ * - The `writeFile` method serializes a vector of PointXYZRGB structures into a PCD file.
+ * - The `buildPcd` method writes PCD directly to caller memory (e.g. mapped GstBuffer).
+ * - The `deprojectDepth` method converts depth image to points.
  *
  * Copy operations are deleted to prevent accidental copying, but move operations are allowed.
  *
  * Usage example:
  * @code
- * std::vector<PointXYZRGB> points = GvaRealSensePcd::read("input.pcd");
- * GvaRealSensePcd::write("output.pcd", points);
+ * std::vector<PointXYZRGB> points = GvaRealSensePcd::readFile("input.pcd");
+ * GvaRealSensePcd::writeFile("output.pcd", points, PcdDataFormat::Binary);
  * @endcode
  */
 
@@ -33,7 +35,17 @@
 #include <vector>
 
 #include "gvarealsense_common.h"
-#include <librealsense2/rs.hpp>
+
+// Encoding of point data in PCD file, value of DATA header entry
+enum class PcdDataFormat { Ascii, Binary, BinaryCompressed };
+
+// Pinhole model of depth stream, distortion is not applied
+struct DepthIntrinsics {
+    guint width;
+    guint height;
+    float fx, fy;
+    float ppx, ppy;
+};
 
 class GvaRealSensePcd {
   public:
@@ -45,18 +57,27 @@ class GvaRealSensePcd {
     GvaRealSensePcd &operator=(GvaRealSensePcd &&) = default;
 
     static std::vector<PointXYZRGB> readFile(const std::string &filename);
-    static void writeFile(const std::string &filename, const std::vector<PointXYZRGB> &points);
+    static std::vector<PointXYZRGB> readBuffer(const guint8 *data, gsize size);
+    static void writeFile(const std::string &filename, const std::vector<PointXYZRGB> &points,
+                          PcdDataFormat format = PcdDataFormat::Ascii);
     static void writeRGBFile(const std::string &filename, const std::vector<PointXYZRGB> &points);
 
-    // Reads frame from RealSense camera and returns a vector of PointXYZRGB points.
-    static std::vector<PointXYZRGB> readRSFrame();
-
     // Returns the header string for a PCD file, which includes metadata such as version, fields, and data type.
-    static std::string getPcdHeader(guint width, guint pointCount);
+    static std::string getPcdHeader(guint width, guint pointCount, PcdDataFormat format = PcdDataFormat::Ascii);
+
+    // Returns size of memory sufficient for buildPcd() output.
+    static gsize getMaxPcdSize(gsize pointCount, PcdDataFormat format);
+
+    // Writes PCD file content to data, which holds at least getMaxPcdSize() bytes. Returns number of written bytes.
+    static gsize buildPcd(const PointXYZRGB *points, gsize pointCount, PcdDataFormat format, guint8 *data);
 
-    static std::vector<PointXYZRGB> convertToPointXYZRGB(rs2::depth_frame &depthFrame, rs2::video_frame &rgbFrame);
+    // Converts depth image (16-bit units of depthScale meters) to points of width * height organized cloud. Color of
+    // point is taken from RGB image of the same size aligned to depth, points are black if rgb is null.
+    static void deprojectDepth(const guint16 *depth, gsize depthStride, float depthScale,
+                               const DepthIntrinsics &intrinsics, const guint8 *rgb, gsize rgbStride,
+                               PointXYZRGB *points);
 
-    static std::string buildPcdBuffer(std::vector<PointXYZRGB> &points);
+    static const char *formatToString(PcdDataFormat format);
 };
 
-#endif // __GVAREALSENSE_PCD_H__
\ No newline at end of file
+#endif // __GVAREALSENSE_PCD_H__
@@ -284,49 +284,3 @@ gboolean is_rs_device_available(const char *device) {
 
     return bRet;
 } // is_rs_device_available
-
-/**
- * @brief Builds a buffer containing point cloud data in PCD (Point Cloud Library) format for x, y, z, r, g, b
- * variables.
- *
- * This function constructs a PCD file buffer (ASCII format) from provided vectors of x, y, z coordinates and r, g, b
- * color values. The output buffer can be saved directly as a .pcd file or used for further processing.
- *
- * @param x Vector of x coordinates.
- * @param y Vector of y coordinates.
- * @param z Vector of z coordinates.
- * @param r Vector of red color values (0-255).
- * @param g Vector of green color values (0-255).
- * @param b Vector of blue color values (0-255).
- * @return std::string containing the PCD file content.
- */
-std::string build_pcd_buffer(const std::vector<float> &x, const std::vector<float> &y, const std::vector<float> &z,
-                             const std::vector<uint8_t> &r, const std::vector<uint8_t> &g,
-                             const std::vector<uint8_t> &b) {
-    size_t num_points = x.size();
-    if (y.size() != num_points || z.size() != num_points || r.size() != num_points || g.size() != num_points ||
-        b.size() != num_points) {
-        g_print("build_pcd_buffer: Input vector sizes do not match\n");
-        return "";
-    }
-
-    std::ostringstream oss;
-    oss << "# .PCD v0.7 - Point Cloud Data file format\n";
-    oss << "VERSION 0.7\n";
-    oss << "FIELDS x y z r g b\n";
-    oss << "SIZE 4 4 4 1 1 1\n";
-    oss << "TYPE F F F U U U\n";
-    oss << "COUNT 1 1 1 1 1 1\n";
-    oss << "WIDTH " << num_points << "\n";
-    oss << "HEIGHT 1\n";
-    oss << "VIEWPOINT 0 0 0 1 0 0 0\n";
-    oss << "POINTS " << num_points << "\n";
-    oss << "DATA ascii\n";
-
-    for (size_t i = 0; i < num_points; ++i) {
-        oss << x[i] << " " << y[i] << " " << z[i] << " " << static_cast<int>(r[i]) << " " << static_cast<int>(g[i])
-            << " " << static_cast<int>(b[i]) << "\n";
-    }
-
-    return oss.str();
-}
\ No newline at end of file
@@ -32,6 +32,7 @@
 #include "gva_caps.h"
 #include "gva_utils.h"
 #include "inference_backend/buffer_mapper.h"
+#include "mask_codec.h"
 #include "so_loader.h"
 #include "utils.h"
 #include "video_frame.h"
@@ -863,10 +864,17 @@ void Impl::preparePrimsForTensor(const GVA::Tensor &tensor, GVA::Rect<double> re
     }
 
     if (tensor.format() == "segmentation_mask") {
-        std::vector<float> mask = tensor.data<float>();
         std::vector<guint> dims = tensor.dims();
         assert(dims.size() == 2);
         const cv::Size &mask_size{int(dims[0]), int(dims[1])};
+        std::vector<float> mask;
+        if (tensor.get_string(MaskCodec::ENCODING_FIELD) == MaskCodec::BITMASK) {
+            const std::vector<uint8_t> bits = tensor.data<uint8_t>();
+            mask.resize(mask_size.area());
+            MaskCodec::unpackBits(bits.data(), bits.size(), mask.data(), mask.size());
+        } else {
+            mask = tensor.data<float>();
+        }
         cv::Rect2f box(rect.x, rect.y, rect.w, rect.h);
         Color color = indexToColor(color_index);
 
@@ -893,9 +901,20 @@ void Impl::preparePrimsForTensor(const GVA::Tensor &tensor, GVA::Rect<double> re
     }
 
     if (tensor.format() == "semantic_mask") {
-        assert(tensor.precision() == GVA::Tensor::Precision::I64);
-        std::vector<int64_t> mask = tensor.data<int64_t>();
         std::vector<guint> dims = tensor.dims();
+        std::vector<int64_t> mask;
+        if (tensor.get_string(MaskCodec::ENCODING_FIELD) == MaskCodec::RLE) {
+            const std::vector<uint8_t> rle = tensor.data<uint8_t>();
+            // dims[0] is batch dimension of model output, mask of one frame is encoded
+            size_t size = 1;
+            for (size_t i = 1; i < dims.size(); ++i)
+                size *= dims[i];
+            mask.resize(size);
+            MaskCodec::decodeRle(rle.data(), rle.size(), mask.data(), mask.size());
+        } else {
+            assert(tensor.precision() == GVA::Tensor::Precision::I64);
+            mask = tensor.data<int64_t>();
+        }
         const cv::Size &mask_size{int(dims[1]), int(dims[2])};
         cv::Rect2f box(rect.x, rect.y, rect.w, rect.h);
         prims.emplace_back(render::SemanticSegmantationMask(mask, mask_size, box));
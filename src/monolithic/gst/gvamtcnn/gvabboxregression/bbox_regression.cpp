@@ -218,7 +218,7 @@ gboolean process_onet_output(GstGvaBBoxRegression *bboxregression, GstBuffer *bu
         FaceCandidate *c = &g_array_index(candidates, FaceCandidate, i);
 
         GstBuffer **writable_buffer = &buffer;
-        gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
+        gva_buffer_make_metadata_writable(writable_buffer, PRETTY_FUNCTION_NAME);
 
         GstStructure *structure = gst_structure_new(
             "bboxregression", "score", G_TYPE_DOUBLE, c->score, "left_eye_x", G_TYPE_INT, c->left_eye_x, "right_eye_x",
@@ -9,6 +9,7 @@
 #include <gst/base/gstbasetransform.h>
 #include <gst/gst.h>
 
+#include "analytics_meta_mode.h"
 #include "bbox_regression.h"
 #include "config.h"
 #include "utils.h"
@@ -201,6 +202,14 @@ static gboolean gst_gva_bbox_regression_start(GstBaseTransform *trans) {
     GST_INFO_OBJECT(bboxregression, "%s parameters:\n -- Mode: %s\n",
                     GST_ELEMENT_NAME(GST_ELEMENT_CAST(bboxregression)), mode_type_to_string(bboxregression->mode));
 
+    // Regressed regions replace original ones, which isn't possible for regions stored in analytics metadata only
+    if (gva_analytics_meta_only(GST_ELEMENT_CAST(bboxregression))) {
+        GST_ELEMENT_ERROR(bboxregression, CORE, STATE_CHANGE,
+                          ("gvabboxregression doesn't support analytics-meta-only mode"),
+                          ("regions can't be removed from GstAnalyticsRelationMeta"));
+        return FALSE;
+    }
+
     return TRUE;
 }
 
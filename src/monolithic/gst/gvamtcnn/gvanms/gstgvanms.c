@@ -9,6 +9,7 @@
 #include <gst/base/gstbasetransform.h>
 #include <gst/gst.h>
 
+#include "analytics_meta_mode.h"
 #include "config.h"
 #include "gva_caps.h"
 #include "nms.h"
@@ -230,6 +231,13 @@ static gboolean gst_gva_nms_start(GstBaseTransform *trans) {
                     GST_ELEMENT_NAME(GST_ELEMENT_CAST(nms)), mode_type_to_string(nms->mode), nms->threshold,
                     nms->merge ? "true" : "false");
 
+    // Suppressed regions are removed from frame, which isn't possible for regions stored in analytics metadata only
+    if (gva_analytics_meta_only(GST_ELEMENT_CAST(nms))) {
+        GST_ELEMENT_ERROR(nms, CORE, STATE_CHANGE, ("gvanms doesn't support analytics-meta-only mode"),
+                          ("regions can't be removed from GstAnalyticsRelationMeta"));
+        return FALSE;
+    }
+
     return TRUE;
 }
 
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "adaptive_interval.h"
+
+#include "gva_utils.h"
+#include "motion_meta.h"
+
+#include <gst/analytics/analytics.h>
+
+#include <algorithm>
+#include <cmath>
+
+AdaptiveInterval::AdaptiveInterval(unsigned min_interval, unsigned max_interval)
+    : min_interval(std::max(1u, min_interval)), max_interval(std::max(std::max(1u, min_interval), max_interval)),
+      interval(this->min_interval) {
+}
+
+AdaptiveInterval::Activity AdaptiveInterval::GetActivity(GstBuffer *buffer, const GstVideoInfo *info) {
+    Activity activity;
+    // Frame analyzed by gvamotiondetect without motion ROIs has no motion, rather than unknown activity
+    activity.has_motion_info = gva_buffer_has_motion_meta(buffer);
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+    if (!relation_meta || !info)
+        return activity;
+
+    static const GQuark motion_quark = g_quark_from_static_string("motion");
+    const double frame_area = static_cast<double>(info->width) * info->height;
+
+    double motion_area = 0.0;
+    double confidence_sum = 0.0;
+    size_t tracked_count = 0;
+
+    gpointer state = nullptr;
+    GstAnalyticsODMtd od_mtd;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
+        if (gst_analytics_od_mtd_get_obj_type(&od_mtd) == motion_quark) {
+            gint x, y, w, h;
+            if (gst_analytics_od_mtd_get_location(&od_mtd, &x, &y, &w, &h, nullptr))
+                motion_area += static_cast<double>(w) * h;
+            activity.has_motion_info = true;
+            continue;
+        }
+
+        int id;
+        if (!get_od_id(od_mtd, &id))
+            continue;
+        gfloat confidence = 0.f;
+        gst_analytics_od_mtd_get_confidence_lvl(&od_mtd, &confidence);
+        confidence_sum += confidence;
+        tracked_count++;
+    }
+
+    if (frame_area > 0)
+        activity.motion_area = std::min(1.0, motion_area / frame_area);
+    if (tracked_count) {
+        activity.has_tracking_info = true;
+        activity.tracking_confidence = confidence_sum / tracked_count;
+    }
+    return activity;
+}
+
+unsigned AdaptiveInterval::Update(const Activity &activity, size_t free_requests, size_t nireq) {
+    // Activity score in [0, 1]: 1 - run at min_interval, 0 - nothing happens in the scene
+    // Without any information the scene is treated as fully active, zero motion area means static scene
+    double score = 1.0;
+    if (activity.has_motion_info || activity.has_tracking_info) {
+        double motion_score = activity.has_motion_info ? std::min(1.0, activity.motion_area / MOTION_AREA_ACTIVE) : 0.0;
+        double tracking_score =
+            activity.has_tracking_info
+                ? std::clamp((TRACKING_CONFIDENCE_STABLE - activity.tracking_confidence) / TRACKING_CONFIDENCE_STABLE,
+                             0.0, 1.0)
+                : 0.0;
+        score = std::max(motion_score, tracking_score);
+    }
+    // React to activity rise immediately, decay slowly
+    smoothed_activity = score > smoothed_activity ? score : smoothed_activity + SMOOTHING * (score - smoothed_activity);
+
+    if (nireq) {
+        double occupancy = 1.0 - static_cast<double>(std::min(free_requests, nireq)) / nireq;
+        smoothed_load += SMOOTHING * (occupancy - smoothed_load);
+        if (smoothed_load > LOAD_HIGH)
+            load_scale = std::min(load_scale * LOAD_BACKOFF, static_cast<double>(max_interval));
+        else if (smoothed_load < LOAD_LOW)
+            load_scale = std::max(load_scale * LOAD_RECOVERY, 1.0);
+    }
+
+    double content_interval = min_interval + (1.0 - smoothed_activity) * (max_interval - min_interval);
+    double target = std::round(content_interval * load_scale);
+    target = std::clamp(target, static_cast<double>(min_interval), static_cast<double>(max_interval));
+    interval = static_cast<unsigned>(target);
+    return interval;
+}
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <gst/gst.h>
+#include <gst/video/video.h>
+
+#include <cstddef>
+
+/**
+ * Computes per-stream inference interval between [min_interval, max_interval] from scene activity and load of the
+ * (possibly shared) inference instance.
+ *
+ * Scene activity is estimated from motion ROIs attached by gvamotiondetect (share of frame area in motion) and from
+ * confidence of tracked objects. Load is occupancy of inference requests. All streams sharing one model instance
+ * observe the same occupancy, so under saturation they back off by the same factor instead of dropping frames
+ * randomly as no-block does.
+ */
+class AdaptiveInterval {
+  public:
+    struct Activity {
+        bool has_motion_info = false; // frame analyzed by gvamotiondetect, motion_area is 0 if it found no motion
+        double motion_area = 0.0;     // share of frame area covered by motion ROIs, [0, 1]
+        bool has_tracking_info = false;
+        double tracking_confidence = 0.0; // mean confidence of tracked objects, [0, 1]
+    };
+
+    AdaptiveInterval(unsigned min_interval, unsigned max_interval);
+
+    // Extracts activity estimation from analytics metadata of the buffer. Motion info is known for frames marked by
+    // gvamotiondetect (see motion_meta.h) or having motion ROIs, unknown otherwise
+    static Activity GetActivity(GstBuffer *buffer, const GstVideoInfo *info);
+
+    // Updates controller with current frame statistics and returns interval to apply
+    unsigned Update(const Activity &activity, size_t free_requests, size_t nireq);
+
+    unsigned GetInterval() const {
+        return interval;
+    }
+
+  private:
+    // Motion area at which scene is considered fully active
+    static constexpr double MOTION_AREA_ACTIVE = 0.05;
+    // Tracked objects with mean confidence above this value don't require frequent re-detection
+    static constexpr double TRACKING_CONFIDENCE_STABLE = 0.8;
+    // Occupancy watermarks for load control
+    static constexpr double LOAD_HIGH = 0.9;
+    static constexpr double LOAD_LOW = 0.5;
+    static constexpr double LOAD_BACKOFF = 1.25;
+    static constexpr double LOAD_RECOVERY = 0.95;
+    static constexpr double SMOOTHING = 0.2;
+
+    unsigned min_interval;
+    unsigned max_interval;
+    unsigned interval;
+    double smoothed_activity = 1.0;
+    double smoothed_load = 0.0;
+    double load_scale = 1.0;
+};
@@ -6,6 +6,7 @@
 
 #include "gva_base_inference.h"
 
+#include "analytics_meta_mode.h"
 #include "common/post_processor/post_processor_c.h"
 #include "common/pre_processors.h"
 #include "config.h"
@@ -17,11 +18,16 @@
 #include "inference_impl.h"
 
 #include "gva_base_inference_priv.hpp"
+#include "gva_utils.h"
+#include "model_loader.h"
+#include "startup_profiler.h"
+#include <chrono>
 #include <memory>
 
 #define DEFAULT_MODEL nullptr
 #define DEFAULT_MODEL_INSTANCE_ID nullptr
 #define DEFAULT_SCHEDULING_POLICY "throughput"
+#define DEFAULT_REQUEST_SCHEDULING "fifo"
 #define DEFAULT_MODEL_PROC nullptr
 #define DEFAULT_DEVICE "CPU"
 #define DEFAULT_PRE_PROC "" // empty = autoselection
@@ -38,6 +44,9 @@
 #define DEFAULT_INFERENCE_INTERVAL 1
 #define DEFAULT_FIRST_FRAME_NUM 0
 
+#define DEFAULT_ADAPTIVE_INTERVAL FALSE
+#define DEFAULT_MAX_ADAPTIVE_INFERENCE_INTERVAL 8
+
 #define DEFAULT_RESHAPE FALSE
 
 #define DEFAULT_MIN_BATCH_SIZE 0
@@ -52,12 +61,40 @@
 #define DEFAULT_MAX_RESHAPE_HEIGHT UINT_MAX
 #define DEFAULT_RESHAPE_HEIGHT 0
 
+#define DEFAULT_SHAPE_BUCKETS ""
+
+#define DEFAULT_MIN_TILE_SIZE 32
+#define DEFAULT_MAX_TILE_SIZE UINT_MAX
+#define DEFAULT_TILE_SIZE 640
+
+#define DEFAULT_MIN_TILE_OVERLAP 0.
+#define DEFAULT_MAX_TILE_OVERLAP 0.9
+#define DEFAULT_TILE_OVERLAP 0.2
+
+#define DEFAULT_TILE_MERGE_THRESHOLD 0.5
+#define DEFAULT_TILE_SKIP_STATIC FALSE
+
 #define DEFAULT_NO_BLOCK FALSE
 
 #define DEFAULT_MIN_NIREQ 0
 #define DEFAULT_MAX_NIREQ 1024
 #define DEFAULT_NIREQ 0
 
+#define DEFAULT_MIN_POST_PROC_THREADS 0
+#define DEFAULT_MAX_POST_PROC_THREADS 64
+#define DEFAULT_POST_PROC_THREADS 0
+
+#define DEFAULT_MIN_SCHEDULING_PRIORITY 1
+#define DEFAULT_MAX_SCHEDULING_PRIORITY 1000
+#define DEFAULT_SCHEDULING_PRIORITY 1
+
+#define DEFAULT_MIN_LATENCY_BUDGET 0
+#define DEFAULT_MAX_LATENCY_BUDGET UINT_MAX
+#define DEFAULT_LATENCY_BUDGET 0
+
+#define DEFAULT_ASYNC_MODEL_LOAD FALSE
+#define DEFAULT_CPU_PLACEMENT ""
+
 #define DEFAULT_CPU_THROUGHPUT_STREAMS 0
 #define DEFAULT_MIN_CPU_THROUGHPUT_STREAMS 0
 #define DEFAULT_MAX_CPU_THROUGHPUT_STREAMS UINT_MAX
@@ -83,19 +120,31 @@ GST_DEBUG_CATEGORY_STATIC(gva_base_inference_debug_category);
 
 extern std::shared_ptr<InferenceImpl> acquire_inference_instance(GvaBaseInference *base_inference);
 
+static void complete_initialization(GvaBaseInference *base_inference, const std::shared_ptr<InferenceImpl> &instance);
+static gboolean wait_model_loading(GvaBaseInference *base_inference);
+
 enum {
     PROP_0,
     PROP_MODEL,
     PROP_DEVICE,
     PROP_INFERENCE_INTERVAL,
+    PROP_ADAPTIVE_INTERVAL,
+    PROP_MAX_INFERENCE_INTERVAL,
     PROP_RESHAPE,
     PROP_BATCH_SIZE,
     PROP_RESHAPE_WIDTH,
     PROP_RESHAPE_HEIGHT,
+    PROP_SHAPE_BUCKETS,
     PROP_NO_BLOCK,
     PROP_NIREQ,
+    PROP_POST_PROC_THREADS,
+    PROP_ASYNC_MODEL_LOAD,
+    PROP_CPU_PLACEMENT,
     PROP_MODEL_INSTANCE_ID,
     PROP_SCHEDULING_POLICY,
+    PROP_REQUEST_SCHEDULING,
+    PROP_SCHEDULING_PRIORITY,
+    PROP_LATENCY_BUDGET,
     PROP_PRE_PROC_BACKEND,
     PROP_MODEL_PROC,
     PROP_CPU_THROUGHPUT_STREAMS,
@@ -103,6 +152,11 @@ enum {
     PROP_IE_CONFIG,
     PROP_PRE_PROC_CONFIG,
     PROP_INFERENCE_REGION,
+    PROP_TILE_WIDTH,
+    PROP_TILE_HEIGHT,
+    PROP_TILE_OVERLAP,
+    PROP_TILE_MERGE_THRESHOLD,
+    PROP_TILE_SKIP_STATIC,
     PROP_OBJECT_CLASS,
     PROP_LABELS,
     PROP_LABELS_FILE,
@@ -117,6 +171,8 @@ GType gst_gva_base_inference_get_inf_region(void) {
     static GType gva_inference_region = 0;
     static const GEnumValue inference_region_types[] = {{FULL_FRAME, "Perform inference for full frame", "full-frame"},
                                                         {ROI_LIST, "Perform inference for roi list", "roi-list"},
+                                                        {TILES, "Perform inference for overlapping tiles of frame",
+                                                         "tiles"},
                                                         {0, nullptr, nullptr}};
 
     if (!gva_inference_region) {
@@ -257,6 +313,34 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                             "model-instance-id; recommended batch-size less than or equal to the number of streams) ",
                             DEFAULT_SCHEDULING_POLICY, (GParamFlags)(param_flags)));
 
+    g_object_class_install_property(
+        gobject_class, PROP_REQUEST_SCHEDULING,
+        g_param_spec_string("request-scheduling", "Request Scheduling",
+                            "Order in which streams sharing same model instance take free inference requests: "
+                            "fifo (in order of arrival), "
+                            "round-robin (one request per waiting stream in turn), "
+                            "weighted-fair (waiting streams share requests in proportion to scheduling-priority), "
+                            "deadline (earliest deadline first, deadline is frame presentation time plus "
+                            "latency-budget). Time each element waited for requests is reported in INFO log on stop",
+                            DEFAULT_REQUEST_SCHEDULING, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_SCHEDULING_PRIORITY,
+        g_param_spec_uint("scheduling-priority", "Scheduling Priority",
+                          "Weight of this element's stream for request-scheduling=weighted-fair. Not shared with other "
+                          "elements of model-instance-id",
+                          DEFAULT_MIN_SCHEDULING_PRIORITY, DEFAULT_MAX_SCHEDULING_PRIORITY,
+                          DEFAULT_SCHEDULING_PRIORITY, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_LATENCY_BUDGET,
+        g_param_spec_uint("latency-budget", "Latency Budget",
+                          "Time in milliseconds after frame presentation time by which the frame should get inference "
+                          "request, for request-scheduling=deadline. Not shared with other elements of "
+                          "model-instance-id",
+                          DEFAULT_MIN_LATENCY_BUDGET, DEFAULT_MAX_LATENCY_BUDGET, DEFAULT_LATENCY_BUDGET,
+                          param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_PRE_PROC_BACKEND,
         g_param_spec_string(
@@ -297,6 +381,21 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                           DEFAULT_MIN_INFERENCE_INTERVAL, DEFAULT_MAX_INFERENCE_INTERVAL, DEFAULT_INFERENCE_INTERVAL,
                           param_flags));
 
+    g_object_class_install_property(
+        gobject_class, PROP_ADAPTIVE_INTERVAL,
+        g_param_spec_boolean("adaptive-interval", "Adaptive Inference Interval",
+                             "If true, interval between inference requests changes in range from inference-interval "
+                             "to max-inference-interval depending on scene activity (motion ROIs from gvamotiondetect, "
+                             "confidence of tracked objects) and occupancy of inference requests of the model instance",
+                             DEFAULT_ADAPTIVE_INTERVAL, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_MAX_INFERENCE_INTERVAL,
+        g_param_spec_uint("max-inference-interval", "Max Inference Interval",
+                          "Upper bound of inference interval used when adaptive-interval is enabled",
+                          DEFAULT_MIN_INFERENCE_INTERVAL, DEFAULT_MAX_INFERENCE_INTERVAL,
+                          DEFAULT_MAX_ADAPTIVE_INFERENCE_INTERVAL, param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_RESHAPE,
         g_param_spec_boolean("reshape", "Reshape input layer",
@@ -315,6 +414,16 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
         g_param_spec_uint("reshape-height", "Height for reshape", "Height to which the network will be reshaped.",
                           DEFAULT_MIN_RESHAPE_HEIGHT, DEFAULT_MAX_RESHAPE_HEIGHT, DEFAULT_RESHAPE_HEIGHT, param_flags));
 
+    g_object_class_install_property(
+        gobject_class, PROP_SHAPE_BUCKETS,
+        g_param_spec_string("shape-buckets", "Shape Buckets",
+                            "Comma separated list of input sizes WIDTHxHEIGHT for models with dynamic input width and "
+                            "height, e.g. '32x32,64x32,128x32'. Each region is resized to the smallest size it fits "
+                            "in (or the largest one) and batched with regions of the same size, instead of resizing "
+                            "all regions to one size. Requires pre-process-backend=opencv. Supported by gvaclassify "
+                            "and gvainference with inference-region=roi-list",
+                            DEFAULT_SHAPE_BUCKETS, param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_NO_BLOCK,
         g_param_spec_boolean(
@@ -328,6 +437,34 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                                                       DEFAULT_MIN_NIREQ, DEFAULT_MAX_NIREQ, DEFAULT_NIREQ,
                                                       param_flags));
 
+    g_object_class_install_property(
+        gobject_class, PROP_POST_PROC_THREADS,
+        g_param_spec_uint("post-proc-threads", "Post-processing threads",
+                          "Number of threads running post-processing of inference results. With non-zero value "
+                          "inference request is released as soon as its output tensors are copied, and "
+                          "post-processing runs in parallel for different elements, in order within one element. "
+                          "Zero means post-processing runs on the inference completion thread",
+                          DEFAULT_MIN_POST_PROC_THREADS, DEFAULT_MAX_POST_PROC_THREADS, DEFAULT_POST_PROC_THREADS,
+                          param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_ASYNC_MODEL_LOAD,
+        g_param_spec_boolean("async-model-load", "Asynchronous model loading",
+                             "If true, model is loaded in background after caps negotiation, and element waits for it "
+                             "only when the first buffer arrives. Models of several elements in a pipeline are then "
+                             "loaded concurrently. Model loading errors are reported on the first buffer",
+                             DEFAULT_ASYNC_MODEL_LOAD, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_CPU_PLACEMENT,
+        g_param_spec_string("cpu-placement", "CPU placement",
+                            "CPU cores for work of the model instance: element processing in streaming thread, "
+                            "OpenVINO executor and post-processing threads. One of: none, auto (NUMA nodes are "
+                            "assigned to model instances round-robin), numa:<node>, cores:<list> (for example "
+                            "cores:0-7,16-23). If not set, policy is taken from GVA_CPU_PLACEMENT_FILE or "
+                            "GVA_CPU_PLACEMENT environment variables",
+                            DEFAULT_CPU_PLACEMENT, param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_CPU_THROUGHPUT_STREAMS,
         g_param_spec_uint("cpu-throughput-streams", "CPU-Throughput-Streams",
@@ -361,6 +498,37 @@ void gva_base_inference_class_init(GvaBaseInferenceClass *klass) {
                           "Identifier responsible for the region on which inference will be performed",
                           GST_TYPE_GVA_BASE_INFERENCE_REGION, DEFAULT_INFERENCE_REGION, param_flags));
 
+    g_object_class_install_property(
+        gobject_class, PROP_TILE_WIDTH,
+        g_param_spec_uint("tile-width", "Tile Width", "Width of tiles for inference-region=tiles",
+                          DEFAULT_MIN_TILE_SIZE, DEFAULT_MAX_TILE_SIZE, DEFAULT_TILE_SIZE, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_TILE_HEIGHT,
+        g_param_spec_uint("tile-height", "Tile Height", "Height of tiles for inference-region=tiles",
+                          DEFAULT_MIN_TILE_SIZE, DEFAULT_MAX_TILE_SIZE, DEFAULT_TILE_SIZE, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_TILE_OVERLAP,
+        g_param_spec_double("tile-overlap", "Tile Overlap",
+                            "Minimal overlap of neighbouring tiles as share of tile size, for inference-region=tiles. "
+                            "Objects smaller than overlap are seen whole by at least one tile",
+                            DEFAULT_MIN_TILE_OVERLAP, DEFAULT_MAX_TILE_OVERLAP, DEFAULT_TILE_OVERLAP, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_TILE_MERGE_THRESHOLD,
+        g_param_spec_double("tile-merge-threshold", "Tile Merge Threshold",
+                            "Detections of the same label from different tiles are merged if their intersection "
+                            "exceeds this share of the smaller box, for inference-region=tiles",
+                            DEFAULT_MIN_THRESHOLD, DEFAULT_MAX_THRESHOLD, DEFAULT_TILE_MERGE_THRESHOLD, param_flags));
+
+    g_object_class_install_property(
+        gobject_class, PROP_TILE_SKIP_STATIC,
+        g_param_spec_boolean("tile-skip-static", "Skip Static Tiles",
+                             "Run inference only on tiles intersecting motion regions attached by gvamotiondetect, "
+                             "for inference-region=tiles. Frames without motion regions are not inferred",
+                             DEFAULT_TILE_SKIP_STATIC, param_flags));
+
     g_object_class_install_property(
         gobject_class, PROP_OBJECT_CLASS,
         g_param_spec_string("object-class", "ObjectClass",
@@ -400,6 +568,17 @@ void gva_base_inference_cleanup(GvaBaseInference *base_inference) {
 
     GST_DEBUG_OBJECT(base_inference, "gva_base_inference_cleanup");
 
+    // Model loading refers to the element, it's waited for even if element is destroyed before the first buffer
+    if (base_inference->priv && base_inference->priv->model_loading.valid()) {
+        try {
+            auto instance = base_inference->priv->model_loading.get();
+            if (instance)
+                base_inference->inference = instance.get();
+        } catch (...) {
+            // Loading errors are already posted to the bus by acquire_inference_instance
+        }
+    }
+
     if (base_inference->inference) {
         release_inference_instance(base_inference);
         base_inference->inference = nullptr;
@@ -425,12 +604,21 @@ void gva_base_inference_cleanup(GvaBaseInference *base_inference) {
     g_free(base_inference->scheduling_policy);
     base_inference->scheduling_policy = nullptr;
 
+    g_free(base_inference->request_scheduling);
+    base_inference->request_scheduling = nullptr;
+
     g_free(base_inference->pre_proc_type);
     base_inference->pre_proc_type = nullptr;
 
+    g_free(base_inference->shape_buckets);
+    base_inference->shape_buckets = nullptr;
+
     g_free(base_inference->ie_config);
     base_inference->ie_config = nullptr;
 
+    g_free(base_inference->cpu_placement);
+    base_inference->cpu_placement = nullptr;
+
     g_free(base_inference->pre_proc_config);
     base_inference->pre_proc_config = nullptr;
 
@@ -486,14 +674,23 @@ void gva_base_inference_init(GvaBaseInference *base_inference) {
     base_inference->device = g_strdup(DEFAULT_DEVICE);
     base_inference->model_proc = g_strdup(DEFAULT_MODEL_PROC);
     base_inference->inference_interval = DEFAULT_INFERENCE_INTERVAL;
+    base_inference->adaptive_interval = DEFAULT_ADAPTIVE_INTERVAL;
+    base_inference->max_inference_interval = DEFAULT_MAX_ADAPTIVE_INFERENCE_INTERVAL;
     base_inference->reshape = DEFAULT_RESHAPE;
     base_inference->batch_size = DEFAULT_BATCH_SIZE;
     base_inference->reshape_width = DEFAULT_RESHAPE_WIDTH;
     base_inference->reshape_height = DEFAULT_RESHAPE_HEIGHT;
+    base_inference->shape_buckets = g_strdup(DEFAULT_SHAPE_BUCKETS);
     base_inference->no_block = DEFAULT_NO_BLOCK;
     base_inference->nireq = DEFAULT_NIREQ;
+    base_inference->post_proc_threads = DEFAULT_POST_PROC_THREADS;
+    base_inference->async_model_load = DEFAULT_ASYNC_MODEL_LOAD;
+    base_inference->cpu_placement = g_strdup(DEFAULT_CPU_PLACEMENT);
     base_inference->model_instance_id = g_strdup(DEFAULT_MODEL_INSTANCE_ID);
     base_inference->scheduling_policy = g_strdup(DEFAULT_SCHEDULING_POLICY);
+    base_inference->request_scheduling = g_strdup(DEFAULT_REQUEST_SCHEDULING);
+    base_inference->scheduling_priority = DEFAULT_SCHEDULING_PRIORITY;
+    base_inference->latency_budget = DEFAULT_LATENCY_BUDGET;
     base_inference->pre_proc_type = g_strdup(DEFAULT_PRE_PROC);
     // TODO: make one property for streams
     base_inference->cpu_streams = DEFAULT_CPU_THROUGHPUT_STREAMS;
@@ -505,6 +702,11 @@ void gva_base_inference_init(GvaBaseInference *base_inference) {
     base_inference->initialized = FALSE;
     base_inference->info = nullptr;
     base_inference->inference_region = DEFAULT_INFERENCE_REGION;
+    base_inference->tile_width = DEFAULT_TILE_SIZE;
+    base_inference->tile_height = DEFAULT_TILE_SIZE;
+    base_inference->tile_overlap = DEFAULT_TILE_OVERLAP;
+    base_inference->tile_merge_threshold = DEFAULT_TILE_MERGE_THRESHOLD;
+    base_inference->tile_skip_static = DEFAULT_TILE_SKIP_STATIC;
     base_inference->inference = nullptr;
 
     base_inference->is_roi_inference_needed = &is_roi_inference_needed;
@@ -612,6 +814,12 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
     case PROP_INFERENCE_INTERVAL:
         base_inference->inference_interval = g_value_get_uint(value);
         break;
+    case PROP_ADAPTIVE_INTERVAL:
+        base_inference->adaptive_interval = g_value_get_boolean(value);
+        break;
+    case PROP_MAX_INFERENCE_INTERVAL:
+        base_inference->max_inference_interval = g_value_get_uint(value);
+        break;
     case PROP_RESHAPE:
         base_inference->reshape = g_value_get_boolean(value);
         break;
@@ -624,12 +832,26 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
     case PROP_RESHAPE_HEIGHT:
         base_inference->reshape_height = g_value_get_uint(value);
         break;
+    case PROP_SHAPE_BUCKETS:
+        g_free(base_inference->shape_buckets);
+        base_inference->shape_buckets = g_value_dup_string(value);
+        break;
     case PROP_NO_BLOCK:
         base_inference->no_block = g_value_get_boolean(value);
         break;
     case PROP_NIREQ:
         base_inference->nireq = g_value_get_uint(value);
         break;
+    case PROP_POST_PROC_THREADS:
+        base_inference->post_proc_threads = g_value_get_uint(value);
+        break;
+    case PROP_ASYNC_MODEL_LOAD:
+        base_inference->async_model_load = g_value_get_boolean(value);
+        break;
+    case PROP_CPU_PLACEMENT:
+        g_free(base_inference->cpu_placement);
+        base_inference->cpu_placement = g_value_dup_string(value);
+        break;
     case PROP_MODEL_INSTANCE_ID:
         g_free(base_inference->model_instance_id);
         base_inference->model_instance_id = g_value_dup_string(value);
@@ -638,6 +860,16 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
         g_free(base_inference->scheduling_policy);
         base_inference->scheduling_policy = g_value_dup_string(value);
         break;
+    case PROP_REQUEST_SCHEDULING:
+        g_free(base_inference->request_scheduling);
+        base_inference->request_scheduling = g_value_dup_string(value);
+        break;
+    case PROP_SCHEDULING_PRIORITY:
+        base_inference->scheduling_priority = g_value_get_uint(value);
+        break;
+    case PROP_LATENCY_BUDGET:
+        base_inference->latency_budget = g_value_get_uint(value);
+        break;
     case PROP_PRE_PROC_BACKEND:
         g_free(base_inference->pre_proc_type);
         base_inference->pre_proc_type = g_value_dup_string(value);
@@ -669,6 +901,21 @@ void gva_base_inference_set_property(GObject *object, guint property_id, const G
     case PROP_INFERENCE_REGION:
         base_inference->inference_region = static_cast<InferenceRegionType>(g_value_get_enum(value));
         break;
+    case PROP_TILE_WIDTH:
+        base_inference->tile_width = g_value_get_uint(value);
+        break;
+    case PROP_TILE_HEIGHT:
+        base_inference->tile_height = g_value_get_uint(value);
+        break;
+    case PROP_TILE_OVERLAP:
+        base_inference->tile_overlap = g_value_get_double(value);
+        break;
+    case PROP_TILE_MERGE_THRESHOLD:
+        base_inference->tile_merge_threshold = g_value_get_double(value);
+        break;
+    case PROP_TILE_SKIP_STATIC:
+        base_inference->tile_skip_static = g_value_get_boolean(value);
+        break;
     case PROP_OBJECT_CLASS:
         g_free(base_inference->object_class);
         base_inference->object_class = g_value_dup_string(value);
@@ -743,6 +990,12 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_INFERENCE_INTERVAL:
         g_value_set_uint(value, base_inference->inference_interval);
         break;
+    case PROP_ADAPTIVE_INTERVAL:
+        g_value_set_boolean(value, base_inference->adaptive_interval);
+        break;
+    case PROP_MAX_INFERENCE_INTERVAL:
+        g_value_set_uint(value, base_inference->max_inference_interval);
+        break;
     case PROP_RESHAPE:
         g_value_set_boolean(value, base_inference->reshape);
         break;
@@ -755,12 +1008,24 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_RESHAPE_HEIGHT:
         g_value_set_uint(value, base_inference->reshape_height);
         break;
+    case PROP_SHAPE_BUCKETS:
+        g_value_set_string(value, base_inference->shape_buckets);
+        break;
     case PROP_NO_BLOCK:
         g_value_set_boolean(value, base_inference->no_block);
         break;
     case PROP_NIREQ:
         g_value_set_uint(value, base_inference->nireq);
         break;
+    case PROP_POST_PROC_THREADS:
+        g_value_set_uint(value, base_inference->post_proc_threads);
+        break;
+    case PROP_ASYNC_MODEL_LOAD:
+        g_value_set_boolean(value, base_inference->async_model_load);
+        break;
+    case PROP_CPU_PLACEMENT:
+        g_value_set_string(value, base_inference->cpu_placement);
+        break;
     case PROP_MODEL_INSTANCE_ID:
         g_value_set_string(value, base_inference->model_instance_id);
         break;
@@ -782,6 +1047,21 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_INFERENCE_REGION:
         g_value_set_enum(value, base_inference->inference_region);
         break;
+    case PROP_TILE_WIDTH:
+        g_value_set_uint(value, base_inference->tile_width);
+        break;
+    case PROP_TILE_HEIGHT:
+        g_value_set_uint(value, base_inference->tile_height);
+        break;
+    case PROP_TILE_OVERLAP:
+        g_value_set_double(value, base_inference->tile_overlap);
+        break;
+    case PROP_TILE_MERGE_THRESHOLD:
+        g_value_set_double(value, base_inference->tile_merge_threshold);
+        break;
+    case PROP_TILE_SKIP_STATIC:
+        g_value_set_boolean(value, base_inference->tile_skip_static);
+        break;
     case PROP_OBJECT_CLASS:
         g_value_set_string(value, base_inference->object_class);
         break;
@@ -809,6 +1089,15 @@ void gva_base_inference_get_property(GObject *object, guint property_id, GValue
     case PROP_SCHEDULING_POLICY:
         g_value_set_string(value, base_inference->scheduling_policy);
         break;
+    case PROP_REQUEST_SCHEDULING:
+        g_value_set_string(value, base_inference->request_scheduling);
+        break;
+    case PROP_SCHEDULING_PRIORITY:
+        g_value_set_uint(value, base_inference->scheduling_priority);
+        break;
+    case PROP_LATENCY_BUDGET:
+        g_value_set_uint(value, base_inference->latency_budget);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -888,6 +1177,10 @@ gboolean gva_base_inference_set_caps(GstBaseTransform *trans, GstCaps *incaps, G
              base_inference->device));
     }
 
+    // Model for previous caps may still be loading
+    if (!wait_model_loading(base_inference))
+        return FALSE;
+
     if (base_inference->inference && base_inference->info &&
         gst_video_info_is_equal(base_inference->info, &video_info) && base_inference->caps_feature == caps_feature) {
         // We alredy have an inference model instance.
@@ -895,7 +1188,7 @@ gboolean gva_base_inference_set_caps(GstBaseTransform *trans, GstCaps *incaps, G
     }
 
     if (base_inference->inference) {
-        base_inference->inference->FlushInference();
+        base_inference->inference->FlushInference(base_inference);
         release_inference_instance(base_inference);
         base_inference->inference = nullptr;
     }
@@ -905,9 +1198,19 @@ gboolean gva_base_inference_set_caps(GstBaseTransform *trans, GstCaps *incaps, G
         base_inference->info = NULL;
     }
     base_inference->info = gst_video_info_copy(&video_info);
+    base_inference->priv->video_info =
+        std::shared_ptr<GstVideoInfo>(gst_video_info_copy(&video_info), gst_video_info_free);
     base_inference->caps_feature = caps_feature;
 
     base_inference->priv->buffer_mapper.reset();
+    base_inference->priv->first_frame_reported = false;
+    StartupProfiler &profiler = StartupProfiler::Instance();
+    if (profiler.IsEnabled()) {
+        // Path tells apart elements of different pipelines in the profile
+        gchar *path = gst_object_get_path_string(GST_OBJECT(base_inference));
+        profiler.CapsReceived(base_inference, path);
+        g_free(path);
+    }
 
     // Need to acquire inference model instance
     try {
@@ -939,47 +1242,89 @@ gboolean gva_base_inference_set_caps(GstBaseTransform *trans, GstCaps *incaps, G
         }
 #endif
 
-        base_inference->inference = acquire_inference_instance(base_inference).get();
-        if (!base_inference->inference)
-            throw std::runtime_error("inference is NULL.");
+        if (base_inference->async_model_load) {
+            // Caps are passed downstream right away, so following inference elements start loading their models too
+            base_inference->priv->model_loading = ModelLoader::Instance().Submit(
+                [base_inference]() { return acquire_inference_instance(base_inference); });
+            return TRUE;
+        }
+
+        complete_initialization(base_inference, acquire_inference_instance(base_inference));
+    } catch (const std::exception &e) {
+        GST_ELEMENT_ERROR(base_inference, LIBRARY, INIT,
+                          ("base_inference based element initialization has been failed."),
+                          ("%s", Utils::createNestedErrorMsg(e).c_str()));
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void complete_initialization(GvaBaseInference *base_inference, const std::shared_ptr<InferenceImpl> &instance) {
+    base_inference->inference = instance.get();
+    if (!base_inference->inference)
+        throw std::runtime_error("inference is NULL.");
 
-        GvaBaseInferenceClass *base_inference_class = GVA_BASE_INFERENCE_GET_CLASS(base_inference);
-        if (base_inference_class->on_initialized) {
-            base_inference_class->on_initialized(base_inference);
+    GvaBaseInferenceClass *base_inference_class = GVA_BASE_INFERENCE_GET_CLASS(base_inference);
+    if (base_inference_class->on_initialized) {
+        base_inference_class->on_initialized(base_inference);
 
-            if (!base_inference->post_proc)
-                throw std::runtime_error("post-processing is NULL.");
-        }
+        if (!base_inference->post_proc)
+            throw std::runtime_error("post-processing is NULL.");
+    }
 
-        // Create a buffer mapper once we know the target memory type
+    // Create a buffer mapper once we know the target memory type
 #ifdef _MSC_VER
-        if (base_inference->caps_feature == D3D11_MEMORY_CAPS_FEATURE) {
-            base_inference->priv->buffer_mapper =
-                BufferMapperFactory::createMapper(base_inference->inference->GetInferenceMemoryType(),
-                                                  base_inference->info, base_inference->priv->d3d11_device);
-        } else {
-            base_inference->priv->buffer_mapper =
-                BufferMapperFactory::createMapper(base_inference->inference->GetInferenceMemoryType(),
-                                                  base_inference->info, base_inference->priv->va_display);
-        }
-#else
+    if (base_inference->caps_feature == D3D11_MEMORY_CAPS_FEATURE) {
+        base_inference->priv->buffer_mapper =
+            BufferMapperFactory::createMapper(base_inference->inference->GetInferenceMemoryType(),
+                                              base_inference->info, base_inference->priv->d3d11_device);
+    } else {
         base_inference->priv->buffer_mapper =
-            BufferMapperFactory::createMapper(base_inference->inference->GetInferenceMemoryType(), base_inference->info,
-                                              base_inference->priv->va_display);
+            BufferMapperFactory::createMapper(base_inference->inference->GetInferenceMemoryType(),
+                                              base_inference->info, base_inference->priv->va_display);
+    }
+#else
+    base_inference->priv->buffer_mapper = BufferMapperFactory::createMapper(
+        base_inference->inference->GetInferenceMemoryType(), base_inference->info, base_inference->priv->va_display);
 #endif
 
-        if (!base_inference->priv->buffer_mapper)
-            throw std::runtime_error("couldn't create buffer mapper");
+    if (!base_inference->priv->buffer_mapper)
+        throw std::runtime_error("couldn't create buffer mapper");
 
-        // We need to set the vector of object classes after InferenceImpl instance acquirement
-        gva_base_inference_update_object_classes(base_inference);
+    // We need to set the vector of object classes after InferenceImpl instance acquirement
+    gva_base_inference_update_object_classes(base_inference);
+
+    GST_INFO_OBJECT(base_inference, "CPU placement: %s",
+                    base_inference->inference->GetCpuPlacement().description.c_str());
+}
+
+// CPUs to run element's work in streaming thread on, empty if the thread isn't pinned
+static std::vector<unsigned> streaming_thread_cpus(GvaBaseInference *base_inference) {
+    if (base_inference->priv->pinning_failed)
+        return {};
+    return base_inference->inference->GetCpuPlacement().cpus;
+}
+
+/**
+ * Waits for model loaded in background if async-model-load is enabled and completes element initialization.
+ * Returns FALSE if model loading or initialization failed, error is posted to the bus.
+ */
+static gboolean wait_model_loading(GvaBaseInference *base_inference) {
+    if (!base_inference->priv->model_loading.valid())
+        return TRUE;
+
+    const auto wait_start = std::chrono::steady_clock::now();
+    try {
+        complete_initialization(base_inference, base_inference->priv->model_loading.get());
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(base_inference, LIBRARY, INIT,
                           ("base_inference based element initialization has been failed."),
                           ("%s", Utils::createNestedErrorMsg(e).c_str()));
         return FALSE;
     }
-
+    const std::chrono::duration<double, std::milli> wait_time = std::chrono::steady_clock::now() - wait_start;
+    StartupProfiler::Instance().AddStage(base_inference, "wait", wait_time.count());
     return TRUE;
 }
 
@@ -1027,6 +1372,20 @@ gboolean gva_base_inference_check_properties_correctness(GvaBaseInference *base_
         return FALSE;
     }
 
+    if (base_inference->inference_region == TILES && base_inference->type != GST_GVA_DETECT_TYPE) {
+        GST_ERROR_OBJECT(base_inference, ("'tiles' value of 'inference-region' property is supported by gvadetect "
+                                          "only."));
+        return FALSE;
+    }
+
+    // Detection converters expect boxes relative to model input size, and full frames are all of one size
+    if (base_inference->shape_buckets && !g_str_equal(base_inference->shape_buckets, "") &&
+        (base_inference->type == GST_GVA_DETECT_TYPE || base_inference->inference_region != ROI_LIST)) {
+        GST_ERROR_OBJECT(base_inference, ("'shape-buckets' property is supported by gvaclassify and gvainference with "
+                                          "'roi-list' value of 'inference-region' property only."));
+        return FALSE;
+    }
+
     return TRUE;
 }
 
@@ -1061,10 +1420,15 @@ gboolean gva_base_inference_start(GstBaseTransform *trans) {
         return base_inference->initialized;
     }
 
+    base_inference->analytics_meta_only = gva_analytics_meta_only(GST_ELEMENT(base_inference));
+
     gboolean success = registerElement(base_inference);
     if (!success)
         return base_inference->initialized;
 
+    // Properties could be updated from master element on registration, controller is created on first frame
+    base_inference->priv->adaptive_interval.reset();
+
     base_inference->initialized = TRUE;
 
     return base_inference->initialized;
@@ -1074,18 +1438,32 @@ gboolean gva_base_inference_stop(GstBaseTransform *trans) {
     GvaBaseInference *self = GVA_BASE_INFERENCE(trans);
     GST_DEBUG_OBJECT(self, "stop");
 
+    if (self && !wait_model_loading(self))
+        return TRUE;
+
     if (!self || !self->inference) {
         GST_ELEMENT_ERROR(self, CORE, STATE_CHANGE, ("base_inference failed on stop"), ("empty inference instance"));
         return TRUE;
     }
 
     try {
-        self->inference->FlushInference();
+        self->inference->FlushInference(self);
+        flushPostProcessor(self->post_proc);
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(self, CORE, STATE_CHANGE, ("base_inference failed on stop"),
                           ("%s", Utils::createNestedErrorMsg(e).c_str()));
     }
 
+    // Trace of stopped pipeline is available without waiting for process exit
+    if (TraceRecorder::Instance().IsEnabled())
+        TraceRecorder::Instance().Flush();
+
+    const GvaWritableBufferStats writable_stats = gva_buffer_writable_stats();
+    GST_INFO_OBJECT(self,
+                    "Buffers made writable by inference elements: %" G_GUINT64_FORMAT " metadata copies, "
+                    "%" G_GUINT64_FORMAT " deep copies",
+                    writable_stats.metadata_copies, writable_stats.deep_copies);
+
     return TRUE;
 }
 
@@ -1095,8 +1473,20 @@ gboolean gva_base_inference_sink_event(GstBaseTransform *trans, GstEvent *event)
     GST_DEBUG_OBJECT(base_inference, "sink_event");
 
     try {
+        if (event->type == GST_EVENT_STREAM_START && TraceRecorder::Instance().IsEnabled()) {
+            const gchar *stream_id = nullptr;
+            gst_event_parse_stream_start(event, &stream_id);
+            if (stream_id)
+                base_inference->priv->trace_stream = TraceRecorder::Instance().RegisterStream(stream_id);
+        }
+        if ((event->type == GST_EVENT_EOS || event->type == GST_EVENT_FLUSH_STOP) &&
+            !wait_model_loading(base_inference)) {
+            gst_event_unref(event);
+            return FALSE;
+        }
         if (base_inference->inference && (event->type == GST_EVENT_EOS || event->type == GST_EVENT_FLUSH_STOP)) {
-            base_inference->inference->FlushInference();
+            base_inference->inference->FlushInference(base_inference);
+            flushPostProcessor(base_inference->post_proc);
         }
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(base_inference, CORE, EVENT, ("base_inference failed while handling sink"),
@@ -1111,6 +1501,9 @@ GstFlowReturn gva_base_inference_transform_ip(GstBaseTransform *trans, GstBuffer
 
     GST_DEBUG_OBJECT(base_inference, "transform_ip");
 
+    if (!wait_model_loading(base_inference))
+        return GST_FLOW_ERROR;
+
     if (!base_inference->inference) { // TODO find a way to move this check out to initialization stage
         GST_ELEMENT_ERROR(base_inference, RESOURCE, SETTINGS,
                           ("There is no master element provided for base_inference elements with inference-id '%s'. At "
@@ -1122,7 +1515,20 @@ GstFlowReturn gva_base_inference_transform_ip(GstBaseTransform *trans, GstBuffer
 
     GstFlowReturn status;
     try {
+        // Frames are identified by timestamp in trace, which is the same in all elements of stream
+        TraceFrameScope frame_scope(base_inference->priv->trace_stream, GST_BUFFER_PTS(buf));
+        // Streaming thread is shared with upstream elements, so it is pinned only while the element processes buffer
+        const std::vector<unsigned> cpus = streaming_thread_cpus(base_inference);
+        CpuPlacement::ScopedThreadAffinity affinity(cpus);
+        if (!cpus.empty() && !affinity.pinned()) {
+            base_inference->priv->pinning_failed = true;
+            GST_WARNING_OBJECT(base_inference, "Couldn't pin streaming thread, running it unpinned");
+        }
         status = base_inference->inference->TransformFrameIp(base_inference, buf);
+        if (!base_inference->priv->first_frame_reported) {
+            base_inference->priv->first_frame_reported = true;
+            StartupProfiler::Instance().FirstFrame(base_inference);
+        }
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(base_inference, STREAM, FAILED, ("base_inference failed on frame processing"),
                           ("%s", Utils::createNestedErrorMsg(e).c_str()));
@@ -29,7 +29,7 @@ G_BEGIN_DECLS
 typedef void (*OnBaseInferenceInitializedFunction)(GvaBaseInference *base_inference);
 
 typedef enum { GST_GVA_DETECT_TYPE, GST_GVA_CLASSIFY_TYPE, GST_GVA_INFERENCE_TYPE } InferenceType;
-typedef enum { FULL_FRAME, ROI_LIST } InferenceRegionType;
+typedef enum { FULL_FRAME, ROI_LIST, TILES } InferenceRegionType;
 
 typedef struct _GvaBaseInference {
     GstBaseTransform base_transform;
@@ -39,10 +39,16 @@ typedef struct _GvaBaseInference {
     gboolean reshape;
     gboolean share_va_display_ctx;
     guint inference_interval;
+    gboolean adaptive_interval;
+    guint max_inference_interval;
     guint batch_size;
     guint reshape_width;
     guint reshape_height;
+    gchar *shape_buckets;
     guint nireq;
+    guint post_proc_threads;
+    gboolean async_model_load;
+    gchar *cpu_placement;
     guint cpu_streams;
     guint gpu_streams;
     gchar *model;
@@ -50,6 +56,9 @@ typedef struct _GvaBaseInference {
     gchar *device;
     gchar *model_instance_id;
     gchar *scheduling_policy;
+    gchar *request_scheduling;
+    guint scheduling_priority;
+    guint latency_budget;
     gchar *ie_config;
     gchar *pre_proc_config;
     gchar *allocator_name;
@@ -60,6 +69,11 @@ typedef struct _GvaBaseInference {
     gchar *custom_preproc_lib;
     gchar *custom_postproc_lib;
     gchar *ov_extension_lib;
+    guint tile_width;
+    guint tile_height;
+    gdouble tile_overlap;
+    gdouble tile_merge_threshold;
+    gboolean tile_skip_static;
 
     // other fields
     struct GvaBaseInferencePrivate *priv;
@@ -68,6 +82,8 @@ typedef struct _GvaBaseInference {
     GstVideoInfo *info;
     CapsFeature caps_feature;
     InferenceRegionType inference_region;
+    /* regions are stored in analytics metadata only, selected by pipeline context or process default on start */
+    gboolean analytics_meta_only;
 
     InferenceImpl *inference;
 
@@ -8,10 +8,17 @@
 
 #ifdef __cplusplus
 
+#include "adaptive_interval.h"
 #include "inference_backend/buffer_mapper.h"
+#include "inference_backend/trace_recorder.h"
 
+#include <gst/video/video.h>
+
+#include <future>
 #include <memory>
 
+class InferenceImpl;
+
 // Channel (GvaBaseInference) specific information. Contains C++ objects
 struct GvaBaseInferencePrivate {
     // Decoder VA display, if present
@@ -20,6 +27,21 @@ struct GvaBaseInferencePrivate {
     dlstreamer::ContextPtr d3d11_device;
 
     std::unique_ptr<InferenceBackend::BufferToImageMapper> buffer_mapper;
+
+    // Copy of GvaBaseInference::info referenced by in-flight inference frames, replaced on caps change
+    std::shared_ptr<const GstVideoInfo> video_info;
+
+    // Inference interval controller, set if adaptive-interval is enabled
+    std::unique_ptr<AdaptiveInterval> adaptive_interval;
+
+    // Pending model loading if async-model-load is enabled, completed on the first buffer
+    std::future<std::shared_ptr<InferenceImpl>> model_loading;
+    // Whether the first frame after caps negotiation was reported to startup profiler
+    bool first_frame_reported = false;
+    // Set if streaming thread couldn't be pinned according to CPU placement of model instance, not retried then
+    bool pinning_failed = false;
+    // Stream of incoming buffers in trace, registered on stream-start if trace recorder is enabled
+    uint32_t trace_stream = TraceRecorder::NO_STREAM;
 };
 
 #endif // __cplusplus
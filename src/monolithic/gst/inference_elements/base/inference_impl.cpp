@@ -23,10 +23,13 @@
 #include "region_of_interest.h"
 #include "safe_arithmetic.hpp"
 #include "scope_guard.h"
+#include "tiling.h"
 #include "utils.h"
 #include "video_frame.h"
 
+#include <algorithm>
 #include <assert.h>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <exception>
@@ -152,6 +155,8 @@ InferenceConfig CreateNestedInferenceConfig(GvaBaseInference *gva_base_inference
     base[KEY_CUSTOM_PREPROC_LIB] = custom_preproc_lib;
     base[KEY_OV_EXTENSION_LIB] = gva_base_inference->ov_extension_lib ? gva_base_inference->ov_extension_lib : "";
     base[KEY_NIREQ] = std::to_string(gva_base_inference->nireq);
+    base[KEY_POST_PROC_THREADS] = std::to_string(gva_base_inference->post_proc_threads);
+    base[KEY_REQUEST_SCHEDULING] = gva_base_inference->request_scheduling ? gva_base_inference->request_scheduling : "";
     if (gva_base_inference->device != nullptr) {
         std::string device = gva_base_inference->device;
         base[KEY_DEVICE] = device;
@@ -212,6 +217,7 @@ InferenceConfig CreateNestedInferenceConfig(GvaBaseInference *gva_base_inference
             base[KEY_RESHAPE_HEIGHT] = std::to_string(gva_base_inference->info->height);
         }
     }
+    base[KEY_SHAPE_BUCKETS] = gva_base_inference->shape_buckets ? gva_base_inference->shape_buckets : "";
     base[KEY_CAPS_FEATURE] = std::to_string(static_cast<int>(gva_base_inference->caps_feature));
 
     // add KEY_VAAPI_THREAD_POOL_SIZE, KEY_VAAPI_FAST_SCALE_LOAD_FACTOR elements to preprocessor config
@@ -354,7 +360,10 @@ void setPreprocessorType(InferenceConfig &config,
     ImagePreprocessorType selected_preprocessor = current;
 
     // Determine the appropriate preprocessor type
-    if (current == ImagePreprocessorType::AUTO) {
+    if (current == ImagePreprocessorType::AUTO && !config[KEY_BASE][KEY_SHAPE_BUCKETS].empty()) {
+        // Only OpenCV pre-processor resizes regions to shape bucket sizes
+        selected_preprocessor = ImagePreprocessorType::OPENCV;
+    } else if (current == ImagePreprocessorType::AUTO) {
         // Automatically select the preferred preprocessor type based on capabilities and input info
         selected_preprocessor =
             GetPreferredImagePreproc(caps, model_input_processor_info, input_video_info, config[KEY_BASE]);
@@ -495,12 +504,33 @@ void UpdateConfigWithLayerInfo(const std::vector<ModelInputProcessorInfo::Ptr> &
     }
 }
 
+/**
+ * Makes GstVideoRegionOfInterestMeta describing region stored as object detection metadata only, so such regions
+ * go through roi-list inference the same way as regions with attached GstVideoRegionOfInterestMeta. Returned meta
+ * is not attached to any buffer (meta.info is null).
+ */
+bool MakeRegionFromODMtd(GstAnalyticsODMtd *od_mtd, GstVideoRegionOfInterestMeta *region) {
+    gint x, y, w, h;
+    if (!gst_analytics_od_mtd_get_location(od_mtd, &x, &y, &w, &h, nullptr))
+        return false;
+
+    *region = GstVideoRegionOfInterestMeta();
+    region->roi_type = gst_analytics_od_mtd_get_obj_type(od_mtd);
+    region->id = od_mtd->id;
+    region->parent_id = -1;
+    region->x = std::max(x, 0);
+    region->y = std::max(y, 0);
+    region->w = std::max(w, 0);
+    region->h = std::max(h, 0);
+    return true;
+}
+
 void ApplyImageBoundaries(std::shared_ptr<InferenceBackend::Image> &image, GstVideoRegionOfInterestMeta *meta,
                           InferenceRegionType inference_region, GstBuffer *buffer) {
     if (!meta) {
         throw std::invalid_argument("Region of interest meta is null.");
     }
-    if (inference_region == FULL_FRAME) {
+    if (inference_region == FULL_FRAME || inference_region == TILES) {
         image->rect = InferenceBackend::Rectangle<uint32_t>(meta->x, meta->y, meta->w, meta->h);
         return;
     }
@@ -519,7 +549,8 @@ void ApplyImageBoundaries(std::shared_ptr<InferenceBackend::Image> &image, GstVi
         throw std::runtime_error("Failed to get ODMtd from analytics relation meta");
     }
 
-    GVA::RegionOfInterest roi(od_mtd, meta);
+    // Region made by MakeRegionFromODMtd isn't attached to buffer, its params are read from relation meta
+    GVA::RegionOfInterest roi(od_mtd, meta->meta.info ? meta : nullptr);
     const GVA::Rect<double> normalized_bbox = roi.normalized_rect();
 
     const constexpr double zero = 0;
@@ -719,6 +750,47 @@ dlstreamer::ContextPtr createVaDisplay(GvaBaseInference *gva_base_inference) {
     return display;
 }
 
+// Motion regions attached by gvamotiondetect as object detection metadata of "motion" type
+std::vector<Tiling::Rect> GetMotionRects(GstBuffer *buffer) {
+    std::vector<Tiling::Rect> rects;
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+    if (!relation_meta)
+        return rects;
+
+    static const GQuark motion_quark = g_quark_from_static_string("motion");
+    gpointer state = nullptr;
+    GstAnalyticsODMtd od_mtd;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
+        if (gst_analytics_od_mtd_get_obj_type(&od_mtd) != motion_quark)
+            continue;
+        gint x, y, w, h;
+        if (!gst_analytics_od_mtd_get_location(&od_mtd, &x, &y, &w, &h, nullptr) || w <= 0 || h <= 0)
+            continue;
+        rects.push_back({static_cast<uint32_t>(std::max(x, 0)), static_cast<uint32_t>(std::max(y, 0)),
+                         static_cast<uint32_t>(w), static_cast<uint32_t>(h)});
+    }
+    return rects;
+}
+
+// All ROIs of the buffer are scheduled as one stream with the same deadline. Deadline is clock time of buffer
+// presentation plus latency budget, so streams of pipelines using the system clock are comparable; buffers without
+// timestamp get deadline from the current monotonic time, which the system clock uses by default.
+ImageInference::IFrameBase::SchedulingInfo MakeSchedulingInfo(GvaBaseInference *gva_base_inference,
+                                                              GstBuffer *buffer) {
+    ImageInference::IFrameBase::SchedulingInfo info;
+    info.stream = gva_base_inference;
+    info.priority = gva_base_inference->scheduling_priority;
+
+    GstClockTime time = gst_segment_to_running_time(&gva_base_inference->base_transform.segment, GST_FORMAT_TIME,
+                                                    GST_BUFFER_PTS(buffer));
+    if (GST_CLOCK_TIME_IS_VALID(time))
+        time += gst_element_get_base_time(GST_ELEMENT(gva_base_inference));
+    else
+        time = gst_util_get_timestamp();
+    info.deadline_ns = time + gva_base_inference->latency_budget * GST_MSECOND;
+    return info;
+}
+
 } // namespace
 
 InferenceImpl::Model InferenceImpl::CreateModel(GvaBaseInference *gva_base_inference, const std::string &model_file,
@@ -745,6 +817,7 @@ InferenceImpl::Model InferenceImpl::CreateModel(GvaBaseInference *gva_base_infer
 
     Model model;
 
+    const auto model_proc_start = std::chrono::steady_clock::now();
     if (!model_proc_path.empty()) {
         const constexpr size_t MAX_MODEL_PROC_SIZE = 10 * 1024 * 1024; // 10 Mb
         if (!Utils::CheckFileSize(model_proc_path, MAX_MODEL_PROC_SIZE))
@@ -765,6 +838,9 @@ InferenceImpl::Model InferenceImpl::CreateModel(GvaBaseInference *gva_base_infer
         // to construct preprocessor info
         model.input_processor_info = ModelProcProvider::parseInputPreproc(model_config);
     }
+    const std::chrono::duration<double, std::milli> model_proc_time =
+        std::chrono::steady_clock::now() - model_proc_start;
+    loading_timings = {{"model_proc", model_proc_time.count()}};
 
     if (Utils::symLink(labels_str))
         throw std::invalid_argument("ERROR: labels-file '" + labels_str + "' is a symbolic link");
@@ -831,6 +907,8 @@ InferenceImpl::Model InferenceImpl::CreateModel(GvaBaseInference *gva_base_infer
         throw std::runtime_error("Failed to create inference instance");
     model.inference = image_inference;
     model.name = image_inference->GetModelName();
+    for (const auto &timing : image_inference->GetLoadingTimings())
+        loading_timings.push_back(timing);
 
     // if auto batch size was requested, use the actual batch size determined by inference instance
     if (gva_base_inference->batch_size == 0)
@@ -865,6 +943,16 @@ InferenceImpl::InferenceImpl(GvaBaseInference *gva_base_inference) {
 
     GVA_INFO("Loading model: device=%s, path=%s", std::string(gva_base_inference->device).c_str(), model_file.c_str());
     GVA_INFO("Initial settings: batch_size=%u, nireq=%u", gva_base_inference->batch_size, gva_base_inference->nireq);
+
+    // Elements sharing model instance form one group placed on the same CPUs
+    const gchar *instance_id = gva_base_inference->model_instance_id;
+    const std::string placement_group =
+        (instance_id && *instance_id) ? instance_id : GST_ELEMENT_NAME(gva_base_inference);
+    cpu_placement = CpuPlacement::Placer::Instance().place(
+        placement_group, gva_base_inference->cpu_placement ? gva_base_inference->cpu_placement : "");
+
+    // Threads created by inference backend during model compilation inherit affinity of this thread
+    CpuPlacement::ScopedThreadAffinity affinity(cpu_placement.cpus);
     this->model = CreateModel(gva_base_inference, model_file, model_proc, labels_str, custom_preproc_lib);
 }
 
@@ -879,8 +967,9 @@ void InferenceImpl::SetDisplay(GvaBaseInference *gva_base_inference, const dlstr
     gva_base_inference->priv->va_display = display;
 }
 
-void InferenceImpl::FlushInference() {
-    model.inference->Flush();
+void InferenceImpl::FlushInference(GvaBaseInference *gva_base_inference) {
+    // Frames of the element are ordered by the element, see InferenceResult::GetOrderingKey
+    model.inference->FlushStream(gva_base_inference);
 }
 
 void InferenceImpl::FlushOutputs() {
@@ -1057,19 +1146,18 @@ std::shared_ptr<InferenceImpl::InferenceResult>
 InferenceImpl::MakeInferenceResult(GvaBaseInference *gva_base_inference, Model &model,
                                    GstVideoRegionOfInterestMeta *meta, std::shared_ptr<InferenceBackend::Image> &image,
                                    GstBuffer *buffer) {
-    auto result = std::make_shared<InferenceResult>();
-    /* expect that std::make_shared must throw instead of returning nullptr */
+    auto result = std::allocate_shared<InferenceResult>(PoolAllocator<InferenceResult>(result_pool));
+    /* expect that std::allocate_shared must throw instead of returning nullptr */
     assert(result.get() != nullptr && "Expected a valid InferenceResult");
 
-    result->inference_frame = std::make_shared<InferenceFrame>();
-    /* expect that std::make_shared must throw instead of returning nullptr */
+    result->inference_frame = std::allocate_shared<InferenceFrame>(PoolAllocator<InferenceFrame>(frame_pool));
+    /* expect that std::allocate_shared must throw instead of returning nullptr */
     assert(result->inference_frame.get() != nullptr && "Expected a valid InferenceFrame");
 
     result->inference_frame->buffer = buffer;
     result->inference_frame->roi = *meta;
     result->inference_frame->gva_base_inference = gva_base_inference;
-    if (gva_base_inference->info)
-        result->inference_frame->info = gst_video_info_copy(gva_base_inference->info);
+    result->inference_frame->info = gva_base_inference->priv->video_info;
 
     result->model = &model;
     result->image = image;
@@ -1101,6 +1189,8 @@ GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
         if (!image)
             throw std::invalid_argument("image is null");
 
+        const auto scheduling = MakeSchedulingInfo(gva_base_inference, buffer);
+
         size_t i = 0;
         for (auto meta : metas) {
             // Workaround for CodeCoverity
@@ -1109,6 +1199,13 @@ GstFlowReturn InferenceImpl::SubmitImages(GvaBaseInference *gva_base_inference,
 
             ApplyImageBoundaries(image, &meta, gva_base_inference->inference_region, buffer);
             auto result = MakeInferenceResult(gva_base_inference, model, &meta, image, buffer);
+            result->scheduling = scheduling;
+            if (gva_base_inference->inference_region == TILES) {
+                // Detections of the frame are merged once results of all its tiles are ready
+                result->inference_frame->tile = i;
+                result->inference_frame->tile_count = metas.size();
+                result->inference_frame->frame_num = gva_base_inference->frame_num;
+            }
             // Because image is a shared pointer with custom deleter which performs buffer unmapping
             // we need to manually reset it after we passed it to the last InferenceResult
             // Otherwise it may try to unmap buffer which is already pushed to downstream
@@ -1149,7 +1246,21 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
     InferenceStatus status = INFERENCE_EXECUTED;
     {
         ITT_TASK("InferenceImpl::TransformFrameIp check_skip");
-        if (++gva_base_inference->num_skipped_frames < gva_base_inference->inference_interval) {
+        guint inference_interval = gva_base_inference->inference_interval;
+        auto &adaptive_interval = gva_base_inference->priv->adaptive_interval;
+        if (gva_base_inference->adaptive_interval && !adaptive_interval) {
+            adaptive_interval = std::make_unique<AdaptiveInterval>(gva_base_inference->inference_interval,
+                                                                   gva_base_inference->max_inference_interval);
+            GVA_INFO("Adaptive inference interval enabled for <%s>, range [%u, %u]",
+                     GST_ELEMENT_NAME(gva_base_inference), gva_base_inference->inference_interval,
+                     gva_base_inference->max_inference_interval);
+        }
+        if (adaptive_interval) {
+            auto activity = AdaptiveInterval::GetActivity(buffer, gva_base_inference->info);
+            inference_interval = adaptive_interval->Update(activity, model.inference->GetFreeRequestsCount(),
+                                                           model.inference->GetNireq());
+        }
+        if (++gva_base_inference->num_skipped_frames < inference_interval) {
             status = INFERENCE_SKIPPED_PER_PROPERTY;
         }
         if (gva_base_inference->no_block) {
@@ -1180,6 +1291,26 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
                 }
             }
 
+            /* regions added in analytics-meta-only mode have object detection metadata only. In default mode object
+             * detection metadata without ROI meta belongs to removed (e.g. suppressed) region and is skipped */
+            GstAnalyticsRelationMeta *relation_meta =
+                gva_base_inference->analytics_meta_only ? gst_buffer_get_analytics_relation_meta(buffer) : NULL;
+            GstAnalyticsODMtd od_mtd;
+            state = NULL;
+            while (relation_meta && gst_analytics_relation_meta_iterate(relation_meta, &state,
+                                                                        gst_analytics_od_mtd_get_mtd_type(), &od_mtd)) {
+                if (gst_buffer_get_video_region_of_interest_meta_id(buffer, od_mtd.id))
+                    continue;
+                GstVideoRegionOfInterestMeta region;
+                if (!MakeRegionFromODMtd(&od_mtd, &region))
+                    continue;
+                if (!gva_base_inference->is_roi_inference_needed ||
+                    gva_base_inference->is_roi_inference_needed(gva_base_inference, gva_base_inference->frame_num,
+                                                                buffer, &region)) {
+                    metas.push_back(region);
+                }
+            }
+
             break;
         }
         case FULL_FRAME: {
@@ -1194,6 +1325,29 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
                 metas.push_back(full_frame_meta);
             break;
         }
+        case TILES: {
+            /* pushes meta for each tile, tiles without motion are skipped if requested. */
+            std::vector<Tiling::Rect> motion_rects;
+            if (gva_base_inference->tile_skip_static)
+                motion_rects = GetMotionRects(buffer);
+            for (const auto &tile :
+                 Tiling::makeTiles(gva_base_inference->info->width, gva_base_inference->info->height,
+                                   gva_base_inference->tile_width, gva_base_inference->tile_height,
+                                   gva_base_inference->tile_overlap)) {
+                if (gva_base_inference->tile_skip_static &&
+                    std::none_of(motion_rects.begin(), motion_rects.end(),
+                                 [&tile](const Tiling::Rect &motion) { return Tiling::intersects(tile, motion); }))
+                    continue;
+                GstVideoRegionOfInterestMeta tile_meta = GstVideoRegionOfInterestMeta();
+                tile_meta.x = tile.x;
+                tile_meta.y = tile.y;
+                tile_meta.w = tile.w;
+                tile_meta.h = tile.h;
+                tile_meta.id = -1;
+                metas.push_back(tile_meta);
+            }
+            break;
+        }
         default:
             throw std::logic_error("Unsupported inference region type");
         }
@@ -1269,12 +1423,16 @@ GstFlowReturn InferenceImpl::TransformFrameIp(GvaBaseInference *gva_base_inferen
 void InferenceImpl::PushFramesIfInferenceFailed(
     std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames) {
     std::lock_guard<std::mutex> guard(output_frames_mutex);
+    InferenceFrames inference_frames;
+    PostProcessor *post_proc = nullptr;
     for (auto &frame : frames) {
         auto inference_result = std::dynamic_pointer_cast<InferenceResult>(frame);
         /* InferenceResult is inherited from IFrameBase */
         assert(inference_result.get() != nullptr && "Expected a valid InferenceResult");
 
         std::shared_ptr<InferenceFrame> inference_roi = inference_result->inference_frame;
+        inference_frames.push_back(inference_roi);
+        post_proc = inference_roi->gva_base_inference->post_proc;
         auto it =
             std::find_if(output_frames.begin(), output_frames.end(), [inference_roi](const OutputFrame &output_frame) {
                 return output_frame.buffer == inference_roi->buffer;
@@ -1286,6 +1444,10 @@ void InferenceImpl::PushFramesIfInferenceFailed(
         PushBufferToSrcPad(*it);
         output_frames.erase(it);
     }
+
+    // Detections of other tiles of failed frames are held back for tile merging until frame gets all tiles
+    if (post_proc != nullptr)
+        post_proc->discard(inference_frames);
 }
 
 /**
@@ -1331,21 +1493,31 @@ void InferenceImpl::UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inferenc
  * @throw throw std::runtime_error when post-processing is failed
  */
 void InferenceImpl::InferenceCompletionCallback(
-    std::map<std::string, InferenceBackend::OutputBlob::Ptr> blobs,
-    std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames) {
-    ITT_TASK(__FUNCTION__);
+    const std::map<std::string, InferenceBackend::OutputBlob::Ptr> &blobs,
+    const std::vector<InferenceBackend::ImageInference::IFrameBase::Ptr> &frames) {
     if (frames.empty())
         return;
 
+    // Batch is traced as its first frame
+    uint32_t trace_stream = TraceRecorder::NO_STREAM;
+    uint64_t trace_frame = TraceRecorder::NO_FRAME;
+    if (auto first_result = dynamic_cast<InferenceResult *>(frames.front().get())) {
+        trace_stream = first_result->inference_frame->gva_base_inference->priv->trace_stream;
+        trace_frame = GST_BUFFER_PTS(first_result->inference_frame->buffer);
+    }
+    TraceFrameScope frame_scope(trace_stream, trace_frame);
+    ITT_TASK(__FUNCTION__);
+
     std::vector<std::shared_ptr<InferenceFrame>> inference_frames;
+    inference_frames.reserve(frames.size());
     PostProcessor *post_proc = nullptr;
 
     for (auto &frame : frames) {
-        auto inference_result = std::dynamic_pointer_cast<InferenceResult>(frame);
+        auto inference_result = dynamic_cast<InferenceResult *>(frame.get());
         /* InferenceResult is inherited from IFrameBase */
-        assert(inference_result.get() != nullptr && "Expected a valid InferenceResult");
+        assert(inference_result != nullptr && "Expected a valid InferenceResult");
 
-        std::shared_ptr<InferenceFrame> inference_roi = inference_result->inference_frame;
+        std::shared_ptr<InferenceFrame> &inference_roi = inference_result->inference_frame;
         inference_roi->image_transform_info = inference_result->GetImageTransformationParams();
         inference_result->image.reset(); // deleter will to not make buffer_unref, see 'SubmitImages' method
         post_proc = inference_roi->gva_base_inference->post_proc;
@@ -6,9 +6,11 @@
 #pragma once
 
 #include "classification_history.h"
+#include "cpu_placement.h"
 #include "gstgvaclassify.h"
 #include "gva_base_inference.h"
 #include "input_model_preproc.h"
+#include "pool_allocator.h"
 
 #include "inference_backend/image_inference.h"
 
@@ -38,7 +40,8 @@ class InferenceImpl {
 
     GstFlowReturn TransformFrameIp(GvaBaseInference *element, GstBuffer *buffer);
     void FlushOutputs();
-    void FlushInference();
+    // Flushes inference of the instance and waits for results of frames of the element
+    void FlushInference(GvaBaseInference *gva_base_inference);
     const Model &GetModel() const;
 
     void UpdateObjectClasses(const gchar *obj_classes_str);
@@ -50,6 +53,16 @@ class InferenceImpl {
         return memory_type;
     }
 
+    // Durations of model loading stages, model-proc parsing followed by stages reported by inference backend
+    const InferenceBackend::ImageInference::LoadingTimings &GetLoadingTimings() const {
+        return loading_timings;
+    }
+
+    // CPUs chosen for threads of this instance, empty if threads aren't pinned
+    const CpuPlacement::Placement &GetCpuPlacement() const {
+        return cpu_placement;
+    }
+
     ~InferenceImpl();
 
     static bool IsRoiSizeValid(const GstVideoRegionOfInterestMeta *roi_meta);
@@ -57,6 +70,8 @@ class InferenceImpl {
 
   private:
     InferenceBackend::MemoryType memory_type;
+    InferenceBackend::ImageInference::LoadingTimings loading_timings;
+    CpuPlacement::Placement cpu_placement;
     struct InferenceResult : public InferenceBackend::ImageInference::IFrameBase {
         void SetImage(InferenceBackend::ImagePtr image_) override {
             image = image_;
@@ -64,6 +79,13 @@ class InferenceImpl {
         InferenceBackend::ImagePtr GetImage() const override {
             return image;
         }
+        const void *GetOrderingKey() const override {
+            return inference_frame ? inference_frame->gva_base_inference : nullptr;
+        }
+        SchedulingInfo GetSchedulingInfo() const override {
+            return scheduling;
+        }
+        SchedulingInfo scheduling;
         std::shared_ptr<InferenceFrame> inference_frame;
         Model *model;
         std::shared_ptr<InferenceBackend::Image> image;
@@ -82,6 +104,11 @@ class InferenceImpl {
     Model model;
     std::shared_ptr<InferenceBackend::Allocator> allocator;
 
+    // Memory of per-ROI results is recycled instead of going through heap shared by all streams on each inference
+    static constexpr size_t MAX_POOLED_RESULTS = 256;
+    std::shared_ptr<BlockPool> result_pool = std::make_shared<BlockPool>(MAX_POOLED_RESULTS);
+    std::shared_ptr<BlockPool> frame_pool = std::make_shared<BlockPool>(MAX_POOLED_RESULTS);
+
     struct OutputFrame {
         GstBuffer *buffer;
         uint64_t inference_count;
@@ -96,8 +123,8 @@ class InferenceImpl {
     bool CheckSrcPadBlocked(GstObject *src);
     void PushBufferToSrcPad(OutputFrame &output_frame);
     void PushFramesIfInferenceFailed(std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames);
-    void InferenceCompletionCallback(std::map<std::string, InferenceBackend::OutputBlob::Ptr> blobs,
-                                     std::vector<std::shared_ptr<InferenceBackend::ImageInference::IFrameBase>> frames);
+    void InferenceCompletionCallback(const std::map<std::string, InferenceBackend::OutputBlob::Ptr> &blobs,
+                                     const std::vector<InferenceBackend::ImageInference::IFrameBase::Ptr> &frames);
     void UpdateOutputFrames(std::shared_ptr<InferenceFrame> &inference_roi);
     Model CreateModel(GvaBaseInference *gva_base_inference, const std::string &model_file,
                       const std::string &model_proc_path, const std::string &labels_str,
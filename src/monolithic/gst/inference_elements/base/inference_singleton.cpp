@@ -9,12 +9,17 @@
 
 #include "gva_base_inference.h"
 #include "inference_impl.h"
+#include "startup_profiler.h"
 #include "utils.h"
 #include <assert.h>
+#include <mutex>
 #include <set>
+#include <vector>
 
 struct InferenceRefs {
     std::set<GvaBaseInference *> refs;
+    // Guards creation of proxy, which happens outside of inference_pool_mutex_
+    std::mutex proxy_mutex;
     std::shared_ptr<InferenceImpl> proxy = nullptr;
     dlstreamer::ContextPtr context = nullptr;
     GstVideoFormat videoFormat = GST_VIDEO_FORMAT_UNKNOWN;
@@ -80,19 +85,29 @@ void fillElementProps(GvaBaseInference *targetElem, GvaBaseInference *masterElem
     COPY_GSTRING(targetElem->model_proc, masterElem->model_proc);
     targetElem->batch_size = masterElem->batch_size;
     targetElem->inference_interval = masterElem->inference_interval;
+    targetElem->adaptive_interval = masterElem->adaptive_interval;
+    targetElem->max_inference_interval = masterElem->max_inference_interval;
     targetElem->no_block = masterElem->no_block;
     targetElem->nireq = masterElem->nireq;
+    targetElem->post_proc_threads = masterElem->post_proc_threads;
+    COPY_GSTRING(targetElem->request_scheduling, masterElem->request_scheduling);
+    COPY_GSTRING(targetElem->shape_buckets, masterElem->shape_buckets);
+    targetElem->async_model_load = masterElem->async_model_load;
     targetElem->cpu_streams = masterElem->cpu_streams;
     targetElem->gpu_streams = masterElem->gpu_streams;
     COPY_GSTRING(targetElem->ie_config, masterElem->ie_config);
+    COPY_GSTRING(targetElem->cpu_placement, masterElem->cpu_placement);
     COPY_GSTRING(targetElem->allocator_name, masterElem->allocator_name);
     COPY_GSTRING(targetElem->pre_proc_type, masterElem->pre_proc_type);
     COPY_GSTRING(targetElem->object_class, masterElem->object_class);
     COPY_GSTRING(targetElem->labels, masterElem->labels);
     // no need to copy model_instance_id because it should match already.
+    // scheduling_priority and latency_budget describe element's own stream.
 }
 
-void initExistingElements(std::shared_ptr<InferenceRefs> infRefs) {
+// Copies properties of master element to base_inference. Other elements get properties on their own acquisition, so
+// properties of element which may be loading the model at the moment aren't touched.
+void initElementFromMaster(std::shared_ptr<InferenceRefs> infRefs, GvaBaseInference *base_inference) {
     GvaBaseInference *master = nullptr;
     for (auto elem : infRefs->refs) {
         if (elem->model && *elem->model != 0) {
@@ -106,10 +121,8 @@ void initExistingElements(std::shared_ptr<InferenceRefs> infRefs) {
                                "set, for example 'model'.");
     }
 
-    for (auto elem : infRefs->refs) {
-        if (elem != master)
-            fillElementProps(elem, master, infRefs->proxy);
-    }
+    if (base_inference != master)
+        fillElementProps(base_inference, master, infRefs->proxy);
 }
 
 std::string capsFeatureString(CapsFeature newCapsFeature) {
@@ -160,24 +173,40 @@ std::shared_ptr<InferenceImpl> acquire_inference_instance(GvaBaseInference *base
         if (!base_inference)
             throw std::invalid_argument("GvaBaseInference is null");
 
-        std::lock_guard<std::mutex> guard(inference_pool_mutex_);
         std::shared_ptr<InferenceRefs> infRefs = nullptr;
-        std::string name = get_inference_key(base_inference);
-        GST_INFO_OBJECT(base_inference, "key: %s\n", name.c_str());
-        infRefs = registerElementUnlocked(base_inference);
+        {
+            std::lock_guard<std::mutex> guard(inference_pool_mutex_);
+            std::string name = get_inference_key(base_inference);
+            GST_INFO_OBJECT(base_inference, "key: %s\n", name.c_str());
+            infRefs = registerElementUnlocked(base_inference);
 
-        initInferenceProps(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
-        check_inference_props_same(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
+            initInferenceProps(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
+            check_inference_props_same(*infRefs, base_inference->info->finfo->format, base_inference->caps_feature);
 
-        // if base_inference is not master element, it will get all master element's properties here
-        initExistingElements(infRefs);
+            // if base_inference is not master element, it will get all master element's properties here
+            initElementFromMaster(infRefs, base_inference);
+        }
 
-        if (infRefs->proxy == nullptr) { // no instance for current inference-id acquired yet
+        // Model is loaded without holding the pool lock, so elements with different model-instance-id load their
+        // models concurrently, while elements sharing an instance wait for the one creating it
+        std::lock_guard<std::mutex> guard(infRefs->proxy_mutex);
+        const bool created = infRefs->proxy == nullptr;
+        if (created) { // no instance for current inference-id acquired yet
             infRefs->proxy =
                 std::make_shared<InferenceImpl>(base_inference); // one instance for all elements with same inference-id
         }
         infRefs->context = InferenceImpl::GetDisplay(base_inference);
 
+        StartupProfiler &profiler = StartupProfiler::Instance();
+        if (profiler.IsEnabled()) {
+            if (created) {
+                for (const auto &timing : infRefs->proxy->GetLoadingTimings())
+                    profiler.AddStage(base_inference, timing.first, timing.second);
+            }
+            profiler.ModelReady(base_inference, base_inference->model ? base_inference->model : "",
+                                base_inference->device ? base_inference->device : "", !created);
+        }
+
         return infRefs->proxy;
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(base_inference, LIBRARY, INIT, ("base_inference plugin initialization failed"),
@@ -186,21 +215,48 @@ std::shared_ptr<InferenceImpl> acquire_inference_instance(GvaBaseInference *base
     }
 }
 
+// Logs wait statistics of element and drops its state in shared instance, element's address may be reused by new one
+static void releaseQueueWaitStats(GvaBaseInference *base_inference, const InferenceImpl &inference_impl) {
+    const auto &inference = inference_impl.GetModel().inference;
+    if (!inference)
+        return;
+    const auto stats = inference->GetQueueWaitStats(base_inference);
+    if (stats.requests)
+        GST_INFO_OBJECT(base_inference,
+                        "Waited for inference request %" G_GUINT64_FORMAT " times: mean %.3f ms, max %.3f ms",
+                        static_cast<guint64>(stats.requests), stats.total_ms / stats.requests, stats.max_ms);
+    inference->RemoveStream(base_inference);
+}
+
 void release_inference_instance(GvaBaseInference *base_inference) {
     try {
-        std::lock_guard<std::mutex> guard(inference_pool_mutex_);
-
-        for (auto it = inference_pool_.begin(); it != inference_pool_.end();) {
-            auto infRefs = it->second;
-            infRefs->refs.erase(base_inference);
-            if (infRefs->refs.empty()) {
-                infRefs->proxy.reset();
-                infRefs.reset();
-                it = inference_pool_.erase(it);
-            } else {
-                ++it;
+        struct ReleasedRefs {
+            std::shared_ptr<InferenceRefs> infRefs;
+            bool registered; // base_inference was one of refs
+            bool removed;    // no refs left, entry is removed from pool
+        };
+        std::vector<ReleasedRefs> released;
+        {
+            std::lock_guard<std::mutex> guard(inference_pool_mutex_);
+            for (auto it = inference_pool_.begin(); it != inference_pool_.end();) {
+                auto infRefs = it->second;
+                const bool registered = infRefs->refs.erase(base_inference) != 0;
+                const bool removed = infRefs->refs.empty();
+                if (registered || removed)
+                    released.push_back({infRefs, registered, removed});
+                it = removed ? inference_pool_.erase(it) : std::next(it);
             }
         }
+
+        // proxy_mutex is held by element acquiring the instance for the whole model loading, so it's locked only for
+        // instances of this element and after releasing inference_pool_mutex_, not to block acquiring other instances
+        for (auto &entry : released) {
+            std::lock_guard<std::mutex> proxy_guard(entry.infRefs->proxy_mutex);
+            if (entry.registered && entry.infRefs->proxy)
+                releaseQueueWaitStats(base_inference, *entry.infRefs->proxy);
+            if (entry.removed)
+                entry.infRefs->proxy.reset();
+        }
     } catch (const std::exception &e) {
         GST_ELEMENT_ERROR(base_inference, LIBRARY, SHUTDOWN, ("base_inference failed on releasing inference instance"),
                           ("%s", Utils::createNestedErrorMsg(e).c_str()));
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "model_loader.h"
+
+ModelLoader &ModelLoader::Instance() {
+    static ModelLoader loader(DEFAULT_THREADS);
+    return loader;
+}
+
+ModelLoader::ModelLoader(size_t threads) {
+    for (size_t i = 0; i < threads; ++i)
+        this->threads.emplace_back(&ModelLoader::Run, this);
+}
+
+ModelLoader::~ModelLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminate = true;
+    }
+    task_available.notify_all();
+    for (auto &thread : threads) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+void ModelLoader::Schedule(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    task_available.notify_one();
+}
+
+void ModelLoader::Run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        task_available.wait(lock, [this] { return !tasks.empty() || terminate; });
+        if (tasks.empty())
+            return;
+
+        std::function<void()> task = std::move(tasks.front());
+        tasks.pop_front();
+
+        // Exceptions are delivered to waiting element through the future
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+}
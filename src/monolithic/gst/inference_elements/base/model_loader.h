@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Threads loading models of inference elements with async-model-load enabled. Element hands model loading to the pool
+ * on caps negotiation and waits for the result only when its first buffer arrives, so models of elements in one
+ * pipeline are read and compiled concurrently.
+ */
+class ModelLoader {
+  public:
+    static ModelLoader &Instance();
+
+    explicit ModelLoader(size_t threads);
+    ~ModelLoader();
+
+    ModelLoader(const ModelLoader &) = delete;
+    ModelLoader &operator=(const ModelLoader &) = delete;
+
+    template <typename Task>
+    auto Submit(Task task) -> std::future<decltype(task())> {
+        using Result = decltype(task());
+        auto packaged_task = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+        auto result = packaged_task->get_future();
+        Schedule([packaged_task]() { (*packaged_task)(); });
+        return result;
+    }
+
+  private:
+    // Compilation is multithreaded itself, a few loaders are enough to overlap I/O and single-threaded stages
+    static constexpr size_t DEFAULT_THREADS = 4;
+
+    void Schedule(std::function<void()> task);
+    void Run();
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable task_available;
+    std::deque<std::function<void()>> tasks;
+    bool terminate = false;
+};
@@ -18,6 +18,7 @@
 #include <gst/video/video.h>
 
 #include <functional>
+#include <memory>
 
 struct _GvaBaseInference;
 typedef struct _GvaBaseInference GvaBaseInference;
@@ -27,19 +28,19 @@ struct InferenceFrame {
     GstVideoRegionOfInterestMeta roi;
     std::vector<GstStructure *> roi_classifications; // length equals to output layers count
     GvaBaseInference *gva_base_inference;
-    GstVideoInfo *info;
+    // Video info of negotiated caps, shared by all frames inferred with these caps
+    std::shared_ptr<const GstVideoInfo> info;
 
     InferenceBackend::ImageTransformationParams::Ptr image_transform_info = nullptr;
 
+    // Set for inference-region=tiles: index of the tile, number of tiles the frame is split into and frame number
+    size_t tile = 0;
+    size_t tile_count = 0;
+    uint64_t frame_num = 0;
+
     InferenceFrame() = default;
     InferenceFrame(const InferenceFrame &) = delete;
     InferenceFrame &operator=(const InferenceFrame &rhs) = delete;
-    ~InferenceFrame() {
-        if (info) {
-            gst_video_info_free(info);
-            info = nullptr;
-        }
-    }
 };
 
 using InputPreprocessingFunction = std::function<void(const InferenceBackend::InputBlob::Ptr &)>;
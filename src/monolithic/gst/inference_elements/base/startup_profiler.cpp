@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "startup_profiler.h"
+
+#include "inference_backend/logger.h"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace {
+
+std::string profile_path_from_env() {
+    const char *path = std::getenv(StartupProfiler::ENV_VARIABLE);
+    return path ? path : "";
+}
+
+nlohmann::json time_point(double ms) {
+    return ms < 0 ? nlohmann::json() : nlohmann::json(ms);
+}
+
+} // namespace
+
+StartupProfiler &StartupProfiler::Instance() {
+    static StartupProfiler profiler(profile_path_from_env());
+    return profiler;
+}
+
+StartupProfiler::StartupProfiler(std::string path) : path(std::move(path)) {
+}
+
+double StartupProfiler::Now() {
+    const auto now = Clock::now();
+    if (!started) {
+        origin = now;
+        started = true;
+    }
+    return std::chrono::duration<double, std::milli>(now - origin).count();
+}
+
+StartupProfiler::ElementProfile &StartupProfiler::GetProfile(const void *element) {
+    auto it = profiles.find(element);
+    if (it != profiles.end())
+        return it->second;
+    order.push_back(element);
+    return profiles[element];
+}
+
+void StartupProfiler::CapsReceived(const void *element, const std::string &name) {
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> lock(mutex);
+    ElementProfile &profile = GetProfile(element);
+    profile = ElementProfile();
+    profile.name = name;
+    profile.caps_ms = Now();
+}
+
+void StartupProfiler::AddStage(const void *element, const std::string &stage, double duration_ms) {
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> lock(mutex);
+    GetProfile(element).stages.emplace_back(stage, duration_ms);
+}
+
+void StartupProfiler::ModelReady(const void *element, const std::string &model, const std::string &device,
+                                 bool shared_instance) {
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> lock(mutex);
+    ElementProfile &profile = GetProfile(element);
+    profile.model = model;
+    profile.device = device;
+    profile.shared_instance = shared_instance;
+    profile.model_ready_ms = Now();
+}
+
+void StartupProfiler::FirstFrame(const void *element) {
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> lock(mutex);
+    GetProfile(element).first_frame_ms = Now();
+    Write();
+}
+
+nlohmann::json StartupProfiler::ToJson() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return ToJsonUnlocked();
+}
+
+nlohmann::json StartupProfiler::ToJsonUnlocked() const {
+    nlohmann::json elements = nlohmann::json::array();
+    for (const void *element : order) {
+        const ElementProfile &profile = profiles.at(element);
+        nlohmann::json stages = nlohmann::json::object();
+        for (const auto &stage : profile.stages)
+            stages[stage.first] = stage.second;
+        elements.push_back({{"element", profile.name},
+                            {"model", profile.model},
+                            {"device", profile.device},
+                            {"shared_instance", profile.shared_instance},
+                            {"caps_ms", time_point(profile.caps_ms)},
+                            {"model_ready_ms", time_point(profile.model_ready_ms)},
+                            {"first_frame_ms", time_point(profile.first_frame_ms)},
+                            {"stages_ms", stages}});
+    }
+    return {{"elements", elements}};
+}
+
+void StartupProfiler::Write() const {
+    std::ofstream file(path);
+    if (!file) {
+        GVA_WARNING("Couldn't write startup profile to '%s'", path.c_str());
+        return;
+    }
+    file << ToJsonUnlocked().dump(2) << std::endl;
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Collects startup timeline of inference elements: when caps were received, durations of model loading stages
+ * (model-proc, read, reshape, ppp, compile), when model became ready and when the first frame was processed.
+ * Points in time are milliseconds since the first event recorded by profiler, so loading of different elements can
+ * be compared on one timeline.
+ *
+ * Profile of all elements is written as JSON to the file set by GVA_STARTUP_PROFILE environment variable each time
+ * an element processes its first frame. Profiler is disabled if the variable is not set.
+ *
+ * Elements are identified by pointer, as names of elements of different pipelines may be the same. Name is used in
+ * the output only.
+ */
+class StartupProfiler {
+  public:
+    static constexpr const char *ENV_VARIABLE = "GVA_STARTUP_PROFILE";
+
+    static StartupProfiler &Instance();
+
+    // Empty path disables profiler
+    explicit StartupProfiler(std::string path);
+
+    bool IsEnabled() const {
+        return !path.empty();
+    }
+
+    // Starts new profile of element, previous profile of element is discarded
+    void CapsReceived(const void *element, const std::string &name);
+    void AddStage(const void *element, const std::string &stage, double duration_ms);
+    void ModelReady(const void *element, const std::string &model, const std::string &device, bool shared_instance);
+    // Records first processed frame and writes profile
+    void FirstFrame(const void *element);
+
+    nlohmann::json ToJson() const;
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct ElementProfile {
+        std::string name;
+        std::string model;
+        std::string device;
+        bool shared_instance = false;
+        double caps_ms = -1;
+        double model_ready_ms = -1;
+        double first_frame_ms = -1;
+        std::vector<std::pair<std::string, double>> stages;
+    };
+
+    // Callers hold the mutex
+    ElementProfile &GetProfile(const void *element);
+    double Now();
+    nlohmann::json ToJsonUnlocked() const;
+    void Write() const;
+
+    const std::string path;
+    mutable std::mutex mutex;
+    bool started = false;
+    Clock::time_point origin;
+    std::vector<const void *> order;
+    std::map<const void *, ElementProfile> profiles;
+};
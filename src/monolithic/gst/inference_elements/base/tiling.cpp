@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "tiling.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Tiling {
+
+namespace {
+
+// Start positions of tiles along one axis
+std::vector<uint32_t> tileOffsets(uint32_t frame_size, uint32_t tile_size, double overlap) {
+    if (tile_size >= frame_size)
+        return {0};
+
+    const uint32_t stride = std::max<uint32_t>(1, static_cast<uint32_t>(std::floor(tile_size * (1.0 - overlap))));
+    std::vector<uint32_t> offsets;
+    for (uint32_t offset = 0; offset + tile_size < frame_size; offset += stride)
+        offsets.push_back(offset);
+    offsets.push_back(frame_size - tile_size);
+    return offsets;
+}
+
+double area(const Detection &d) {
+    return std::max(0.0, d.x_max - d.x_min) * std::max(0.0, d.y_max - d.y_min);
+}
+
+double intersectionOverSmaller(const Detection &a, const Detection &b) {
+    const double w = std::min(a.x_max, b.x_max) - std::max(a.x_min, b.x_min);
+    const double h = std::min(a.y_max, b.y_max) - std::max(a.y_min, b.y_min);
+    if (w <= 0 || h <= 0)
+        return 0;
+    const double smaller = std::min(area(a), area(b));
+    return smaller > 0 ? w * h / smaller : 0;
+}
+
+} // namespace
+
+std::vector<Rect> makeTiles(uint32_t frame_width, uint32_t frame_height, uint32_t tile_width, uint32_t tile_height,
+                            double overlap) {
+    std::vector<Rect> tiles;
+    if (!frame_width || !frame_height || !tile_width || !tile_height)
+        return tiles;
+    overlap = std::clamp(overlap, 0.0, 0.99);
+
+    const auto xs = tileOffsets(frame_width, tile_width, overlap);
+    const auto ys = tileOffsets(frame_height, tile_height, overlap);
+    tiles.reserve(xs.size() * ys.size());
+    for (uint32_t y : ys) {
+        for (uint32_t x : xs) {
+            Rect tile;
+            tile.x = x;
+            tile.y = y;
+            tile.w = std::min(tile_width, frame_width);
+            tile.h = std::min(tile_height, frame_height);
+            tiles.push_back(tile);
+        }
+    }
+    return tiles;
+}
+
+bool intersects(const Rect &a, const Rect &b) {
+    return a.x < static_cast<uint64_t>(b.x) + b.w && b.x < static_cast<uint64_t>(a.x) + a.w &&
+           a.y < static_cast<uint64_t>(b.y) + b.h && b.y < static_cast<uint64_t>(a.y) + a.h;
+}
+
+std::vector<bool> mergeSeamDuplicates(const std::vector<Detection> &detections, double threshold) {
+    std::vector<size_t> order(detections.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&detections](size_t lhs, size_t rhs) {
+        return detections[lhs].confidence > detections[rhs].confidence;
+    });
+
+    std::vector<bool> keep(detections.size(), true);
+    for (size_t i = 0; i < order.size(); i++) {
+        const Detection &kept = detections[order[i]];
+        if (!keep[order[i]])
+            continue;
+        for (size_t j = i + 1; j < order.size(); j++) {
+            const Detection &candidate = detections[order[j]];
+            if (!keep[order[j]] || candidate.tile == kept.tile || candidate.label_id != kept.label_id)
+                continue;
+            if (intersectionOverSmaller(kept, candidate) > threshold)
+                keep[order[j]] = false;
+        }
+    }
+    return keep;
+}
+
+} // namespace Tiling
@@ -0,0 +1,50 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Splitting of frames into overlapping tiles for inference-region=tiles, and merging of detections that neighbouring
+ * tiles report for the same object.
+ */
+namespace Tiling {
+
+struct Rect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t w = 0;
+    uint32_t h = 0;
+};
+
+// Detection in frame coordinates, tile is index of the tile it was found in
+struct Detection {
+    double x_min = 0;
+    double y_min = 0;
+    double x_max = 0;
+    double y_max = 0;
+    double confidence = 0;
+    int label_id = 0;
+    size_t tile = 0;
+};
+
+// Covers frame with tiles of given size overlapping by at least overlap share of tile size, [0, 1). Last tile of
+// each row and column is aligned to frame border, so all tiles have the same size unless frame is smaller than tile.
+std::vector<Rect> makeTiles(uint32_t frame_width, uint32_t frame_height, uint32_t tile_width, uint32_t tile_height,
+                            double overlap);
+
+bool intersects(const Rect &a, const Rect &b);
+
+// Marks detections to keep. Detection is dropped if detection of the same label from another tile with higher
+// confidence covers it by more than threshold of the smaller box area: box of an object cut by tile border is covered
+// by the full box found in the neighbouring tile, while their IoU may be low. Detections of one tile are never merged,
+// the model has already applied NMS to them.
+std::vector<bool> mergeSeamDuplicates(const std::vector<Detection> &detections, double threshold);
+
+} // namespace Tiling
@@ -193,6 +193,10 @@ PostProcessor::PostProcessor(InferenceImpl *inference_impl, GvaBaseInference *ba
     /* set attach type */
     if (inference_region == InferenceRegionType::FULL_FRAME) {
         initializer.attach_type = AttachType::TO_FRAME;
+    } else if (inference_region == InferenceRegionType::TILES) {
+        initializer.attach_type = AttachType::TO_FRAME;
+        initializer.merge_tiles = true;
+        initializer.tile_merge_threshold = base_inference->tile_merge_threshold;
     } else if (inference_region == InferenceRegionType::ROI_LIST) {
         initializer.attach_type = AttachType::TO_ROI;
     }
@@ -253,3 +257,11 @@ PostProcessorImpl::ExitStatus PostProcessor::process(const OutputBlobs &blobs, I
     auto frame_wrappers = FramesWrapper(frames);
     return post_proc_impl.process(blobs, frame_wrappers);
 }
+
+void PostProcessor::discard(InferenceFrames &frames) const {
+    post_proc_impl.discard(FramesWrapper(frames));
+}
+
+void PostProcessor::flush() const {
+    post_proc_impl.flush();
+}
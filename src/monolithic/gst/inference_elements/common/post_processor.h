@@ -25,6 +25,8 @@ class PostProcessor {
                   const std::string &labels);
 
     PostProcessorImpl::ExitStatus process(const OutputBlobs &, InferenceFrames &) const;
+    void discard(InferenceFrames &) const;
+    void flush() const;
 
     // TODO: temporary for test purposes
     PostProcessorImpl::Initializer get_initializer() const {
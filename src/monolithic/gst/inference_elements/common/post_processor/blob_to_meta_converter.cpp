@@ -137,6 +137,14 @@ BlobToMetaConverter::BlobToMetaConverter(Initializer initializer)
       labels(initializer.labels) {
 }
 
+std::string BlobToMetaConverter::getMaskEncoding() const {
+    const GstStructure *s = model_proc_output_info.get();
+    if (s == nullptr || !gst_structure_has_field(s, "mask_encoding"))
+        return std::string();
+    const gchar *encoding = gst_structure_get_string(s, "mask_encoding");
+    return encoding ? encoding : std::string();
+}
+
 BlobToMetaConverter::Ptr BlobToMetaConverter::create(Initializer initializer, ConverterType converter_type,
                                                      const std::string &displayed_layer_name_in_meta,
                                                      const std::string &custom_postproc_lib) {
@@ -54,6 +54,9 @@ class BlobToMetaConverter {
         return model_proc_output_info;
     }
 
+    // Compact encoding of masks requested by "mask_encoding" field of model-proc output processor, empty if not set
+    std::string getMaskEncoding() const;
+
     const std::string &getLabelByLabelId(size_t label_id) const {
         static const std::string empty_label;
         const auto &labels = getLabels();
@@ -156,6 +156,20 @@ OutputBlobs ConverterFacade::extractProcessedOutputBlobs(const OutputBlobs &all_
     return processed_output_blobs;
 }
 
+void ConverterFacade::enableTileMerging(double threshold) {
+    tile_merger = TileMerger::Ptr(new TileMerger(threshold));
+}
+
+void ConverterFacade::discard(const FramesWrapper &frames) const {
+    if (tile_merger)
+        tile_merger->discard(frames);
+}
+
+void ConverterFacade::flush() const {
+    if (tile_merger)
+        tile_merger->clear();
+}
+
 void ConverterFacade::convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames) const {
     TensorsTable tensors_batch;
     if (process_all_outputs)
@@ -168,5 +182,8 @@ void ConverterFacade::convert(const OutputBlobs &all_output_blobs, FramesWrapper
     if (frames.need_coordinate_restore() && coordinates_restorer != nullptr)
         coordinates_restorer->restore(tensors_batch, frames);
 
+    if (tile_merger)
+        tile_merger->merge(tensors_batch, frames);
+
     meta_attacher->attach(tensors_batch, frames, *blob_to_meta);
 }
@@ -9,6 +9,7 @@
 #include "blob_to_meta_converter.h"
 #include "coordinates_restorer.h"
 #include "meta_attacher.h"
+#include "tile_merger.h"
 
 #include "inference_backend/image_inference.h"
 
@@ -38,6 +39,7 @@ class ConverterFacade {
     BlobToMetaConverter::Ptr blob_to_meta;
     CoordinatesRestorer::Ptr coordinates_restorer;
     MetaAttacher::Ptr meta_attacher;
+    TileMerger::Ptr tile_merger;
 
   public:
     ConverterFacade(std::unordered_set<std::string> all_layer_names, GstStructure *model_proc_output_info,
@@ -51,6 +53,12 @@ class ConverterFacade {
 
     void convert(const OutputBlobs &all_output_blobs, FramesWrapper &frames) const;
 
+    // Detections of tiles are attached once per frame, with duplicates at tile seams merged
+    void enableTileMerging(double threshold);
+    // Frames failed inference and flush of detections held back for tile merging
+    void discard(const FramesWrapper &frames) const;
+    void flush() const;
+
     ConverterFacade() = default;
     ConverterFacade(const ConverterFacade &) = delete;
     ConverterFacade(ConverterFacade &&) = default;
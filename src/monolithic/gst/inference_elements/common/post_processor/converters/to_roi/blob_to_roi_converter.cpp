@@ -23,6 +23,7 @@
 #include "yolo_v8.h"
 #include "yolo_x.h"
 
+#include "copy_blob_to_gststruct.h"
 #include "inference_backend/logger.h"
 
 #include <gst/gst.h>
@@ -109,6 +110,7 @@ TensorsTable BlobToROIConverter::toTensorsTable(const DetectedObjectsTable &bbox
     for (size_t image_id = 0; image_id < batch_size; ++image_id) {
         auto &tensors_batch = tensors_table[image_id];
         const auto &bboxes = bboxes_table[image_id];
+        tensors_batch.reserve(bboxes.size());
         for (const DetectedObject &object : bboxes) {
             tensors_batch.emplace_back(object.toTensor(getModelProcOutputInfo()));
         }
@@ -117,6 +119,18 @@ TensorsTable BlobToROIConverter::toTensorsTable(const DetectedObjectsTable &bbox
     return tensors_table;
 }
 
+void BlobToROIConverter::setSegmentationMaskData(GstStructure *tensor, const float *mask, size_t size) const {
+    if (mask_encoding == MaskCodec::BITMASK) {
+        const std::vector<uint8_t> bits = MaskCodec::packBits(mask, size);
+        gst_structure_set(tensor, "precision", G_TYPE_INT, GVA_PRECISION_U8, MaskCodec::ENCODING_FIELD, G_TYPE_STRING,
+                          MaskCodec::BITMASK, NULL);
+        copy_buffer_to_structure(tensor, reinterpret_cast<const void *>(bits.data()), bits.size());
+        return;
+    }
+    gst_structure_set(tensor, "precision", G_TYPE_INT, GVA_PRECISION_FP32, NULL);
+    copy_buffer_to_structure(tensor, reinterpret_cast<const void *>(mask), size * sizeof(float));
+}
+
 TensorsTable BlobToROIConverter::storeObjects(DetectedObjectsTable &objects_table) const {
     ITT_TASK(__FUNCTION__);
     if (need_nms)
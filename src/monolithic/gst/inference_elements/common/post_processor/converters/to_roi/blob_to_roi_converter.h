@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "mask_codec.h"
 #include "post_processor/blob_to_meta_converter.h"
 #include "post_processor/post_proc_common.h"
 
@@ -31,13 +32,14 @@ class BlobToROIConverter : public BlobToMetaConverter {
         double confidence;
 
         size_t label_id;
-        std::string label;
+        // Not owned: points to label stored by converter or interned as GQuark, so sorting and copying detections
+        // doesn't copy label strings
+        const char *label;
 
         std::vector<GstStructure *> tensors;
 
         DetectedObject(double x, double y, double w, double h, double r, double confidence, size_t label_id,
-                       const std::string &label, double w_scale = 1.f, double h_scale = 1.f,
-                       bool relative_to_center = false)
+                       const char *label, double w_scale = 1.f, double h_scale = 1.f, bool relative_to_center = false)
             : confidence(confidence), label_id(label_id), label(label) {
             if (relative_to_center) {
                 this->x = (x - w / 2) * w_scale;
@@ -53,6 +55,16 @@ class BlobToROIConverter : public BlobToMetaConverter {
             this->r = r;
         }
 
+        // Label must outlive detected object, usually it is returned by getLabelByLabelId()
+        DetectedObject(double x, double y, double w, double h, double r, double confidence, size_t label_id,
+                       const std::string &label, double w_scale = 1.f, double h_scale = 1.f,
+                       bool relative_to_center = false)
+            : DetectedObject(x, y, w, h, r, confidence, label_id, label.c_str(), w_scale, h_scale, relative_to_center) {
+        }
+        DetectedObject(double x, double y, double w, double h, double r, double confidence, size_t label_id,
+                       std::string &&label, double w_scale = 1.f, double h_scale = 1.f,
+                       bool relative_to_center = false) = delete;
+
         bool operator<(const DetectedObject &other) const {
             return this->confidence < other.confidence;
         }
@@ -69,12 +81,13 @@ class BlobToROIConverter : public BlobToMetaConverter {
                               confidence, "x_min", G_TYPE_DOUBLE, x, "x_max", G_TYPE_DOUBLE, x + w, "y_min",
                               G_TYPE_DOUBLE, y, "y_max", G_TYPE_DOUBLE, y + h, "rotation", G_TYPE_DOUBLE, r, NULL);
 
-            if (not label.empty())
-                gst_structure_set(detection_tensor, "label", G_TYPE_STRING, label.c_str(), NULL);
+            if (label && label[0] != '\0')
+                gst_structure_set(detection_tensor, "label", G_TYPE_STRING, label, NULL);
 
-            std::vector<GstStructure *> results{detection_tensor};
-            for (size_t i = 0; i < tensors.size(); i++)
-                results.push_back(tensors[i]);
+            std::vector<GstStructure *> results;
+            results.reserve(tensors.size() + 1);
+            results.push_back(detection_tensor);
+            results.insert(results.end(), tensors.begin(), tensors.end());
 
             return results;
         }
@@ -85,9 +98,14 @@ class BlobToROIConverter : public BlobToMetaConverter {
     void runNms(std::vector<DetectedObject> &candidates) const;
     TensorsTable toTensorsTable(const DetectedObjectsTable &bboxes_table) const;
 
+    // Stores instance segmentation mask of detected object as tensor data: packed to bits if "mask_encoding" is
+    // "bitmask", otherwise as FP32 probabilities
+    void setSegmentationMaskData(GstStructure *tensor, const float *mask, size_t size) const;
+
     const double confidence_threshold;
     const bool need_nms;
     const double iou_threshold;
+    const std::string mask_encoding;
 
   public:
     BlobToROIConverter() = delete;
@@ -95,7 +113,10 @@ class BlobToROIConverter : public BlobToMetaConverter {
     BlobToROIConverter(BlobToMetaConverter::Initializer initializer, double confidence_threshold, bool need_nms,
                        double iou_threshold)
         : BlobToMetaConverter(std::move(initializer)), confidence_threshold(confidence_threshold), need_nms(need_nms),
-          iou_threshold(iou_threshold) {
+          iou_threshold(iou_threshold), mask_encoding(getMaskEncoding()) {
+        if (!mask_encoding.empty() && mask_encoding != MaskCodec::BITMASK)
+            throw std::invalid_argument("Unsupported mask_encoding '" + mask_encoding +
+                                        "' for detection output, supported: " + MaskCodec::BITMASK);
     }
 
     TensorsTable convert(const OutputBlobs &output_blobs) = 0;
@@ -173,7 +173,8 @@ TensorsTable CustomToRoiConverter::convert(const OutputBlobs &output_blobs) {
                 }
 
                 GQuark label_gquark = gst_analytics_od_mtd_get_obj_type(&od_mtd);
-                std::string label = "";
+                // Quark strings are interned for process lifetime, so detected object may refer to them
+                const char *label = "";
                 size_t label_id = 0;
 
                 if (label_gquark) {
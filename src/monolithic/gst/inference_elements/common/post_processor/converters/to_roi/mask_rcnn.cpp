@@ -142,7 +142,6 @@ TensorsTable MaskRCNNConverter::convert(const OutputBlobs &output_blobs) {
                 // create segmentation mask tensor
                 GstStructure *tensor = gst_structure_copy(getModelProcOutputInfo().get());
                 gst_structure_set_name(tensor, "mask_rcnn");
-                gst_structure_set(tensor, "precision", G_TYPE_INT, GVA_PRECISION_FP32, NULL);
                 gst_structure_set(tensor, "format", G_TYPE_STRING, "segmentation_mask", NULL);
 
                 GValueArray *data = g_value_array_new(2);
@@ -155,8 +154,7 @@ TensorsTable MaskRCNNConverter::convert(const OutputBlobs &output_blobs) {
                 gst_structure_set_array(tensor, "dims", data);
                 g_value_array_free(data);
 
-                copy_buffer_to_structure(tensor, reinterpret_cast<const void *>(mask),
-                                         masks_height * masks_width * sizeof(float));
+                setSegmentationMaskData(tensor, mask, masks_height * masks_width);
                 detected_object.tensors.push_back(tensor);
 
                 objects.push_back(detected_object);
@@ -301,9 +301,8 @@ void YOLOv8SegConverter::parseOutputBlob(const float *boxes_data, const std::vec
 
             // set tensor data
             tensor.set_dims({safe_convert<uint32_t>(cropped_mask.cols), safe_convert<uint32_t>(cropped_mask.rows)});
-            tensor.set_precision(GVA::Tensor::Precision::FP32);
-            tensor.set_data(reinterpret_cast<const void *>(cropped_mask.data),
-                            cropped_mask.rows * cropped_mask.cols * sizeof(float));
+            setSegmentationMaskData(tensor.gst_structure(), reinterpret_cast<const float *>(cropped_mask.data),
+                                    cropped_mask.total());
 
             // add tensor to the list of detected objects
             detected_object.tensors.push_back(tensor.gst_structure());
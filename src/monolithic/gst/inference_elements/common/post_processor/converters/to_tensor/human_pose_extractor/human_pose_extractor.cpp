@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -29,23 +29,28 @@ HumanPoseExtractor::HumanPoses HumanPoseExtractor::postprocess(const float *heat
         heat_maps[i] = cv::Mat(feature_map_height, feature_map_width, CV_32FC1,
                                reinterpret_cast<void *>(const_cast<float *>(heat_maps_data + i * heat_map_offset)));
     }
-    resizeFeatureMaps(heat_maps);
+    if (maps_resize_device_type != ResizeDeviceType::NATIVE)
+        resizeFeatureMaps(heat_maps);
 
     std::vector<cv::Mat> pafs(n_pafs);
     for (size_t i = 0; i < pafs.size(); i++) {
         pafs[i] = cv::Mat(feature_map_height, feature_map_width, CV_32FC1,
                           reinterpret_cast<void *>(const_cast<float *>(pafs_data + i * paf_offset)));
     }
-    resizeFeatureMaps(pafs);
+    if (maps_resize_device_type != ResizeDeviceType::NATIVE)
+        resizeFeatureMaps(pafs);
 
-    HumanPoseExtractor::HumanPoses poses = extractPoses(heat_maps, pafs);
+    // Resized maps are used as is, native ones are upsampled on access
+    const int maps_upsample_ratio = maps_resize_device_type == ResizeDeviceType::NATIVE ? upsample_ratio : 1;
+    HumanPoseExtractor::HumanPoses poses = extractPoses(heat_maps, pafs, maps_upsample_ratio);
     return poses;
 }
 
 HumanPoseExtractor::HumanPoses HumanPoseExtractor::extractPoses(const std::vector<cv::Mat> &heat_maps,
-                                                                const std::vector<cv::Mat> &pafs) const {
+                                                                const std::vector<cv::Mat> &pafs,
+                                                                int maps_upsample_ratio) const {
     std::vector<std::vector<Peak>> peaks_from_heat_map(heat_maps.size());
-    FindPeaksBody find_peaks_body(heat_maps, min_peaks_distance, peaks_from_heat_map);
+    FindPeaksBody find_peaks_body(heat_maps, min_peaks_distance, peaks_from_heat_map, maps_upsample_ratio);
     cv::parallel_for_(cv::Range(0, safe_convert<int>(heat_maps.size())), find_peaks_body);
     int peaks_before = 0;
     for (size_t heatmap_id = 1; heatmap_id < heat_maps.size(); heatmap_id++) {
@@ -54,8 +59,12 @@ HumanPoseExtractor::HumanPoses HumanPoseExtractor::extractPoses(const std::vecto
             peak.id += peaks_before;
         }
     }
+    std::vector<UpsampledFeatureMap> upsampled_pafs;
+    upsampled_pafs.reserve(pafs.size());
+    for (const auto &paf : pafs)
+        upsampled_pafs.emplace_back(paf, maps_upsample_ratio);
     HumanPoseExtractor::HumanPoses poses =
-        GroupPeaksToPoses(peaks_from_heat_map, pafs, keypoints_number, mid_points_score_threshold,
+        GroupPeaksToPoses(peaks_from_heat_map, upsampled_pafs, keypoints_number, mid_points_score_threshold,
                           found_mid_points_ratio_threshold, min_joints_number, min_subset_score);
     return poses;
 }
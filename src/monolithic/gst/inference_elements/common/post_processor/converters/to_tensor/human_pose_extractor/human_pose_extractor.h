@@ -17,7 +17,9 @@ class HumanPoseExtractor {
   public:
     const size_t keypoints_number;
 
-    enum class ResizeDeviceType { CPU_OCV, GPU_OCV };
+    // NATIVE - feature maps are not resized: peaks are found on native resolution maps and refined on upsampled grid,
+    // upsampled values are interpolated only at the points where they are needed. CPU_OCV and GPU_OCV resize whole maps
+    enum class ResizeDeviceType { CPU_OCV, GPU_OCV, NATIVE };
     struct HumanPose {
         HumanPose(const std::vector<cv::Point2f> &keypoints = std::vector<cv::Point2f>(), const float &score = 0)
             : keypoints(keypoints), score(score) {
@@ -29,7 +31,7 @@ class HumanPoseExtractor {
 
     using HumanPoses = std::vector<HumanPose>;
 
-    HumanPoseExtractor(size_t, ResizeDeviceType maps_resize_device_type = ResizeDeviceType::CPU_OCV);
+    HumanPoseExtractor(size_t, ResizeDeviceType maps_resize_device_type = ResizeDeviceType::NATIVE);
 
     HumanPoseExtractor() = delete;
     HumanPoseExtractor(const HumanPoseExtractor &) = default;
@@ -42,7 +44,8 @@ class HumanPoseExtractor {
     void correctCoordinates(HumanPoses &poses, cv::Size output_feature_map_size) const;
 
   private:
-    HumanPoses extractPoses(const std::vector<cv::Mat> &heat_maps, const std::vector<cv::Mat> &pafs) const;
+    HumanPoses extractPoses(const std::vector<cv::Mat> &heat_maps, const std::vector<cv::Mat> &pafs,
+                            int maps_upsample_ratio) const;
     void resizeFeatureMaps(std::vector<cv::Mat> &feature_maps) const;
 
     const int min_joints_number;
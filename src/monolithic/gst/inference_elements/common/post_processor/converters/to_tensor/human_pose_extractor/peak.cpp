@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -7,9 +7,49 @@
 #include "peak.h"
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 
+UpsampledFeatureMap::UpsampledFeatureMap(const cv::Mat &map, int upsample_ratio)
+    : map(map), upsample_ratio(std::max(upsample_ratio, 1)) {
+    // Same as coefficients of cv::resize with cv::INTER_CUBIC, upsampled point u is interpolated around native point
+    // (u + 0.5) / upsample_ratio - 0.5
+    const float a = -0.75f;
+    for (int phase = 0; phase < this->upsample_ratio; phase++) {
+        const float position = (phase + 0.5f) / this->upsample_ratio - 0.5f;
+        Taps phase_taps;
+        phase_taps.offset = cvFloor(position);
+        const float x = position - phase_taps.offset;
+        phase_taps.coeffs[0] = ((a * (x + 1) - 5 * a) * (x + 1) + 8 * a) * (x + 1) - 4 * a;
+        phase_taps.coeffs[1] = ((a + 2) * x - (a + 3)) * x * x + 1;
+        phase_taps.coeffs[2] = ((a + 2) * (1 - x) - (a + 3)) * (1 - x) * (1 - x) + 1;
+        phase_taps.coeffs[3] = 1.f - phase_taps.coeffs[0] - phase_taps.coeffs[1] - phase_taps.coeffs[2];
+        taps.push_back(phase_taps);
+    }
+}
+
+float UpsampledFeatureMap::at(const cv::Point &point) const {
+    if (upsample_ratio == 1)
+        return map.at<float>(point);
+
+    const Taps &taps_x = taps[point.x % upsample_ratio];
+    const Taps &taps_y = taps[point.y % upsample_ratio];
+    const int x0 = point.x / upsample_ratio + taps_x.offset - 1;
+    const int y0 = point.y / upsample_ratio + taps_y.offset - 1;
+    // Border pixels are replicated
+    int xs[4];
+    for (int i = 0; i < 4; i++)
+        xs[i] = std::min(std::max(x0 + i, 0), map.cols - 1);
+    float value = 0.0f;
+    for (int j = 0; j < 4; j++) {
+        const float *row = map.ptr<float>(std::min(std::max(y0 + j, 0), map.rows - 1));
+        value += taps_y.coeffs[j] * (taps_x.coeffs[0] * row[xs[0]] + taps_x.coeffs[1] * row[xs[1]] +
+                                     taps_x.coeffs[2] * row[xs[2]] + taps_x.coeffs[3] * row[xs[3]]);
+    }
+    return value;
+}
+
 Peak::Peak(const int id, const cv::Point2f &pos, const float score) : id(id), pos(pos), score(score) {
 }
 
@@ -22,8 +62,9 @@ TwoJointsConnection::TwoJointsConnection(const int first_joint_idx, const int se
 }
 
 FindPeaksBody::FindPeaksBody(const std::vector<cv::Mat> &heat_maps, float min_peaks_distance,
-                             std::vector<std::vector<Peak>> &peaks_from_heat_map)
-    : heat_maps(heat_maps), min_peaks_distance(min_peaks_distance), peaks_from_heat_map(peaks_from_heat_map) {
+                             std::vector<std::vector<Peak>> &peaks_from_heat_map, int upsample_ratio)
+    : heat_maps(heat_maps), min_peaks_distance(min_peaks_distance), peaks_from_heat_map(peaks_from_heat_map),
+      upsample_ratio(upsample_ratio) {
 }
 
 void FindPeaksBody::operator()(const cv::Range &range) const {
@@ -34,7 +75,7 @@ void FindPeaksBody::operator()(const cv::Range &range) const {
 
 std::vector<TwoJointsConnection> ComputeLineIntegralAndWeightedBipartiteGraph(
     const std::vector<Peak> &candidate_a, const std::vector<Peak> &candidate_b, const float mid_points_score_threshold,
-    const std::pair<cv::Mat, cv::Mat> &score_mid, const std::vector<cv::Mat> &pafs,
+    const std::pair<UpsampledFeatureMap, UpsampledFeatureMap> &score_mid, const std::vector<UpsampledFeatureMap> &pafs,
     const float found_mid_points_ratio_threshold) {
     std::vector<TwoJointsConnection> temp_joint_connections;
     for (size_t i = 0; i < candidate_a.size(); ++i) {
@@ -49,8 +90,8 @@ std::vector<TwoJointsConnection> ComputeLineIntegralAndWeightedBipartiteGraph(
             }
             vec /= norm_vec;
             // sampling
-            float score = vec.x * score_mid.first.at<float>(mid) + vec.y * score_mid.second.at<float>(mid);
-            int height_n = pafs[0].rows / 2;
+            float score = vec.x * score_mid.first.at(mid) + vec.y * score_mid.second.at(mid);
+            int height_n = pafs[0].rows() / 2;
             float suc_ratio = 0.0f;
             float mid_score = 0.0f;
             const int mid_num = 10;
@@ -64,7 +105,7 @@ std::vector<TwoJointsConnection> ComputeLineIntegralAndWeightedBipartiteGraph(
                 for (int n = 0; n < mid_num; n++) {
                     cv::Point mid_point(cvRound(candidate_a[i].pos.x + n * step.width),
                                         cvRound(candidate_a[i].pos.y + n * step.height));
-                    cv::Point2f pred(score_mid.first.at<float>(mid_point), score_mid.second.at<float>(mid_point));
+                    cv::Point2f pred(score_mid.first.at(mid_point), score_mid.second.at(mid_point));
                     // integral step
                     score = vec.x * pred.x + vec.y * pred.y;
                     if (score > mid_points_score_threshold) {
@@ -140,7 +181,7 @@ void FillingSubSetForExistPeak(const size_t n_joint_peak, const size_t keypoints
 }
 
 void FindPeaksBody::runNms(std::vector<cv::Point> &peaks, std::vector<std::vector<Peak>> &all_peaks, int heat_map_id,
-                           const float min_peaks_distance, const cv::Mat &heat_map) const {
+                           const float min_peaks_distance, const UpsampledFeatureMap &heat_map) const {
     std::sort(peaks.begin(), peaks.end(), [](const cv::Point &a, const cv::Point &b) { return a.x < b.x; });
     std::vector<bool> is_actual_peak(peaks.size(), true);
     int peak_counter = 0;
@@ -154,7 +195,7 @@ void FindPeaksBody::runNms(std::vector<cv::Point> &peaks, std::vector<std::vecto
                 }
             }
             peaks_with_score_and_id.push_back(Peak(peak_counter++, peaks[i],
-                                                   heat_map.at<float>(peaks[i]))); // each heatmap contain image
+                                                   heat_map.at(peaks[i]))); // each heatmap contain image
                                                                                    // with keypoint for specia
                                                                                    // limb(for all people on image)
         }
@@ -205,7 +246,28 @@ void FindPeaksBody::findPeaks(const std::vector<cv::Mat> &heat_maps, const float
             }
         }
     }
-    runNms(peaks, all_peaks, heat_map_id, min_peaks_distance, heat_map);
+    const UpsampledFeatureMap upsampled_heat_map(heat_map, upsample_ratio);
+    if (upsample_ratio > 1) {
+        // Maximum of upsampled map lies between native neighbors of the peak, so peak is moved to the maximum of
+        // upsampled points around it
+        for (auto &peak : peaks) {
+            cv::Point refined_peak;
+            float max_val = -std::numeric_limits<float>::max();
+            const int y_end = std::min((peak.y + 2) * upsample_ratio, upsampled_heat_map.rows());
+            const int x_end = std::min((peak.x + 2) * upsample_ratio, upsampled_heat_map.cols());
+            for (int y = std::max((peak.y - 1) * upsample_ratio, 0); y < y_end; y++) {
+                for (int x = std::max((peak.x - 1) * upsample_ratio, 0); x < x_end; x++) {
+                    float val = upsampled_heat_map.at(cv::Point(x, y));
+                    if (val > max_val) {
+                        max_val = val;
+                        refined_peak = cv::Point(x, y);
+                    }
+                }
+            }
+            peak = refined_peak;
+        }
+    }
+    runNms(peaks, all_peaks, heat_map_id, min_peaks_distance, upsampled_heat_map);
 }
 
 void MergingTwoHumanPose(const std::vector<Peak> &candidates, const std::vector<TwoJointsConnection> &connections,
@@ -252,7 +314,8 @@ void MergingTwoHumanPose(const std::vector<Peak> &candidates, const std::vector<
 }
 
 HumanPoseExtractor::HumanPoses GroupPeaksToPoses(const std::vector<std::vector<Peak>> &all_peaks,
-                                                 const std::vector<cv::Mat> &pafs, const size_t keypoints_number,
+                                                 const std::vector<UpsampledFeatureMap> &pafs,
+                                                 const size_t keypoints_number,
                                                  const float mid_points_score_threshold,
                                                  const float found_mid_points_ratio_threshold,
                                                  const int min_peak_degree,
@@ -268,10 +331,30 @@ HumanPoseExtractor::HumanPoses GroupPeaksToPoses(const std::vector<std::vector<P
     for (const auto &peaks : all_peaks) {
         candidates.insert(candidates.end(), peaks.begin(), peaks.end());
     }
+
+    // Connections of different limbs are independent, so they are found in parallel and merged in limbs order
+    const size_t limbs_number = 17;
+    std::vector<std::vector<TwoJointsConnection>> limb_connections(limbs_number);
+    cv::parallel_for_(cv::Range(0, safe_convert<int>(limbs_number)), [&](const cv::Range &range) {
+        for (int k = range.start; k < range.end; k++) {
+            const std::vector<Peak> &candidate_a = all_peaks[limb_ids_heatmap[k].first];
+            const std::vector<Peak> &candidate_b = all_peaks[limb_ids_heatmap[k].second];
+            if (candidate_a.empty() || candidate_b.empty())
+                continue;
+            std::pair<UpsampledFeatureMap, UpsampledFeatureMap> score_mid = {pafs[limb_ids_paf[k].first],
+                                                                             pafs[limb_ids_paf[k].second]};
+            std::vector<TwoJointsConnection> temp_joint_connections = ComputeLineIntegralAndWeightedBipartiteGraph(
+                candidate_a, candidate_b, mid_points_score_threshold, score_mid, pafs,
+                found_mid_points_ratio_threshold);
+            if (!temp_joint_connections.empty()) {
+                AssignmentAlgoritm(temp_joint_connections, limb_connections[k], candidate_a, candidate_b);
+            }
+        }
+    });
+
     std::vector<HumanPoseByPeaksIndices> pose_by_peak_indices_set;
-    for (size_t k = 0; k < 17; k++) {
-        std::vector<TwoJointsConnection> connections;
-        std::pair<cv::Mat, cv::Mat> score_mid = {pafs[limb_ids_paf[k].first], pafs[limb_ids_paf[k].second]};
+    for (size_t k = 0; k < limbs_number; k++) {
+        const std::vector<TwoJointsConnection> &connections = limb_connections[k];
         const int idx_joint_a = limb_ids_heatmap[k].first;
         const int idx_joint_b = limb_ids_heatmap[k].second;
         const std::vector<Peak> &candidate_b = all_peaks[idx_joint_b]; // vector limbs, witch connect with
@@ -290,11 +373,6 @@ HumanPoseExtractor::HumanPoses GroupPeaksToPoses(const std::vector<std::vector<P
             FillingSubSetForExistPeak(n_joints_a, keypoints_number, candidate_a, idx_joint_a, pose_by_peak_indices_set);
             continue;
         }
-        std::vector<TwoJointsConnection> temp_joint_connections = ComputeLineIntegralAndWeightedBipartiteGraph(
-            candidate_a, candidate_b, mid_points_score_threshold, score_mid, pafs, found_mid_points_ratio_threshold);
-        if (!temp_joint_connections.empty()) {
-            AssignmentAlgoritm(temp_joint_connections, connections, candidate_a, candidate_b);
-        }
         if (connections.empty()) {
             continue;
         }
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -11,6 +11,33 @@
 #include <opencv2/core/core.hpp>
 #include <vector>
 
+// Feature map resized by integer ratio with cv::INTER_CUBIC interpolation. Upsampled values are interpolated from the
+// native map on access, so only the points used by post-processing are computed. Ratio 1 reads the map as is.
+class UpsampledFeatureMap {
+  public:
+    UpsampledFeatureMap(const cv::Mat &map, int upsample_ratio = 1);
+
+    float at(const cv::Point &point) const;
+
+    int rows() const {
+        return map.rows * upsample_ratio;
+    }
+    int cols() const {
+        return map.cols * upsample_ratio;
+    }
+
+  private:
+    // Interpolation taps depend only on position of upsampled point inside native one
+    struct Taps {
+        int offset;
+        float coeffs[4];
+    };
+
+    cv::Mat map;
+    int upsample_ratio;
+    std::vector<Taps> taps;
+};
+
 struct Peak {
     Peak(const int id = -1, const cv::Point2f &pos = cv::Point2f(), const float score = 0.0f);
 
@@ -36,7 +63,8 @@ struct TwoJointsConnection {
 };
 
 HumanPoseExtractor::HumanPoses GroupPeaksToPoses(const std::vector<std::vector<Peak>> &all_peaks,
-                                                 const std::vector<cv::Mat> &pafs, const size_t keypoints_number,
+                                                 const std::vector<UpsampledFeatureMap> &pafs,
+                                                 const size_t keypoints_number,
                                                  const float mid_points_score_threshold,
                                                  const float found_mid_points_ratio_threshold,
                                                  const int min_joints_number, const float min_subset_score);
@@ -55,18 +83,19 @@ void AssignmentAlgoritm(std::vector<TwoJointsConnection> &temp_joint_connections
 
 std::vector<TwoJointsConnection> ComputeLineIntegralAndWeightedBipartiteGraph(
     const std::vector<Peak> &candidate_a, const std::vector<Peak> &candidate_b, const float mid_points_score_threshold,
-    const std::pair<cv::Mat, cv::Mat> &score_mid, const std::vector<cv::Mat> &pafs,
+    const std::pair<UpsampledFeatureMap, UpsampledFeatureMap> &score_mid, const std::vector<UpsampledFeatureMap> &pafs,
     const float found_mid_points_ratio_threshold);
 
 class FindPeaksBody : public cv::ParallelLoopBody {
   public:
+    // Peaks are reported in coordinates of heat maps upsampled by upsample_ratio
     FindPeaksBody(const std::vector<cv::Mat> &heat_maps, float min_peaks_distance,
-                  std::vector<std::vector<Peak>> &peaks_from_heat_map);
+                  std::vector<std::vector<Peak>> &peaks_from_heat_map, int upsample_ratio = 1);
 
     void operator()(const cv::Range &range) const;
 
     void runNms(std::vector<cv::Point> &peaks, std::vector<std::vector<Peak>> &all_peaks, int heat_map_id,
-                const float min_peaks_distance, const cv::Mat &heat_map) const;
+                const float min_peaks_distance, const UpsampledFeatureMap &heat_map) const;
 
     void findPeaks(const std::vector<cv::Mat> &heat_maps, const float min_peaks_distance,
                    std::vector<std::vector<Peak>> &all_peaks, int heat_map_id) const;
@@ -75,4 +104,5 @@ class FindPeaksBody : public cv::ParallelLoopBody {
     const std::vector<cv::Mat> &heat_maps;
     float min_peaks_distance;
     std::vector<std::vector<Peak>> &peaks_from_heat_map;
+    int upsample_ratio;
 };
@@ -13,6 +13,29 @@
 
 using namespace post_processing;
 
+void SemanticMaskConverter::setRleData(const InferenceBackend::OutputBlob::Ptr &blob, GstStructure *tensor_data,
+                                       size_t batch_size, size_t frame_index) const {
+    using Precision = InferenceBackend::OutputBlob::Precision;
+    const size_t unbatched_size = blob->GetSize() / batch_size;
+    std::vector<uint8_t> rle;
+    switch (blob->GetPrecision()) {
+    case Precision::I64:
+        rle = MaskCodec::encodeRle(reinterpret_cast<const int64_t *>(blob->GetData()) + frame_index * unbatched_size,
+                                   unbatched_size);
+        break;
+    case Precision::I32:
+        rle = MaskCodec::encodeRle(reinterpret_cast<const int32_t *>(blob->GetData()) + frame_index * unbatched_size,
+                                   unbatched_size);
+        break;
+    default:
+        throw std::invalid_argument("RLE mask encoding requires I32 or I64 output, got precision " +
+                                    std::to_string(static_cast<int>(blob->GetPrecision())));
+    }
+    copy_buffer_to_structure(tensor_data, reinterpret_cast<const void *>(rle.data()), rle.size());
+    gst_structure_set(tensor_data, "precision", G_TYPE_INT, static_cast<int>(Precision::U8),
+                      MaskCodec::ENCODING_FIELD, G_TYPE_STRING, MaskCodec::RLE, NULL);
+}
+
 TensorsTable SemanticMaskConverter::convert(const OutputBlobs &output_blobs) {
     ITT_TASK(__FUNCTION__);
     TensorsTable tensors_table;
@@ -31,8 +54,15 @@ TensorsTable SemanticMaskConverter::convert(const OutputBlobs &output_blobs) {
             for (size_t frame_index = 0; frame_index < batch_size; ++frame_index) {
                 GstStructure *tensor_data = BlobToTensorConverter::createTensor().gst_structure();
 
-                CopyOutputBlobToGstStructure(blob, tensor_data, BlobToMetaConverter::getModelName().c_str(),
-                                             layer_name.c_str(), batch_size, frame_index);
+                if (mask_encoding == MaskCodec::RLE) {
+                    // copy metadata of blob only, mask data is replaced with encoded runs
+                    CopyOutputBlobToGstStructure(blob, tensor_data, BlobToMetaConverter::getModelName().c_str(),
+                                                 layer_name.c_str(), batch_size, frame_index, 0);
+                    setRleData(blob, tensor_data, batch_size, frame_index);
+                } else {
+                    CopyOutputBlobToGstStructure(blob, tensor_data, BlobToMetaConverter::getModelName().c_str(),
+                                                 layer_name.c_str(), batch_size, frame_index);
+                }
 
                 gst_structure_set(tensor_data, "tensor_id", G_TYPE_INT, safe_convert<int>(frame_index), NULL);
                 gst_structure_set(tensor_data, "format", G_TYPE_STRING, format.c_str(), NULL);
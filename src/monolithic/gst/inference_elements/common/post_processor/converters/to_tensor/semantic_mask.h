@@ -9,6 +9,7 @@
 #include "blob_to_tensor_converter.h"
 #include "inference_backend/image_inference.h"
 #include "inference_backend/logger.h"
+#include "mask_codec.h"
 
 #include <gst/gst.h>
 
@@ -24,15 +25,23 @@ Masks output = [B, H, W] where:
     B - batch size
     H - mask height
     W - mask width
-Output mask contains integer values, which represent an index of a predicted class for each image pixel
+Output mask contains integer values, which represent an index of a predicted class for each image pixel.
+If model-proc output processor sets "mask_encoding" to "rle", integer masks are stored run-length encoded.
 */
 class SemanticMaskConverter : public BlobToTensorConverter {
   private:
     const std::string format;
+    const std::string mask_encoding;
+
+    void setRleData(const InferenceBackend::OutputBlob::Ptr &blob, GstStructure *tensor_data, size_t batch_size,
+                    size_t frame_index) const;
 
   public:
     SemanticMaskConverter(BlobToMetaConverter::Initializer initializer)
-        : BlobToTensorConverter(std::move(initializer)), format("semantic_mask") {
+        : BlobToTensorConverter(std::move(initializer)), format("semantic_mask"), mask_encoding(getMaskEncoding()) {
+        if (!mask_encoding.empty() && mask_encoding != MaskCodec::RLE)
+            throw std::invalid_argument("Unsupported mask_encoding '" + mask_encoding +
+                                        "' for semantic mask, supported: " + MaskCodec::RLE);
     }
 
     TensorsTable convert(const OutputBlobs &output_blobs) override;
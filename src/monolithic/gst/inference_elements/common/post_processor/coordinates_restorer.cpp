@@ -82,34 +82,14 @@ GstVideoRegionOfInterestMeta *ROICoordinatesRestorer::findRoiMeta(const FrameWra
     GstBuffer *buffer = frame.buffer;
     if (not buffer)
         throw std::invalid_argument("Inference frame's buffer is nullptr");
-    auto frame_roi = frame.roi;
-    GstVideoRegionOfInterestMeta *meta = nullptr;
-    gpointer state = nullptr;
-    while ((meta = GST_VIDEO_REGION_OF_INTEREST_META_ITERATE(buffer, &state))) {
-        if (sameRegion(meta, frame_roi)) {
-            return meta;
-        }
-    }
-    return meta;
+    return findROIMeta(buffer, frame.roi);
 }
 
 bool ROICoordinatesRestorer::findObjectDetectionMeta(const FrameWrapper &frame, GstAnalyticsODMtd *rlt_mtd) {
     GstBuffer *buffer = frame.buffer;
     if (not buffer)
         throw std::invalid_argument("Inference frame's buffer is nullptr");
-    auto frame_roi = frame.roi;
-    gpointer state = nullptr;
-
-    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
-    if (relation_meta) {
-        while (
-            gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), rlt_mtd)) {
-            if (sameRegion(rlt_mtd, frame_roi)) {
-                return true;
-            }
-        }
-    }
-    return false;
+    return findODMtd(buffer, frame.roi, rlt_mtd);
 }
 
 void ROICoordinatesRestorer::updateCoordinatesToFullFrame(double &x_min, double &y_min, double &x_max, double &y_max,
@@ -134,6 +114,12 @@ void ROICoordinatesRestorer::updateCoordinatesToFullFrame(double &x_min, double
             x_max = (od_meta_x + od_meta_w * x_max) / frame.width;
             y_max = (od_meta_y + od_meta_h * y_max) / frame.height;
         }
+    } else if (frame.tile_count && frame.roi) {
+        /* In case of inference-region=tiles coordinates are relative to the tile. */
+        x_min = (frame.roi->x + frame.roi->w * x_min) / frame.width;
+        y_min = (frame.roi->y + frame.roi->h * y_min) / frame.height;
+        x_max = (frame.roi->x + frame.roi->w * x_max) / frame.width;
+        y_max = (frame.roi->y + frame.roi->h * y_max) / frame.height;
     }
 }
 
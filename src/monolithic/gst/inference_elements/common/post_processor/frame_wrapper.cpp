@@ -6,6 +6,7 @@
 
 #include "frame_wrapper.h"
 
+#include "analytics_meta_mode.h"
 #include "gva_base_inference.h"
 #include <processor_types.h>
 
@@ -17,14 +18,17 @@ FrameWrapper::FrameWrapper(InferenceFrame &frame)
     : buffer(frame.buffer), model_instance_id(frame.gva_base_inference->model_instance_id),
       meta_mutex(&frame.gva_base_inference->meta_mutex), roi(&frame.roi),
       image_transform_info(frame.image_transform_info), width(frame.info->width), height(frame.info->height),
-      roi_classifications(&frame.roi_classifications) {
+      roi_classifications(&frame.roi_classifications), tile(frame.tile), tile_count(frame.tile_count),
+      frame_num(frame.frame_num), analytics_meta_only(frame.gva_base_inference->analytics_meta_only),
+      gva_base_inference(frame.gva_base_inference) {
 }
 
 // This constructor is only called for micro-elements, initialization of the rest of the fields is not required because
 // they are not used there
 FrameWrapper::FrameWrapper(GstBuffer *buf, const std::string &instance_id, GMutex *meta_mutex)
     : buffer(buf), model_instance_id(instance_id), meta_mutex(meta_mutex), roi(nullptr), image_transform_info(nullptr),
-      width(0), height(0), roi_classifications(nullptr) {
+      width(0), height(0), roi_classifications(nullptr), tile(0), tile_count(0), frame_num(0),
+      analytics_meta_only(GVA::analytics_meta_only()), gva_base_inference(nullptr) {
 }
 
 /* class FramesWrapper */
@@ -32,6 +32,14 @@ class FrameWrapper {
     size_t width;
     size_t height;
     std::vector<GstStructure *> *roi_classifications;
+    /* inference-region=tiles only: index of the tile and number of tiles of the frame, 0 for other regions */
+    size_t tile;
+    size_t tile_count;
+    uint64_t frame_num;
+    /* regions are attached as analytics metadata only */
+    bool analytics_meta_only;
+    /* element inferring the frame, nullptr for micro elements */
+    GvaBaseInference *gva_base_inference;
 };
 
 using InferenceFrames = std::vector<std::shared_ptr<InferenceFrame>>;
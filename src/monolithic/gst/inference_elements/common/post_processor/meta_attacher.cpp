@@ -6,15 +6,35 @@
 
 #include "meta_attacher.h"
 
+#include "analytics_meta_mode.h"
 #include "gmutex_lock_guard.h"
 #include "gva_utils.h"
 #include "processor_types.h"
+#include <dlstreamer/gst/metadata/gstanalyticsparammtd.h>
 #include <gst/analytics/analytics.h>
 
 #include <exception>
 
 using namespace post_processing;
 
+namespace {
+
+// Stores param of region in relation meta instead of GstVideoRegionOfInterestMeta, takes ownership of params
+void addParamMtd(GstAnalyticsODMtd *od_mtd, GstStructure *params) {
+    GstAnalyticsParamMtd param_mtd;
+    if (!gst_analytics_relation_meta_add_param_mtd(od_mtd->meta, params, &param_mtd))
+        throw std::runtime_error("Failed to add param metadata to meta");
+
+    if (!gst_analytics_relation_meta_set_relation(od_mtd->meta, GST_ANALYTICS_REL_TYPE_CONTAIN, od_mtd->id,
+                                                  param_mtd.id) ||
+        !gst_analytics_relation_meta_set_relation(od_mtd->meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF, param_mtd.id,
+                                                  od_mtd->id)) {
+        throw std::runtime_error("Failed to set relation between object detection metadata and param metadata");
+    }
+}
+
+} // namespace
+
 MetaAttacher::Ptr MetaAttacher::create(ConverterType converter_type, AttachType attach_type) {
     switch (converter_type) {
     case ConverterType::TO_ROI:
@@ -58,7 +78,7 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
             const gchar *label = gst_structure_get_string(detection_tensor, "label");
 
             GstBuffer **writable_buffer = &frame.buffer;
-            gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
+            gva_buffer_make_metadata_writable(writable_buffer, PRETTY_FUNCTION_NAME);
 
             GMutexLockGuard guard(frame.meta_mutex);
             GQuark gquark_label = g_quark_from_string(label);
@@ -149,30 +169,19 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
                 }
             }
 
-            GstVideoRegionOfInterestMeta *roi_meta =
-                gst_buffer_add_video_region_of_interest_meta(*writable_buffer, label, x_abs, y_abs, w_abs, h_abs);
-
-            if (not roi_meta)
-                throw std::runtime_error("Failed to add GstVideoRegionOfInterestMeta to buffer");
-
-            roi_meta->id = od_mtd.id;
-            if (frame.roi) {
-                roi_meta->parent_id = frame.roi->id;
-
-                if (frame.roi->id >= 0) {
-                    GstAnalyticsODMtd parent_od_mtd;
-                    if (gst_analytics_relation_meta_get_od_mtd(relation_meta, frame.roi->id, &parent_od_mtd)) {
-                        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
-                                                                      od_mtd.id, parent_od_mtd.id)) {
-                            throw std::runtime_error(
-                                "Failed to set relation between object detection metadata and parent metadata");
-                        }
+            if (frame.roi && frame.roi->id >= 0) {
+                GstAnalyticsODMtd parent_od_mtd;
+                if (gst_analytics_relation_meta_get_od_mtd(relation_meta, frame.roi->id, &parent_od_mtd)) {
+                    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_IS_PART_OF,
+                                                                  od_mtd.id, parent_od_mtd.id)) {
+                        throw std::runtime_error(
+                            "Failed to set relation between object detection metadata and parent metadata");
+                    }
 
-                        if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
-                                                                      parent_od_mtd.id, od_mtd.id)) {
-                            throw std::runtime_error(
-                                "Failed to set relation between object detection metadata and parent metadata");
-                        }
+                    if (!gst_analytics_relation_meta_set_relation(relation_meta, GST_ANALYTICS_REL_TYPE_CONTAIN,
+                                                                  parent_od_mtd.id, od_mtd.id)) {
+                        throw std::runtime_error(
+                            "Failed to set relation between object detection metadata and parent metadata");
                     }
                 }
             }
@@ -183,6 +192,23 @@ void ROIToFrameAttacher::attach(const TensorsTable &tensors, FramesWrapper &fram
             gst_structure_remove_field(detection_tensor, "w_abs");
             gst_structure_remove_field(detection_tensor, "h_abs");
 
+            if (frame.analytics_meta_only) {
+                for (size_t k = 0; k < tensor[j].size(); k++) {
+                    addParamMtd(&od_mtd, tensor[j][k]);
+                }
+                continue;
+            }
+
+            GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_add_video_region_of_interest_meta_id(
+                *writable_buffer, gquark_label, x_abs, y_abs, w_abs, h_abs);
+
+            if (not roi_meta)
+                throw std::runtime_error("Failed to add GstVideoRegionOfInterestMeta to buffer");
+
+            roi_meta->id = od_mtd.id;
+            if (frame.roi)
+                roi_meta->parent_id = frame.roi->id;
+
             for (size_t k = 0; k < tensor[j].size(); k++) {
                 gst_video_region_of_interest_meta_add_param(roi_meta, tensor[j][k]);
             }
@@ -199,7 +225,7 @@ void TensorToFrameAttacher::attach(const TensorsTable &tensors_batch, FramesWrap
         GstBuffer **writable_buffer = &frames[i].buffer;
 
         for (std::vector<GstStructure *> tensor_data : tensors_batch[i]) {
-            gva_buffer_check_and_make_writable(writable_buffer, PRETTY_FUNCTION_NAME);
+            gva_buffer_make_metadata_writable(writable_buffer, PRETTY_FUNCTION_NAME);
             GstGVATensorMeta *tensor = GST_GVA_TENSOR_META_ADD(*writable_buffer);
             /* Tensor Meta already creates GstStructure during initialization */
             /* TODO: reduce amount of GstStructures copy from loading model-proc till attaching meta */
@@ -222,7 +248,7 @@ void TensorToROIAttacher::attach(const TensorsTable &tensors_batch, FramesWrappe
 
         GMutexLockGuard guard(frames[i].meta_mutex);
         GstAnalyticsODMtd od_meta;
-        if (!findODMeta(buffer, frames[i].roi, &od_meta)) {
+        if (!findODMtd(buffer, frames[i].roi, &od_meta)) {
             GST_WARNING("No detection tensors were found for this buffer in case of roi-list inference.");
             continue;
         }
@@ -299,15 +325,15 @@ void TensorToROIAttacher::attach(const TensorsTable &tensors_batch, FramesWrappe
             }
         }
 
+        // Region added in analytics-meta-only mode has no GstVideoRegionOfInterestMeta, its params go to relation meta
         GstVideoRegionOfInterestMeta *roi_meta = findROIMeta(buffer, frames[i].roi);
-        if (!roi_meta) {
-            GST_WARNING("No detection tensors were found for this buffer in case of roi-list inference.");
-            continue;
-        }
 
         for (std::vector<GstStructure *> tensor_data : tensors_batch[i]) {
             assert(tensor_data.size() == 1);
-            gst_video_region_of_interest_meta_add_param(roi_meta, tensor_data[0]);
+            if (roi_meta)
+                gst_video_region_of_interest_meta_add_param(roi_meta, tensor_data[0]);
+            else
+                addParamMtd(&od_meta, tensor_data[0]);
             frames[i].roi_classifications->push_back(tensor_data[0]);
         }
     }
@@ -339,31 +365,3 @@ void TensorToFrameAttacherForMicro::attach(const TensorsTable &tensors, FramesWr
         }
     }
 }
-
-GstVideoRegionOfInterestMeta *TensorToROIAttacher::findROIMeta(GstBuffer *buffer,
-                                                               GstVideoRegionOfInterestMeta *frame_roi) {
-    GstVideoRegionOfInterestMeta *meta = nullptr;
-    gpointer state = nullptr;
-    while ((meta = GST_VIDEO_REGION_OF_INTEREST_META_ITERATE(buffer, &state))) {
-        if (sameRegion(meta, frame_roi)) {
-            return meta;
-        }
-    }
-    return meta;
-}
-
-bool TensorToROIAttacher::findODMeta(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi,
-                                     GstAnalyticsODMtd *rlt_mtd) {
-    gpointer state = nullptr;
-    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
-
-    if (relation_meta) {
-        while (
-            gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), rlt_mtd)) {
-            if (sameRegion(rlt_mtd, frame_roi)) {
-                return true;
-            }
-        }
-    }
-    return false;
-}
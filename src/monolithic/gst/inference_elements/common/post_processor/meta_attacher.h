@@ -45,10 +45,6 @@ class TensorToFrameAttacher : public MetaAttacher {
 };
 
 class TensorToROIAttacher : public MetaAttacher {
-  private:
-    GstVideoRegionOfInterestMeta *findROIMeta(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi);
-    bool findODMeta(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi, GstAnalyticsODMtd *rlt_mtd);
-
   public:
     TensorToROIAttacher() = default;
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -19,4 +19,34 @@ void checkFramesAndTensorsTable(const FramesWrapper &frames, const TensorsTable
                                std::to_string(tensors.size()) + " / " + std::to_string(frames.size()));
 }
 
+bool findODMtd(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi, GstAnalyticsODMtd *od_mtd) {
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+    if (!relation_meta)
+        return false;
+
+    if (frame_roi->id >= 0 && gst_analytics_relation_meta_get_od_mtd(relation_meta, frame_roi->id, od_mtd) &&
+        sameRegion(od_mtd, frame_roi))
+        return true;
+
+    gpointer state = nullptr;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), od_mtd)) {
+        if (sameRegion(od_mtd, frame_roi))
+            return true;
+    }
+    return false;
+}
+
+GstVideoRegionOfInterestMeta *findROIMeta(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi) {
+    GstVideoRegionOfInterestMeta *meta = gst_buffer_get_video_region_of_interest_meta_id(buffer, frame_roi->id);
+    if (meta && sameRegion(meta, frame_roi))
+        return meta;
+
+    gpointer state = nullptr;
+    while ((meta = GST_VIDEO_REGION_OF_INTEREST_META_ITERATE(buffer, &state))) {
+        if (sameRegion(meta, frame_roi))
+            return meta;
+    }
+    return nullptr;
+}
+
 } // namespace post_processing
@@ -70,6 +70,25 @@ inline bool sameRegion(const GstAnalyticsODMtd *od_meta, GstVideoRegionOfInteres
            od_meta_h == static_cast<gint>(roi_meta->h);
 }
 
+/**
+ * Finds object detection metadata of inference region. Region id is tried first, comparison with every object
+ * detection metadata of buffer is used only if region has no id or id refers to other region.
+ *
+ * @param[in] buffer - buffer with analytics relation meta.
+ * @param[in] frame_roi - inference region.
+ * @param[out] od_mtd - found object detection metadata.
+ *
+ * @return true if found, false otherwise.
+ */
+bool findODMtd(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi, GstAnalyticsODMtd *od_mtd);
+
+/**
+ * Finds GstVideoRegionOfInterestMeta of inference region the same way as findODMtd.
+ *
+ * @return meta of buffer or nullptr if region is stored in analytics metadata only.
+ */
+GstVideoRegionOfInterestMeta *findROIMeta(GstBuffer *buffer, GstVideoRegionOfInterestMeta *frame_roi);
+
 template <typename T>
 std::pair<const T *, size_t> get_data_by_batch_index(const T *batch_data, size_t batch_data_size, size_t batch_size,
                                                      size_t batch_index) {
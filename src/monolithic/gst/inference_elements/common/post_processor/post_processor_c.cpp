@@ -28,3 +28,8 @@ void releasePostProcessor(post_processing::PostProcessor *post_processor) {
     if (post_processor)
         delete post_processor;
 }
+
+void flushPostProcessor(post_processing::PostProcessor *post_processor) {
+    if (post_processor)
+        post_processor->flush();
+}
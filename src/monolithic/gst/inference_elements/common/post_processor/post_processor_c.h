@@ -20,6 +20,7 @@ extern "C" {
 
 PostProcessor *createPostProcessor(InferenceImpl *inference_impl, GvaBaseInference *base_inference);
 void releasePostProcessor(PostProcessor *post_processor);
+void flushPostProcessor(PostProcessor *post_processor);
 
 #ifdef __cplusplus
 }
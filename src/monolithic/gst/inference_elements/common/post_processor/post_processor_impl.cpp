@@ -95,6 +95,8 @@ PostProcessorImpl::PostProcessorImpl(Initializer initializer) {
             converters.emplace_back(layer_names, model_proc_outputs.cbegin()->second, initializer.converter_type,
                                     initializer.attach_type, initializer.image_info, initializer.model_outputs,
                                     initializer.model_name, labels, initializer.custom_postproc_lib);
+            if (initializer.merge_tiles && initializer.converter_type == ConverterType::TO_ROI)
+                converters.back().enableTileMerging(initializer.tile_merge_threshold);
         } else {
             for (const auto &model_proc_output : initializer.output_processors) {
                 if (model_proc_output.second == nullptr) {
@@ -114,6 +116,8 @@ PostProcessorImpl::PostProcessorImpl(Initializer initializer) {
                 converters.emplace_back(model_proc_output.second, initializer.converter_type, initializer.attach_type,
                                         initializer.image_info, initializer.model_outputs, initializer.model_name,
                                         labels, initializer.custom_postproc_lib);
+                if (initializer.merge_tiles && initializer.converter_type == ConverterType::TO_ROI)
+                    converters.back().enableTileMerging(initializer.tile_merge_threshold);
             }
         }
     } catch (const std::exception &e) {
@@ -122,6 +126,16 @@ PostProcessorImpl::PostProcessorImpl(Initializer initializer) {
     }
 }
 
+void PostProcessorImpl::discard(const FramesWrapper &frames) const {
+    for (const auto &converter : converters)
+        converter.discard(frames);
+}
+
+void PostProcessorImpl::flush() const {
+    for (const auto &converter : converters)
+        converter.flush();
+}
+
 PostProcessorImpl::ExitStatus PostProcessorImpl::process(const OutputBlobs &output_blobs, FramesWrapper &frames) const {
     try {
         for (const auto &converter : converters) {
@@ -41,6 +41,9 @@ class PostProcessorImpl {
         AttachType attach_type;
         bool use_default = true;
         double threshold = 0.5;
+        /* inference-region=tiles */
+        bool merge_tiles = false;
+        double tile_merge_threshold = 0.5;
 
         std::string custom_postproc_lib;
     };
@@ -48,6 +51,9 @@ class PostProcessorImpl {
     PostProcessorImpl(Initializer initializer);
 
     ExitStatus process(const OutputBlobs &, FramesWrapper &) const;
+    // Drops state kept for frames which failed inference or for all frames on flush
+    void discard(const FramesWrapper &) const;
+    void flush() const;
 
     PostProcessorImpl() = default;
     ~PostProcessorImpl() = default;
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "tile_merger.h"
+
+#include "tiling.h"
+
+#include <utility>
+
+using namespace post_processing;
+
+namespace {
+
+void freeDetection(std::vector<GstStructure *> &detection) {
+    for (GstStructure *s : detection)
+        gst_structure_free(s);
+    detection.clear();
+}
+
+void freeDetections(std::vector<std::vector<GstStructure *>> &detections) {
+    for (auto &detection : detections)
+        freeDetection(detection);
+    detections.clear();
+}
+
+} // namespace
+
+TileMerger::~TileMerger() {
+    clear();
+}
+
+void TileMerger::merge(TensorsTable &tensors_batch, const FramesWrapper &frames) {
+    checkFramesAndTensorsTable(frames, tensors_batch);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const FrameWrapper &frame = frames[i];
+        if (!frame.tile_count)
+            continue;
+
+        const Key key(frame.gva_base_inference, frame.frame_num);
+        Pending &pending = pending_frames[key];
+        if (pending.failed) {
+            freeDetections(tensors_batch[i]);
+        } else {
+            for (auto &detection : tensors_batch[i]) {
+                pending.detections.push_back(std::move(detection));
+                pending.detection_tiles.push_back(frame.tile);
+            }
+        }
+        tensors_batch[i].clear();
+
+        if (++pending.tiles < frame.tile_count)
+            continue;
+        if (!pending.failed)
+            tensors_batch[i] = mergeSeamDuplicates(pending);
+        pending_frames.erase(key);
+    }
+}
+
+void TileMerger::discard(const FramesWrapper &frames) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const FrameWrapper &frame = frames[i];
+        if (!frame.tile_count)
+            continue;
+
+        const Key key(frame.gva_base_inference, frame.frame_num);
+        Pending &pending = pending_frames[key];
+        pending.failed = true;
+        freeDetections(pending.detections);
+        pending.detection_tiles.clear();
+        if (++pending.tiles >= frame.tile_count)
+            pending_frames.erase(key);
+    }
+}
+
+void TileMerger::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &pending : pending_frames)
+        freeDetections(pending.second.detections);
+    pending_frames.clear();
+}
+
+std::vector<std::vector<GstStructure *>> TileMerger::mergeSeamDuplicates(Pending &pending) const {
+    std::vector<Tiling::Detection> boxes(pending.detections.size());
+    for (size_t i = 0; i < pending.detections.size(); ++i) {
+        GstStructure *detection_tensor = pending.detections[i][DETECTION_TENSOR_ID];
+        Tiling::Detection &box = boxes[i];
+        gst_structure_get(detection_tensor, "x_min", G_TYPE_DOUBLE, &box.x_min, "y_min", G_TYPE_DOUBLE, &box.y_min,
+                          "x_max", G_TYPE_DOUBLE, &box.x_max, "y_max", G_TYPE_DOUBLE, &box.y_max, NULL);
+        gst_structure_get_double(detection_tensor, "confidence", &box.confidence);
+        gst_structure_get_int(detection_tensor, "label_id", &box.label_id);
+        box.tile = pending.detection_tiles[i];
+    }
+
+    const std::vector<bool> keep = Tiling::mergeSeamDuplicates(boxes, threshold);
+    std::vector<std::vector<GstStructure *>> merged;
+    for (size_t i = 0; i < pending.detections.size(); ++i) {
+        if (keep[i])
+            merged.push_back(std::move(pending.detections[i]));
+        else
+            freeDetection(pending.detections[i]);
+    }
+    return merged;
+}
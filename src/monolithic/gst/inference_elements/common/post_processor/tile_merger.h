@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "post_proc_common.h"
+
+#include <gst/gst.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace post_processing {
+
+/**
+ * Holds back detections of tiles (inference-region=tiles) until all tiles of the frame are inferred, then merges
+ * duplicates found by neighbouring tiles at their seams. Tiles of one frame may come in different batches.
+ */
+class TileMerger {
+  public:
+    explicit TileMerger(double threshold) : threshold(threshold) {
+    }
+
+    // Takes detections of tile frames out of tensors_batch, coordinates must be already restored to full frame. When
+    // the last tile of a frame comes, its row is replaced with merged detections of all tiles of the frame, so frame
+    // metadata is attached once. Rows of other frames are left untouched.
+    void merge(TensorsTable &tensors_batch, const FramesWrapper &frames);
+
+    // Tile frames which failed inference. The frame gets no detections instead of detections of part of its tiles,
+    // detections of its other tiles are dropped as they come.
+    void discard(const FramesWrapper &frames);
+
+    // Drops detections of all frames waiting for their tiles, e.g. on flush
+    void clear();
+
+    using Ptr = std::unique_ptr<TileMerger>;
+
+    ~TileMerger();
+
+  private:
+    struct Pending {
+        size_t tiles = 0;
+        bool failed = false;
+        std::vector<std::vector<GstStructure *>> detections;
+        std::vector<size_t> detection_tiles;
+    };
+
+    // Frames of different elements and streams may have the same number
+    using Key = std::pair<const GvaBaseInference *, uint64_t>;
+
+    std::vector<std::vector<GstStructure *>> mergeSeamDuplicates(Pending &pending) const;
+
+    const double threshold;
+    std::mutex mutex;
+    // By element and number of the frame in the element's stream
+    std::map<Key, Pending> pending_frames;
+};
+
+} // namespace post_processing
@@ -18,6 +18,13 @@ ClassificationHistory::ClassificationHistory(GstGvaClassify *gva_classify)
     : gva_classify(gva_classify), current_num_frame(0), history(CLASSIFICATION_HISTORY_SIZE) {
 }
 
+ClassificationHistory::~ClassificationHistory() {
+    if (gva_classify->static_object_cache)
+        GVA_INFO("%s static-object-cache: %" G_GUINT64_FORMAT " hits, %" G_GUINT64_FORMAT " misses",
+                 GST_ELEMENT_NAME(gva_classify), static_cast<guint64>(cache_stats.hits),
+                 static_cast<guint64>(cache_stats.misses));
+}
+
 bool ClassificationHistory::IsROIClassificationNeeded(GstVideoRegionOfInterestMeta *roi, GstBuffer *buffer,
                                                       uint64_t current_num_frame) {
     try {
@@ -48,6 +55,8 @@ bool ClassificationHistory::IsROIClassificationNeeded(GstVideoRegionOfInterestMe
         if (history.count(id) == 0) { // new object
             history.put(id);
             history.get(id).frame_of_last_update = current_num_frame;
+            if (gva_classify->static_object_cache)
+                IsRegionUnchanged(history.get(id), roi, buffer);
             result = true;
         } else if (gva_classify->reclassify_interval == 0) {
             return false;
@@ -56,6 +65,9 @@ bool ClassificationHistory::IsROIClassificationNeeded(GstVideoRegionOfInterestMe
             if (current_interval > INT64_MAX && history.get(id).frame_of_last_update > current_num_frame)
                 current_interval = (UINT64_MAX - history.get(id).frame_of_last_update) + current_num_frame + 1;
             if (current_interval >= gva_classify->reclassify_interval) {
+                // object hasn't moved and looks the same, so previous result is still valid
+                if (gva_classify->static_object_cache && IsRegionUnchanged(history.get(id), roi, buffer))
+                    return false;
                 // new object or reclassify old object
                 history.get(id).frame_of_last_update = current_num_frame;
                 result = true;
@@ -125,6 +137,52 @@ LRUCache<int, ClassificationHistory::ROIClassificationHistory> &ClassificationHi
     return history;
 }
 
+ClassificationHistory::CacheStats ClassificationHistory::GetCacheStats() {
+    std::lock_guard<std::mutex> guard(history_mutex);
+    return cache_stats;
+}
+
+// Compares region with region of the last classification and keeps the new signature if they differ. Regions are
+// compared only in system memory, mapping of video memory would cost more than classification saves.
+bool ClassificationHistory::IsRegionUnchanged(ROIClassificationHistory &roi_history, GstVideoRegionOfInterestMeta *roi,
+                                              GstBuffer *buffer) {
+    GstVideoInfo *info = gva_classify->base_inference.info;
+    if (gva_classify->base_inference.caps_feature != SYSTEM_MEMORY_CAPS_FEATURE || !info) {
+        if (!warned_not_system_memory) {
+            GVA_WARNING("static-object-cache is supported for system memory only, objects are reclassified");
+            warned_not_system_memory = true;
+        }
+        return false;
+    }
+
+    const int x = std::max<int>(roi->x, 0);
+    const int y = std::max<int>(roi->y, 0);
+    const int w = std::min<int>(roi->x + roi->w, GST_VIDEO_INFO_WIDTH(info)) - x;
+    const int h = std::min<int>(roi->y + roi->h, GST_VIDEO_INFO_HEIGHT(info)) - y;
+    if (w <= 0 || h <= 0)
+        return false;
+
+    GstVideoFrame frame;
+    if (!gst_video_frame_map(&frame, info, buffer, GST_MAP_READ))
+        throw std::runtime_error("Failed to map buffer to compare object region");
+    // Luma plane for YUV formats, green component approximates it for RGB formats
+    const guint component = GST_VIDEO_INFO_IS_YUV(info) ? 0 : 1;
+    const auto *data = static_cast<const uint8_t *>(GST_VIDEO_FRAME_COMP_DATA(&frame, component));
+    const auto signature = RegionSignature::compute(data, GST_VIDEO_FRAME_COMP_STRIDE(&frame, component),
+                                                    GST_VIDEO_FRAME_COMP_PSTRIDE(&frame, component), x, y, w, h);
+    gst_video_frame_unmap(&frame);
+
+    if (roi_history.has_signature && RegionSignature::matches(roi_history.signature, signature)) {
+        ++cache_stats.hits;
+        return true;
+    }
+    if (roi_history.has_signature)
+        ++cache_stats.misses;
+    roi_history.signature = signature;
+    roi_history.has_signature = true;
+    return false;
+}
+
 void ClassificationHistory::CheckExistingAndReaddObjectId(int roi_id) {
     if (history.count(roi_id) == 0) {
         GVA_WARNING("Classification history size limit is exceeded. "
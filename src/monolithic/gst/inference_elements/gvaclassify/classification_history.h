@@ -25,6 +25,7 @@ G_END_DECLS
 #ifdef __cplusplus
 #include "gst_smart_pointer_types.hpp"
 #include "lru_cache.h"
+#include "region_signature.h"
 
 #include <map>
 #include <mutex>
@@ -36,6 +37,9 @@ struct ClassificationHistory {
     struct ROIClassificationHistory {
         uint64_t frame_of_last_update;
         std::map<std::string, GstStructureSharedPtr> layers_to_roi_params;
+        // Region at the last classification, static-object-cache only
+        bool has_signature = false;
+        RegionSignature::Signature signature;
 
         ROIClassificationHistory(uint64_t frame_of_last_update = {},
                                  std::map<std::string, GstStructureSharedPtr> layers_to_roi_params = {})
@@ -43,19 +47,31 @@ struct ClassificationHistory {
         }
     };
 
+    // Classifications skipped by static-object-cache (hits) and done for tracked objects it checked (misses)
+    struct CacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
     ClassificationHistory(GstGvaClassify *gva_classify);
+    ~ClassificationHistory();
 
     bool IsROIClassificationNeeded(GstVideoRegionOfInterestMeta *roi, GstBuffer *buffer, uint64_t current_num_frame);
     void UpdateROIParams(int roi_id, const GstStructure *roi_param);
     void FillROIParams(GstBuffer *buffer);
     LRUCache<int, ROIClassificationHistory> &GetHistory();
+    CacheStats GetCacheStats();
 
   private:
     void CheckExistingAndReaddObjectId(int roi_id);
+    bool IsRegionUnchanged(ROIClassificationHistory &roi_history, GstVideoRegionOfInterestMeta *roi,
+                           GstBuffer *buffer);
 
     GstGvaClassify *gva_classify;
     uint64_t current_num_frame;
     LRUCache<int, ROIClassificationHistory> history;
     std::mutex history_mutex;
+    CacheStats cache_stats;
+    bool warned_not_system_memory = false;
 };
 #endif
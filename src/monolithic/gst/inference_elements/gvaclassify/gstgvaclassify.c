@@ -26,12 +26,15 @@
 enum {
     PROP_0,
     PROP_RECLASSIFY_INTERVAL,
+    PROP_STATIC_OBJECT_CACHE,
 };
 
 #define DEFAULT_RECLASSIFY_INTERVAL 1
 #define DEFAULT_MIN_RECLASSIFY_INTERVAL 0
 #define DEFAULT_MAX_RECLASSIFY_INTERVAL UINT_MAX
 
+#define DEFAULT_STATIC_OBJECT_CACHE FALSE
+
 GST_DEBUG_CATEGORY_STATIC(gst_gva_classify_debug_category);
 #define GST_CAT_DEFAULT gst_gva_classify_debug_category
 
@@ -44,31 +47,22 @@ static void gst_gva_classify_finalize(GObject *);
 static void gst_gva_classify_cleanup(GstGvaClassify *);
 static gboolean gst_gva_classify_check_properties_correctness(GstGvaClassify *gvaclassify);
 static gboolean gst_gva_classify_start(GstBaseTransform *trans);
+static void gst_gva_classify_update_history_probe(GstGvaClassify *gvaclassify);
 
 void gst_gva_classify_set_property(GObject *object, guint property_id, const GValue *value, GParamSpec *pspec) {
     GstGvaClassify *gvaclassify = GST_GVA_CLASSIFY(object);
 
     GST_DEBUG_OBJECT(gvaclassify, "set_property");
 
-    static gulong probe_id = 0;
-
     switch (property_id) {
-    case PROP_RECLASSIFY_INTERVAL: {
-        guint newValue = g_value_get_uint(value);
-        guint oldValue = gvaclassify->reclassify_interval;
-        if (newValue != oldValue) {
-            if (oldValue == DEFAULT_RECLASSIFY_INTERVAL) {
-                probe_id =
-                    gst_pad_add_probe(gvaclassify->base_inference.base_transform.srcpad, GST_PAD_PROBE_TYPE_BUFFER,
-                                      FillROIParamsCallback, gvaclassify->classification_history, NULL);
-            } else if (newValue == DEFAULT_RECLASSIFY_INTERVAL) { // not tested
-                gst_pad_remove_probe(gvaclassify->base_inference.base_transform.srcpad, probe_id);
-                probe_id = 0;
-            }
-            gvaclassify->reclassify_interval = newValue;
-        }
+    case PROP_RECLASSIFY_INTERVAL:
+        gvaclassify->reclassify_interval = g_value_get_uint(value);
+        gst_gva_classify_update_history_probe(gvaclassify);
+        break;
+    case PROP_STATIC_OBJECT_CACHE:
+        gvaclassify->static_object_cache = g_value_get_boolean(value);
+        gst_gva_classify_update_history_probe(gvaclassify);
         break;
-    }
     default: {
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -85,6 +79,9 @@ void gst_gva_classify_get_property(GObject *object, guint property_id, GValue *v
     case PROP_RECLASSIFY_INTERVAL:
         g_value_set_uint(value, gvaclassify->reclassify_interval);
         break;
+    case PROP_STATIC_OBJECT_CACHE:
+        g_value_set_boolean(value, gvaclassify->static_object_cache);
+        break;
     default:
         G_OBJECT_WARN_INVALID_PROPERTY_ID(object, property_id, pspec);
         break;
@@ -124,6 +121,15 @@ void gst_gva_classify_class_init(GstGvaClassifyClass *gvaclassify_class) {
             "inference interval)",
             DEFAULT_MIN_RECLASSIFY_INTERVAL, DEFAULT_MAX_RECLASSIFY_INTERVAL, DEFAULT_RECLASSIFY_INTERVAL,
             (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property(
+        gobject_class, PROP_STATIC_OBJECT_CACHE,
+        g_param_spec_boolean(
+            "static-object-cache", "Static Object Cache",
+            "Reuse the last classification result of a tracked object while its bounding box and the downsampled "
+            "luma of its region stay unchanged, e.g. for parked cars. Only valid when used in conjunction with "
+            "gvatrack and system memory. Applied to objects due for reclassification by reclassify-interval",
+            DEFAULT_STATIC_OBJECT_CACHE, (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 }
 
 void gst_gva_classify_init(GstGvaClassify *gvaclassify) {
@@ -137,6 +143,8 @@ void gst_gva_classify_init(GstGvaClassify *gvaclassify) {
     gvaclassify->base_inference.type = GST_GVA_CLASSIFY_TYPE;
     gvaclassify->base_inference.inference_region = ROI_LIST;
     gvaclassify->reclassify_interval = DEFAULT_RECLASSIFY_INTERVAL;
+    gvaclassify->static_object_cache = DEFAULT_STATIC_OBJECT_CACHE;
+    gvaclassify->history_probe_id = 0;
     gvaclassify->classification_history = create_classification_history(gvaclassify);
     if (gvaclassify->classification_history == NULL)
         return;
@@ -175,6 +183,21 @@ GstPadProbeReturn FillROIParamsCallback(GstPad *pad, GstPadProbeInfo *info, gpoi
     return GST_PAD_PROBE_OK;
 }
 
+// Results are filled from history only when some objects are not reclassified on every frame
+static void gst_gva_classify_update_history_probe(GstGvaClassify *gvaclassify) {
+    gboolean history_used =
+        gvaclassify->reclassify_interval != DEFAULT_RECLASSIFY_INTERVAL || gvaclassify->static_object_cache;
+    GstPad *srcpad = gvaclassify->base_inference.base_transform.srcpad;
+
+    if (history_used && !gvaclassify->history_probe_id) {
+        gvaclassify->history_probe_id = gst_pad_add_probe(srcpad, GST_PAD_PROBE_TYPE_BUFFER, FillROIParamsCallback,
+                                                          gvaclassify->classification_history, NULL);
+    } else if (!history_used && gvaclassify->history_probe_id) {
+        gst_pad_remove_probe(srcpad, gvaclassify->history_probe_id);
+        gvaclassify->history_probe_id = 0;
+    }
+}
+
 gboolean gst_gva_classify_check_properties_correctness(GstGvaClassify *gvaclassify) {
     GvaBaseInference *base_inference = GVA_BASE_INFERENCE(gvaclassify);
 
@@ -184,6 +207,12 @@ gboolean gst_gva_classify_check_properties_correctness(GstGvaClassify *gvaclassi
                           "'inference-region' property."));
         return FALSE;
     }
+    if (base_inference->inference_region == FULL_FRAME && gvaclassify->static_object_cache) {
+        GST_ERROR_OBJECT(gvaclassify,
+                         ("You cannot use 'static-object-cache' property on gvaclassify if you set 'full-frame' for "
+                          "'inference-region' property."));
+        return FALSE;
+    }
 
     return TRUE;
 }
@@ -191,8 +220,9 @@ gboolean gst_gva_classify_check_properties_correctness(GstGvaClassify *gvaclassi
 gboolean gst_gva_classify_start(GstBaseTransform *trans) {
     GstGvaClassify *gvaclassify = GST_GVA_CLASSIFY(trans);
 
-    GST_INFO_OBJECT(gvaclassify, "%s parameters:\n -- Reclassify interval: %d\n",
-                    GST_ELEMENT_NAME(GST_ELEMENT_CAST(gvaclassify)), gvaclassify->reclassify_interval);
+    GST_INFO_OBJECT(gvaclassify, "%s parameters:\n -- Reclassify interval: %d\n -- Static object cache: %s\n",
+                    GST_ELEMENT_NAME(GST_ELEMENT_CAST(gvaclassify)), gvaclassify->reclassify_interval,
+                    gvaclassify->static_object_cache ? "true" : "false");
 
     if (!gst_gva_classify_check_properties_correctness(gvaclassify))
         return FALSE;
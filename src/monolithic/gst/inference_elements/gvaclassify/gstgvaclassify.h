@@ -22,8 +22,11 @@ typedef struct _GstGvaClassify {
     GvaBaseInference base_inference;
     // properties:
     guint reclassify_interval;
+    gboolean static_object_cache;
 
     struct ClassificationHistory *classification_history;
+    // probe filling results from classification history, installed when history results are reused
+    gulong history_probe_id;
 } GstGvaClassify;
 
 typedef struct _GstGvaClassifyClass {
@@ -31,7 +31,7 @@ bool IsROIClassificationNeeded(GvaBaseInference *gva_base_inference, guint64 cur
     assert(gva_classify->classification_history != NULL);
 
     // Check is object recently classified
-    return (gva_classify->reclassify_interval == 1 ||
+    return ((gva_classify->reclassify_interval == 1 && !gva_classify->static_object_cache) ||
             gva_classify->classification_history->IsROIClassificationNeeded(roi, buffer, current_num_frame));
 }
 
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "region_signature.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace RegionSignature {
+
+namespace {
+
+// Each cell is averaged over SAMPLES x SAMPLES pixels, so cost doesn't depend on region size
+constexpr int SAMPLES = 4;
+
+bool edgeMatches(int a, int b, int size) {
+    const int tolerance = std::max(1, static_cast<int>(size * BOX_TOLERANCE));
+    return std::abs(a - b) <= tolerance;
+}
+
+} // namespace
+
+Signature compute(const uint8_t *data, size_t stride, size_t pixel_stride, int x, int y, int w, int h) {
+    Signature signature;
+    signature.x = x;
+    signature.y = y;
+    signature.w = w;
+    signature.h = h;
+    if (w <= 0 || h <= 0)
+        return signature;
+
+    constexpr int grid_samples = static_cast<int>(GRID) * SAMPLES;
+    for (size_t cell_y = 0; cell_y < GRID; ++cell_y) {
+        for (size_t cell_x = 0; cell_x < GRID; ++cell_x) {
+            unsigned sum = 0;
+            for (int sample_y = 0; sample_y < SAMPLES; ++sample_y) {
+                // Center of sample row, regions smaller than the grid repeat their pixels
+                const int row = static_cast<int>(cell_y) * SAMPLES + sample_y;
+                const uint8_t *line = data + static_cast<size_t>(y + (2 * row + 1) * h / (2 * grid_samples)) * stride;
+                for (int sample_x = 0; sample_x < SAMPLES; ++sample_x) {
+                    const int column = static_cast<int>(cell_x) * SAMPLES + sample_x;
+                    sum += line[static_cast<size_t>(x + (2 * column + 1) * w / (2 * grid_samples)) * pixel_stride];
+                }
+            }
+            signature.luma[cell_y * GRID + cell_x] = static_cast<uint8_t>(sum / (SAMPLES * SAMPLES));
+        }
+    }
+    return signature;
+}
+
+bool matches(const Signature &a, const Signature &b) {
+    if (!edgeMatches(a.x, b.x, a.w) || !edgeMatches(a.x + a.w, b.x + b.w, a.w) || !edgeMatches(a.y, b.y, a.h) ||
+        !edgeMatches(a.y + a.h, b.y + b.h, a.h))
+        return false;
+
+    for (size_t i = 0; i < a.luma.size(); ++i) {
+        if (std::abs(a.luma[i] - b.luma[i]) > LUMA_TOLERANCE)
+            return false;
+    }
+    return true;
+}
+
+} // namespace RegionSignature
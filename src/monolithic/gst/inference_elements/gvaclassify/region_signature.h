@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Cheap signature of object region used by static-object-cache of gvaclassify: bounding box plus luma of the region
+ * downsampled to GRID x GRID cells. Classification result of tracked object is reused while signature of its region
+ * matches signature of the region last classified.
+ */
+namespace RegionSignature {
+
+constexpr size_t GRID = 8;
+// Box edges may move by this share of box size (at least one pixel), e.g. because of detector jitter
+constexpr double BOX_TOLERANCE = 0.02;
+// Mean luma of each cell may change by this number of levels, e.g. because of sensor noise or compression
+constexpr int LUMA_TOLERANCE = 8;
+
+struct Signature {
+    int x = 0;
+    int y = 0;
+    int w = 0;
+    int h = 0;
+    std::array<uint8_t, GRID * GRID> luma{};
+};
+
+// Computes signature of region inside of image plane. Pixel stride is distance in bytes between luma (or other
+// component approximating it, e.g. green) values of neighbouring pixels, data points to the value of pixel (0, 0).
+Signature compute(const uint8_t *data, size_t stride, size_t pixel_stride, int x, int y, int w, int h);
+
+bool matches(const Signature &a, const Signature &b);
+
+} // namespace RegionSignature
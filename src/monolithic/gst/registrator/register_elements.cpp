@@ -24,6 +24,7 @@
 #include "inference_backend/logger.h"
 #include "logger_functions.h"
 
+#include "gva_binary_meta.h"
 #include "gva_json_meta.h"
 #include "gva_tensor_meta.h"
 
@@ -68,6 +69,8 @@ static gboolean plugin_init(GstPlugin *plugin) {
     // register metadata
     gst_gva_json_meta_get_info();
     gst_gva_json_meta_api_get_type();
+    gst_gva_binary_meta_get_info();
+    gst_gva_binary_meta_api_get_type();
     gst_gva_tensor_meta_get_info();
     gst_gva_tensor_meta_api_get_type();
     return TRUE;
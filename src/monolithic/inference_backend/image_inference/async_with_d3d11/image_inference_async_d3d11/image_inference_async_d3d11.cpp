@@ -186,6 +186,22 @@ bool ImageInferenceAsyncD3D11::IsQueueFull() {
     return _inference->IsQueueFull();
 }
 
+size_t ImageInferenceAsyncD3D11::GetFreeRequestsCount() {
+    return _inference->GetFreeRequestsCount();
+}
+
+ImageInference::LoadingTimings ImageInferenceAsyncD3D11::GetLoadingTimings() const {
+    return _inference->GetLoadingTimings();
+}
+
+ImageInference::QueueWaitStats ImageInferenceAsyncD3D11::GetQueueWaitStats(const void *stream) const {
+    return _inference->GetQueueWaitStats(stream);
+}
+
+void ImageInferenceAsyncD3D11::RemoveStream(const void *stream) {
+    _inference->RemoveStream(stream);
+}
+
 void ImageInferenceAsyncD3D11::Flush() {
     if (_d3d11_image_pool) {
         _d3d11_image_pool->Flush();
@@ -195,6 +211,15 @@ void ImageInferenceAsyncD3D11::Flush() {
     }
 }
 
+void ImageInferenceAsyncD3D11::FlushStream(const void *ordering_key) {
+    if (_d3d11_image_pool) {
+        _d3d11_image_pool->Flush();
+    }
+    if (_inference) {
+        _inference->FlushStream(ordering_key);
+    }
+}
+
 void ImageInferenceAsyncD3D11::Close() {
     _inference->Close();
 }
@@ -46,8 +46,13 @@ class ImageInferenceAsyncD3D11 : public ImageInference {
     std::map<std::string, GstStructure *> GetModelInfoPostproc() const override;
 
     bool IsQueueFull() override;
+    size_t GetFreeRequestsCount() override;
+    LoadingTimings GetLoadingTimings() const override;
+    QueueWaitStats GetQueueWaitStats(const void *stream) const override;
+    void RemoveStream(const void *stream) override;
 
     void Flush() override;
+    void FlushStream(const void *ordering_key) override;
 
     void Close() override;
 
@@ -212,6 +212,22 @@ bool ImageInferenceAsync::IsQueueFull() {
     return _inference->IsQueueFull();
 }
 
+size_t ImageInferenceAsync::GetFreeRequestsCount() {
+    return _inference->GetFreeRequestsCount();
+}
+
+ImageInference::LoadingTimings ImageInferenceAsync::GetLoadingTimings() const {
+    return _inference->GetLoadingTimings();
+}
+
+ImageInference::QueueWaitStats ImageInferenceAsync::GetQueueWaitStats(const void *stream) const {
+    return _inference->GetQueueWaitStats(stream);
+}
+
+void ImageInferenceAsync::RemoveStream(const void *stream) {
+    _inference->RemoveStream(stream);
+}
+
 void ImageInferenceAsync::Flush() {
     if (_va_image_pool) {
         _va_image_pool->Flush();
@@ -221,6 +237,15 @@ void ImageInferenceAsync::Flush() {
     }
 }
 
+void ImageInferenceAsync::FlushStream(const void *ordering_key) {
+    if (_va_image_pool) {
+        _va_image_pool->Flush();
+    }
+    if (_inference) {
+        _inference->FlushStream(ordering_key);
+    }
+}
+
 void ImageInferenceAsync::Close() {
     _inference->Close();
 }
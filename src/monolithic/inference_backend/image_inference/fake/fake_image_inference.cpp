@@ -0,0 +1,343 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "fake_image_inference.h"
+
+#include "inference_backend/logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+
+using namespace InferenceBackend;
+
+namespace {
+
+constexpr size_t DEFAULT_NIREQ = 4;
+constexpr size_t DETECTION_OBJECT_SIZE = 7;
+
+class FakeOutputBlob : public OutputBlob {
+  public:
+    FakeOutputBlob(std::vector<size_t> dims, std::vector<float> data) : _dims(std::move(dims)), _data(std::move(data)) {
+    }
+
+    const std::vector<size_t> &GetDims() const override {
+        return _dims;
+    }
+    Layout GetLayout() const override {
+        return Layout::ANY;
+    }
+    Precision GetPrecision() const override {
+        return Precision::FP32;
+    }
+    const void *GetData() const override {
+        return _data.data();
+    }
+
+  private:
+    const std::vector<size_t> _dims;
+    const std::vector<float> _data;
+};
+
+// detection_output layout: [image_id, label, confidence, x_min, y_min, x_max, y_max], image_id -1 terminates list
+std::shared_ptr<OutputBlob> makeDetectionOutput(const nlohmann::json &desc, size_t batch_size) {
+    const size_t objects = desc.value("objects", 1);
+    const size_t labels = std::max<size_t>(1, desc.value("labels", 1));
+    const size_t grid = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(objects)))));
+    const float cell = 1.0f / grid;
+    const float margin = cell * 0.1f;
+
+    const size_t proposals = batch_size * objects + 1;
+    std::vector<float> data(proposals * DETECTION_OBJECT_SIZE, 0.0f);
+    for (size_t image = 0; image < batch_size; ++image) {
+        for (size_t i = 0; i < objects; ++i) {
+            float *object = &data[(image * objects + i) * DETECTION_OBJECT_SIZE];
+            const float x = (i % grid) * cell;
+            const float y = (i / grid) * cell;
+            object[0] = static_cast<float>(image);
+            object[1] = static_cast<float>(i % labels);
+            object[2] = 0.9f;
+            object[3] = x + margin;
+            object[4] = y + margin;
+            object[5] = x + cell - margin;
+            object[6] = y + cell - margin;
+        }
+    }
+    data[(proposals - 1) * DETECTION_OBJECT_SIZE] = -1.0f;
+    return std::make_shared<FakeOutputBlob>(std::vector<size_t>{1, 1, proposals, DETECTION_OBJECT_SIZE},
+                                            std::move(data));
+}
+
+std::shared_ptr<OutputBlob> makeClassificationOutput(const nlohmann::json &desc, size_t batch_size) {
+    const size_t classes = std::max<size_t>(1, desc.value("classes", 1));
+    const size_t class_id = desc.value("class_id", 0);
+    if (class_id >= classes)
+        throw std::invalid_argument("Fake model: class_id " + std::to_string(class_id) + " is out of range");
+
+    std::vector<float> data(batch_size * classes, 0.0f);
+    for (size_t image = 0; image < batch_size; ++image)
+        data[image * classes + class_id] = 1.0f;
+    return std::make_shared<FakeOutputBlob>(std::vector<size_t>{batch_size, classes}, std::move(data));
+}
+
+const InputImageLayerDesc::Ptr
+getImagePreProcInfo(const std::map<std::string, InferenceBackend::InputLayerDesc::Ptr> &input_preprocessors) {
+    const auto image_it = input_preprocessors.find("image");
+    if (image_it != input_preprocessors.cend() && image_it->second)
+        return image_it->second->input_image_preroc_params;
+    return nullptr;
+}
+
+std::shared_ptr<OutputBlob> makeConstantOutput(const nlohmann::json &desc) {
+    std::vector<size_t> dims = desc.at("dims").get<std::vector<size_t>>();
+    size_t size = 1;
+    for (size_t dim : dims)
+        size *= dim;
+    return std::make_shared<FakeOutputBlob>(std::move(dims), std::vector<float>(size, desc.value("value", 0.0f)));
+}
+
+} // namespace
+
+bool FakeImageInference::IsFakeModel(const std::string &model_file) {
+    const std::string suffix = MODEL_SUFFIX;
+    return model_file.size() >= suffix.size() &&
+           model_file.compare(model_file.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+FakeImageInference::FakeImageInference(const InferenceConfig &config, CallbackFunc callback,
+                                       ErrorHandlingFunc error_handler)
+    : _callback(std::move(callback)), _error_handler(std::move(error_handler)) {
+    const auto &base_config = config.at(KEY_BASE);
+    auto batch_size = base_config.find(KEY_BATCH_SIZE);
+    if (batch_size != base_config.end())
+        _batch_size = std::max(1, std::stoi(batch_size->second));
+    auto nireq = base_config.find(KEY_NIREQ);
+    if (nireq != base_config.end())
+        _nireq = std::stoi(nireq->second);
+
+    LoadModel(base_config.at(KEY_MODEL));
+
+    // Images pre-processed by VA-API already have size and layout of model input, others are pre-processed the same
+    // way as by OpenVINO backend with pre-process-backend=opencv
+    auto pp_type = base_config.find(KEY_PRE_PROCESSOR_TYPE);
+    if (pp_type == base_config.end() ||
+        static_cast<ImagePreprocessorType>(std::stoi(pp_type->second)) != ImagePreprocessorType::VAAPI_SYSTEM) {
+        auto custom_preproc_lib = base_config.find(KEY_CUSTOM_PREPROC_LIB);
+        _pre_processor.reset(ImagePreprocessor::Create(
+            ImagePreprocessorType::OPENCV, custom_preproc_lib != base_config.end() ? custom_preproc_lib->second : ""));
+    }
+
+    GVA_INFO("Fake inference: model=%s, batch_size=%zu, nireq=%zu, latency=%lldus", _model_name.c_str(), _batch_size,
+             _nireq, static_cast<long long>(_latency.count()));
+
+    for (size_t i = 0; i < _nireq; ++i)
+        _workers.emplace_back(&FakeImageInference::RequestWorker, this);
+}
+
+FakeImageInference::~FakeImageInference() {
+    Close();
+}
+
+void FakeImageInference::LoadModel(const std::string &model_file) {
+    std::ifstream file(model_file);
+    if (!file)
+        throw std::invalid_argument("Couldn't open fake model '" + model_file + "'");
+    nlohmann::json model;
+    try {
+        file >> model;
+    } catch (const nlohmann::json::exception &e) {
+        throw std::invalid_argument("Couldn't parse fake model '" + model_file + "': " + e.what());
+    }
+
+    _model_name = model.value("name", "fake");
+    const auto &input = model.at("input");
+    _input_name = input.value("name", "image");
+    _width = input.at("width").get<size_t>();
+    _height = input.at("height").get<size_t>();
+    _format = input.value("format", "BGR") == "RGB" ? FourCC::FOURCC_RGBP : FourCC::FOURCC_BGRP;
+
+    if (!_nireq)
+        _nireq = model.value("nireq", DEFAULT_NIREQ);
+    _latency = std::chrono::microseconds(static_cast<int64_t>(model.value("latency_ms", 0.0) * 1000));
+    _busy_wait = model.value("busy_wait", false);
+
+    for (const auto &output : model.at("outputs")) {
+        const std::string type = output.at("type").get<std::string>();
+        std::shared_ptr<OutputBlob> blob;
+        if (type == "detection")
+            blob = makeDetectionOutput(output, _batch_size);
+        else if (type == "classification")
+            blob = makeClassificationOutput(output, _batch_size);
+        else if (type == "constant")
+            blob = makeConstantOutput(output);
+        else
+            throw std::invalid_argument("Fake model: unknown output type '" + type + "'");
+        _outputs.emplace(output.at("name").get<std::string>(), std::move(blob));
+    }
+}
+
+void FakeImageInference::SubmitImage(IFrameBase::Ptr frame,
+                                     const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors) {
+    if (!frame)
+        throw std::invalid_argument("Invalid frame provided");
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_pre_processor) {
+        if (_pending.input.empty()) {
+            if (_free_inputs.empty()) {
+                _pending.input.resize(_batch_size * 3 * _width * _height);
+            } else {
+                _pending.input = std::move(_free_inputs.back());
+                _free_inputs.pop_back();
+            }
+        }
+        Image dst = InputImage(_pending.input, _pending.frames.size());
+        try {
+            _pre_processor->Convert(*frame->GetImage(), dst, getImagePreProcInfo(input_preprocessors),
+                                    frame->GetImageTransformationParams());
+        } catch (const std::exception &e) {
+            std::throw_with_nested(std::runtime_error("Failed while software frame preprocessing"));
+        }
+        // Input tensor holds pre-processed image, so mapped frame can be released
+        frame->SetImage(nullptr);
+    }
+    _pending.frames.push_back(std::move(frame));
+    if (_pending.frames.size() >= _batch_size)
+        StartRequestUnlocked(lock);
+}
+
+Image FakeImageInference::InputImage(std::vector<uint8_t> &input, size_t batch_index) const {
+    const size_t plane_size = _width * _height;
+    Image image = Image();
+    image.type = MemoryType::SYSTEM;
+    image.format = _format;
+    image.width = static_cast<uint32_t>(_width);
+    image.height = static_cast<uint32_t>(_height);
+    image.planes[0] = input.data() + batch_index * 3 * plane_size;
+    image.planes[1] = image.planes[0] + plane_size;
+    image.planes[2] = image.planes[1] + plane_size;
+    image.planes[3] = nullptr;
+    image.stride[0] = image.stride[1] = image.stride[2] = image.width;
+    return image;
+}
+
+void FakeImageInference::StartRequestUnlocked(std::unique_lock<std::mutex> &lock) {
+    // Batch is taken before waiting, so frames submitted meanwhile go to the next one
+    Request request = std::move(_pending);
+    _pending = Request();
+    // Blocks like real backend does when all requests are busy
+    ++_starting;
+    _request_completed.wait(lock, [this] { return _in_flight < _nireq; });
+    --_starting;
+    ++_in_flight;
+    _requests.push_back(std::move(request));
+    _request_available.notify_one();
+}
+
+void FakeImageInference::RequestWorker() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _request_available.wait(lock, [this] { return !_requests.empty() || _terminate; });
+        if (_requests.empty())
+            return;
+        Request request = std::move(_requests.front());
+        _requests.pop_front();
+        lock.unlock();
+
+        if (_busy_wait) {
+            const auto until = std::chrono::steady_clock::now() + _latency;
+            while (std::chrono::steady_clock::now() < until) {
+            }
+        } else if (_latency.count() > 0) {
+            std::this_thread::sleep_for(_latency);
+        }
+
+        try {
+            _callback(_outputs, request.frames);
+        } catch (const std::exception &e) {
+            GVA_ERROR("Fake inference callback failed: %s", e.what());
+            _error_handler(request.frames);
+        }
+
+        lock.lock();
+        if (!request.input.empty())
+            _free_inputs.push_back(std::move(request.input));
+        --_in_flight;
+        _request_completed.notify_all();
+    }
+}
+
+const std::string &FakeImageInference::GetModelName() const {
+    return _model_name;
+}
+
+size_t FakeImageInference::GetBatchSize() const {
+    return _batch_size;
+}
+
+size_t FakeImageInference::GetNireq() const {
+    return _nireq;
+}
+
+void FakeImageInference::GetModelImageInputInfo(size_t &width, size_t &height, size_t &batch_size, int &format,
+                                                int &memory_type) const {
+    width = _width;
+    height = _height;
+    batch_size = _batch_size;
+    format = _format;
+    memory_type = static_cast<int>(MemoryType::SYSTEM);
+}
+
+std::map<std::string, std::vector<size_t>> FakeImageInference::GetModelInputsInfo() const {
+    return {{_input_name, {_batch_size, 3, _height, _width}}};
+}
+
+std::map<std::string, std::vector<size_t>> FakeImageInference::GetModelOutputsInfo() const {
+    std::map<std::string, std::vector<size_t>> info;
+    for (const auto &output : _outputs)
+        info.emplace(output.first, output.second->GetDims());
+    return info;
+}
+
+std::map<std::string, GstStructure *> FakeImageInference::GetModelInfoPostproc() const {
+    // Post-processing is described by model-proc file
+    return {};
+}
+
+bool FakeImageInference::IsQueueFull() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _in_flight >= _nireq;
+}
+
+size_t FakeImageInference::GetFreeRequestsCount() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _nireq - std::min(_in_flight, _nireq);
+}
+
+void FakeImageInference::Flush() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_pending.frames.empty())
+        StartRequestUnlocked(lock);
+    _request_completed.wait(lock, [this] { return _in_flight == 0 && _starting == 0; });
+}
+
+void FakeImageInference::Close() {
+    if (_workers.empty())
+        return;
+    Flush();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _request_available.notify_all();
+    for (auto &worker : _workers)
+        worker.join();
+    _workers.clear();
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include "inference_backend/image_inference.h"
+#include "inference_backend/pre_proc.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace InferenceBackend {
+
+/**
+ * Deterministic inference backend without model and device, used to benchmark pipelines on machines without models
+ * or accelerators. Backend is selected when model file name ends with ".fake.json", the file describes the model:
+ *
+ *   {
+ *     "name": "fake-detector",
+ *     "input": {"name": "image", "width": 300, "height": 300, "format": "BGR"},
+ *     "outputs": [
+ *       {"name": "detection_out", "type": "detection", "objects": 8, "labels": 3},
+ *       {"name": "prob", "type": "classification", "classes": 10, "class_id": 2},
+ *       {"name": "raw", "type": "constant", "dims": [1, 256], "value": 0.5}
+ *     ],
+ *     "latency_ms": 4.0,
+ *     "busy_wait": false
+ *   }
+ *
+ * Output types:
+ *   detection      - detection_output layout [1, 1, N, 7], 'objects' boxes per frame laid out in a grid
+ *   classification - [batch, classes], one-hot at 'class_id'
+ *   constant       - tensor of 'dims' filled with 'value'
+ *
+ * Images are pre-processed into planar input tensor of request by OpenCV pre-processor, the same way OpenVINO backend
+ * does with pre-process-backend=opencv, unless they were pre-processed by VA-API already. Each of nireq requests takes
+ * latency_ms to complete, sleeping or spinning if busy_wait is set. Output tensors are generated once and shared by all
+ * requests.
+ */
+class FakeImageInference : public ImageInference {
+  public:
+    static constexpr const char *MODEL_SUFFIX = ".fake.json";
+
+    static bool IsFakeModel(const std::string &model_file);
+
+    FakeImageInference(const InferenceConfig &config, CallbackFunc callback, ErrorHandlingFunc error_handler);
+    ~FakeImageInference() override;
+
+    void SubmitImage(IFrameBase::Ptr frame,
+                     const std::map<std::string, InputLayerDesc::Ptr> &input_preprocessors) override;
+
+    const std::string &GetModelName() const override;
+    size_t GetBatchSize() const override;
+    size_t GetNireq() const override;
+    void GetModelImageInputInfo(size_t &width, size_t &height, size_t &batch_size, int &format,
+                                int &memory_type) const override;
+    std::map<std::string, std::vector<size_t>> GetModelInputsInfo() const override;
+    std::map<std::string, std::vector<size_t>> GetModelOutputsInfo() const override;
+    std::map<std::string, GstStructure *> GetModelInfoPostproc() const override;
+
+    bool IsQueueFull() override;
+    size_t GetFreeRequestsCount() override;
+
+    void Flush() override;
+    void Close() override;
+
+  private:
+    struct Request {
+        std::vector<IFrameBase::Ptr> frames;
+        std::vector<uint8_t> input; // planar images of batch, empty if images are not pre-processed
+    };
+
+    void LoadModel(const std::string &model_file);
+    Image InputImage(std::vector<uint8_t> &input, size_t batch_index) const;
+    void StartRequestUnlocked(std::unique_lock<std::mutex> &lock);
+    void RequestWorker();
+
+    std::string _model_name;
+    std::string _input_name;
+    size_t _width = 0;
+    size_t _height = 0;
+    int _format = 0;
+    size_t _batch_size = 1;
+    size_t _nireq = 1;
+    std::chrono::microseconds _latency{0};
+    bool _busy_wait = false;
+    std::map<std::string, std::shared_ptr<OutputBlob>> _outputs;
+    std::unique_ptr<ImagePreprocessor> _pre_processor;
+
+    CallbackFunc _callback;
+    ErrorHandlingFunc _error_handler;
+
+    std::mutex _mutex;
+    std::condition_variable _request_available;
+    std::condition_variable _request_completed;
+    Request _pending;
+    std::deque<Request> _requests;
+    std::vector<std::vector<uint8_t>> _free_inputs; // input tensors of completed requests, re-used by next ones
+    size_t _in_flight = 0;
+    size_t _starting = 0; // batches taken from _pending and waiting for free request
+    bool _terminate = false;
+    std::vector<std::thread> _workers;
+};
+
+} // namespace InferenceBackend
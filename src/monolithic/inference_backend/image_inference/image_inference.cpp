@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include "fake_image_inference.h"
 #include "image_inference_async/image_inference_async.h"
 #include "openvino_image_inference.h"
 #include "utils.h"
@@ -27,6 +28,9 @@ ImagePreprocessorType getPreProcType(const std::map<std::string, std::string> &b
 std::map<std::string, GstStructure *> ImageInference::GetModelInfoPreproc(const std::string model_file,
                                                                           const gchar *preproc_config,
                                                                           const gchar *ov_extension_lib) {
+    // Fake models are pre-processed according to model-proc only
+    if (FakeImageInference::IsFakeModel(model_file))
+        return {};
     return OpenVINOImageInference::GetModelInfoPreproc(model_file, preproc_config, ov_extension_lib);
 }
 
@@ -99,24 +103,31 @@ ImageInference::Ptr ImageInference::createImageInferenceInstance(MemoryType inpu
         throw std::invalid_argument("Unsupported memory type");
     }
 
-    // Create an OpenVINOImageInference instance with the determined memory type
-    auto ov_inference = std::make_shared<OpenVINOImageInference>(config, allocator, context, callback, error_handler,
-                                                                 memory_type_to_use);
+    ImageInference::Ptr backend_inference;
+    if (FakeImageInference::IsFakeModel(config.at(KEY_BASE).at(KEY_MODEL))) {
+        if (memory_type_to_use != MemoryType::SYSTEM)
+            throw std::invalid_argument("Fake inference supports system memory only");
+        backend_inference = std::make_shared<FakeImageInference>(config, std::move(callback), std::move(error_handler));
+    } else {
+        // Create an OpenVINOImageInference instance with the determined memory type
+        backend_inference = std::make_shared<OpenVINOImageInference>(config, allocator, context, callback,
+                                                                     error_handler, memory_type_to_use);
+    }
 
     ImageInference::Ptr result_inference;
     if (async_mode) {
 #ifdef ENABLE_VAAPI
 #ifndef _MSC_VER
         // Wrap the inference in an asynchronous handler if async mode is enabled
-        result_inference = std::make_shared<ImageInferenceAsync>(config, context, std::move(ov_inference));
+        result_inference = std::make_shared<ImageInferenceAsync>(config, context, std::move(backend_inference));
 #endif
 #endif
 #ifdef _MSC_VER
-        result_inference = std::make_shared<ImageInferenceAsyncD3D11>(config, context, std::move(ov_inference));
+        result_inference = std::make_shared<ImageInferenceAsyncD3D11>(config, context, std::move(backend_inference));
 #endif
     } else {
         // Use the OpenVINO inference directly if not in async mode
-        result_inference = std::move(ov_inference);
+        result_inference = std::move(backend_inference);
     }
 
     return result_inference;
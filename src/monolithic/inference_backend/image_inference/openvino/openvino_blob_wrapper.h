@@ -90,6 +90,12 @@ class OpenvinoOutputTensor : public InferenceBackend::OutputBlob {
     OpenvinoOutputTensor(ov::Tensor tensor) : _tensor(std::move(tensor)) {
     }
 
+    // Rebinds wrapper to another tensor, lets inference request reuse its output blobs
+    void reset(ov::Tensor tensor) {
+        _tensor = std::move(tensor);
+        _shape.clear();
+    }
+
     const std::vector<size_t> &GetDims() const override {
         if (_shape.empty())
             _shape = _tensor.get_shape();
@@ -34,6 +34,8 @@
 #endif
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <regex>
@@ -248,6 +250,17 @@ struct ConfigHelper {
         return std::stoi(base_config.at(KEY_NIREQ));
     }
 
+    size_t post_proc_threads() const {
+        auto it = base_config.find(KEY_POST_PROC_THREADS);
+        return it != base_config.end() ? std::stoul(it->second) : 0;
+    }
+
+    RequestScheduler::Policy request_scheduling() const {
+        auto it = base_config.find(KEY_REQUEST_SCHEDULING);
+        return (it != base_config.end() && !it->second.empty()) ? RequestScheduler::PolicyFromString(it->second)
+                                                                : RequestScheduler::Policy::Fifo;
+    }
+
     const std::string model_path() const {
         return base_config.at(KEY_MODEL);
     }
@@ -332,6 +345,10 @@ struct ConfigHelper {
         return {base_get_or(KEY_RESHAPE_WIDTH, 0), base_get_or(KEY_RESHAPE_HEIGHT, 0)};
     }
 
+    std::vector<ShapeBuckets::Bucket> shape_buckets() const {
+        return ShapeBuckets::parse(base_get_or_empty(KEY_SHAPE_BUCKETS));
+    }
+
     std::pair<size_t, size_t> image_size() const {
         return {base_get_or("img-width", 0), base_get_or("img-height", 0)};
     }
@@ -465,7 +482,7 @@ class OpenVinoNewApiImpl {
         }
 
         // read model & configure model
-        _model = core().read_model(config.model_path());
+        timed_stage("read", [&] { _model = core().read_model(config.model_path()); });
 
         {
             size_t bs;
@@ -477,7 +494,7 @@ class OpenVinoNewApiImpl {
         create_remote_context();
 
         // Load nn to device
-        load_network(config);
+        timed_stage("compile", [&] { load_network(config); });
 
         if (!_nireq)
             _nireq = _compiled_model.get_property(ov::optimal_number_of_infer_requests);
@@ -1082,6 +1099,7 @@ class OpenVinoNewApiImpl {
 #endif
     int _nireq = 0;
     int _batch_size = 0;
+    std::vector<ShapeBuckets::Bucket> _shape_buckets;
 
     size_t _origin_model_in_w = 0;
     size_t _origin_model_in_h = 0;
@@ -1090,15 +1108,39 @@ class OpenVinoNewApiImpl {
     ImageInference::CallbackFunc _callback;
     ImageInference::ErrorHandlingFunc _error_handler;
 
+    ImageInference::LoadingTimings _loading_timings;
+
+    // Runs model loading stage and adds its duration to timings of the stage
+    template <typename Stage>
+    void timed_stage(const std::string &name, Stage &&stage) {
+        const auto start = std::chrono::steady_clock::now();
+        stage();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        auto it = std::find_if(_loading_timings.begin(), _loading_timings.end(),
+                               [&name](const auto &timing) { return timing.first == name; });
+        if (it != _loading_timings.end())
+            it->second += elapsed.count();
+        else
+            _loading_timings.emplace_back(name, elapsed.count());
+    }
+
     void configure_model(const ConfigHelper &config) {
 
+        _shape_buckets = config.shape_buckets();
         auto [reshape_width, reshape_height] = config.reshape_size();
-        if (config.need_reshape() && (reshape_width || reshape_height))
-            reshape_model(reshape_height, reshape_width);
+        if (!_shape_buckets.empty()) {
+            if (config.pp_type() != ImagePreprocessorType::OPENCV)
+                throw std::invalid_argument("shape-buckets property requires pre-process-backend=opencv");
+            timed_stage("reshape", [&] { reshape_model_to_buckets(); });
+        } else if (config.need_reshape() && (reshape_width || reshape_height)) {
+            timed_stage("reshape", [&] { reshape_model(reshape_height, reshape_width); });
+        }
 
-        auto ppp = ov::preprocess::PrePostProcessor(_model);
-        configure_model_inputs(config, ppp);
-        _model = ppp.build();
+        timed_stage("ppp", [&] {
+            auto ppp = ov::preprocess::PrePostProcessor(_model);
+            configure_model_inputs(config, ppp);
+            _model = ppp.build();
+        });
         _model_format = config.model_format();
 
         // dynamic shapes may have height=0 and width=0 after IE preprocessing
@@ -1106,7 +1148,7 @@ class OpenVinoNewApiImpl {
         auto [img_width, img_height] = config.image_size();
         if (img_width == 0 && img_height == 0 && config.pp_type() == ImagePreprocessorType::IE) {
             auto [frame_width, frame_height] = config.frame_size();
-            reshape_model(frame_height, frame_width);
+            timed_stage("reshape", [&] { reshape_model(frame_height, frame_width); });
         }
 
         _batch_size = config.batch_size();
@@ -1355,6 +1397,52 @@ class OpenVinoNewApiImpl {
         print_input_and_outputs_info(*_model);
     }
 
+    // Makes image input width and height dynamic in range of shape bucket sizes, so one compiled model serves all
+    // buckets. Input tensors of bucket sizes are set to requests before pre-processing.
+    void reshape_model_to_buckets() {
+        const ov::Output<ov::Node> input = _model->inputs().front();
+        const ov::Layout layout = get_ov_node_layout(input, true);
+        if (layout.empty())
+            throw std::runtime_error("Shape buckets: couldn't determine input layout");
+
+        size_t min_width = SIZE_MAX, max_width = 0, min_height = SIZE_MAX, max_height = 0;
+        for (const auto &bucket : _shape_buckets) {
+            min_width = std::min(min_width, bucket.width);
+            max_width = std::max(max_width, bucket.width);
+            min_height = std::min(min_height, bucket.height);
+            max_height = std::max(max_height, bucket.height);
+        }
+
+        ov::PartialShape shape = input.get_partial_shape();
+        shape[ov::layout::height_idx(layout)] = ov::Dimension(min_height, max_height);
+        shape[ov::layout::width_idx(layout)] = ov::Dimension(min_width, max_width);
+
+        GVA_INFO("Reshaping model input %s from %s to %s for shape buckets", input.get_any_name().c_str(),
+                 input.get_partial_shape().to_string().c_str(), shape.to_string().c_str());
+        _model->reshape(std::map<ov::Output<ov::Node>, ov::PartialShape>{{input, shape}});
+    }
+
+    // Shape of image input tensor of bucket size, in layout of pre-processed input
+    ov::Shape bucket_input_shape(const ShapeBuckets::Bucket &bucket) {
+        const ov::Output<ov::Node> input = _model->input(_image_input_name);
+        const ov::Layout layout = get_ov_node_layout(input, true);
+        if (layout.empty() || !ov::layout::has_batch(layout) || !ov::layout::has_channels(layout))
+            throw std::runtime_error("Shape buckets: couldn't determine layout of pre-processed input");
+
+        const ov::PartialShape &partial_shape = input.get_partial_shape();
+        const int64_t rank = partial_shape.rank().get_length();
+        // Layout indices may be counted from the end
+        auto index = [rank](int64_t idx) { return safe_convert<size_t>(idx < 0 ? idx + rank : idx); };
+
+        ov::Shape shape(safe_convert<size_t>(rank));
+        shape[index(ov::layout::batch_idx(layout))] = safe_convert<size_t>(_batch_size);
+        const size_t channels = index(ov::layout::channels_idx(layout));
+        shape[channels] = safe_convert<size_t>(partial_shape[channels].get_length());
+        shape[index(ov::layout::height_idx(layout))] = bucket.height;
+        shape[index(ov::layout::width_idx(layout))] = bucket.width;
+        return shape;
+    }
+
     // Loads network to the device
     void load_network(const ConfigHelper &config) {
         assert(!_compiled_model);
@@ -1480,15 +1568,30 @@ OpenVINOImageInference::OpenVINOImageInference(const InferenceBackend::Inference
         nireq = _impl->_nireq;
         batch_size = _impl->_batch_size;
         image_layer = _impl->_image_input_name;
+        shape_buckets = _impl->_shape_buckets;
+        for (const auto &bucket : shape_buckets)
+            bucket_shapes.push_back(_impl->bucket_input_shape(bucket));
+        for (const auto &output : _impl->_compiled_model.outputs())
+            output_names.push_back(output.get_names().size() > 0 ? output.get_any_name() : std::string("output"));
 
         for (int i = 0; i < nireq; i++) {
             std::shared_ptr<BatchRequest> batch_request = std::make_shared<BatchRequest>();
             batch_request->infer_request_new = _impl->_compiled_model.create_infer_request();
             batch_request->in_tensors.resize(_impl->_model->inputs().size());
+            batch_request->bucket_tensors.resize(shape_buckets.size());
             SetCompletionCallback(batch_request);
             freeRequests.push(batch_request);
         }
 
+        const size_t post_proc_threads = cfg_helper.post_proc_threads();
+        if (post_proc_threads) {
+            GVA_INFO("Post-processing is offloaded to %zu threads", post_proc_threads);
+            // Completion thread blocks only if post-processing lags behind by more than nireq results
+            post_proc_pool = std::make_unique<OrderedTaskPool>(post_proc_threads, nireq);
+        }
+
+        request_scheduler = std::make_unique<RequestScheduler>(cfg_helper.request_scheduling());
+
 #ifndef ENABLE_D3D_NPU_COLOR_CONV
         if (pp_type == InferenceBackend::ImagePreprocessorType::OPENCV ||
             pp_type == InferenceBackend::ImagePreprocessorType::D3D11) {
@@ -1526,6 +1629,27 @@ bool OpenVINOImageInference::IsQueueFull() {
     return freeRequests.empty();
 }
 
+ImageInference::LoadingTimings OpenVINOImageInference::GetLoadingTimings() const {
+    return _impl->_loading_timings;
+}
+
+size_t OpenVINOImageInference::GetFreeRequestsCount() {
+    return freeRequests.size();
+}
+
+ImageInference::QueueWaitStats OpenVINOImageInference::GetQueueWaitStats(const void *stream) const {
+    const RequestScheduler::WaitStats stats = request_scheduler->GetWaitStats(stream);
+    QueueWaitStats result;
+    result.requests = stats.requests;
+    result.total_ms = stats.total_ns / 1e6;
+    result.max_ms = stats.max_ns / 1e6;
+    return result;
+}
+
+void OpenVINOImageInference::RemoveStream(const void *stream) {
+    request_scheduler->RemoveStream(stream);
+}
+
 Image fill_image(ov::Tensor &tensor, size_t bindex) {
     Image image = Image();
     const auto &dims = tensor.get_shape();
@@ -1688,9 +1812,15 @@ void OpenVINOImageInference::SubmitImage(
     if (!frame)
         throw std::invalid_argument("Invalid frame provided");
 
+    // Streams of shared instance take turns according to request-scheduling policy instead of racing for the lock
+    const IFrameBase::SchedulingInfo scheduling = frame->GetSchedulingInfo();
+    RequestScheduler::Turn turn(*request_scheduler, scheduling.stream, scheduling.priority, scheduling.deadline_ns);
+
     std::unique_lock<std::mutex> lk(requests_mutex_);
     ++requests_processing_;
-    std::shared_ptr<BatchRequest> request = freeRequests.pop();
+    std::shared_ptr<BatchRequest> request =
+        shape_buckets.empty() ? freeRequests.pop() : TakeBucketRequest(SelectShapeBucket(*frame->GetImage()));
+    turn.RequestObtained();
 
     try {
         if (DoNeedImagePreProcessing(frame->GetImage())) {
@@ -1719,6 +1849,8 @@ void OpenVINOImageInference::SubmitImage(
         // start inference asynchronously if enough buffers for batching
         if (request->buffers.size() >= safe_convert<size_t>(batch_size)) {
             request->start_async();
+        } else if (!shape_buckets.empty()) {
+            open_requests.push_back(request);
         } else {
             freeRequests.push_front(request);
         }
@@ -1727,6 +1859,48 @@ void OpenVINOImageInference::SubmitImage(
     }
 }
 
+size_t OpenVINOImageInference::SelectShapeBucket(const Image &image) const {
+    // Empty rectangle means the whole image is inferred
+    const size_t width = image.rect.width ? image.rect.width : image.width;
+    const size_t height = image.rect.height ? image.rect.height : image.height;
+    return ShapeBuckets::select(shape_buckets, width, height);
+}
+
+std::shared_ptr<OpenVINOImageInference::BatchRequest> OpenVINOImageInference::TakeBucketRequest(size_t bucket) {
+    auto it = std::find_if(open_requests.begin(), open_requests.end(),
+                           [bucket](const std::shared_ptr<BatchRequest> &open) { return open->bucket == bucket; });
+    if (it != open_requests.end()) {
+        std::shared_ptr<BatchRequest> request = *it;
+        open_requests.erase(it);
+        return request;
+    }
+
+    // Partially filled requests of other buckets would hold all requests otherwise
+    while (freeRequests.empty() && !open_requests.empty())
+        StartOpenRequest();
+
+    std::shared_ptr<BatchRequest> request = freeRequests.pop();
+    request->bucket = bucket;
+    ov::Tensor &tensor = request->bucket_tensors[bucket];
+    if (!tensor)
+        tensor = ov::Tensor(_impl->_compiled_model.input(image_layer).get_element_type(), bucket_shapes[bucket]);
+    request->infer_request_new.set_tensor(image_layer, tensor);
+    return request;
+}
+
+void OpenVINOImageInference::StartOpenRequest() {
+    // Oldest partially filled request goes first
+    std::shared_ptr<BatchRequest> request = open_requests.front();
+    open_requests.erase(open_requests.begin());
+    try {
+        request->start_async();
+    } catch (const std::exception &e) {
+        GVA_ERROR("Couldn't start inference of partially filled batch: %s", e.what());
+        this->handleError(request->buffers);
+        FreeRequest(request);
+    }
+}
+
 const std::string &OpenVINOImageInference::GetModelName() const {
     return model_name;
 }
@@ -1767,6 +1941,21 @@ std::map<std::string, GstStructure *> OpenVINOImageInference::GetModelInfoPrepro
 }
 
 void OpenVINOImageInference::Flush() {
+    FlushRequests();
+    // Requests are released before post-processing when it is offloaded, wait for results to be delivered
+    if (post_proc_pool)
+        post_proc_pool->wait_idle();
+}
+
+void OpenVINOImageInference::FlushStream(const void *ordering_key) {
+    FlushRequests();
+    // Other streams sharing the instance may keep scheduling results, so pool may never become idle. Wait for results
+    // of the caller only
+    if (post_proc_pool)
+        post_proc_pool->wait_idle(ordering_key);
+}
+
+void OpenVINOImageInference::FlushRequests() {
     ITT_TASK(__FUNCTION__);
 
     // because Flush can execute by several threads for one InferenceImpl instance
@@ -1775,6 +1964,9 @@ void OpenVINOImageInference::Flush() {
 
     std::unique_lock<std::mutex> flush_lk(flush_mutex);
 
+    while (!open_requests.empty())
+        StartOpenRequest();
+
     while (requests_processing_ != 0) {
         auto request = freeRequests.pop();
 
@@ -1819,11 +2011,31 @@ void OpenVINOImageInference::Close() {
 void OpenVINOImageInference::WorkingFunction(const std::shared_ptr<BatchRequest> &request) {
     assert(request);
 
+    if (!post_proc_pool) {
+        // Blobs are rebound to request's output tensors, so steady state doesn't allocate per inference
+        auto &output_blobs = request->output_blobs;
+        for (size_t i = 0; i < output_names.size(); i++) {
+            auto &blob = output_blobs[output_names[i]];
+            ov::Tensor tensor = request->infer_request_new.get_output_tensor(i);
+            if (blob)
+                std::static_pointer_cast<OpenvinoOutputTensor>(blob)->reset(std::move(tensor));
+            else
+                blob = std::make_shared<OpenvinoOutputTensor>(std::move(tensor));
+        }
+        callback(output_blobs, request->buffers);
+        return;
+    }
+
     std::map<std::string, OutputBlob::Ptr> output_blobs;
-    const auto &outputs = _impl->_compiled_model.outputs();
-    for (size_t i = 0; i < outputs.size(); i++) {
-        auto name = outputs[i].get_names().size() > 0 ? outputs[i].get_any_name() : std::string("output");
-        output_blobs[name] = std::make_shared<OpenvinoOutputTensor>(request->infer_request_new.get_output_tensor(i));
+    for (size_t i = 0; i < output_names.size(); i++) {
+        ov::Tensor tensor = request->infer_request_new.get_output_tensor(i);
+        // Request is reused by next inference before post-processing is done, so results are copied out
+        ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+        tensor.copy_to(copy);
+        output_blobs[output_names[i]] = std::make_shared<OpenvinoOutputTensor>(copy);
     }
-    callback(output_blobs, request->buffers);
+
+    const void *key = request->buffers.empty() ? nullptr : request->buffers.front()->GetOrderingKey();
+    post_proc_pool->schedule(key,
+                             [this, output_blobs, buffers = request->buffers]() { callback(output_blobs, buffers); });
 }
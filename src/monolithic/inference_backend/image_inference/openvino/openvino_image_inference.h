@@ -17,8 +17,12 @@
 #include <map>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "config.h"
+#include "ordered_task_pool.h"
+#include "request_scheduler.h"
+#include "shape_buckets.h"
 #include "safe_queue.h"
 
 class OpenVINOImageInference : public InferenceBackend::ImageInference {
@@ -47,8 +51,13 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
     GetModelInfoPreproc(const std::string model_file, const gchar *pre_proc_config, const gchar *ov_extension_lib);
 
     bool IsQueueFull() override;
+    size_t GetFreeRequestsCount() override;
+    LoadingTimings GetLoadingTimings() const override;
+    QueueWaitStats GetQueueWaitStats(const void *stream) const override;
+    void RemoveStream(const void *stream) override;
 
     void Flush() override;
+    void FlushStream(const void *ordering_key) override;
 
     void Close() override;
 
@@ -59,6 +68,11 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
         ov::InferRequest infer_request_new;
         std::vector<IFrameBase::Ptr> buffers;
         std::vector<ov::TensorVector> in_tensors;
+        // Output blobs wrapping request's output tensors, reused if post-processing runs on completion thread
+        std::map<std::string, InferenceBackend::OutputBlob::Ptr> output_blobs;
+        // Shape bucket of regions in the request and input tensors of each bucket size, if shape-buckets is set
+        size_t bucket = 0;
+        std::vector<ov::Tensor> bucket_tensors;
 
         void start_async() {
             return this->infer_request_new.start_async();
@@ -75,13 +89,26 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
 
     std::string model_name;
     std::string image_layer;
+    // Names of compiled model outputs by output index
+    std::vector<std::string> output_names;
 
     int batch_size;
     int nireq;
     SafeQueue<std::shared_ptr<BatchRequest>> freeRequests;
+    // Order in which streams of shared instance take free requests
+    std::unique_ptr<RequestScheduler> request_scheduler;
+
+    std::vector<ShapeBuckets::Bucket> shape_buckets;
+    // Image input tensor shape of each bucket
+    std::vector<ov::Shape> bucket_shapes;
+    // Partially filled requests, at most one per shape bucket, oldest first. Guarded by requests_mutex_
+    std::vector<std::shared_ptr<BatchRequest>> open_requests;
 
     std::unique_ptr<InferenceBackend::ImagePreprocessor> pre_processor;
 
+    // Runs callback off the inference completion thread if post-proc-threads is set
+    std::unique_ptr<OrderedTaskPool> post_proc_pool;
+
     // Threading
     std::mutex requests_mutex_;
     std::atomic<unsigned int> requests_processing_;
@@ -90,6 +117,11 @@ class OpenVINOImageInference : public InferenceBackend::ImageInference {
 
   private:
     void FreeRequest(std::shared_ptr<BatchRequest> request);
+    size_t SelectShapeBucket(const InferenceBackend::Image &image) const;
+    std::shared_ptr<BatchRequest> TakeBucketRequest(size_t bucket);
+    void StartOpenRequest();
+    // Starts incomplete batches and waits for all infer requests to complete
+    void FlushRequests();
     bool DoNeedImagePreProcessing(const InferenceBackend::ImagePtr src_img);
     void SubmitImageProcessing(const std::string &input_name, std::shared_ptr<BatchRequest> request,
                                const InferenceBackend::Image &src_img,
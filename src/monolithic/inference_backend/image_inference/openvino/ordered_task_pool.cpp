@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "ordered_task_pool.h"
+
+#include "inference_backend/logger.h"
+#include "utils.h"
+
+#include <algorithm>
+
+OrderedTaskPool::OrderedTaskPool(size_t threads, size_t max_pending) : _max_pending(std::max<size_t>(1, max_pending)) {
+    for (size_t i = 0; i < threads; ++i)
+        _threads.emplace_back(&OrderedTaskPool::task_runner, this);
+}
+
+OrderedTaskPool::~OrderedTaskPool() {
+    wait_idle();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _task_available.notify_all();
+    for (auto &t : _threads) {
+        if (t.joinable())
+            t.join();
+    }
+}
+
+void OrderedTaskPool::schedule(const void *key, std::function<void()> task) {
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _task_taken.wait(lock, [this] { return _pending < _max_pending; });
+
+        auto &queue = _tasks[key];
+        // Key is not ready if it already has pending tasks or one of its tasks is running
+        bool busy = !queue.empty() || std::find(_running_keys.begin(), _running_keys.end(), key) != _running_keys.end();
+        queue.push_back(std::move(task));
+        _pending++;
+        if (!busy)
+            _ready.push_back(key);
+    }
+    _task_available.notify_one();
+}
+
+void OrderedTaskPool::wait_idle() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return _pending == 0 && _running_keys.empty(); });
+}
+
+void OrderedTaskPool::wait_idle(const void *key) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this, key] { return _tasks.find(key) == _tasks.end(); });
+}
+
+void OrderedTaskPool::task_runner() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _task_available.wait(lock, [this] { return !_ready.empty() || _terminate; });
+        if (_ready.empty())
+            return;
+
+        const void *key = _ready.front();
+        _ready.pop_front();
+        auto it = _tasks.find(key);
+        std::function<void()> task = std::move(it->second.front());
+        it->second.pop_front();
+        _pending--;
+        _running_keys.push_back(key);
+        _task_taken.notify_one();
+
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception &e) {
+            GVA_ERROR("Error during execution of post-processing task: %s", Utils::createNestedErrorMsg(e).c_str());
+        }
+        task = nullptr;
+        lock.lock();
+
+        _running_keys.erase(std::find(_running_keys.begin(), _running_keys.end(), key));
+        it = _tasks.find(key);
+        if (it->second.empty()) {
+            // Last task of the key, pool is idle if it was the last running task
+            _tasks.erase(it);
+            _idle.notify_all();
+        } else {
+            _ready.push_back(key);
+            _task_available.notify_one();
+        }
+    }
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Thread pool that executes tasks with the same key one at a time in submission order, while tasks with different
+ * keys run in parallel. Number of scheduled but not started tasks is limited by max_pending, schedule() blocks the
+ * caller when the limit is reached.
+ */
+class OrderedTaskPool {
+  public:
+    OrderedTaskPool(size_t threads, size_t max_pending);
+    ~OrderedTaskPool();
+
+    OrderedTaskPool(const OrderedTaskPool &) = delete;
+    OrderedTaskPool &operator=(const OrderedTaskPool &) = delete;
+
+    void schedule(const void *key, std::function<void()> task);
+
+    // Waits until all scheduled tasks are completed
+    void wait_idle();
+    // Waits until tasks with given key are completed, tasks with other keys may still be scheduled and run
+    void wait_idle(const void *key);
+
+  private:
+    void task_runner();
+
+    std::vector<std::thread> _threads;
+    std::mutex _mutex;
+    std::condition_variable _task_available;
+    std::condition_variable _task_taken;
+    std::condition_variable _idle;
+
+    // Pending tasks per key, key is removed once its last task is completed. Key is present in _ready only if it has
+    // pending tasks and none of its tasks is running
+    std::map<const void *, std::deque<std::function<void()>>> _tasks;
+    std::deque<const void *> _ready;
+    std::vector<const void *> _running_keys;
+    size_t _pending = 0;
+    size_t _max_pending;
+    bool _terminate = false;
+};
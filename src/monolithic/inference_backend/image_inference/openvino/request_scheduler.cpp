@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "request_scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+RequestScheduler::Policy RequestScheduler::PolicyFromString(const std::string &name) {
+    constexpr std::pair<const char *, Policy> policies[]{{"fifo", Policy::Fifo},
+                                                         {"round-robin", Policy::RoundRobin},
+                                                         {"weighted-fair", Policy::WeightedFair},
+                                                         {"deadline", Policy::EarliestDeadline}};
+
+    for (const auto &policy : policies) {
+        if (name == policy.first)
+            return policy.second;
+    }
+    throw std::invalid_argument("Invalid request scheduling policy: '" + name +
+                                "'. Supported values: fifo, round-robin, weighted-fair, deadline");
+}
+
+RequestScheduler::RequestScheduler(Policy policy) : policy(policy) {
+}
+
+uint64_t RequestScheduler::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+uint64_t RequestScheduler::Acquire(const void *stream, unsigned weight, uint64_t deadline_ns) {
+    const uint64_t begin_ns = NowNs();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    StreamState &state = streams[stream];
+    state.weight = std::max(weight, 1u);
+    // Stream becoming backlogged doesn't get credit for time it was idle
+    if (state.waiters.empty())
+        state.virtual_time = std::max(state.virtual_time, virtual_time);
+
+    Waiter waiter;
+    waiter.deadline_ns = deadline_ns;
+    waiter.sequence = ++sequence;
+
+    if (!busy && waiting == 0) {
+        Grant(state, waiter);
+    } else {
+        state.waiters.push_back(&waiter);
+        ++waiting;
+        waiter.condition.wait(lock, [&waiter] { return waiter.granted; });
+    }
+
+    return NowNs() - begin_ns;
+}
+
+void RequestScheduler::Release() {
+    std::lock_guard<std::mutex> lock(mutex);
+    busy = false;
+    if (waiting == 0)
+        return;
+
+    StreamState *next = nullptr;
+    for (auto &stream : streams) {
+        StreamState &state = stream.second;
+        if (!state.waiters.empty() && (!next || IsBefore(state, *next)))
+            next = &state;
+    }
+    Waiter &waiter = *next->waiters.front();
+    next->waiters.pop_front();
+    --waiting;
+    Grant(*next, waiter);
+    waiter.condition.notify_one();
+}
+
+void RequestScheduler::RecordWait(const void *stream, uint64_t wait_ns) {
+    std::lock_guard<std::mutex> lock(mutex);
+    WaitStats &stats = streams[stream].stats;
+    ++stats.requests;
+    stats.total_ns += wait_ns;
+    stats.max_ns = std::max(stats.max_ns, wait_ns);
+}
+
+RequestScheduler::WaitStats RequestScheduler::GetWaitStats(const void *stream) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = streams.find(stream);
+    return it != streams.end() ? it->second.stats : WaitStats();
+}
+
+void RequestScheduler::RemoveStream(const void *stream) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = streams.find(stream);
+    // Stream with waiters is still in use
+    if (it != streams.end() && it->second.waiters.empty())
+        streams.erase(it);
+}
+
+size_t RequestScheduler::GetWaitingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return waiting;
+}
+
+// Compares first waiters of two streams, ties are resolved in order of arrival
+bool RequestScheduler::IsBefore(const StreamState &lhs, const StreamState &rhs) const {
+    const Waiter &lhs_waiter = *lhs.waiters.front();
+    const Waiter &rhs_waiter = *rhs.waiters.front();
+    switch (policy) {
+    case Policy::Fifo:
+        break;
+    case Policy::RoundRobin:
+        if (lhs.last_turn != rhs.last_turn)
+            return lhs.last_turn < rhs.last_turn;
+        break;
+    case Policy::WeightedFair:
+        if (lhs.virtual_time != rhs.virtual_time)
+            return lhs.virtual_time < rhs.virtual_time;
+        break;
+    case Policy::EarliestDeadline:
+        if (lhs_waiter.deadline_ns != rhs_waiter.deadline_ns)
+            return lhs_waiter.deadline_ns < rhs_waiter.deadline_ns;
+        break;
+    }
+    return lhs_waiter.sequence < rhs_waiter.sequence;
+}
+
+void RequestScheduler::Grant(StreamState &state, Waiter &waiter) {
+    state.last_turn = ++turns;
+    virtual_time = state.virtual_time;
+    state.virtual_time += 1.0 / state.weight;
+
+    busy = true;
+    waiter.granted = true;
+}
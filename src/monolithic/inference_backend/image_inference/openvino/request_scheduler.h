@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Decides which of the streams sharing an inference instance takes the next infer request. Submitting threads call
+ * Acquire() before taking a request and Release() once the request is filled; only one caller holds the turn at a
+ * time, the next one is chosen by policy among all callers waiting at that moment:
+ *
+ * - fifo: in order of arrival.
+ * - round-robin: stream served least recently first, so each waiting stream gets one request per round.
+ * - weighted-fair: start-time fair queuing, waiting streams share requests in proportion to their weights.
+ * - deadline: earliest deadline first, deadline is given by caller (e.g. frame running time plus latency budget).
+ *
+ * Callers of one stream are always served in arrival order. Time each stream waits for its turn and then for the
+ * request itself is reported by Turn::RequestObtained(), accumulated and returned by GetWaitStats().
+ */
+class RequestScheduler {
+  public:
+    enum class Policy { Fifo, RoundRobin, WeightedFair, EarliestDeadline };
+
+    struct WaitStats {
+        uint64_t requests = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+    };
+
+    // Holds the turn until end of scope
+    class Turn {
+      public:
+        Turn(RequestScheduler &scheduler, const void *stream, unsigned weight, uint64_t deadline_ns)
+            : scheduler(scheduler), stream(stream), begin_ns(NowNs()) {
+            scheduler.Acquire(stream, weight, deadline_ns);
+        }
+        ~Turn() {
+            scheduler.Release();
+        }
+
+        // Records wait of the stream: for the turn and then for free request, which turn holder blocks on
+        void RequestObtained() {
+            scheduler.RecordWait(stream, NowNs() - begin_ns);
+        }
+
+        Turn(const Turn &) = delete;
+        Turn &operator=(const Turn &) = delete;
+
+      private:
+        RequestScheduler &scheduler;
+        const void *stream;
+        uint64_t begin_ns;
+    };
+
+    // Accepts fifo, round-robin, weighted-fair and deadline, throws std::invalid_argument otherwise
+    static Policy PolicyFromString(const std::string &name);
+
+    explicit RequestScheduler(Policy policy);
+
+    RequestScheduler(const RequestScheduler &) = delete;
+    RequestScheduler &operator=(const RequestScheduler &) = delete;
+
+    // Blocks until the caller gets the turn. Weight is used by weighted-fair, deadline by deadline policy. Returns
+    // time spent waiting in nanoseconds.
+    uint64_t Acquire(const void *stream, unsigned weight, uint64_t deadline_ns);
+    void Release();
+
+    void RecordWait(const void *stream, uint64_t wait_ns);
+    WaitStats GetWaitStats(const void *stream) const;
+    // Drops state and statistics of stream which stopped using the instance, so stream created later at the same
+    // address starts from scratch
+    void RemoveStream(const void *stream);
+    // Number of callers waiting for the turn
+    size_t GetWaitingCount() const;
+
+    Policy GetPolicy() const {
+        return policy;
+    }
+
+    static uint64_t NowNs();
+
+  private:
+    struct Waiter {
+        uint64_t deadline_ns;
+        uint64_t sequence;
+        bool granted = false;
+        std::condition_variable condition;
+    };
+
+    struct StreamState {
+        unsigned weight = 1;
+        // Waiters of the stream in arrival order, only the first one competes with other streams
+        std::deque<Waiter *> waiters;
+        uint64_t last_turn = 0;
+        double virtual_time = 0;
+        WaitStats stats;
+    };
+
+    bool IsBefore(const StreamState &lhs, const StreamState &rhs) const;
+    void Grant(StreamState &state, Waiter &waiter);
+
+    const Policy policy;
+
+    mutable std::mutex mutex;
+    std::unordered_map<const void *, StreamState> streams;
+    size_t waiting = 0;
+    bool busy = false;
+    uint64_t sequence = 0;
+    uint64_t turns = 0;
+    // Start tag of the last granted turn, weighted-fair only
+    double virtual_time = 0;
+};
@@ -61,6 +61,11 @@ class SafeQueue {
         return queue_.empty();
     }
 
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
+
     void waitEmpty() {
         std::unique_lock<std::mutex> lock(mutex_);
         while (!queue_.empty()) {
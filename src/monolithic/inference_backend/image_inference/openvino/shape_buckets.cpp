@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "shape_buckets.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace ShapeBuckets {
+
+namespace {
+
+size_t parseDimension(const std::string &value, const std::string &item) {
+    size_t pos = 0;
+    unsigned long dimension = 0;
+    try {
+        dimension = std::stoul(value, &pos);
+    } catch (const std::exception &) {
+        pos = 0;
+    }
+    if (pos == 0 || pos != value.size() || dimension == 0 || value[0] == '-')
+        throw std::invalid_argument("Invalid shape bucket '" + item + "', expected WIDTHxHEIGHT");
+    return dimension;
+}
+
+} // namespace
+
+std::vector<Bucket> parse(const std::string &list) {
+    std::vector<Bucket> buckets;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const size_t begin = item.find_first_not_of(" \t");
+        const size_t end = item.find_last_not_of(" \t");
+        if (begin == std::string::npos)
+            continue;
+        item = item.substr(begin, end - begin + 1);
+
+        const size_t separator = item.find('x');
+        if (separator == std::string::npos)
+            throw std::invalid_argument("Invalid shape bucket '" + item + "', expected WIDTHxHEIGHT");
+        Bucket bucket;
+        bucket.width = parseDimension(item.substr(0, separator), item);
+        bucket.height = parseDimension(item.substr(separator + 1), item);
+        buckets.push_back(bucket);
+    }
+    return buckets;
+}
+
+size_t select(const std::vector<Bucket> &buckets, size_t region_width, size_t region_height) {
+    if (buckets.empty())
+        throw std::invalid_argument("No shape buckets to select from");
+
+    size_t fitting = buckets.size();
+    size_t largest = 0;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        const Bucket &bucket = buckets[i];
+        const size_t area = bucket.width * bucket.height;
+        if (area > buckets[largest].width * buckets[largest].height)
+            largest = i;
+        if (bucket.width >= region_width && bucket.height >= region_height &&
+            (fitting == buckets.size() || area < buckets[fitting].width * buckets[fitting].height))
+            fitting = i;
+    }
+    return fitting != buckets.size() ? fitting : largest;
+}
+
+} // namespace ShapeBuckets
@@ -0,0 +1,39 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Input sizes of dynamic-shape model used for regions of different sizes. Regions are resized to the bucket they fit
+ * in instead of the single model input size, so small crops aren't upscaled and batches don't carry padding of the
+ * largest size. Requests are batched per bucket.
+ */
+namespace ShapeBuckets {
+
+struct Bucket {
+    size_t width = 0;
+    size_t height = 0;
+
+    bool operator==(const Bucket &other) const {
+        return width == other.width && height == other.height;
+    }
+    bool operator<(const Bucket &other) const {
+        return width != other.width ? width < other.width : height < other.height;
+    }
+};
+
+// Parses comma separated list of WIDTHxHEIGHT sizes, e.g. "32x32,64x32,128x32". Throws std::invalid_argument.
+std::vector<Bucket> parse(const std::string &list);
+
+// Returns index of the smallest bucket containing region of given size, or of the largest bucket if region doesn't
+// fit in any of them. Buckets must not be empty.
+size_t select(const std::vector<Bucket> &buckets, size_t region_width, size_t region_height);
+
+} // namespace ShapeBuckets
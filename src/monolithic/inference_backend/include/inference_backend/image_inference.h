@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <gst/gst.h>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "image.h"
@@ -43,12 +45,27 @@ class ImageInference {
         virtual ImageTransformationParams::Ptr GetImageTransformationParams() {
             return image_trans_params;
         }
+        // Results of frames with the same key are passed to callback in submission order
+        virtual const void *GetOrderingKey() const {
+            return nullptr;
+        }
+        // Used to share infer requests between streams of shared instance, see request-scheduling property
+        struct SchedulingInfo {
+            const void *stream = nullptr;
+            unsigned priority = 1;
+            uint64_t deadline_ns = UINT64_MAX;
+        };
+        virtual SchedulingInfo GetSchedulingInfo() const {
+            SchedulingInfo info;
+            info.stream = GetOrderingKey();
+            return info;
+        }
 
         virtual ~IFrameBase() = default;
     };
 
-    typedef std::function<void(std::map<std::string, std::shared_ptr<OutputBlob>> blobs,
-                               std::vector<IFrameBase::Ptr> frames)>
+    typedef std::function<void(const std::map<std::string, std::shared_ptr<OutputBlob>> &blobs,
+                               const std::vector<IFrameBase::Ptr> &frames)>
         CallbackFunc;
     typedef std::function<void(std::vector<IFrameBase::Ptr> frames)> ErrorHandlingFunc;
 
@@ -74,7 +91,36 @@ class ImageInference {
     GetModelInfoPreproc(const std::string model_file, const gchar *pre_proc_config, const gchar *ov_extension_lib);
 
     virtual bool IsQueueFull() = 0;
+    // Number of inference requests not occupied at the moment, used to estimate load of the instance
+    virtual size_t GetFreeRequestsCount() {
+        return IsQueueFull() ? 0 : GetNireq();
+    }
+    // Durations of model loading stages in milliseconds in order of execution, e.g. read, ppp, compile
+    using LoadingTimings = std::vector<std::pair<std::string, double>>;
+    virtual LoadingTimings GetLoadingTimings() const {
+        return {};
+    }
+    // Time frames of the stream (SchedulingInfo::stream) waited for infer request
+    struct QueueWaitStats {
+        uint64_t requests = 0;
+        double total_ms = 0;
+        double max_ms = 0;
+    };
+    virtual QueueWaitStats GetQueueWaitStats(const void *stream) const {
+        (void)stream;
+        return {};
+    }
+    // Called when the stream stops using the instance, drops its scheduling state and wait statistics
+    virtual void RemoveStream(const void *stream) {
+        (void)stream;
+    }
     virtual void Flush() = 0;
+    // Flushes infer requests like Flush(), but waits for delivery of results of frames with given ordering key only
+    // (see IFrameBase::GetOrderingKey), results of other streams of shared instance may still be delivered
+    virtual void FlushStream(const void *ordering_key) {
+        (void)ordering_key;
+        Flush();
+    }
     virtual void Close() = 0;
 
     virtual ~ImageInference() = default;
@@ -166,6 +212,8 @@ __DECLARE_CONFIG_KEY(MODEL); // Path to model
 __DECLARE_CONFIG_KEY(CUSTOM_PREPROC_LIB);
 __DECLARE_CONFIG_KEY(OV_EXTENSION_LIB);
 __DECLARE_CONFIG_KEY(NIREQ);
+__DECLARE_CONFIG_KEY(POST_PROC_THREADS);
+__DECLARE_CONFIG_KEY(REQUEST_SCHEDULING);
 __DECLARE_CONFIG_KEY(DEVICE_EXTENSIONS);
 __DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS); // number inference requests running in parallel
 __DECLARE_CONFIG_KEY(GPU_THROUGHPUT_STREAMS);
@@ -177,6 +225,7 @@ __DECLARE_CONFIG_KEY(RESHAPE);
 __DECLARE_CONFIG_KEY(BATCH_SIZE);
 __DECLARE_CONFIG_KEY(RESHAPE_WIDTH);
 __DECLARE_CONFIG_KEY(RESHAPE_HEIGHT);
+__DECLARE_CONFIG_KEY(SHAPE_BUCKETS);
 __DECLARE_CONFIG_KEY(image);
 __DECLARE_CONFIG_KEY(CAPS_FEATURE);
 __DECLARE_CONFIG_KEY(VAAPI_THREAD_POOL_SIZE);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
@@ -44,12 +44,17 @@ void debug_log(int level, const char *file, const char *function, int line, cons
 #define GVA_WARNING(format, ...) GVA_DEBUG_LOG(GVA_WARNING_LOG_LEVEL, format, ##__VA_ARGS__)
 #define GVA_ERROR(format, ...) GVA_DEBUG_LOG(GVA_ERROR_LOG_LEVEL, format, ##__VA_ARGS__)
 
-#if defined(ENABLE_ITT) && defined(__cplusplus)
+#ifdef __cplusplus
+#include "trace_recorder.h"
+
+// Scope recorded by TraceRecorder (GVA_TRACE) and by ITT if built with ENABLE_ITT. NAME is a string literal,
+// __FUNCTION__ or std::string
+#define ITT_TASK(NAME) TraceTask task(NAME)
+
+#if defined(ENABLE_ITT)
 #include "ittnotify.h"
 #include <string>
 
-#define ITT_TASK(NAME) ITTTask task(NAME)
-
 class ITTTask {
   public:
     ITTTask(const char *name);
@@ -60,6 +65,7 @@ class ITTTask {
     void taskBegin(const char *name);
     void taskEnd();
 };
+#endif
 
 #else
 
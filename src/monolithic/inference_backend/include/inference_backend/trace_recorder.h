@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Records spans of ITT_TASK scopes into per-thread ring buffers and exports them in Chrome trace event format, which
+ * is opened by Perfetto UI (ui.perfetto.dev) and chrome://tracing.
+ *
+ * Recorder is enabled by GVA_TRACE environment variable holding path of output file ("%p" is replaced by process id)
+ * or by gvatrace tracer. Disabled recorder costs one relaxed atomic load per scope. Enabled recorder keeps names as
+ * pointers to static strings (string literals, __FUNCTION__), so no string is built or hashed per event, and takes
+ * two clock reads and an uncontended lock of calling thread buffer per scope. Each thread keeps its last
+ * GVA_TRACE_BUFFER_SIZE events, older events are overwritten.
+ *
+ * Each event carries stream and frame of the thread context set by TraceFrameScope, so timelines of one frame can be
+ * followed across elements and threads. Every shared library linking logger has own recorder; all of them append
+ * their events to the same file when pipeline stops (Flush() called by inference elements and gvatrace tracer) and
+ * when process exits.
+ */
+class TraceRecorder {
+  public:
+    static constexpr const char *ENV_VARIABLE = "GVA_TRACE";
+    static constexpr const char *BUFFER_SIZE_ENV_VARIABLE = "GVA_TRACE_BUFFER_SIZE";
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 16384;
+    static constexpr uint32_t NO_STREAM = UINT32_MAX;
+    static constexpr uint64_t NO_FRAME = UINT64_MAX;
+
+    struct Event {
+        const char *name;
+        const char *detail;
+        uint64_t begin_ns;
+        uint64_t end_ns;
+        uint64_t frame;
+        uint32_t stream;
+    };
+
+    struct Context {
+        uint32_t stream = NO_STREAM;
+        uint64_t frame = NO_FRAME;
+    };
+
+    // Recorder configured from environment, writes trace on destruction if enabled
+    static TraceRecorder &Instance();
+
+    // Empty path: events are recorded once enabled but only exported on request
+    TraceRecorder(std::string path, size_t buffer_size);
+    ~TraceRecorder();
+
+    TraceRecorder(const TraceRecorder &) = delete;
+    TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+    bool IsEnabled() const {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    void Enable(const std::string &output_path = {});
+    void Disable();
+
+    // name and detail must be static strings or interned with Intern()
+    void Record(const char *name, const char *detail, uint64_t begin_ns, uint64_t end_ns, const Context &context);
+
+    // Returns pointer to copy of name living as long as recorder, for names built at runtime
+    const char *Intern(const std::string &name);
+    // Returns id of stream (e.g. GStreamer stream-id), ids are exported as stream names
+    uint32_t RegisterStream(const std::string &name);
+
+    // Writes recorded events as complete JSON array
+    void WriteChromeTrace(std::ostream &out) const;
+    // Moves recorded events to trace file, which is shared with recorders of other libraries of the process
+    bool Flush();
+    void Clear();
+    // Number of thread buffers, buffers of exited threads are dropped by Flush() and Clear()
+    size_t GetBufferCount() const;
+
+    static uint64_t NowNs();
+    static Context &ThreadContext();
+
+  private:
+    struct ThreadBuffer;
+
+    ThreadBuffer &GetThreadBuffer();
+    // Removes written events if clear is set
+    void WriteEvents(std::ostream &out, bool clear) const;
+    // Called under mutex
+    void DropReleasedBuffers();
+
+    const uint64_t id;
+    const size_t buffer_size;
+    std::atomic<bool> enabled{false};
+
+    mutable std::mutex mutex;
+    std::string path;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::unordered_set<std::string> names;
+    std::vector<std::string> streams;
+};
+
+/**
+ * Sets stream and frame recorded with events of the calling thread until end of scope.
+ */
+class TraceFrameScope {
+  public:
+    TraceFrameScope(uint32_t stream, uint64_t frame) : previous(TraceRecorder::ThreadContext()) {
+        TraceRecorder::ThreadContext() = {stream, frame};
+    }
+    ~TraceFrameScope() {
+        TraceRecorder::ThreadContext() = previous;
+    }
+
+    TraceFrameScope(const TraceFrameScope &) = delete;
+    TraceFrameScope &operator=(const TraceFrameScope &) = delete;
+
+  private:
+    const TraceRecorder::Context previous;
+};
+
+/**
+ * Scope recorded by TraceRecorder and, if built with ENABLE_ITT, reported as ITT task.
+ */
+class TraceTask {
+  public:
+    // String literals and __FUNCTION__ are arrays with static storage, they are recorded by pointer
+    template <size_t N>
+    explicit TraceTask(const char (&name)[N], const char *static_detail = nullptr) {
+        Begin(name, static_detail);
+    }
+    // Name built at runtime is interned
+    explicit TraceTask(const std::string &name);
+    ~TraceTask();
+
+    TraceTask(const TraceTask &) = delete;
+    TraceTask &operator=(const TraceTask &) = delete;
+
+  private:
+    void Begin(const char *name, const char *detail);
+
+    TraceRecorder *recorder = nullptr;
+    const char *name = nullptr;
+    const char *detail = nullptr;
+    uint64_t begin_ns = 0;
+    // ITT task was started, only in builds with ENABLE_ITT
+    bool itt_task = false;
+};
@@ -0,0 +1,408 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/trace_recorder.h"
+
+#include "inference_backend/logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+#include <process.h>
+#endif
+
+namespace {
+
+std::atomic<uint64_t> recorder_ids{0};
+
+uint32_t currentThreadId() {
+#ifdef __linux__
+    // OS thread id is the same for recorders of all libraries of the process
+    return static_cast<uint32_t>(syscall(SYS_gettid));
+#else
+    return static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+#endif
+}
+
+int currentProcessId() {
+#ifdef _WIN32
+    return _getpid();
+#else
+    return getpid();
+#endif
+}
+
+std::string expandPath(std::string path) {
+    const size_t pos = path.find("%p");
+    if (pos != std::string::npos)
+        path.replace(pos, 2, std::to_string(currentProcessId()));
+    return path;
+}
+
+size_t bufferSizeFromEnv() {
+    const char *value = std::getenv(TraceRecorder::BUFFER_SIZE_ENV_VARIABLE);
+    if (value) {
+        const long long size = std::atoll(value);
+        if (size > 0)
+            return static_cast<size_t>(size);
+    }
+    return TraceRecorder::DEFAULT_BUFFER_SIZE;
+}
+
+void writeEscaped(std::ostream &out, const char *str) {
+    for (; *str; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\')
+            out << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            out << ' ';
+        else
+            out << c;
+    }
+}
+
+// Trace event format expects microseconds, nanoseconds are kept as fraction
+void writeMicroseconds(std::ostream &out, uint64_t ns) {
+    const uint64_t fraction = ns % 1000;
+    out << ns / 1000 << '.' << fraction / 100 << (fraction / 10) % 10 << fraction % 10;
+}
+
+// First line of trace file, identifies process which created it
+std::string processHeader() {
+    std::ostringstream header;
+    header << "[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << currentProcessId()
+           << ",\"args\":{\"name\":\"dlstreamer\"}}";
+    return header.str();
+}
+
+// Serializes flushes to trace file. Recorders of other libraries have own mutexes, and pipelines may stop concurrently
+class TraceFileLock {
+  public:
+    explicit TraceFileLock(const std::string &path) {
+#ifdef __linux__
+        fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd >= 0 && flock(fd, LOCK_EX) != 0) {
+            close(fd);
+            fd = -1;
+        }
+#else
+        (void)path;
+#endif
+    }
+    ~TraceFileLock() {
+#ifdef __linux__
+        if (fd >= 0) {
+            flock(fd, LOCK_UN);
+            close(fd);
+        }
+#endif
+    }
+
+    TraceFileLock(const TraceFileLock &) = delete;
+    TraceFileLock &operator=(const TraceFileLock &) = delete;
+
+  private:
+    int fd = -1;
+};
+
+#ifdef ENABLE_ITT
+__itt_domain *ittDomain() {
+    static __itt_domain *domain = __itt_domain_create("video-analytics");
+    return domain;
+}
+
+// Task names are static or interned strings, so handle is looked up by name pointer instead of created per task
+__itt_string_handle *ittStringHandle(const char *name) {
+    thread_local std::unordered_map<const char *, __itt_string_handle *> handles;
+    auto it = handles.find(name);
+    if (it == handles.end())
+        it = handles.emplace(name, __itt_string_handle_create(name)).first;
+    return it->second;
+}
+#endif
+
+} // namespace
+
+struct TraceRecorder::ThreadBuffer {
+    std::mutex mutex;
+    uint32_t tid = 0;
+    std::vector<Event> events;
+    // Position of the oldest event once buffer is full
+    size_t next = 0;
+    // Thread exited (or switched to another recorder), buffer is dropped once its events are written
+    bool released = false;
+};
+
+TraceRecorder &TraceRecorder::Instance() {
+    static TraceRecorder recorder([] {
+        const char *path = std::getenv(ENV_VARIABLE);
+        return std::string(path ? path : "");
+    }(), bufferSizeFromEnv());
+    return recorder;
+}
+
+TraceRecorder::TraceRecorder(std::string output_path, size_t buffer_size)
+    : id(++recorder_ids), buffer_size(std::max<size_t>(buffer_size, 1)) {
+    if (!output_path.empty())
+        Enable(output_path);
+}
+
+TraceRecorder::~TraceRecorder() {
+    if (IsEnabled())
+        Flush();
+}
+
+void TraceRecorder::Enable(const std::string &output_path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!output_path.empty())
+        path = expandPath(output_path);
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void TraceRecorder::Disable() {
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+uint64_t TraceRecorder::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+TraceRecorder::Context &TraceRecorder::ThreadContext() {
+    thread_local Context context;
+    return context;
+}
+
+TraceRecorder::ThreadBuffer &TraceRecorder::GetThreadBuffer() {
+    // Buffer of the calling thread is cached, recorder id tells which recorder it belongs to. Owner marks buffer
+    // released on thread exit, so buffers of short-living threads don't accumulate in recorder
+    thread_local struct Owner {
+        uint64_t recorder_id = 0;
+        std::shared_ptr<ThreadBuffer> buffer;
+
+        void Release() {
+            if (!buffer)
+                return;
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->released = true;
+        }
+        ~Owner() {
+            Release();
+        }
+    } cache;
+
+    if (cache.recorder_id != id) {
+        cache.Release();
+        auto buffer = std::make_shared<ThreadBuffer>();
+        buffer->tid = currentThreadId();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers.push_back(buffer);
+        }
+        cache.buffer = std::move(buffer);
+        cache.recorder_id = id;
+    }
+    return *cache.buffer;
+}
+
+void TraceRecorder::Record(const char *name, const char *detail, uint64_t begin_ns, uint64_t end_ns,
+                           const Context &context) {
+    ThreadBuffer &buffer = GetThreadBuffer();
+    const Event event = {name, detail, begin_ns, end_ns, context.frame, context.stream};
+
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    // Buffer grows up to its size, so short-living threads don't reserve memory for the whole ring
+    if (buffer.events.size() < buffer_size) {
+        buffer.events.push_back(event);
+        return;
+    }
+    buffer.events[buffer.next] = event;
+    buffer.next = (buffer.next + 1) % buffer_size;
+}
+
+const char *TraceRecorder::Intern(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Node based set doesn't move its elements on rehash
+    return names.insert(name).first->c_str();
+}
+
+uint32_t TraceRecorder::RegisterStream(const std::string &name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = std::find(streams.begin(), streams.end(), name);
+    if (it != streams.end())
+        return static_cast<uint32_t>(it - streams.begin());
+    streams.push_back(name);
+    return static_cast<uint32_t>(streams.size() - 1);
+}
+
+void TraceRecorder::Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &buffer : buffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        buffer->events.clear();
+        buffer->next = 0;
+    }
+    DropReleasedBuffers();
+}
+
+size_t TraceRecorder::GetBufferCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return buffers.size();
+}
+
+void TraceRecorder::DropReleasedBuffers() {
+    buffers.erase(std::remove_if(buffers.begin(), buffers.end(),
+                                 [](const std::shared_ptr<ThreadBuffer> &buffer) {
+                                     std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+                                     return buffer->released && buffer->events.empty();
+                                 }),
+                  buffers.end());
+}
+
+// Each event is written as ",\n{...}", so events of several recorders can be appended one after another
+void TraceRecorder::WriteEvents(std::ostream &out, bool clear) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const int pid = currentProcessId();
+
+    for (const auto &buffer : buffers) {
+        std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+        const size_t count = buffer->events.size();
+        for (size_t i = 0; i < count; ++i) {
+            const Event &event = buffer->events[(buffer->next + i) % count];
+            // Complete event, timestamps are microseconds
+            out << ",\n{\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"cat\":\"gva\",\"ph\":\"X\",\"ts\":";
+            writeMicroseconds(out, event.begin_ns);
+            out << ",\"dur\":";
+            writeMicroseconds(out, event.end_ns - event.begin_ns);
+            out << ",\"pid\":" << pid << ",\"tid\":" << buffer->tid << ",\"args\":{";
+
+            const char *separator = "";
+            if (event.stream != NO_STREAM && event.stream < streams.size()) {
+                out << "\"stream\":\"";
+                writeEscaped(out, streams[event.stream].c_str());
+                out << '"';
+                separator = ",";
+            }
+            if (event.frame != NO_FRAME) {
+                out << separator << "\"frame\":" << event.frame;
+                separator = ",";
+            }
+            if (event.detail) {
+                out << separator << "\"detail\":\"";
+                writeEscaped(out, event.detail);
+                out << '"';
+            }
+            out << "}}";
+        }
+        // Cleared under the same lock, so events recorded meanwhile are kept for the next flush
+        if (clear) {
+            buffer->events.clear();
+            buffer->next = 0;
+        }
+    }
+}
+
+void TraceRecorder::WriteChromeTrace(std::ostream &out) const {
+    out << processHeader();
+    WriteEvents(out, false);
+    out << "\n]\n";
+}
+
+bool TraceRecorder::Flush() {
+    std::string file_path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        file_path = path;
+    }
+    if (file_path.empty())
+        return false;
+
+    TraceFileLock file_lock(file_path);
+    // File started by this process is continued: its closing bracket is overwritten by appended events. Otherwise
+    // (file of previous run) it is replaced.
+    const std::string header = processHeader();
+    std::fstream file(file_path, std::ios::in | std::ios::out | std::ios::binary);
+    std::string first_line;
+    if (file && std::getline(file, first_line) && first_line.compare(0, header.size(), header) == 0) {
+        static const std::string closing = "\n]\n";
+        std::string tail(closing.size(), '\0');
+        file.seekg(-static_cast<std::streamoff>(closing.size()), std::ios::end);
+        file.read(&tail[0], tail.size());
+        file.clear();
+        if (tail == closing)
+            file.seekp(-static_cast<std::streamoff>(closing.size()), std::ios::end);
+        else
+            file.seekp(0, std::ios::end);
+    } else {
+        file.close();
+        file.open(file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+        file << header;
+    }
+    if (!file) {
+        GVA_WARNING("Couldn't write trace to '%s'", file_path.c_str());
+        return false;
+    }
+
+    // Written events are not repeated by the next flush
+    WriteEvents(file, true);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        DropReleasedBuffers();
+    }
+    file << "\n]\n";
+    return static_cast<bool>(file);
+}
+
+TraceTask::TraceTask(const std::string &name) {
+    TraceRecorder &trace_recorder = TraceRecorder::Instance();
+#ifdef ENABLE_ITT
+    Begin(trace_recorder.Intern(name), nullptr);
+#else
+    if (trace_recorder.IsEnabled())
+        Begin(trace_recorder.Intern(name), nullptr);
+#endif
+}
+
+void TraceTask::Begin(const char *task_name, const char *task_detail) {
+#ifdef ENABLE_ITT
+    __itt_domain *domain = ittDomain();
+    if (domain) {
+        __itt_task_begin(domain, __itt_null, __itt_null, ittStringHandle(task_name));
+        itt_task = true;
+    }
+#endif
+    TraceRecorder &trace_recorder = TraceRecorder::Instance();
+    if (!trace_recorder.IsEnabled())
+        return;
+    recorder = &trace_recorder;
+    name = task_name;
+    detail = task_detail;
+    begin_ns = TraceRecorder::NowNs();
+}
+
+TraceTask::~TraceTask() {
+    if (recorder)
+        recorder->Record(name, detail, begin_ns, TraceRecorder::NowNs(), TraceRecorder::ThreadContext());
+#ifdef ENABLE_ITT
+    if (itt_task)
+        __itt_task_end(ittDomain());
+#endif
+}
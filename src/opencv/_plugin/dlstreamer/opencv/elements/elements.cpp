@@ -12,6 +12,7 @@
 #include "opencv_remove_background.h"
 #include "opencv_tensor_normalize.h"
 #include "opencv_warp_affine.h"
+#include "roi_cropscale_batch.h"
 #include "tensor_postproc_human_pose.h"
 
 extern "C" {
@@ -22,6 +23,7 @@ DLS_EXPORT const dlstreamer::ElementDesc *dlstreamer_elements[] = { //
     &opencv_object_association,
     &opencv_tensor_normalize,
     &opencv_cropscale,
+    &roi_cropscale_batch,
     &opencv_meta_overlay,
     &opencv_remove_background,
     &tensor_postproc_human_pose,
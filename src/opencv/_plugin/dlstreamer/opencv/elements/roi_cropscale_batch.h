@@ -0,0 +1,12 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "dlstreamer/transform.h"
+
+extern "C" {
+
+extern dlstreamer::ElementDesc roi_cropscale_batch;
+}
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "dlstreamer/opencv/elements/roi_cropscale_batch.h"
+#include "dlstreamer/base/transform.h"
+#include "dlstreamer/cpu/context.h"
+#include "dlstreamer/cpu/frame_alloc.h"
+#include "dlstreamer/image_metadata.h"
+#include "dlstreamer/memory_mapper_factory.h"
+#include "dlstreamer/opencv/context.h"
+#include "dlstreamer/opencv/tensor.h"
+#include "dlstreamer/utils.h"
+#include <opencv2/core/utility.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace dlstreamer {
+
+namespace param {
+
+static constexpr auto add_borders = "add-borders"; // aspect-ratio
+static constexpr auto object_class = "object-class";
+
+}; // namespace param
+
+static ParamDescVector params_desc = {
+    {param::add_borders, "Add borders if necessary to keep the aspect ratio", false},
+    {param::object_class,
+     "Filter ROI list by object class(es) (comma separated list if multiple). Process only ROIs with specified "
+     "object class(es)",
+     std::string()},
+};
+
+class RoiCropscaleBatch : public BaseTransform {
+  public:
+    RoiCropscaleBatch(DictionaryCPtr params, const ContextPtr &app_context)
+        : BaseTransform(app_context) {
+        _aspect_ratio = params->get<bool>(param::add_borders, false);
+        auto object_class = params->get<std::string>(param::object_class, std::string());
+        if (!object_class.empty())
+            _object_classes = split_string(object_class, ',');
+    }
+
+    bool init_once() override {
+        auto cpu_context = std::make_shared<CPUContext>();
+        auto opencv_context = std::make_shared<OpenCVContext>();
+        _opencv_mapper = create_mapper({_app_context, cpu_context, opencv_context});
+        return true;
+    }
+
+    std::function<FramePtr()> get_output_allocator() override {
+        return [this]() { return std::make_shared<CPUFrameAlloc>(_output_info); };
+    }
+
+    // Frame with more ROIs than batch size is processed into several batches: GStreamer element calls process() with
+    // same frame until it returns nullptr (ELEMENT_FLAG_MULTIPLE_OUTPUTS)
+    FramePtr process(FramePtr src) override {
+        DLS_CHECK(init());
+        if (src != _src) {
+            _src = src;
+            _rois = collect_rois(*src);
+            _next_roi = 0;
+        }
+        if (_next_roi >= _rois.size()) { // no ROIs or all ROIs processed
+            _src = nullptr;
+            _rois.clear();
+            return nullptr;
+        }
+
+        auto dst = create_output();
+        auto dst_tensor = dst->tensor(0);
+        ImageInfo dst_info(dst_tensor->info());
+        const auto layout = dst_info.layout();
+        if (layout != ImageLayout::NCHW && layout != ImageLayout::NHWC)
+            throw std::runtime_error("Expect output tensor with NCHW or NHWC layout, got " + layout.to_string());
+        const bool planar = layout == ImageLayout::NCHW;
+        const int batch_size = dst_info.batch();
+        const int dst_w = dst_info.width();
+        const int dst_h = dst_info.height();
+        const int channels = dst_info.channels();
+
+        const size_t first_roi = _next_roi;
+        const size_t num_rois = std::min(_rois.size() - first_roi, static_cast<size_t>(batch_size));
+        _next_roi += num_rois;
+        const bool last_batch = _next_roi == _rois.size();
+
+        auto src_tensor = ptr_cast<OpenCVTensor>(_opencv_mapper->map(src->tensor(0), AccessMode::Read));
+        cv::Mat src_mat = *src_tensor;
+        if (channels > src_mat.channels())
+            throw std::runtime_error("Output tensor has more channels than input image");
+
+        uint8_t *dst_data = dst_tensor->data<uint8_t>();
+        const size_t slot_size = dst_tensor->info().nbytes() / batch_size;
+        std::vector<cv::Rect> dst_rects(num_rois);
+
+        // Each ROI is resized straight into its slot of batch tensor, unused slots are zero-filled
+        cv::parallel_for_(cv::Range(0, batch_size), [&](const cv::Range &range) {
+            for (int i = range.start; i < range.end; i++) {
+                uint8_t *slot = dst_data + i * slot_size;
+                if (static_cast<size_t>(i) >= num_rois) {
+                    std::memset(slot, 0, slot_size);
+                    continue;
+                }
+
+                const cv::Rect &src_rect = _rois[first_roi + i].rect;
+                cv::Rect dst_rect = {0, 0, dst_w, dst_h};
+                if (_aspect_ratio) {
+                    double scale_x = static_cast<double>(dst_rect.width) / src_rect.width;
+                    double scale_y = static_cast<double>(dst_rect.height) / src_rect.height;
+                    double scale = std::min(scale_x, scale_y);
+                    dst_rect.width = std::max(static_cast<int>(src_rect.width * scale), 1);
+                    dst_rect.height = std::max(static_cast<int>(src_rect.height * scale), 1);
+                    std::memset(slot, 0, slot_size);
+                }
+                dst_rects[i] = dst_rect;
+
+                resize_to_slot(src_mat(src_rect), slot, planar, dst_w, dst_h, channels, dst_rect);
+            }
+        });
+
+        const double src_w = src_mat.cols;
+        const double src_h = src_mat.rows;
+        for (size_t i = 0; i < num_rois; i++) {
+            const Roi &roi = _rois[first_roi + i];
+            // Store metadata with coefficients for dst<>frame coordinates conversion of batch item
+            auto affine_meta = dst->metadata().add(AffineTransformInfoMetadata::name);
+            AffineTransformInfoMetadata(affine_meta).set_rect(src_w, src_h, dst_w, dst_h, roi.rect, dst_rects[i]);
+
+            // Batch item to ROI mapping, used by batch_split to push inference result of each ROI separately
+            auto source_meta = dst->metadata().add(SourceIdentifierMetadata::name);
+            source_meta->set(SourceIdentifierMetadata::key::batch_index, static_cast<int>(i));
+            source_meta->set(SourceIdentifierMetadata::key::roi_id, roi.roi_id);
+            source_meta->set(SourceIdentifierMetadata::key::object_id, roi.object_id);
+            source_meta->set(SourceIdentifierMetadata::key::last_roi, last_batch && i == num_rois - 1);
+        }
+
+        return dst;
+    }
+
+  private:
+    struct Roi {
+        cv::Rect rect;
+        int roi_id;
+        int object_id;
+    };
+
+    std::vector<Roi> collect_rois(Frame &src) {
+        ImageInfo src_info(src.tensor(0)->info());
+        const cv::Rect frame_rect(0, 0, src_info.width(), src_info.height());
+
+        std::vector<Roi> rois;
+        for (auto &region : src.regions()) {
+            auto detection_meta = find_metadata<DetectionMetadata>(*region);
+            if (!detection_meta)
+                continue;
+            if (!_object_classes.empty() &&
+                std::find(_object_classes.begin(), _object_classes.end(), detection_meta->label()) ==
+                    _object_classes.end())
+                continue;
+
+            auto region_tensor = region->tensor(0);
+            ImageInfo region_info(region_tensor->info());
+            int x = region_tensor->handle(tensor::key::offset_x, 0);
+            int y = region_tensor->handle(tensor::key::offset_y, 0);
+            cv::Rect rect(x, y, region_info.width(), region_info.height());
+            rect &= frame_rect;
+            if (rect.empty())
+                continue;
+
+            auto object_id_meta = find_metadata<ObjectIdMetadata>(*region);
+            rois.push_back({rect, detection_meta->id(), object_id_meta ? object_id_meta->id() : 0});
+        }
+        return rois;
+    }
+
+    // Resizes crop into batch slot of width x height image, converts to planar layout or drops channels if needed
+    static void resize_to_slot(const cv::Mat &crop, uint8_t *slot, bool planar, int width, int height, int channels,
+                               const cv::Rect &dst_rect) {
+        if (!planar && crop.channels() == channels) {
+            cv::Mat dst_mat(height, width, CV_8UC(channels), slot);
+            cv::resize(crop, dst_mat(dst_rect), dst_rect.size());
+            return;
+        }
+
+        cv::Mat resized;
+        cv::resize(crop, resized, dst_rect.size());
+        std::vector<cv::Mat> dst_mats;
+        if (planar) {
+            for (int c = 0; c < channels; c++)
+                dst_mats.push_back(cv::Mat(height, width, CV_8UC1, slot + c * width * height)(dst_rect));
+        } else {
+            dst_mats.push_back(cv::Mat(height, width, CV_8UC(channels), slot)(dst_rect));
+        }
+        std::vector<int> from_to;
+        for (int c = 0; c < channels; c++) {
+            from_to.push_back(c);
+            from_to.push_back(c);
+        }
+        cv::mixChannels(std::vector<cv::Mat>{resized}, dst_mats, from_to);
+    }
+
+    MemoryMapperPtr _opencv_mapper;
+    bool _aspect_ratio = false;
+    std::vector<std::string> _object_classes;
+    // Frame being processed, its ROIs and first ROI of next batch
+    FramePtr _src;
+    std::vector<Roi> _rois;
+    size_t _next_roi = 0;
+};
+
+extern "C" {
+ElementDesc roi_cropscale_batch = {
+    .name = "roi_cropscale_batch",
+    .description = "Crop and scale all ROIs of frame into one batched tensor on OpenCV backend",
+    .author = "Intel Corporation",
+    .params = &params_desc,
+    .input_info = MAKE_FRAME_INFO_VECTOR({
+        {ImageFormat::RGB},
+        {ImageFormat::BGR},
+        {ImageFormat::RGBX},
+        {ImageFormat::BGRX},
+    }),
+    .output_info = MAKE_FRAME_INFO_VECTOR({FrameInfo(MediaType::Tensors, MemoryType::CPU, {{{}, DataType::UInt8}})}),
+    .create = create_element<RoiCropscaleBatch>,
+    .flags = ELEMENT_FLAG_MULTIPLE_OUTPUTS};
+}
+
+} // namespace dlstreamer
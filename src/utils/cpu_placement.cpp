@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "cpu_placement.h"
+
+#include "inference_backend/logger.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace CpuPlacement {
+
+namespace {
+
+constexpr const char *NODE_SYSFS_DIR = "/sys/devices/system/node";
+
+std::string trim(const std::string &str) {
+    const auto begin = str.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos)
+        return std::string();
+    const auto end = str.find_last_not_of(" \t\r\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+unsigned parseNumber(const std::string &str, const std::string &list) {
+    if (str.empty() || str.find_first_not_of("0123456789") != std::string::npos)
+        throw std::invalid_argument("Malformed CPU list: '" + list + "'");
+    return static_cast<unsigned>(std::stoul(str));
+}
+
+std::string readFile(const std::string &path) {
+    std::ifstream file(path);
+    if (!file)
+        return std::string();
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+std::string envOrEmpty(const char *name) {
+    const char *value = std::getenv(name);
+    return value ? value : "";
+}
+
+} // namespace
+
+std::vector<unsigned> parseCpuList(const std::string &list) {
+    std::vector<unsigned> cpus;
+    std::stringstream stream(trim(list));
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        range = trim(range);
+        const auto dash = range.find('-');
+        if (dash == std::string::npos) {
+            cpus.push_back(parseNumber(range, list));
+            continue;
+        }
+        const unsigned first = parseNumber(range.substr(0, dash), list);
+        const unsigned last = parseNumber(range.substr(dash + 1), list);
+        if (first > last)
+            throw std::invalid_argument("Malformed CPU list: '" + list + "'");
+        for (unsigned cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::string formatCpuList(const std::vector<unsigned> &cpus) {
+    std::string result;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+            ++j;
+        if (!result.empty())
+            result += ',';
+        result += std::to_string(cpus[i]);
+        if (j > i)
+            result += '-' + std::to_string(cpus[j]);
+        i = j + 1;
+    }
+    return result;
+}
+
+std::map<std::string, std::string> parseConfig(const std::string &text) {
+    std::map<std::string, std::string> policies;
+    std::stringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+        const auto eq = line.find('=');
+        if (eq == std::string::npos)
+            throw std::invalid_argument("Expected '<group> = <policy>' in CPU placement config, got: '" + line + "'");
+        policies[trim(line.substr(0, eq))] = trim(line.substr(eq + 1));
+    }
+    return policies;
+}
+
+Topology Topology::detect() {
+    Topology topology;
+#ifdef __linux__
+    // CPUs outside of process mask (cgroups, taskset) are excluded
+    const std::vector<unsigned> allowed = currentThreadCpus();
+    std::map<unsigned, std::vector<unsigned>> nodes;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(NODE_SYSFS_DIR, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+            name.find_first_not_of("0123456789", 4) != std::string::npos)
+            continue;
+        std::vector<unsigned> cpus;
+        try {
+            cpus = parseCpuList(readFile((entry.path() / "cpulist").string()));
+        } catch (const std::invalid_argument &) {
+            continue;
+        }
+        std::vector<unsigned> usable;
+        std::set_intersection(cpus.begin(), cpus.end(), allowed.begin(), allowed.end(), std::back_inserter(usable));
+        if (!usable.empty())
+            nodes[static_cast<unsigned>(std::stoul(name.substr(4)))] = std::move(usable);
+    }
+    for (auto &node : nodes)
+        topology.nodes.push_back(std::move(node.second));
+    if (topology.nodes.empty() && !allowed.empty())
+        topology.nodes.push_back(allowed);
+#endif
+    if (topology.nodes.empty()) {
+        std::vector<unsigned> cpus(std::max(1u, std::thread::hardware_concurrency()));
+        for (size_t i = 0; i < cpus.size(); ++i)
+            cpus[i] = static_cast<unsigned>(i);
+        topology.nodes.push_back(std::move(cpus));
+    }
+    return topology;
+}
+
+Placer &Placer::Instance() {
+    static Placer placer = []() {
+        std::map<std::string, std::string> group_policies;
+        const std::string config_path = envOrEmpty(FILE_ENV_VARIABLE);
+        if (!config_path.empty()) {
+            std::ifstream file(config_path);
+            if (!file)
+                GVA_WARNING("Couldn't read CPU placement config '%s'", config_path.c_str());
+            else
+                group_policies = parseConfig(readFile(config_path));
+        }
+        return Placer(Topology::detect(), envOrEmpty(POLICY_ENV_VARIABLE), std::move(group_policies));
+    }();
+    return placer;
+}
+
+Placer::Placer(Topology topology, std::string default_policy, std::map<std::string, std::string> group_policies)
+    : _topology(std::move(topology)), _default_policy(std::move(default_policy)),
+      _group_policies(std::move(group_policies)) {
+}
+
+Placement Placer::place(const std::string &group, const std::string &element_policy) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _placements.find(group);
+    if (it != _placements.end())
+        return it->second;
+
+    std::string policy = element_policy;
+    if (policy.empty()) {
+        auto group_policy = _group_policies.find(group);
+        policy = group_policy != _group_policies.end() ? group_policy->second : _default_policy;
+    }
+
+    Placement placement = resolve(trim(policy));
+    GVA_INFO("CPU placement of '%s': %s", group.c_str(), placement.description.c_str());
+    _order.push_back(group);
+    return _placements[group] = placement;
+}
+
+Placement Placer::resolve(const std::string &policy) {
+    Placement placement;
+    if (policy.empty() || policy == "none") {
+        placement.description = "not pinned";
+        return placement;
+    }
+
+    if (policy == "auto") {
+        if (_topology.nodes.size() < 2) {
+            placement.description = "not pinned (single NUMA node)";
+            return placement;
+        }
+        placement.node = static_cast<int>(_next_auto_node++ % _topology.nodes.size());
+    } else if (policy.rfind("numa:", 0) == 0) {
+        const std::string node = policy.substr(5);
+        if (node.empty() || node.find_first_not_of("0123456789") != std::string::npos ||
+            std::stoul(node) >= _topology.nodes.size())
+            throw std::invalid_argument("Invalid NUMA node in CPU placement policy '" + policy + "', system has " +
+                                        std::to_string(_topology.nodes.size()) + " node(s)");
+        placement.node = std::stoi(node);
+    } else if (policy.rfind("cores:", 0) == 0) {
+        placement.cpus = parseCpuList(policy.substr(6));
+        if (placement.cpus.empty())
+            throw std::invalid_argument("Empty CPU list in CPU placement policy '" + policy + "'");
+        placement.description = "cores " + formatCpuList(placement.cpus);
+        return placement;
+    } else {
+        throw std::invalid_argument("Unknown CPU placement policy '" + policy +
+                                    "', expected one of: none, auto, numa:<node>, cores:<list>");
+    }
+
+    placement.cpus = _topology.nodes[placement.node];
+    placement.description =
+        "NUMA node " + std::to_string(placement.node) + " (cores " + formatCpuList(placement.cpus) + ")";
+    return placement;
+}
+
+std::vector<std::string> Placer::report() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::string> lines;
+    lines.reserve(_order.size());
+    for (const auto &group : _order)
+        lines.push_back(group + ": " + _placements.at(group).description);
+    return lines;
+}
+
+std::vector<unsigned> currentThreadCpus() {
+    std::vector<unsigned> cpus;
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(mask), &mask) != 0)
+        return cpus;
+    for (unsigned cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &mask))
+            cpus.push_back(cpu);
+    }
+#endif
+    return cpus;
+}
+
+bool pinCurrentThread(const std::vector<unsigned> &cpus) {
+#ifdef __linux__
+    if (cpus.empty())
+        return false;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (unsigned cpu : cpus) {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &mask);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+ScopedThreadAffinity::ScopedThreadAffinity(const std::vector<unsigned> &cpus) {
+    if (cpus.empty())
+        return;
+    _previous = currentThreadCpus();
+    _pinned = !_previous.empty() && pinCurrentThread(cpus);
+    if (!_pinned)
+        GVA_WARNING("Couldn't pin thread to cores %s", formatCpuList(cpus).c_str());
+}
+
+ScopedThreadAffinity::~ScopedThreadAffinity() {
+    if (_pinned)
+        pinCurrentThread(_previous);
+}
+
+} // namespace CpuPlacement
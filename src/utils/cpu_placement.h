@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Placement of threads of a stream group (elements sharing one model instance) on CPU cores. Policy is one of:
+ *
+ *   none         - threads are not pinned
+ *   auto         - groups are assigned to NUMA nodes round-robin in order of their creation, no pinning on
+ *                  single-node systems
+ *   numa:<node>  - all CPUs of NUMA node
+ *   cores:<list> - CPUs listed as in /sys cpulist format, for example cores:0-7,16-23
+ *
+ * Policy of element (cpu-placement property) has priority over group policy from file set by GVA_CPU_PLACEMENT_FILE
+ * (lines "<group> = <policy>", '#' starts comment), which has priority over default policy from GVA_CPU_PLACEMENT.
+ * Same group always gets the same placement.
+ */
+namespace CpuPlacement {
+
+constexpr const char *POLICY_ENV_VARIABLE = "GVA_CPU_PLACEMENT";
+constexpr const char *FILE_ENV_VARIABLE = "GVA_CPU_PLACEMENT_FILE";
+
+// Parses list like "0-3,8,10-11", throws std::invalid_argument on malformed list
+std::vector<unsigned> parseCpuList(const std::string &list);
+std::string formatCpuList(const std::vector<unsigned> &cpus);
+
+// Parses "<group> = <policy>" lines
+std::map<std::string, std::string> parseConfig(const std::string &text);
+
+struct Topology {
+    // CPUs of each NUMA node, single node with all CPUs if NUMA information is unavailable
+    std::vector<std::vector<unsigned>> nodes;
+
+    static Topology detect();
+};
+
+struct Placement {
+    std::vector<unsigned> cpus; // empty if threads are not pinned
+    int node = -1;              // NUMA node or -1 if CPUs are set explicitly or not pinned
+    std::string description;
+};
+
+class Placer {
+  public:
+    // Detected topology, policies from environment
+    static Placer &Instance();
+
+    Placer(Topology topology, std::string default_policy, std::map<std::string, std::string> group_policies);
+
+    // Throws std::invalid_argument on unknown policy or NUMA node
+    Placement place(const std::string &group, const std::string &element_policy = std::string());
+
+    // Chosen placements as "<group>: <description>" lines
+    std::vector<std::string> report() const;
+
+  private:
+    Placement resolve(const std::string &policy);
+
+    const Topology _topology;
+    const std::string _default_policy;
+    const std::map<std::string, std::string> _group_policies;
+
+    mutable std::mutex _mutex;
+    std::map<std::string, Placement> _placements;
+    std::vector<std::string> _order;
+    size_t _next_auto_node = 0;
+};
+
+// Returns empty list if affinity can't be read on this platform
+std::vector<unsigned> currentThreadCpus();
+
+// Returns false if affinity can't be set on this platform or call failed
+bool pinCurrentThread(const std::vector<unsigned> &cpus);
+
+/**
+ * Pins current thread for the lifetime of object and restores previous affinity. Threads created meanwhile inherit
+ * affinity, so OpenVINO executor and post-processing threads created during model compilation stay on placed CPUs.
+ * Does nothing if list of CPUs is empty.
+ */
+class ScopedThreadAffinity {
+  public:
+    explicit ScopedThreadAffinity(const std::vector<unsigned> &cpus);
+    ~ScopedThreadAffinity();
+
+    bool pinned() const {
+        return _pinned;
+    }
+
+    ScopedThreadAffinity(const ScopedThreadAffinity &) = delete;
+    ScopedThreadAffinity &operator=(const ScopedThreadAffinity &) = delete;
+
+  private:
+    std::vector<unsigned> _previous;
+    bool _pinned = false;
+};
+
+} // namespace CpuPlacement
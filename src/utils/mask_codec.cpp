@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "mask_codec.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MASK_CODEC_SSE2
+#endif
+
+namespace MaskCodec {
+
+namespace {
+
+void putVarint(std::vector<uint8_t> &out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v) | 0x80);
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+uint64_t getVarint(const uint8_t *data, size_t size, size_t &pos) {
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64 && pos < size; shift += 7) {
+        uint8_t b = data[pos++];
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            return v;
+    }
+    throw std::invalid_argument("Malformed run-length encoded mask");
+}
+
+// Returns end of run of elements equal to data[begin]
+template <typename T>
+size_t runEnd(const T *data, size_t begin, size_t size) {
+    const T value = data[begin];
+    size_t i = begin + 1;
+#ifdef MASK_CODEC_SSE2
+    // Compare 16 bytes at once, equality of all 32-bit lanes means equality of all elements
+    const __m128i pattern = sizeof(T) == 8 ? _mm_set1_epi64x(static_cast<int64_t>(value))
+                                           : _mm_set1_epi32(static_cast<int32_t>(value));
+    constexpr size_t step = 16 / sizeof(T);
+    for (; i + step <= size; i += step) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(chunk, pattern)) != 0xFFFF)
+            break;
+    }
+#endif
+    while (i < size && data[i] == value)
+        i++;
+    return i;
+}
+
+template <typename T>
+std::vector<uint8_t> encodeRleImpl(const T *data, size_t size) {
+    std::vector<uint8_t> out;
+    // Segmentation masks are mostly large uniform areas, a few bytes per row is typical
+    out.reserve(std::min<size_t>(size, 256));
+    for (size_t begin = 0; begin < size;) {
+        size_t end = runEnd(data, begin, size);
+        int64_t value = static_cast<int64_t>(data[begin]);
+        putVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        putVarint(out, end - begin);
+        begin = end;
+    }
+    return out;
+}
+
+} // namespace
+
+std::vector<uint8_t> packBits(const float *data, size_t size, float threshold) {
+    std::vector<uint8_t> bits((size + 7) / 8, 0);
+    size_t i = 0;
+#ifdef MASK_CODEC_SSE2
+    const __m128 thr = _mm_set1_ps(threshold);
+    for (; i + 8 <= size; i += 8) {
+        int low = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(data + i), thr));
+        int high = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(data + i + 4), thr));
+        bits[i / 8] = static_cast<uint8_t>(low | (high << 4));
+    }
+#endif
+    for (; i < size; i++) {
+        if (data[i] > threshold)
+            bits[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+    }
+    return bits;
+}
+
+void unpackBits(const uint8_t *bits, size_t bits_size, float *dst, size_t size) {
+    if (bits_size < (size + 7) / 8)
+        throw std::invalid_argument("Bitmask is too short: " + std::to_string(bits_size) + " bytes for " +
+                                    std::to_string(size) + " elements");
+    size_t full_bytes = size / 8;
+    // Fixed inner loop is vectorized by compiler
+    for (size_t k = 0; k < full_bytes; k++) {
+        const uint8_t b = bits[k];
+        float *out = dst + k * 8;
+        for (int j = 0; j < 8; j++)
+            out[j] = static_cast<float>((b >> j) & 1);
+    }
+    for (size_t i = full_bytes * 8; i < size; i++)
+        dst[i] = static_cast<float>((bits[i / 8] >> (i % 8)) & 1);
+}
+
+std::vector<uint8_t> encodeRle(const int64_t *data, size_t size) {
+    return encodeRleImpl(data, size);
+}
+
+std::vector<uint8_t> encodeRle(const int32_t *data, size_t size) {
+    return encodeRleImpl(data, size);
+}
+
+void decodeRle(const uint8_t *rle, size_t rle_size, int64_t *dst, size_t size) {
+    size_t pos = 0;
+    size_t filled = 0;
+    while (pos < rle_size) {
+        uint64_t zigzag = getVarint(rle, rle_size, pos);
+        uint64_t length = getVarint(rle, rle_size, pos);
+        if (length > size - filled)
+            throw std::invalid_argument("Run-length encoded mask exceeds " + std::to_string(size) + " elements");
+        int64_t value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        std::fill_n(dst + filled, length, value);
+        filled += length;
+    }
+    if (filled != size)
+        throw std::invalid_argument("Run-length encoded mask has " + std::to_string(filled) + " elements, expected " +
+                                    std::to_string(size));
+}
+
+std::vector<std::pair<int64_t, uint64_t>> decodeRleRuns(const uint8_t *rle, size_t rle_size) {
+    std::vector<std::pair<int64_t, uint64_t>> runs;
+    size_t pos = 0;
+    while (pos < rle_size) {
+        uint64_t zigzag = getVarint(rle, rle_size, pos);
+        uint64_t length = getVarint(rle, rle_size, pos);
+        runs.emplace_back(static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1), length);
+    }
+    return runs;
+}
+
+} // namespace MaskCodec
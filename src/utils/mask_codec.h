@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * Compact encodings of segmentation masks stored in tensor metadata. Encoding is specified by tensor field "encoding",
+ * encoded bytes are stored as tensor data with U8 precision, while "dims" keep dimensions of decoded mask.
+ *
+ *   bitmask - binary instance mask, one bit per element in row-major order: bit i of byte k is element 8 * k + i
+ *             (same as numpy.packbits(mask, bitorder="little")). Element is set if its value is above threshold.
+ *   rle     - class index mask as runs of equal values in row-major order. Each run is zigzag-encoded LEB128 varint
+ *             value followed by unsigned LEB128 varint run length. First of "dims" is batch dimension of model output,
+ *             encoded mask holds elements of one frame.
+ */
+namespace MaskCodec {
+
+constexpr const char *ENCODING_FIELD = "encoding";
+constexpr const char *BITMASK = "bitmask";
+constexpr const char *RLE = "rle";
+
+constexpr float DEFAULT_THRESHOLD = 0.5f;
+
+/**
+ * Packs mask of probabilities to bits.
+ *
+ * @param data mask values.
+ * @param size number of mask elements.
+ * @param threshold element is set if its value is greater than threshold.
+ * @return (size + 7) / 8 bytes of packed mask.
+ */
+std::vector<uint8_t> packBits(const float *data, size_t size, float threshold = DEFAULT_THRESHOLD);
+
+/**
+ * Unpacks bitmask to 0.0f/1.0f values.
+ *
+ * @exception std::invalid_argument if bitmask is too short for requested number of elements.
+ */
+void unpackBits(const uint8_t *bits, size_t bits_size, float *dst, size_t size);
+
+std::vector<uint8_t> encodeRle(const int64_t *data, size_t size);
+std::vector<uint8_t> encodeRle(const int32_t *data, size_t size);
+
+/**
+ * Expands run-length encoded mask.
+ *
+ * @exception std::invalid_argument if encoded data is malformed or its runs don't sum up to size.
+ */
+void decodeRle(const uint8_t *rle, size_t rle_size, int64_t *dst, size_t size);
+
+/**
+ * Returns runs of encoded mask as (value, length) pairs without expanding them.
+ *
+ * @exception std::invalid_argument if encoded data is malformed.
+ */
+std::vector<std::pair<int64_t, uint64_t>> decodeRleRuns(const uint8_t *rle, size_t rle_size);
+
+} // namespace MaskCodec
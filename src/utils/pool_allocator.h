@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * Free list of memory blocks of one size. Size is fixed by the first allocation, requests of other sizes are served
+ * from heap. Freed blocks are kept for reuse up to max_cached blocks.
+ */
+class BlockPool {
+  public:
+    explicit BlockPool(size_t max_cached) : _max_cached(max_cached) {
+        _free_blocks.reserve(max_cached);
+    }
+
+    ~BlockPool() {
+        for (void *block : _free_blocks)
+            ::operator delete(block);
+    }
+
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    void *allocate(size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_block_size)
+                _block_size = size;
+            if (size == _block_size && !_free_blocks.empty()) {
+                void *block = _free_blocks.back();
+                _free_blocks.pop_back();
+                return block;
+            }
+        }
+        return ::operator new(size);
+    }
+
+    void deallocate(void *block, size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (size == _block_size && _free_blocks.size() < _max_cached) {
+                _free_blocks.push_back(block);
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    size_t cached() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _free_blocks.size();
+    }
+
+  private:
+    mutable std::mutex _mutex;
+    std::vector<void *> _free_blocks;
+    size_t _block_size = 0;
+    const size_t _max_cached;
+};
+
+/**
+ * Allocator backed by BlockPool. Intended for std::allocate_shared, so object and its control block take one pooled
+ * block. Pool is shared by all copies and rebinds of allocator and lives until the last object allocated from it is
+ * freed.
+ */
+template <typename T>
+class PoolAllocator {
+  public:
+    using value_type = T;
+
+    explicit PoolAllocator(std::shared_ptr<BlockPool> pool) : _pool(std::move(pool)) {
+    }
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &other) : _pool(other._pool) {
+    }
+
+    T *allocate(size_t n) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported");
+        return static_cast<T *>(_pool->allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n) {
+        _pool->deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U> &other) const {
+        return _pool == other._pool;
+    }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U> &other) const {
+        return _pool != other._pool;
+    }
+
+  private:
+    template <typename U>
+    friend class PoolAllocator;
+
+    std::shared_ptr<BlockPool> _pool;
+};
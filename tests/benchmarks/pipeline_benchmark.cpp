@@ -0,0 +1,478 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * Pipeline benchmark running predefined pipelines on synthetic frames (videotestsrc) with fake inference models, so it
+ * needs neither models nor accelerators. Reports fps, per-element latency percentiles, CPU usage and C++ heap
+ * allocations per frame, and compares results with baseline to catch performance regressions on CI.
+ */
+
+#include <glib/gstdio.h>
+#include <gst/gst.h>
+#include <nlohmann/json.hpp>
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+std::atomic<uint64_t> heap_allocations{0};
+
+} // namespace
+
+// Heap allocations are counted for the whole process, including plugins
+void *operator new(size_t size) {
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+constexpr int EXIT_REGRESSION = 1;
+constexpr int EXIT_ERROR = 2;
+
+const std::vector<std::string> DETECTION_LABELS = {"vehicle", "person", "bike"};
+const std::vector<std::string> CLASSIFICATION_LABELS = {"white", "gray", "yellow", "red", "green", "blue", "black"};
+
+// Predefined pipelines, placeholders in braces are substituted before launch
+const std::vector<std::pair<std::string, std::string>> PIPELINES = {
+    {"detect", "{source} ! gvadetect name=detect model={models}/detector.fake.json "
+               "model-proc={models}/detector.model_proc.json {inference} ! fakesink name=sink sync=false"},
+    {"detect-classify", "{source} ! gvadetect name=detect model={models}/detector.fake.json "
+                        "model-proc={models}/detector.model_proc.json {inference} ! "
+                        "gvaclassify name=classify model={models}/classifier.fake.json "
+                        "model-proc={models}/classifier.model_proc.json {inference} ! fakesink name=sink sync=false"},
+    {"full", "{source} ! gvadetect name=detect model={models}/detector.fake.json "
+             "model-proc={models}/detector.model_proc.json {inference} ! "
+             "gvatrack name=track tracking-type=zero-term-imageless ! "
+             "gvaclassify name=classify model={models}/classifier.fake.json "
+             "model-proc={models}/classifier.model_proc.json {inference} ! gvametaconvert name=metaconvert ! "
+             "gvametapublish name=publish method=file file-format=json-lines file-path={output} ! "
+             "fakesink name=sink sync=false"},
+};
+
+struct Options {
+    gchar *pipelines = nullptr;
+    gint frames = 500;
+    gint warmup = 30;
+    gint width = 1920;
+    gint height = 1080;
+    gchar *format = nullptr;
+    gint objects = 8;
+    gdouble detect_latency_ms = 2.0;
+    gdouble classify_latency_ms = 0.5;
+    gboolean busy_wait = FALSE;
+    gint batch_size = 1;
+    gint nireq = 4;
+    gchar *output = nullptr;
+    gchar *baseline = nullptr;
+    gdouble tolerance = 0.1;
+    gint timeout_sec = 300;
+};
+
+void replaceAll(std::string &str, const std::string &from, const std::string &to) {
+    for (size_t pos = str.find(from); pos != std::string::npos; pos = str.find(from, pos + to.size()))
+        str.replace(pos, from.size(), to);
+}
+
+void writeJson(const std::string &path, const nlohmann::json &json) {
+    std::ofstream file(path);
+    if (!file)
+        throw std::runtime_error("Couldn't write '" + path + "'");
+    file << json.dump(2) << std::endl;
+}
+
+void writeModels(const std::string &dir, const Options &options) {
+    writeJson(dir + "/detector.fake.json",
+              {{"name", "fake-detector"},
+               {"input", {{"name", "image"}, {"width", 300}, {"height", 300}, {"format", "BGR"}}},
+               {"outputs",
+                {{{"name", "detection_out"},
+                  {"type", "detection"},
+                  {"objects", options.objects},
+                  {"labels", DETECTION_LABELS.size()}}}},
+               {"latency_ms", options.detect_latency_ms},
+               {"busy_wait", static_cast<bool>(options.busy_wait)}});
+    writeJson(dir + "/detector.model_proc.json",
+              {{"json_schema_version", "2.2.0"},
+               {"input_preproc", nlohmann::json::array()},
+               {"output_postproc", {{{"converter", "detection_output"}, {"labels", DETECTION_LABELS}}}}});
+
+    writeJson(dir + "/classifier.fake.json",
+              {{"name", "fake-classifier"},
+               {"input", {{"name", "image"}, {"width", 72}, {"height", 72}, {"format", "BGR"}}},
+               {"outputs",
+                {{{"name", "color"},
+                  {"type", "classification"},
+                  {"classes", CLASSIFICATION_LABELS.size()},
+                  {"class_id", 3}}}},
+               {"latency_ms", options.classify_latency_ms},
+               {"busy_wait", static_cast<bool>(options.busy_wait)}});
+    writeJson(dir + "/classifier.model_proc.json",
+              {{"json_schema_version", "2.2.0"},
+               {"input_preproc", nlohmann::json::array()},
+               {"output_postproc",
+                {{{"layer_name", "color"},
+                  {"attribute_name", "color"},
+                  {"converter", "label"},
+                  {"method", "max"},
+                  {"labels", CLASSIFICATION_LABELS}}}}});
+}
+
+double percentile(const std::vector<double> &sorted_values, double p) {
+    if (sorted_values.empty())
+        return 0.0;
+    const size_t index = std::min(sorted_values.size() - 1, static_cast<size_t>(p * (sorted_values.size() - 1) + 0.5));
+    return sorted_values[index];
+}
+
+double cpuSeconds() {
+    rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+/**
+ * Latency of buffer between sink and source pads of one element. Buffers are matched by PTS, which is unique for
+ * frames of videotestsrc.
+ */
+class LatencyProbe {
+  public:
+    LatencyProbe(GstPad *in_pad, GstPad *out_pad) {
+        gst_pad_add_probe(in_pad, GST_PAD_PROBE_TYPE_BUFFER, &LatencyProbe::OnEnter, this, nullptr);
+        gst_pad_add_probe(out_pad, GST_PAD_PROBE_TYPE_BUFFER, &LatencyProbe::OnLeave, this, nullptr);
+    }
+
+    nlohmann::json Percentiles() {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::sort(latencies_ms.begin(), latencies_ms.end());
+        return {{"p50", percentile(latencies_ms, 0.5)},
+                {"p90", percentile(latencies_ms, 0.9)},
+                {"p99", percentile(latencies_ms, 0.99)},
+                {"max", latencies_ms.empty() ? 0.0 : latencies_ms.back()}};
+    }
+
+  private:
+    static GstPadProbeReturn OnEnter(GstPad *, GstPadProbeInfo *info, gpointer user_data) {
+        auto *self = static_cast<LatencyProbe *>(user_data);
+        const GstClockTime pts = GST_BUFFER_PTS(GST_PAD_PROBE_INFO_BUFFER(info));
+        std::lock_guard<std::mutex> lock(self->mutex);
+        self->entered[pts] = std::chrono::steady_clock::now();
+        return GST_PAD_PROBE_OK;
+    }
+
+    static GstPadProbeReturn OnLeave(GstPad *, GstPadProbeInfo *info, gpointer user_data) {
+        auto *self = static_cast<LatencyProbe *>(user_data);
+        const auto now = std::chrono::steady_clock::now();
+        const GstClockTime pts = GST_BUFFER_PTS(GST_PAD_PROBE_INFO_BUFFER(info));
+        std::lock_guard<std::mutex> lock(self->mutex);
+        auto it = self->entered.find(pts);
+        if (it != self->entered.end()) {
+            self->latencies_ms.push_back(std::chrono::duration<double, std::milli>(now - it->second).count());
+            self->entered.erase(it);
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    std::mutex mutex;
+    std::unordered_map<GstClockTime, std::chrono::steady_clock::time_point> entered;
+    std::vector<double> latencies_ms;
+};
+
+// Starts measurement when warmup frames passed the sink
+struct MeasurementWindow {
+    explicit MeasurementWindow(int warmup) : warmup(warmup) {
+    }
+
+    void Start() {
+        start_time = std::chrono::steady_clock::now();
+        start_cpu = cpuSeconds();
+        start_allocations = heap_allocations.load();
+    }
+
+    static GstPadProbeReturn OnFrame(GstPad *, GstPadProbeInfo *, gpointer user_data) {
+        auto *self = static_cast<MeasurementWindow *>(user_data);
+        if (++self->frames == self->warmup)
+            self->Start();
+        return GST_PAD_PROBE_OK;
+    }
+
+    const int warmup;
+    std::atomic<int> frames{0};
+    std::chrono::steady_clock::time_point start_time;
+    double start_cpu = 0;
+    uint64_t start_allocations = 0;
+};
+
+nlohmann::json runPipeline(const std::string &name, std::string description, const Options &options,
+                           const std::string &models_dir) {
+    const std::string source = "videotestsrc name=src pattern=ball num-buffers=" + std::to_string(options.frames) +
+                               " ! video/x-raw,format=" + (options.format ? options.format : "BGRx") +
+                               ",width=" + std::to_string(options.width) + ",height=" + std::to_string(options.height);
+    const std::string inference_props =
+        "device=CPU batch-size=" + std::to_string(options.batch_size) + " nireq=" + std::to_string(options.nireq);
+    replaceAll(description, "{source}", source);
+    replaceAll(description, "{inference}", inference_props);
+    replaceAll(description, "{output}", models_dir + "/" + name + ".jsonl");
+    replaceAll(description, "{models}", models_dir);
+
+    GError *error = nullptr;
+    GstElement *pipeline = gst_parse_launch(description.c_str(), &error);
+    if (!pipeline || error) {
+        std::string message = error ? error->message : "unknown error";
+        g_clear_error(&error);
+        throw std::runtime_error("Couldn't create pipeline '" + name + "': " + message);
+    }
+    std::unique_ptr<GstElement, decltype(&gst_object_unref)> pipeline_guard(pipeline, gst_object_unref);
+
+    // Latency of each named element and of the whole pipeline
+    std::map<std::string, std::unique_ptr<LatencyProbe>> probes;
+    GstElement *src = gst_bin_get_by_name(GST_BIN(pipeline), "src");
+    GstElement *sink = gst_bin_get_by_name(GST_BIN(pipeline), "sink");
+    GstPad *src_pad = gst_element_get_static_pad(src, "src");
+    GstPad *sink_pad = gst_element_get_static_pad(sink, "sink");
+    probes["pipeline"] = std::make_unique<LatencyProbe>(src_pad, sink_pad);
+
+    MeasurementWindow window(options.warmup);
+    gst_pad_add_probe(sink_pad, GST_PAD_PROBE_TYPE_BUFFER, &MeasurementWindow::OnFrame, &window, nullptr);
+
+    for (const char *element_name : {"detect", "track", "classify", "metaconvert", "publish"}) {
+        GstElement *element = gst_bin_get_by_name(GST_BIN(pipeline), element_name);
+        if (!element)
+            continue;
+        GstPad *in = gst_element_get_static_pad(element, "sink");
+        GstPad *out = gst_element_get_static_pad(element, "src");
+        probes[element_name] = std::make_unique<LatencyProbe>(in, out);
+        gst_object_unref(in);
+        gst_object_unref(out);
+        gst_object_unref(element);
+    }
+    gst_object_unref(src_pad);
+    gst_object_unref(sink_pad);
+    gst_object_unref(src);
+    gst_object_unref(sink);
+
+    if (options.warmup <= 0)
+        window.Start();
+    if (gst_element_set_state(pipeline, GST_STATE_PLAYING) == GST_STATE_CHANGE_FAILURE)
+        throw std::runtime_error("Couldn't start pipeline '" + name + "'");
+
+    GstBus *bus = gst_element_get_bus(pipeline);
+    GstMessage *msg = gst_bus_timed_pop_filtered(bus, options.timeout_sec * GST_SECOND,
+                                                 static_cast<GstMessageType>(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+    const auto end_time = std::chrono::steady_clock::now();
+    const double end_cpu = cpuSeconds();
+    const uint64_t end_allocations = heap_allocations.load();
+
+    std::string failure;
+    if (!msg) {
+        failure = "timeout";
+    } else if (GST_MESSAGE_TYPE(msg) == GST_MESSAGE_ERROR) {
+        GError *err = nullptr;
+        gst_message_parse_error(msg, &err, nullptr);
+        failure = err ? err->message : "unknown error";
+        g_clear_error(&err);
+    }
+    if (msg)
+        gst_message_unref(msg);
+    gst_object_unref(bus);
+    gst_element_set_state(pipeline, GST_STATE_NULL);
+
+    if (!failure.empty())
+        throw std::runtime_error("Pipeline '" + name + "' failed: " + failure);
+
+    const int measured_frames = window.frames - std::max(0, options.warmup);
+    if (measured_frames <= 0)
+        throw std::runtime_error("Pipeline '" + name + "' processed only " + std::to_string(window.frames.load()) +
+                                 " frames, increase --frames or decrease --warmup");
+    const double seconds = std::chrono::duration<double>(end_time - window.start_time).count();
+
+    nlohmann::json latencies = nlohmann::json::object();
+    for (auto &probe : probes)
+        latencies[probe.first] = probe.second->Percentiles();
+
+    const double allocations = static_cast<double>(end_allocations - window.start_allocations);
+    return {{"name", name},
+            {"frames", measured_frames},
+            {"fps", measured_frames / seconds},
+            {"cpu_percent", 100.0 * (end_cpu - window.start_cpu) / seconds},
+            {"allocations_per_frame", allocations / measured_frames},
+            {"latency_ms", latencies}};
+}
+
+void printResult(const nlohmann::json &result) {
+    std::printf("%-16s fps %9.1f | cpu %6.1f%% | allocations/frame %9.1f\n", result["name"].get<std::string>().c_str(),
+                result["fps"].get<double>(), result["cpu_percent"].get<double>(),
+                result["allocations_per_frame"].get<double>());
+    for (const auto &latency : result["latency_ms"].items()) {
+        const auto &value = latency.value();
+        std::printf("    %-12s latency ms p50 %8.3f | p90 %8.3f | p99 %8.3f | max %8.3f\n", latency.key().c_str(),
+                    value["p50"].get<double>(), value["p90"].get<double>(), value["p99"].get<double>(),
+                    value["max"].get<double>());
+    }
+}
+
+// Returns number of regressions: fps lower or allocations per frame higher than baseline beyond tolerance
+int compareWithBaseline(const nlohmann::json &results, const nlohmann::json &baseline, double tolerance) {
+    std::map<std::string, nlohmann::json> baseline_results;
+    for (const auto &result : baseline.at("pipelines"))
+        baseline_results[result.at("name").get<std::string>()] = result;
+
+    int regressions = 0;
+    for (const auto &result : results.at("pipelines")) {
+        const std::string name = result.at("name").get<std::string>();
+        auto it = baseline_results.find(name);
+        if (it == baseline_results.end()) {
+            std::printf("%-16s not in baseline\n", name.c_str());
+            continue;
+        }
+        const double fps = result.at("fps").get<double>();
+        const double base_fps = it->second.at("fps").get<double>();
+        const double allocations = result.at("allocations_per_frame").get<double>();
+        const double base_allocations = it->second.at("allocations_per_frame").get<double>();
+
+        const bool fps_regression = fps < base_fps * (1.0 - tolerance);
+        // One allocation of slack keeps pipelines allocating almost nothing from flapping
+        const bool allocations_regression = allocations > base_allocations * (1.0 + tolerance) + 1.0;
+        std::printf("%-16s fps %9.1f vs %9.1f %s | allocations/frame %9.1f vs %9.1f %s\n", name.c_str(), fps,
+                    base_fps, fps_regression ? "REGRESSION" : "ok", allocations, base_allocations,
+                    allocations_regression ? "REGRESSION" : "ok");
+        regressions += fps_regression + allocations_regression;
+    }
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    Options options;
+    GOptionEntry entries[] = {
+        {"pipelines", 'p', 0, G_OPTION_ARG_STRING, &options.pipelines,
+         "Comma separated pipelines to run: detect, detect-classify, full. Default: all", nullptr},
+        {"frames", 'n', 0, G_OPTION_ARG_INT, &options.frames, "Number of frames per pipeline. Default: 500", nullptr},
+        {"warmup", 0, 0, G_OPTION_ARG_INT, &options.warmup, "Frames excluded from measurement. Default: 30", nullptr},
+        {"width", 0, 0, G_OPTION_ARG_INT, &options.width, "Frame width. Default: 1920", nullptr},
+        {"height", 0, 0, G_OPTION_ARG_INT, &options.height, "Frame height. Default: 1080", nullptr},
+        {"format", 0, 0, G_OPTION_ARG_STRING, &options.format, "Frame format. Default: BGRx", nullptr},
+        {"objects", 0, 0, G_OPTION_ARG_INT, &options.objects, "Objects detected per frame. Default: 8", nullptr},
+        {"detect-latency", 0, 0, G_OPTION_ARG_DOUBLE, &options.detect_latency_ms,
+         "Latency of fake detection request in ms. Default: 2", nullptr},
+        {"classify-latency", 0, 0, G_OPTION_ARG_DOUBLE, &options.classify_latency_ms,
+         "Latency of fake classification request in ms. Default: 0.5", nullptr},
+        {"busy-wait", 0, 0, G_OPTION_ARG_NONE, &options.busy_wait,
+         "Fake inference requests spin instead of sleeping", nullptr},
+        {"batch-size", 'b', 0, G_OPTION_ARG_INT, &options.batch_size, "Batch size. Default: 1", nullptr},
+        {"nireq", 0, 0, G_OPTION_ARG_INT, &options.nireq, "Number of inference requests. Default: 4", nullptr},
+        {"output", 'o', 0, G_OPTION_ARG_STRING, &options.output, "Path to JSON file with results", nullptr},
+        {"baseline", 0, 0, G_OPTION_ARG_STRING, &options.baseline,
+         "Path to JSON results to compare with, exit code is 1 on regression", nullptr},
+        {"tolerance", 0, 0, G_OPTION_ARG_DOUBLE, &options.tolerance,
+         "Allowed relative regression against baseline. Default: 0.1", nullptr},
+        {"timeout", 0, 0, G_OPTION_ARG_INT, &options.timeout_sec, "Timeout of one pipeline in seconds", nullptr},
+        GOptionEntry()};
+
+    GError *error = nullptr;
+    GOptionContext *context = g_option_context_new("- benchmark of pipelines with fake inference");
+    g_option_context_add_main_entries(context, entries, nullptr);
+    g_option_context_add_group(context, gst_init_get_option_group());
+    if (!g_option_context_parse(context, &argc, &argv, &error)) {
+        std::cerr << "Option parsing failed: " << error->message << std::endl;
+        g_clear_error(&error);
+        g_option_context_free(context);
+        return EXIT_ERROR;
+    }
+    g_option_context_free(context);
+    gst_init(&argc, &argv);
+
+    std::vector<std::string> selected;
+    if (options.pipelines) {
+        gchar **names = g_strsplit(options.pipelines, ",", -1);
+        for (gchar **name = names; *name; ++name)
+            selected.emplace_back(*name);
+        g_strfreev(names);
+    }
+
+    gchar *models_dir = g_dir_make_tmp("gva_benchmark_XXXXXX", &error);
+    if (!models_dir) {
+        std::cerr << "Couldn't create temporary directory: " << error->message << std::endl;
+        g_clear_error(&error);
+        return EXIT_ERROR;
+    }
+
+    nlohmann::json results = {{"config",
+                               {{"frames", options.frames},
+                                {"warmup", options.warmup},
+                                {"width", options.width},
+                                {"height", options.height},
+                                {"format", options.format ? options.format : "BGRx"},
+                                {"objects", options.objects},
+                                {"detect_latency_ms", options.detect_latency_ms},
+                                {"classify_latency_ms", options.classify_latency_ms},
+                                {"batch_size", options.batch_size},
+                                {"nireq", options.nireq}}},
+                              {"pipelines", nlohmann::json::array()}};
+    int exit_code = EXIT_SUCCESS;
+    try {
+        writeModels(models_dir, options);
+        for (const auto &pipeline : PIPELINES) {
+            if (!selected.empty() && std::find(selected.begin(), selected.end(), pipeline.first) == selected.end())
+                continue;
+            nlohmann::json result = runPipeline(pipeline.first, pipeline.second, options, models_dir);
+            printResult(result);
+            results["pipelines"].push_back(result);
+        }
+
+        if (options.output)
+            writeJson(options.output, results);
+
+        if (options.baseline) {
+            std::ifstream file(options.baseline);
+            if (!file)
+                throw std::runtime_error(std::string("Couldn't read baseline '") + options.baseline + "'");
+            nlohmann::json baseline;
+            file >> baseline;
+            if (compareWithBaseline(results, baseline, options.tolerance) > 0)
+                exit_code = EXIT_REGRESSION;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        exit_code = EXIT_ERROR;
+    }
+
+    for (const char *file : {"detector.fake.json", "detector.model_proc.json", "classifier.fake.json",
+                             "classifier.model_proc.json", "full.jsonl"}) {
+        gchar *path = g_build_filename(models_dir, file, nullptr);
+        g_remove(path);
+        g_free(path);
+    }
+    g_rmdir(models_dir);
+    g_free(models_dir);
+    return exit_code;
+}
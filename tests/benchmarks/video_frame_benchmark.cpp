@@ -0,0 +1,148 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * Micro benchmark of GVA::VideoFrame region enumeration against number of regions on buffer. Every element calling
+ * regions() (gvatrack, gvaclassify, gvawatermark, gvametaconvert, gvapython) pays this cost per frame, so it is
+ * measured the same way: new VideoFrame for the buffer, then regions(). Lookup of ROI meta per region by scanning
+ * buffer metas, as done before indexing, is measured alongside for comparison.
+ */
+
+#include "video_frame.h"
+
+#include <gst/gst.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int EXIT_ERROR = 2;
+
+struct Options {
+    gchar *rois = nullptr;
+    gint iterations = 2000;
+    gchar *output = nullptr;
+};
+
+GstBuffer *makeBuffer(GstVideoInfo *info, int rois) {
+    GstBuffer *buffer = gst_buffer_new();
+    GVA::VideoFrame frame(buffer, info);
+    for (int i = 0; i < rois; ++i) {
+        frame.add_region((i * 37) % 1800, (i * 23) % 1000, 100, 60, i % 2 ? "person" : "vehicle", 0.9);
+    }
+    return buffer;
+}
+
+// Enumeration as it was done before ROI metas were indexed: buffer metas are scanned for each region
+size_t legacyRegions(GstBuffer *buffer) {
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+    if (!relation_meta)
+        return 0;
+    gpointer state = NULL;
+    GstAnalyticsODMtd od_mtd;
+    size_t count = 0;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd))
+        ++count;
+    std::vector<GVA::RegionOfInterest> regions;
+    regions.reserve(count);
+    state = NULL;
+    while (gst_analytics_relation_meta_iterate(relation_meta, &state, gst_analytics_od_mtd_get_mtd_type(), &od_mtd))
+        regions.emplace_back(od_mtd, gst_buffer_get_video_region_of_interest_meta_id(buffer, od_mtd.id));
+    return regions.size();
+}
+
+template <typename Function>
+double measureUs(int iterations, Function function) {
+    size_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        checksum += function();
+    const auto end = std::chrono::steady_clock::now();
+    // Keeps the loop from being optimized out
+    if (checksum == static_cast<size_t>(-1))
+        std::printf("\n");
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    Options options;
+    GOptionEntry entries[] = {
+        {"rois", 'r', 0, G_OPTION_ARG_STRING, &options.rois,
+         "Comma separated numbers of regions per buffer. Default: 1,10,50,100,200,500", nullptr},
+        {"iterations", 'n', 0, G_OPTION_ARG_INT, &options.iterations,
+         "Enumerations measured per number of regions. Default: 2000", nullptr},
+        {"output", 'o', 0, G_OPTION_ARG_STRING, &options.output, "Path to JSON file with results", nullptr},
+        GOptionEntry()};
+
+    GError *error = nullptr;
+    GOptionContext *context = g_option_context_new("- benchmark of GVA::VideoFrame region enumeration");
+    g_option_context_add_main_entries(context, entries, nullptr);
+    g_option_context_add_group(context, gst_init_get_option_group());
+    if (!g_option_context_parse(context, &argc, &argv, &error)) {
+        std::cerr << "Option parsing failed: " << error->message << std::endl;
+        g_clear_error(&error);
+        g_option_context_free(context);
+        return EXIT_ERROR;
+    }
+    g_option_context_free(context);
+    gst_init(&argc, &argv);
+
+    std::vector<int> roi_counts = {1, 10, 50, 100, 200, 500};
+    if (options.rois) {
+        roi_counts.clear();
+        gchar **counts = g_strsplit(options.rois, ",", -1);
+        for (gchar **count = counts; *count; ++count)
+            roi_counts.push_back(std::atoi(*count));
+        g_strfreev(counts);
+    }
+    const int iterations = std::max(1, options.iterations);
+
+    GstVideoInfo info;
+    gst_video_info_set_format(&info, GST_VIDEO_FORMAT_BGRx, 1920, 1080);
+
+    nlohmann::json results = nlohmann::json::array();
+    std::printf("%8s | %14s | %12s | %14s\n", "regions", "regions() us", "ns/region", "legacy us");
+    try {
+        for (int rois : roi_counts) {
+            GstBuffer *buffer = makeBuffer(&info, rois);
+            const double indexed_us = measureUs(iterations, [&]() {
+                GVA::VideoFrame frame(buffer, &info);
+                return frame.regions().size();
+            });
+            const double legacy_us = measureUs(iterations, [&]() { return legacyRegions(buffer); });
+            gst_buffer_unref(buffer);
+
+            const double ns_per_region = rois > 0 ? indexed_us * 1000.0 / rois : 0.0;
+            std::printf("%8d | %14.3f | %12.1f | %14.3f\n", rois, indexed_us, ns_per_region, legacy_us);
+            results.push_back({{"regions", rois},
+                               {"regions_us", indexed_us},
+                               {"ns_per_region", ns_per_region},
+                               {"legacy_us", legacy_us}});
+        }
+
+        if (options.output) {
+            std::ofstream file(options.output);
+            if (!file)
+                throw std::runtime_error(std::string("Couldn't write '") + options.output + "'");
+            file << nlohmann::json({{"iterations", iterations}, {"results", results}}).dump(2) << std::endl;
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_ERROR;
+    }
+
+    return EXIT_SUCCESS;
+}
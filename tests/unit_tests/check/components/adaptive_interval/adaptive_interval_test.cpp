@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "adaptive_interval.h"
+#include "motion_meta.h"
+
+#include <gst/analytics/analytics.h>
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr unsigned MIN_INTERVAL = 1;
+constexpr unsigned MAX_INTERVAL = 8;
+constexpr size_t NIREQ = 4;
+// Enough updates for smoothed activity to decay from fully active to static
+constexpr int SETTLE_UPDATES = 50;
+
+AdaptiveInterval::Activity staticScene() {
+    AdaptiveInterval::Activity activity;
+    activity.has_motion_info = true;
+    activity.motion_area = 0.0;
+    return activity;
+}
+
+AdaptiveInterval::Activity movingScene() {
+    AdaptiveInterval::Activity activity;
+    activity.has_motion_info = true;
+    activity.motion_area = 0.1;
+    return activity;
+}
+
+unsigned settle(AdaptiveInterval &controller, const AdaptiveInterval::Activity &activity,
+                size_t free_requests = NIREQ) {
+    unsigned interval = 0;
+    for (int i = 0; i < SETTLE_UPDATES; ++i)
+        interval = controller.Update(activity, free_requests, NIREQ);
+    return interval;
+}
+
+} // namespace
+
+TEST(AdaptiveIntervalTest, StaticSceneBacksOff) {
+    AdaptiveInterval controller(MIN_INTERVAL, MAX_INTERVAL);
+    EXPECT_EQ(settle(controller, staticScene()), MAX_INTERVAL);
+}
+
+TEST(AdaptiveIntervalTest, MovingSceneRunsAtMinInterval) {
+    AdaptiveInterval controller(MIN_INTERVAL, MAX_INTERVAL);
+    EXPECT_EQ(settle(controller, movingScene()), MIN_INTERVAL);
+
+    // Motion after static scene brings interval back immediately
+    settle(controller, staticScene());
+    EXPECT_EQ(controller.Update(movingScene(), NIREQ, NIREQ), MIN_INTERVAL);
+}
+
+TEST(AdaptiveIntervalTest, NoInfoIsTreatedAsActive) {
+    AdaptiveInterval controller(MIN_INTERVAL, MAX_INTERVAL);
+    EXPECT_EQ(settle(controller, AdaptiveInterval::Activity()), MIN_INTERVAL);
+
+    settle(controller, staticScene());
+    EXPECT_EQ(controller.Update(AdaptiveInterval::Activity(), NIREQ, NIREQ), MIN_INTERVAL);
+}
+
+TEST(AdaptiveIntervalTest, SaturationBacksOffActiveScene) {
+    AdaptiveInterval controller(MIN_INTERVAL, MAX_INTERVAL);
+    EXPECT_GT(settle(controller, movingScene(), 0), MIN_INTERVAL);
+    EXPECT_EQ(settle(controller, movingScene(), NIREQ), MIN_INTERVAL);
+}
+
+class AdaptiveIntervalActivityTest : public testing::Test {
+  protected:
+    GstVideoInfo info;
+    GstBuffer *buffer = nullptr;
+
+    void SetUp() override {
+        gva_motion_meta_register();
+        gst_video_info_set_format(&info, GST_VIDEO_FORMAT_NV12, 640, 480);
+        buffer = gst_buffer_new();
+    }
+
+    void TearDown() override {
+        gst_buffer_unref(buffer);
+    }
+};
+
+TEST_F(AdaptiveIntervalActivityTest, FrameWithoutMotionMetaHasNoMotionInfo) {
+    AdaptiveInterval::Activity activity = AdaptiveInterval::GetActivity(buffer, &info);
+    EXPECT_FALSE(activity.has_motion_info);
+    EXPECT_FALSE(activity.has_tracking_info);
+}
+
+TEST_F(AdaptiveIntervalActivityTest, AnalyzedFrameWithoutMotionIsStatic) {
+    gva_buffer_add_motion_meta(buffer);
+    AdaptiveInterval::Activity activity = AdaptiveInterval::GetActivity(buffer, &info);
+    EXPECT_TRUE(activity.has_motion_info);
+    EXPECT_DOUBLE_EQ(activity.motion_area, 0.0);
+}
+
+TEST_F(AdaptiveIntervalActivityTest, MotionAreaIsShareOfFrame) {
+    gva_buffer_add_motion_meta(buffer);
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(buffer);
+    GstAnalyticsODMtd od_mtd;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_od_mtd(relation_meta, g_quark_from_string("motion"), 0, 0, 64, 48,
+                                                       1.0, &od_mtd));
+
+    AdaptiveInterval::Activity activity = AdaptiveInterval::GetActivity(buffer, &info);
+    EXPECT_TRUE(activity.has_motion_info);
+    EXPECT_DOUBLE_EQ(activity.motion_area, 0.01);
+}
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "cpu_placement.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace CpuPlacement;
+using ::testing::ElementsAre;
+
+namespace {
+
+Topology two_nodes() {
+    Topology topology;
+    topology.nodes = {{0, 1, 2, 3}, {4, 5, 6, 7}};
+    return topology;
+}
+
+} // namespace
+
+TEST(CpuPlacement, cpu_list_round_trip) {
+    EXPECT_THAT(parseCpuList("0-3,8, 10-11"), ElementsAre(0, 1, 2, 3, 8, 10, 11));
+    EXPECT_THAT(parseCpuList("5,1,1\n"), ElementsAre(1, 5));
+    EXPECT_EQ(formatCpuList({0, 1, 2, 3, 8, 10, 11}), "0-3,8,10-11");
+    EXPECT_EQ(formatCpuList({}), "");
+    EXPECT_THROW(parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("a-b"), std::invalid_argument);
+}
+
+TEST(CpuPlacement, config_lines) {
+    auto policies = parseConfig("# comment\ndet = numa:1\n\n cls=cores:0-1 # trailing\n");
+    ASSERT_EQ(policies.size(), 2u);
+    EXPECT_EQ(policies["det"], "numa:1");
+    EXPECT_EQ(policies["cls"], "cores:0-1");
+    EXPECT_THROW(parseConfig("det numa:1"), std::invalid_argument);
+}
+
+TEST(CpuPlacement, auto_assigns_nodes_round_robin) {
+    Placer placer(two_nodes(), "auto", {});
+    EXPECT_EQ(placer.place("a").node, 0);
+    EXPECT_EQ(placer.place("b").node, 1);
+    EXPECT_EQ(placer.place("c").node, 0);
+    // Same group keeps its placement
+    EXPECT_THAT(placer.place("b").cpus, ElementsAre(4, 5, 6, 7));
+    EXPECT_EQ(placer.report().size(), 3u);
+}
+
+TEST(CpuPlacement, auto_on_single_node_does_not_pin) {
+    Topology topology;
+    topology.nodes = {{0, 1}};
+    Placer placer(topology, "auto", {});
+    EXPECT_TRUE(placer.place("a").cpus.empty());
+}
+
+TEST(CpuPlacement, element_policy_overrides_group_and_default) {
+    Placer placer(two_nodes(), "numa:0", {{"cls", "numa:1"}});
+    EXPECT_EQ(placer.place("det").node, 0);
+    EXPECT_EQ(placer.place("cls").node, 1);
+    EXPECT_THAT(placer.place("own", "cores:2,3").cpus, ElementsAre(2, 3));
+    EXPECT_EQ(placer.place("own", "cores:2,3").node, -1);
+    EXPECT_TRUE(placer.place("off", "none").cpus.empty());
+}
+
+TEST(CpuPlacement, invalid_policy_throws) {
+    Placer placer(two_nodes(), "", {});
+    EXPECT_TRUE(placer.place("default").cpus.empty());
+    EXPECT_THROW(placer.place("a", "numa:2"), std::invalid_argument);
+    EXPECT_THROW(placer.place("b", "socket:0"), std::invalid_argument);
+}
+
+TEST(CpuPlacement, detected_topology_is_not_empty) {
+    Topology topology = Topology::detect();
+    ASSERT_FALSE(topology.nodes.empty());
+    for (const auto &node : topology.nodes)
+        EXPECT_FALSE(node.empty());
+}
+
+TEST(CpuPlacement, scoped_affinity_is_restored) {
+    const std::vector<unsigned> original = currentThreadCpus();
+    ASSERT_FALSE(original.empty());
+    const unsigned cpu = original.front();
+    {
+        ScopedThreadAffinity affinity({cpu});
+        ASSERT_TRUE(affinity.pinned());
+        EXPECT_THAT(currentThreadCpus(), ElementsAre(cpu));
+    }
+    EXPECT_EQ(currentThreadCpus(), original);
+}
+
+TEST(CpuPlacement, scoped_affinity_without_cpus_keeps_mask) {
+    const std::vector<unsigned> original = currentThreadCpus();
+    {
+        ScopedThreadAffinity affinity({});
+        EXPECT_FALSE(affinity.pinned());
+        EXPECT_EQ(currentThreadCpus(), original);
+    }
+    EXPECT_EQ(currentThreadCpus(), original);
+}
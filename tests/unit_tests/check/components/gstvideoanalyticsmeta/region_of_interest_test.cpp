@@ -103,3 +103,43 @@ TEST_F(RegionOfInterestTest, RegionOfInterestTestTensors) {
         ASSERT_EQ(tensors_roi[i].confidence(), test_tensors[i].confidence());
     }
 }
+
+TEST(RegionOfInterestAnalyticsMetaOnlyTest, RegionOfInterestParamsInAnalyticsMeta) {
+    GstBuffer *buffer = gst_buffer_new_and_alloc(0);
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(buffer);
+    ASSERT_NE(relation_meta, nullptr);
+
+    GstAnalyticsODMtd od_mtd;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_oriented_od_mtd(relation_meta, g_quark_from_string("person"), 10, 20,
+                                                               100, 200, 0.0, 0.9f, &od_mtd));
+    {
+        GVA::RegionOfInterest region(od_mtd, nullptr);
+        ASSERT_EQ(region._meta(), nullptr);
+
+        GVA::Tensor detection(gst_structure_new_empty("detection"));
+        detection.set_double("confidence", 0.9);
+        region.add_tensor(detection);
+        region.add_param(gst_structure_new("face_attributes", "label", G_TYPE_STRING, "smile", NULL));
+
+        ASSERT_NE(region.get_param("face_attributes"), nullptr);
+        ASSERT_EQ(region.get_param("missing"), nullptr);
+        ASSERT_EQ(g_list_length(region.get_params()), 2u);
+    }
+
+    // params are read back from analytics metadata by new instance
+    GVA::RegionOfInterest region(od_mtd, nullptr);
+    ASSERT_EQ(region.tensors().size(), 2u);
+    ASSERT_DOUBLE_EQ(region.confidence(), 0.9);
+    ASSERT_EQ(region.label(), "person");
+
+    // compatibility for readers of GstVideoRegionOfInterestMeta
+    ASSERT_EQ(gst_analytics_param_mtd_attach_roi_metas(buffer), 1u);
+    ASSERT_EQ(gst_analytics_param_mtd_attach_roi_metas(buffer), 0u);
+    GstVideoRegionOfInterestMeta *roi_meta = gst_buffer_get_video_region_of_interest_meta_id(buffer, od_mtd.id);
+    ASSERT_NE(roi_meta, nullptr);
+    ASSERT_EQ(roi_meta->x, 10u);
+    ASSERT_EQ(roi_meta->w, 100u);
+    ASSERT_NE(gst_video_region_of_interest_meta_get_param(roi_meta, "face_attributes"), nullptr);
+
+    gst_buffer_unref(buffer);
+}
@@ -218,3 +218,102 @@ TEST_F(VideoFrameTest, VideoFrameTestRegionIDs) {
         ASSERT_EQ(k.second, 1) << "ID should be unique";
     }
 }
+
+TEST_F(VideoFrameTest, VideoFrameTestRegionsIndex) {
+    constexpr int ROIS_NUMBER = 50;
+    for (int i = 0; i < ROIS_NUMBER; ++i) {
+        frame->add_region(i, i, 10, 10, "label" + std::to_string(i));
+    }
+    // first enumeration builds index of ROI metas
+    ASSERT_EQ(frame->regions().size(), ROIS_NUMBER);
+
+    // regions added via VideoFrame are put into index
+    frame->add_region(100, 100, 10, 10, "added");
+
+    // region added bypassing VideoFrame is found too
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_get_analytics_relation_meta(buffer);
+    ASSERT_NE(relation_meta, nullptr);
+    GstAnalyticsODMtd od_mtd;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_od_mtd(relation_meta, g_quark_from_string("external"), 200, 200, 10,
+                                                       10, 0.5, &od_mtd));
+    GstVideoRegionOfInterestMeta *external_meta =
+        gst_buffer_add_video_region_of_interest_meta(buffer, "external", 200, 200, 10, 10);
+    external_meta->id = od_mtd.id;
+
+    std::vector<GVA::RegionOfInterest> regions = frame->regions();
+    ASSERT_EQ(regions.size(), ROIS_NUMBER + 2);
+    for (int i = 0; i < ROIS_NUMBER; ++i) {
+        ASSERT_EQ(regions[i].label(), "label" + std::to_string(i));
+    }
+    ASSERT_EQ(regions[ROIS_NUMBER].label(), "added");
+    ASSERT_EQ(regions[ROIS_NUMBER + 1]._meta(), external_meta);
+    for (GVA::RegionOfInterest &roi : regions) {
+        ASSERT_EQ(roi._meta()->id, roi.region_id());
+    }
+}
+
+TEST_F(VideoFrameTest, VideoFrameTestRegionsIndexAfterDirectRemoval) {
+    constexpr int ROIS_NUMBER = 10;
+    for (int i = 0; i < ROIS_NUMBER; ++i) {
+        frame->add_region(i, i, 10, 10, "label" + std::to_string(i));
+    }
+    std::vector<GVA::RegionOfInterest> regions = frame->regions();
+    ASSERT_EQ(regions.size(), ROIS_NUMBER);
+
+    // ROI meta replaced bypassing VideoFrame, number of ROI metas doesn't change
+    GstVideoRegionOfInterestMeta *removed_meta = regions[0]._meta();
+    const gint id = removed_meta->id;
+    ASSERT_TRUE(gst_buffer_remove_meta(buffer, (GstMeta *)removed_meta));
+    GstVideoRegionOfInterestMeta *replacement_meta =
+        gst_buffer_add_video_region_of_interest_meta(buffer, "replacement", 0, 0, 10, 10);
+    replacement_meta->id = id;
+
+    regions = frame->regions();
+    ASSERT_EQ(regions.size(), ROIS_NUMBER);
+    ASSERT_EQ(regions[0]._meta(), replacement_meta);
+    for (GVA::RegionOfInterest &roi : regions) {
+        ASSERT_EQ(roi._meta()->id, roi.region_id());
+    }
+}
+
+TEST_F(VideoFrameTest, VideoFrameTestAnalyticsMetaOnlyRegion) {
+    // region stored in analytics metadata only by element of other pipeline, process default mode is not set
+    GstAnalyticsRelationMeta *relation_meta = gst_buffer_add_analytics_relation_meta(buffer);
+    ASSERT_NE(relation_meta, nullptr);
+    GstAnalyticsODMtd od_mtd;
+    ASSERT_TRUE(gst_analytics_relation_meta_add_od_mtd(relation_meta, g_quark_from_string("meta_only"), 10, 10, 20, 20,
+                                                       0.5, &od_mtd));
+    GstStructure *detection = gst_structure_new("detection", "x_min", G_TYPE_DOUBLE, 0.1, "x_max", G_TYPE_DOUBLE, 0.2,
+                                                "y_min", G_TYPE_DOUBLE, 0.1, "y_max", G_TYPE_DOUBLE, 0.2, NULL);
+    GVA::RegionOfInterest(od_mtd, nullptr).add_tensor(GVA::Tensor(detection));
+    frame->add_region(100, 100, 10, 10, "mirrored");
+
+    std::vector<GVA::RegionOfInterest> regions = frame->regions();
+    ASSERT_EQ(regions.size(), 2);
+    ASSERT_EQ(regions[0]._meta(), nullptr);
+    ASSERT_EQ(regions[0].label(), "meta_only");
+    ASSERT_NE(regions[0].get_param("detection"), nullptr);
+    ASSERT_NE(regions[1]._meta(), nullptr);
+}
+
+TEST(AnalyticsMetaModeTest, ModeIsTakenFromPipelineContext) {
+    GstElement *pipeline = gst_pipeline_new("pipeline");
+    GstElement *element = gst_bin_new("element");
+    ASSERT_EQ(gva_analytics_meta_only(element), gva_analytics_meta_only_default());
+
+    GstContext *context = gva_analytics_meta_context_new(TRUE);
+    gst_element_set_context(pipeline, context);
+    gst_context_unref(context);
+
+    // context set on pipeline is propagated to elements added later
+    ASSERT_TRUE(gst_bin_add(GST_BIN(pipeline), element));
+    ASSERT_TRUE(gva_analytics_meta_only(element));
+    ASSERT_TRUE(GVA::analytics_meta_only(pipeline));
+
+    context = gva_analytics_meta_context_new(FALSE);
+    gst_element_set_context(pipeline, context);
+    gst_context_unref(context);
+    ASSERT_FALSE(gva_analytics_meta_only(element));
+
+    gst_object_unref(pipeline);
+}
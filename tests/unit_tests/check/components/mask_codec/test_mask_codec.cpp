@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "mask_codec.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+TEST(MaskCodec, bitmask_round_trip) {
+    // Size not multiple of 8 checks both vectorized and tail paths
+    const size_t size = 28 * 28 + 3;
+    std::vector<float> mask(size);
+    for (size_t i = 0; i < size; i++)
+        mask[i] = (i * 37 % 100) / 100.0f;
+
+    std::vector<uint8_t> bits = MaskCodec::packBits(mask.data(), size);
+    ASSERT_EQ(bits.size(), (size + 7) / 8);
+
+    std::vector<float> decoded(size);
+    MaskCodec::unpackBits(bits.data(), bits.size(), decoded.data(), size);
+    for (size_t i = 0; i < size; i++)
+        ASSERT_EQ(decoded[i], mask[i] > MaskCodec::DEFAULT_THRESHOLD ? 1.0f : 0.0f) << "element " << i;
+}
+
+TEST(MaskCodec, bitmask_bit_order) {
+    std::vector<float> mask = {1, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+    std::vector<uint8_t> bits = MaskCodec::packBits(mask.data(), mask.size());
+    ASSERT_EQ(bits, std::vector<uint8_t>({0x01, 0x02}));
+}
+
+TEST(MaskCodec, bitmask_too_short) {
+    std::vector<uint8_t> bits(2);
+    std::vector<float> decoded(17);
+    ASSERT_THROW(MaskCodec::unpackBits(bits.data(), bits.size(), decoded.data(), decoded.size()),
+                 std::invalid_argument);
+}
+
+TEST(MaskCodec, rle_round_trip) {
+    std::vector<int64_t> mask(64 * 48, 0);
+    for (size_t i = 500; i < 1500; i++)
+        mask[i] = 3;
+    for (size_t i = 1500; i < 1501; i++)
+        mask[i] = -1;
+    for (size_t i = 2000; i < mask.size(); i++)
+        mask[i] = 1000;
+
+    std::vector<uint8_t> rle = MaskCodec::encodeRle(mask.data(), mask.size());
+    ASSERT_LT(rle.size(), 20u);
+
+    auto runs = MaskCodec::decodeRleRuns(rle.data(), rle.size());
+    ASSERT_EQ(runs.size(), 5u);
+    ASSERT_EQ(runs[1], std::make_pair(int64_t(3), uint64_t(1000)));
+    ASSERT_EQ(runs[2], std::make_pair(int64_t(-1), uint64_t(1)));
+
+    std::vector<int64_t> decoded(mask.size());
+    MaskCodec::decodeRle(rle.data(), rle.size(), decoded.data(), decoded.size());
+    ASSERT_EQ(decoded, mask);
+}
+
+TEST(MaskCodec, rle_int32_matches_int64) {
+    std::vector<int32_t> mask32 = {1, 1, 1, 2, 2, 7, 7, 7, 7, 7, 7, 7, 0};
+    std::vector<int64_t> mask64(mask32.begin(), mask32.end());
+    ASSERT_EQ(MaskCodec::encodeRle(mask32.data(), mask32.size()), MaskCodec::encodeRle(mask64.data(), mask64.size()));
+}
+
+TEST(MaskCodec, rle_malformed) {
+    std::vector<int64_t> mask(10, 5);
+    std::vector<uint8_t> rle = MaskCodec::encodeRle(mask.data(), mask.size());
+    std::vector<int64_t> decoded(mask.size() - 1);
+    // More elements than expected
+    ASSERT_THROW(MaskCodec::decodeRle(rle.data(), rle.size(), decoded.data(), decoded.size()), std::invalid_argument);
+    // Truncated varint
+    std::vector<uint8_t> truncated = {0x80};
+    ASSERT_THROW(MaskCodec::decodeRleRuns(truncated.data(), truncated.size()), std::invalid_argument);
+}
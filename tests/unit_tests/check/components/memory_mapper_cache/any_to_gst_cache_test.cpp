@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dlstreamer/cpu/tensor.h>
+#include <dlstreamer/gst/mappers/any_to_gst.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace dlstreamer;
+
+namespace {
+
+FramePtr make_frame(std::vector<uint8_t> &storage, size_t size) {
+    auto tensor = std::make_shared<CPUTensor>(TensorInfo({size}, DataType::UInt8), storage.data());
+    return std::make_shared<BaseFrame>(MediaType::Tensors, 0, TensorVector{tensor});
+}
+
+// Caller owns returned GstBuffer, same as GstDlsTransform pushing it downstream
+GstBuffer *map_frame(MemoryMapperAnyToGST &mapper, const FramePtr &src) {
+    return ptr_cast<GSTFrame>(mapper.map(src, AccessMode::ReadWrite))->gst_buffer();
+}
+
+class AnyToGstCacheTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() {
+        gst_init(nullptr, nullptr);
+    }
+};
+
+} // namespace
+
+TEST_F(AnyToGstCacheTest, released_buffer_is_reused) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 4);
+    std::vector<uint8_t> storage(16);
+    auto src = make_frame(storage, storage.size());
+
+    GstBuffer *buf1 = map_frame(mapper, src);
+    // buffer used downstream keeps source frame alive
+    ASSERT_GT(src.use_count(), 1);
+    gst_buffer_unref(buf1);
+    // idle buffer doesn't, so source pool can re-use frame
+    ASSERT_EQ(src.use_count(), 1);
+
+    GstBuffer *buf2 = map_frame(mapper, src);
+    ASSERT_EQ(buf1, buf2);
+    auto stats = mapper.cache_stats();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.misses, 1u);
+    ASSERT_EQ(stats.evictions, 0u);
+    gst_buffer_unref(buf2);
+}
+
+TEST_F(AnyToGstCacheTest, released_buffer_is_reset) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 4);
+    std::vector<uint8_t> storage(16);
+    auto src = make_frame(storage, storage.size());
+
+    GstBuffer *buf = map_frame(mapper, src);
+    GST_BUFFER_PTS(buf) = 42;
+    GST_BUFFER_FLAG_SET(buf, GST_BUFFER_FLAG_DELTA_UNIT);
+    gst_buffer_unref(buf);
+
+    buf = map_frame(mapper, src);
+    ASSERT_EQ(GST_BUFFER_PTS(buf), GST_CLOCK_TIME_NONE);
+    ASSERT_FALSE(GST_BUFFER_FLAG_IS_SET(buf, GST_BUFFER_FLAG_DELTA_UNIT));
+    gst_buffer_unref(buf);
+}
+
+TEST_F(AnyToGstCacheTest, buffer_in_use_is_not_shared) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 4);
+    std::vector<uint8_t> storage(16);
+    auto src = make_frame(storage, storage.size());
+
+    GstBuffer *buf1 = map_frame(mapper, src);
+    GstBuffer *buf2 = map_frame(mapper, src);
+    ASSERT_NE(buf1, buf2);
+    ASSERT_EQ(mapper.cache_stats().misses, 2u);
+    gst_buffer_unref(buf1);
+    gst_buffer_unref(buf2);
+    // second release replaces idle buffer of same source
+    ASSERT_EQ(mapper.cache_stats().evictions, 1u);
+}
+
+TEST_F(AnyToGstCacheTest, other_source_misses) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 4);
+    std::vector<uint8_t> storage1(16);
+    std::vector<uint8_t> storage2(16);
+
+    gst_buffer_unref(map_frame(mapper, make_frame(storage1, storage1.size())));
+    gst_buffer_unref(map_frame(mapper, make_frame(storage2, storage2.size())));
+    auto stats = mapper.cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 2u);
+}
+
+TEST_F(AnyToGstCacheTest, size_change_invalidates_entry) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 4);
+    std::vector<uint8_t> storage(16);
+
+    gst_buffer_unref(map_frame(mapper, make_frame(storage, 16)));
+    // same memory handle with different size is another tensor, stale wrapper is freed
+    GstBuffer *buf = map_frame(mapper, make_frame(storage, 8));
+    ASSERT_EQ(gst_buffer_get_size(buf), 8u);
+    auto stats = mapper.cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 2u);
+    ASSERT_EQ(stats.evictions, 1u);
+    gst_buffer_unref(buf);
+}
+
+TEST_F(AnyToGstCacheTest, clear_invalidates_idle_and_used_buffers) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 4);
+    std::vector<uint8_t> storage1(16);
+    std::vector<uint8_t> storage2(16);
+    auto src1 = make_frame(storage1, storage1.size());
+    auto src2 = make_frame(storage2, storage2.size());
+
+    gst_buffer_unref(map_frame(mapper, src1));
+    GstBuffer *used = map_frame(mapper, src2);
+    mapper.clear_cache();
+    // buffer used while cache was cleared is freed on release instead of returning to cache
+    gst_buffer_unref(used);
+    ASSERT_EQ(src2.use_count(), 1);
+
+    gst_buffer_unref(map_frame(mapper, src1));
+    gst_buffer_unref(map_frame(mapper, src2));
+    auto stats = mapper.cache_stats();
+    ASSERT_EQ(stats.hits, 0u);
+    ASSERT_EQ(stats.misses, 4u);
+}
+
+TEST_F(AnyToGstCacheTest, capacity_evicts_least_recently_released) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr, true, 2);
+    std::vector<std::vector<uint8_t>> storage(3, std::vector<uint8_t>(8));
+    std::vector<FramePtr> src;
+    for (auto &s : storage)
+        src.push_back(make_frame(s, s.size()));
+
+    for (auto &frame : src)
+        gst_buffer_unref(map_frame(mapper, frame)); // src[0] is evicted on release of src[2]
+    ASSERT_EQ(mapper.cache_stats().evictions, 1u);
+
+    gst_buffer_unref(map_frame(mapper, src[2]));
+    gst_buffer_unref(map_frame(mapper, src[1]));
+    ASSERT_EQ(mapper.cache_stats().hits, 2u);
+    gst_buffer_unref(map_frame(mapper, src[0]));
+    ASSERT_EQ(mapper.cache_stats().hits, 2u);
+    ASSERT_EQ(mapper.cache_stats().misses, 4u);
+
+    mapper.set_cache_capacity(1);
+    ASSERT_EQ(mapper.cache_stats().evictions, 3u);
+}
+
+TEST_F(AnyToGstCacheTest, disabled_cache_maps_every_frame) {
+    MemoryMapperAnyToGST mapper(nullptr, nullptr);
+    std::vector<uint8_t> storage(16);
+    auto src = make_frame(storage, storage.size());
+
+    GstBuffer *buf = map_frame(mapper, src);
+    gst_buffer_unref(buf);
+    ASSERT_EQ(src.use_count(), 1);
+    gst_buffer_unref(map_frame(mapper, src));
+    auto stats = mapper.cache_stats();
+    ASSERT_EQ(stats.hits + stats.misses, 0u);
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dlstreamer/cpu/tensor.h>
+#include <dlstreamer/memory_mapper_factory.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace dlstreamer;
+
+namespace {
+
+// Mapper creating new tensor object on each call and counting calls
+class CountingMapper : public BaseMemoryMapper {
+  public:
+    CountingMapper() : BaseMemoryMapper(nullptr, nullptr) {
+    }
+
+    TensorPtr map(TensorPtr src, AccessMode /*mode*/) override {
+        _calls++;
+        auto dst = std::make_shared<CPUTensor>(src->info(), src->data());
+        dst->set_parent(src);
+        return dst;
+    }
+
+    using BaseMemoryMapper::map;
+
+    int calls() const {
+        return _calls;
+    }
+
+  private:
+    std::atomic<int> _calls{0};
+};
+
+TensorPtr make_tensor(std::vector<uint8_t> &storage, size_t size) {
+    return std::make_shared<CPUTensor>(TensorInfo({size}, DataType::UInt8), storage.data());
+}
+
+} // namespace
+
+TEST(MemoryMapperCacheTest, repeated_map_hits_cache) {
+    auto mapper = std::make_shared<CountingMapper>();
+    MemoryMapperCache cache(mapper, 4);
+    std::vector<uint8_t> storage(16);
+    auto src = make_tensor(storage, storage.size());
+
+    auto dst1 = cache.map(src, AccessMode::Read);
+    auto dst2 = cache.map(src, AccessMode::Read);
+
+    ASSERT_EQ(dst1, dst2);
+    ASSERT_EQ(mapper->calls(), 1);
+    auto stats = cache.stats();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.misses, 1u);
+    ASSERT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+    // cached tensor must not keep source alive, so source pool can re-use it
+    ASSERT_EQ(src.use_count(), 1);
+}
+
+TEST(MemoryMapperCacheTest, capacity_evicts_least_recently_used) {
+    auto mapper = std::make_shared<CountingMapper>();
+    MemoryMapperCache cache(mapper, 2);
+    std::vector<std::vector<uint8_t>> storage(3, std::vector<uint8_t>(8));
+    std::vector<TensorPtr> src;
+    for (auto &s : storage)
+        src.push_back(make_tensor(s, s.size()));
+
+    cache.map(src[0], AccessMode::Read);
+    cache.map(src[1], AccessMode::Read);
+    cache.map(src[0], AccessMode::Read); // src[1] becomes least recently used
+    cache.map(src[2], AccessMode::Read); // evicts src[1]
+    ASSERT_EQ(mapper->calls(), 3);
+
+    cache.map(src[0], AccessMode::Read);
+    ASSERT_EQ(mapper->calls(), 3);
+    cache.map(src[1], AccessMode::Read);
+    ASSERT_EQ(mapper->calls(), 4);
+    ASSERT_EQ(cache.stats().evictions, 2u);
+}
+
+TEST(MemoryMapperCacheTest, size_change_and_clear_invalidate) {
+    auto mapper = std::make_shared<CountingMapper>();
+    MemoryMapperCache cache(mapper, 4);
+    std::vector<uint8_t> storage(16);
+
+    cache.map(make_tensor(storage, 16), AccessMode::Read);
+    // same memory handle with different size is another tensor
+    cache.map(make_tensor(storage, 8), AccessMode::Read);
+    ASSERT_EQ(mapper->calls(), 2);
+
+    cache.clear();
+    cache.map(make_tensor(storage, 8), AccessMode::Read);
+    ASSERT_EQ(mapper->calls(), 3);
+}
+
+TEST(MemoryMapperCacheTest, concurrent_map) {
+    auto mapper = std::make_shared<CountingMapper>();
+    MemoryMapperCache cache(mapper, 4);
+    std::vector<std::vector<uint8_t>> storage(4, std::vector<uint8_t>(8));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; i++) {
+                auto &s = storage[i % storage.size()];
+                ASSERT_NE(cache.map(make_tensor(s, s.size()), AccessMode::Read), nullptr);
+            }
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+
+    auto stats = cache.stats();
+    ASSERT_EQ(stats.hits + stats.misses, 4000u);
+    ASSERT_EQ(stats.evictions, 0u);
+    ASSERT_LE(mapper->calls(), 16);
+}
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "model_loader.h"
+#include "startup_profiler.h"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+int element_a;
+int element_b;
+
+const nlohmann::json &findElement(const nlohmann::json &profile, const std::string &name, const std::string &model) {
+    for (const auto &element : profile["elements"])
+        if (element["element"] == name && element["model"] == model)
+            return element;
+    throw std::runtime_error("No profile of " + name + " with model " + model);
+}
+
+} // namespace
+
+TEST(ModelLoaderTest, SubmitReturnsResult) {
+    ModelLoader loader(2);
+    auto result = loader.Submit([] { return 42; });
+    EXPECT_EQ(result.get(), 42);
+}
+
+TEST(ModelLoaderTest, ErrorIsDeliveredThroughFuture) {
+    ModelLoader loader(1);
+    auto result = loader.Submit([]() -> int { throw std::runtime_error("Model not found"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+
+    // Loader keeps running after failed task
+    EXPECT_EQ(loader.Submit([] { return 1; }).get(), 1);
+}
+
+TEST(ModelLoaderTest, ModelsAreLoadedConcurrently) {
+    ModelLoader loader(2);
+    std::mutex mutex;
+    std::condition_variable cv;
+    int started = 0;
+
+    // Each task completes only if the other one runs at the same time
+    auto task = [&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++started;
+        cv.notify_all();
+        return cv.wait_for(lock, std::chrono::seconds(10), [&] { return started == 2; });
+    };
+    auto first = loader.Submit(task);
+    auto second = loader.Submit(task);
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+}
+
+TEST(ModelLoaderTest, QueuedTasksCompleteOnDestruction) {
+    std::vector<std::future<int>> results;
+    {
+        ModelLoader loader(1);
+        for (int i = 0; i < 3; ++i)
+            results.push_back(loader.Submit([i] { return i; }));
+    }
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(results[i].wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        EXPECT_EQ(results[i].get(), i);
+    }
+}
+
+TEST(StartupProfilerTest, DisabledProfilerRecordsNothing) {
+    StartupProfiler profiler("");
+    EXPECT_FALSE(profiler.IsEnabled());
+    profiler.CapsReceived(&element_a, "/pipeline0/gvadetect0");
+    profiler.AddStage(&element_a, "compile", 10.0);
+    EXPECT_TRUE(profiler.ToJson()["elements"].empty());
+}
+
+TEST(StartupProfilerTest, ElementsWithSameNameAreProfiledSeparately) {
+    StartupProfiler profiler("unused.json");
+    // Elements with the same name in two pipelines
+    profiler.CapsReceived(&element_a, "/pipeline/gvadetect0");
+    profiler.CapsReceived(&element_b, "/pipeline/gvadetect0");
+    profiler.AddStage(&element_a, "compile", 10.0);
+    profiler.AddStage(&element_b, "compile", 20.0);
+    profiler.ModelReady(&element_a, "a.xml", "CPU", false);
+    profiler.ModelReady(&element_b, "b.xml", "GPU", true);
+
+    const nlohmann::json profile = profiler.ToJson();
+    ASSERT_EQ(profile["elements"].size(), 2u);
+    const auto &a = findElement(profile, "/pipeline/gvadetect0", "a.xml");
+    EXPECT_EQ(a["stages_ms"]["compile"], 10.0);
+    EXPECT_EQ(a["shared_instance"], false);
+    const auto &b = findElement(profile, "/pipeline/gvadetect0", "b.xml");
+    EXPECT_EQ(b["stages_ms"]["compile"], 20.0);
+    EXPECT_EQ(b["device"], "GPU");
+    EXPECT_TRUE(b["first_frame_ms"].is_null());
+}
+
+TEST(StartupProfilerTest, CapsReceivedStartsNewProfile) {
+    StartupProfiler profiler("unused.json");
+    profiler.CapsReceived(&element_a, "/pipeline0/gvadetect0");
+    profiler.AddStage(&element_a, "compile", 10.0);
+    profiler.ModelReady(&element_a, "a.xml", "CPU", false);
+
+    // Caps change reloads the model
+    profiler.CapsReceived(&element_a, "/pipeline0/gvadetect0");
+    const nlohmann::json profile = profiler.ToJson();
+    ASSERT_EQ(profile["elements"].size(), 1u);
+    EXPECT_TRUE(profile["elements"][0]["stages_ms"].empty());
+    EXPECT_TRUE(profile["elements"][0]["model_ready_ms"].is_null());
+    EXPECT_FALSE(profile["elements"][0]["caps_ms"].is_null());
+}
+
+TEST(StartupProfilerTest, FirstFrameWritesProfile) {
+    const std::string path = (std::filesystem::temp_directory_path() / "test_startup_profile.json").string();
+    std::remove(path.c_str());
+
+    StartupProfiler profiler(path);
+    profiler.CapsReceived(&element_a, "/pipeline0/gvadetect0");
+    profiler.ModelReady(&element_a, "a.xml", "CPU", false);
+    profiler.FirstFrame(&element_a);
+
+    std::ifstream file(path);
+    ASSERT_TRUE(file.good());
+    const nlohmann::json profile = nlohmann::json::parse(file);
+    ASSERT_EQ(profile["elements"].size(), 1u);
+    const auto &element = profile["elements"][0];
+    EXPECT_EQ(element["element"], "/pipeline0/gvadetect0");
+    EXPECT_LE(element["caps_ms"].get<double>(), element["model_ready_ms"].get<double>());
+    EXPECT_LE(element["model_ready_ms"].get<double>(), element["first_frame_ms"].get<double>());
+    std::remove(path.c_str());
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::ModelLoading from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
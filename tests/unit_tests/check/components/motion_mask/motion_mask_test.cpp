@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "motion_mask.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+
+struct MaskCase {
+    int width;
+    int height;
+    int threshold;
+};
+
+// Mask and its integral image as built by VA path, md_scan_blocks only reads the integral image
+void build_umat_mask(const cv::Mat &curr, const cv::Mat &prev, int threshold, cv::Mat &morph, cv::Mat &integral) {
+    cv::UMat morph_small;
+    md_build_motion_mask(curr.getUMat(cv::ACCESS_READ), prev.getUMat(cv::ACCESS_READ), morph_small, threshold);
+    morph_small.copyTo(morph);
+    md_mask_integral(morph_small, integral);
+}
+
+void expect_same_mask(const cv::Mat &curr, const cv::Mat &prev, int threshold) {
+    cv::Mat expected_morph, expected_integral;
+    build_umat_mask(curr, prev, threshold, expected_morph, expected_integral);
+
+    MotionCpuState st;
+    curr.copyTo(st.curr_small);
+    prev.copyTo(st.prev_small);
+    md_build_motion_mask_cpu(st, threshold);
+
+    ASSERT_EQ(st.morph.size(), expected_morph.size());
+    ASSERT_EQ(st.morph.type(), expected_morph.type());
+    EXPECT_EQ(cv::countNonZero(st.morph != expected_morph), 0);
+    ASSERT_EQ(st.mask_integral.type(), CV_32S);
+    EXPECT_EQ(cv::countNonZero(st.mask_integral != expected_integral), 0);
+}
+
+class MotionMaskTest : public ::testing::TestWithParam<MaskCase> {};
+
+} // namespace
+
+TEST_P(MotionMaskTest, random_frames_match_umat_path) {
+    const MaskCase c = GetParam();
+    cv::RNG rng(c.width * 1000 + c.height + c.threshold);
+    cv::Mat curr(c.height, c.width, CV_8UC1);
+    cv::Mat prev(c.height, c.width, CV_8UC1);
+    rng.fill(curr, cv::RNG::UNIFORM, 0, 256);
+    rng.fill(prev, cv::RNG::UNIFORM, 0, 256);
+    expect_same_mask(curr, prev, c.threshold);
+}
+
+TEST_P(MotionMaskTest, moving_object_matches_umat_path) {
+    const MaskCase c = GetParam();
+    cv::RNG rng(c.width + c.height * 1000 + c.threshold);
+    cv::Mat prev(c.height, c.width, CV_8UC1);
+    rng.fill(prev, cv::RNG::NORMAL, 128, 8);
+    cv::Mat curr = prev.clone();
+    cv::Rect object(c.width / 4, c.height / 4, c.width / 4 + 1, c.height / 4 + 1);
+    rng.fill(curr(object), cv::RNG::UNIFORM, 0, 256);
+    expect_same_mask(curr, prev, c.threshold);
+}
+
+TEST_P(MotionMaskTest, static_frame_has_no_motion) {
+    const MaskCase c = GetParam();
+    cv::Mat frame(c.height, c.width, CV_8UC1);
+    cv::RNG(c.threshold).fill(frame, cv::RNG::UNIFORM, 0, 256);
+    expect_same_mask(frame, frame, c.threshold);
+
+    MotionCpuState st;
+    frame.copyTo(st.curr_small);
+    frame.copyTo(st.prev_small);
+    md_build_motion_mask_cpu(st, c.threshold);
+    EXPECT_EQ(cv::countNonZero(st.morph), 0);
+}
+
+// Working size of element (320 wide) and odd or degenerate sizes exercising reflected borders and stripe boundaries
+INSTANTIATE_TEST_SUITE_P(MotionMask, MotionMaskTest,
+                         ::testing::Values(MaskCase{320, 180, 1}, MaskCase{320, 180, 15}, MaskCase{320, 240, 40},
+                                           MaskCase{320, 180, 255}, MaskCase{37, 23, 10}, MaskCase{5, 3, 10},
+                                           MaskCase{1, 7, 10}, MaskCase{7, 1, 10}, MaskCase{2, 2, 1},
+                                           MaskCase{64, 65, 20}));
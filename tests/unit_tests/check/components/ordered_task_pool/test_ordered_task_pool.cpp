@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "ordered_task_pool.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int stream_a;
+int stream_b;
+
+constexpr size_t THREADS = 4;
+constexpr size_t MAX_PENDING = 8;
+constexpr int TASKS = 100;
+
+// Blocks tasks until released
+class Gate {
+  public:
+    void wait() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _entered = true;
+        _cv.notify_all();
+        _cv.wait(lock, [this] { return _open; });
+    }
+
+    void wait_entered() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _entered; });
+    }
+
+    void open() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _open = true;
+        _cv.notify_all();
+    }
+
+  private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _entered = false;
+    bool _open = false;
+};
+
+} // namespace
+
+TEST(OrderedTaskPoolTest, TasksOfKeyRunInSubmissionOrder) {
+    std::vector<int> order_a;
+    std::vector<int> order_b;
+    {
+        OrderedTaskPool pool(THREADS, MAX_PENDING);
+        for (int i = 0; i < TASKS; ++i) {
+            pool.schedule(&stream_a, [&order_a, i] { order_a.push_back(i); });
+            pool.schedule(&stream_b, [&order_b, i] { order_b.push_back(i); });
+        }
+        pool.wait_idle();
+    }
+
+    ASSERT_EQ(order_a.size(), static_cast<size_t>(TASKS));
+    ASSERT_EQ(order_b.size(), static_cast<size_t>(TASKS));
+    for (int i = 0; i < TASKS; ++i) {
+        EXPECT_EQ(order_a[i], i);
+        EXPECT_EQ(order_b[i], i);
+    }
+}
+
+TEST(OrderedTaskPoolTest, TasksOfKeyDontOverlap) {
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+    OrderedTaskPool pool(THREADS, MAX_PENDING);
+    for (int i = 0; i < TASKS; ++i) {
+        pool.schedule(&stream_a, [&running, &max_running] {
+            int now = ++running;
+            max_running = std::max(max_running.load(), now);
+            std::this_thread::yield();
+            --running;
+        });
+    }
+    pool.wait_idle();
+    EXPECT_EQ(max_running.load(), 1);
+}
+
+TEST(OrderedTaskPoolTest, WaitIdleForKeyIgnoresOtherKeys) {
+    Gate gate;
+    std::atomic<int> done_a{0};
+    OrderedTaskPool pool(THREADS, MAX_PENDING);
+
+    // Stream B is busy all the time the stream A is flushed
+    pool.schedule(&stream_b, [&gate] { gate.wait(); });
+    gate.wait_entered();
+    for (int i = 0; i < TASKS; ++i)
+        pool.schedule(&stream_a, [&done_a] { ++done_a; });
+
+    pool.wait_idle(&stream_a);
+    EXPECT_EQ(done_a.load(), TASKS);
+
+    gate.open();
+    pool.wait_idle();
+}
+
+TEST(OrderedTaskPoolTest, WaitIdleWaitsForRunningTask) {
+    Gate gate;
+    std::atomic<bool> finished{false};
+    OrderedTaskPool pool(THREADS, MAX_PENDING);
+    pool.schedule(&stream_a, [&gate, &finished] {
+        gate.wait();
+        finished = true;
+    });
+    gate.wait_entered();
+
+    std::thread opener([&gate] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        gate.open();
+    });
+    pool.wait_idle(&stream_a);
+    EXPECT_TRUE(finished.load());
+    opener.join();
+}
+
+TEST(OrderedTaskPoolTest, WaitIdleForUnknownKeyReturns) {
+    OrderedTaskPool pool(THREADS, MAX_PENDING);
+    pool.wait_idle(&stream_a);
+    pool.wait_idle();
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::OrderedTaskPool from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "pool_allocator.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Payload {
+    int value = 0;
+    std::vector<int> data;
+};
+
+std::shared_ptr<Payload> make_payload(const std::shared_ptr<BlockPool> &pool, int value) {
+    auto payload = std::allocate_shared<Payload>(PoolAllocator<Payload>(pool));
+    payload->value = value;
+    return payload;
+}
+
+} // namespace
+
+TEST(PoolAllocator, freed_blocks_are_reused) {
+    auto pool = std::make_shared<BlockPool>(4);
+    void *first_block = nullptr;
+    {
+        auto payload = make_payload(pool, 1);
+        first_block = payload.get();
+        EXPECT_EQ(pool->cached(), 0u);
+    }
+    EXPECT_EQ(pool->cached(), 1u);
+
+    // Object and control block share one block, so the same memory is handed out again
+    auto payload = make_payload(pool, 2);
+    EXPECT_EQ(payload.get(), first_block);
+    EXPECT_EQ(payload->value, 2);
+    EXPECT_TRUE(payload->data.empty());
+    EXPECT_EQ(pool->cached(), 0u);
+}
+
+TEST(PoolAllocator, cache_is_bounded) {
+    auto pool = std::make_shared<BlockPool>(2);
+    std::vector<std::shared_ptr<Payload>> payloads;
+    for (int i = 0; i < 5; i++)
+        payloads.push_back(make_payload(pool, i));
+    payloads.clear();
+    EXPECT_EQ(pool->cached(), 2u);
+}
+
+TEST(PoolAllocator, other_sizes_bypass_pool) {
+    auto pool = std::make_shared<BlockPool>(4);
+    PoolAllocator<int> allocator(pool);
+    int *block = allocator.allocate(4);
+    allocator.deallocate(block, 4);
+    EXPECT_EQ(pool->cached(), 1u);
+
+    int *other = allocator.allocate(8);
+    allocator.deallocate(other, 8);
+    EXPECT_EQ(pool->cached(), 1u);
+}
+
+TEST(PoolAllocator, pool_outlives_owner) {
+    auto pool = std::make_shared<BlockPool>(4);
+    auto payload = make_payload(pool, 3);
+    pool.reset();
+    // Allocator stored in control block keeps pool alive until the object is freed
+    EXPECT_EQ(payload->value, 3);
+    payload.reset();
+}
+
+TEST(PoolAllocator, objects_freed_on_other_threads) {
+    auto pool = std::make_shared<BlockPool>(64);
+    const int iterations = 1000;
+    std::vector<std::shared_ptr<Payload>> payloads(iterations);
+    std::thread producer([&] {
+        for (int i = 0; i < iterations; i++)
+            payloads[i] = make_payload(pool, i);
+    });
+    producer.join();
+    std::thread consumer([&] {
+        for (int i = 0; i < iterations; i++) {
+            EXPECT_EQ(payloads[i]->value, i);
+            payloads[i].reset();
+        }
+    });
+    consumer.join();
+    EXPECT_EQ(pool->cached(), 64u);
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "common/post_processor/converters/to_tensor/human_pose_extractor/human_pose_extractor.h"
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr size_t KEYPOINTS_NUMBER = 18;
+constexpr int HEAT_MAPS_NUMBER = 19; // keypoints and background
+constexpr int PAFS_NUMBER = 38;
+constexpr int MAP_WIDTH = 64;
+constexpr int MAP_HEIGHT = 40;
+constexpr int MAP_SIZE = MAP_WIDTH * MAP_HEIGHT;
+
+// Keypoints of a person relative to the neck
+const cv::Point2f SKELETON[KEYPOINTS_NUMBER] = {{0, -4},   {0, 0},   {-3, 0},  {-5, 5}, {-6, 10}, {3, 0},
+                                                {5, 5},    {6, 10},  {-2, 11}, {-2, 18}, {-2, 25}, {2, 11},
+                                                {2, 18},   {2, 25},  {-1, -5}, {1, -5},  {-2, -4}, {2, -4}};
+
+// Keypoints connected by limbs and PAF channels of the limbs, same as expected by HumanPoseExtractor
+const std::pair<int, int> LIMB_KEYPOINTS[] = {{1, 2}, {1, 5},  {2, 3},   {3, 4},  {5, 6},   {6, 7},
+                                              {1, 8}, {8, 9},  {9, 10},  {1, 11}, {11, 12}, {12, 13},
+                                              {1, 0}, {0, 14}, {14, 16}, {0, 15}, {15, 17}};
+const std::pair<int, int> LIMB_PAFS[] = {{12, 13}, {20, 21}, {14, 15}, {16, 17}, {22, 23}, {24, 25},
+                                         {0, 1},   {2, 3},   {4, 5},   {6, 7},   {8, 9},   {10, 11},
+                                         {28, 29}, {30, 31}, {34, 35}, {32, 33}, {36, 37}};
+
+} // namespace
+
+struct HumanPoseExtractorTest : public testing::Test {
+  protected:
+    // Necks of two persons standing apart, keypoints are placed between pixels of feature maps
+    std::vector<cv::Point2f> _necks{{14.3f, 8.6f}, {46.7f, 9.2f}};
+    std::vector<float> _heat_maps;
+    std::vector<float> _pafs;
+
+    void SetUp() override {
+        _heat_maps.assign(HEAT_MAPS_NUMBER * MAP_SIZE, 0.0f);
+        _pafs.assign(PAFS_NUMBER * MAP_SIZE, 0.0f);
+        for (const auto &neck : _necks) {
+            for (size_t k = 0; k < KEYPOINTS_NUMBER; k++)
+                drawKeypoint(&_heat_maps[k * MAP_SIZE], neck + SKELETON[k]);
+            for (size_t l = 0; l < std::size(LIMB_KEYPOINTS); l++)
+                drawLimb(&_pafs[LIMB_PAFS[l].first * MAP_SIZE], &_pafs[LIMB_PAFS[l].second * MAP_SIZE],
+                         neck + SKELETON[LIMB_KEYPOINTS[l].first], neck + SKELETON[LIMB_KEYPOINTS[l].second]);
+        }
+    }
+
+    static void drawKeypoint(float *heat_map, cv::Point2f center) {
+        const float sigma = 1.5f;
+        for (int y = 0; y < MAP_HEIGHT; y++) {
+            for (int x = 0; x < MAP_WIDTH; x++) {
+                float dx = x - center.x;
+                float dy = y - center.y;
+                float &value = heat_map[y * MAP_WIDTH + x];
+                value = std::max(value, std::exp(-(dx * dx + dy * dy) / (2 * sigma * sigma)));
+            }
+        }
+    }
+
+    // Unit vectors along the limb fading with distance from it
+    static void drawLimb(float *paf_x, float *paf_y, cv::Point2f a, cv::Point2f b) {
+        const float sigma = 1.0f;
+        const cv::Point2f limb = b - a;
+        const float length = std::sqrt(limb.dot(limb));
+        const cv::Point2f direction = limb / length;
+        for (int y = 0; y < MAP_HEIGHT; y++) {
+            for (int x = 0; x < MAP_WIDTH; x++) {
+                cv::Point2f point = cv::Point2f(x, y) - a;
+                float t = std::min(std::max(point.dot(direction), 0.0f), length);
+                cv::Point2f distance = point - direction * t;
+                float weight = std::exp(-distance.dot(distance) / (2 * sigma * sigma));
+                paf_x[y * MAP_WIDTH + x] += direction.x * weight;
+                paf_y[y * MAP_WIDTH + x] += direction.y * weight;
+            }
+        }
+    }
+
+    HumanPoseExtractor::HumanPoses extract(HumanPoseExtractor::ResizeDeviceType device_type) const {
+        HumanPoseExtractor extractor(KEYPOINTS_NUMBER, device_type);
+        auto poses = extractor.postprocess(_heat_maps.data(), MAP_SIZE, HEAT_MAPS_NUMBER, _pafs.data(), MAP_SIZE,
+                                           PAFS_NUMBER, MAP_WIDTH, MAP_HEIGHT);
+        extractor.correctCoordinates(poses, cv::Size(MAP_WIDTH, MAP_HEIGHT));
+        std::sort(poses.begin(), poses.end(),
+                  [](const auto &a, const auto &b) { return a.keypoints[1].x < b.keypoints[1].x; });
+        return poses;
+    }
+};
+
+TEST_F(HumanPoseExtractorTest, NativeResolutionMatchesResizedMaps) {
+    auto reference = extract(HumanPoseExtractor::ResizeDeviceType::CPU_OCV);
+    auto poses = extract(HumanPoseExtractor::ResizeDeviceType::NATIVE);
+
+    ASSERT_EQ(reference.size(), _necks.size());
+    ASSERT_EQ(poses.size(), reference.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        EXPECT_NEAR(poses[i].score, reference[i].score, 1e-3f * reference[i].score);
+        ASSERT_EQ(poses[i].keypoints.size(), reference[i].keypoints.size());
+        for (size_t k = 0; k < poses[i].keypoints.size(); k++) {
+            EXPECT_FLOAT_EQ(poses[i].keypoints[k].x, reference[i].keypoints[k].x) << "keypoint " << k;
+            EXPECT_FLOAT_EQ(poses[i].keypoints[k].y, reference[i].keypoints[k].y) << "keypoint " << k;
+        }
+    }
+}
+
+TEST_F(HumanPoseExtractorTest, KeypointsAreRefinedOnUpsampledGrid) {
+    auto poses = extract(HumanPoseExtractor::ResizeDeviceType::NATIVE);
+
+    ASSERT_EQ(poses.size(), _necks.size());
+    for (size_t i = 0; i < poses.size(); i++) {
+        for (size_t k = 0; k < KEYPOINTS_NUMBER; k++) {
+            // Normalized coordinates of pixel centers, tolerance is one pixel of upsampled map
+            cv::Point2f expected = _necks[i] + SKELETON[k] + cv::Point2f(0.5f, 0.5f);
+            EXPECT_NEAR(poses[i].keypoints[k].x, expected.x / MAP_WIDTH, 0.25f / MAP_WIDTH) << "keypoint " << k;
+            EXPECT_NEAR(poses[i].keypoints[k].y, expected.y / MAP_HEIGHT, 0.25f / MAP_HEIGHT) << "keypoint " << k;
+        }
+    }
+}
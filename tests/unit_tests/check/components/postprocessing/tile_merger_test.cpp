@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "common/post_processor/tile_merger.h"
+#include "gva_base_inference.h"
+#include "processor_types.h"
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace post_processing;
+
+namespace {
+
+constexpr size_t TILE_COUNT = 2;
+
+// Element inferring frames split into two tiles, left and right half of the frame overlapping in the middle
+struct TestElement {
+    GvaBaseInference element = {};
+    std::string instance_id;
+
+    explicit TestElement(const std::string &id) : instance_id(id) {
+        element.model_instance_id = const_cast<gchar *>(instance_id.c_str());
+    }
+};
+
+class TileMergerTest : public testing::Test {
+  protected:
+    std::shared_ptr<GstVideoInfo> info{gst_video_info_new(), gst_video_info_free};
+
+    void SetUp() override {
+        gst_video_info_set_format(info.get(), GST_VIDEO_FORMAT_BGR, 640, 480);
+    }
+
+    std::shared_ptr<InferenceFrame> createTile(TestElement &element, uint64_t frame_num, size_t tile) {
+        auto frame = std::make_shared<InferenceFrame>();
+        frame->buffer = nullptr;
+        frame->gva_base_inference = &element.element;
+        frame->info = info;
+        frame->tile = tile;
+        frame->tile_count = TILE_COUNT;
+        frame->frame_num = frame_num;
+        return frame;
+    }
+
+    static std::vector<GstStructure *> createDetection(double x_min, double x_max, double confidence) {
+        GstStructure *detection = gst_structure_new("detection", "x_min", G_TYPE_DOUBLE, x_min, "y_min", G_TYPE_DOUBLE,
+                                                    0.2, "x_max", G_TYPE_DOUBLE, x_max, "y_max", G_TYPE_DOUBLE, 0.4,
+                                                    "confidence", G_TYPE_DOUBLE, confidence, "label_id", G_TYPE_INT, 1,
+                                                    NULL);
+        return {detection};
+    }
+
+    static std::vector<double> confidences(const std::vector<std::vector<GstStructure *>> &detections) {
+        std::vector<double> result;
+        for (const auto &detection : detections) {
+            double confidence = 0;
+            gst_structure_get_double(detection[DETECTION_TENSOR_ID], "confidence", &confidence);
+            result.push_back(confidence);
+        }
+        return result;
+    }
+
+    static void freeTable(TensorsTable &table) {
+        for (auto &frame_detections : table)
+            for (auto &detection : frame_detections)
+                for (GstStructure *s : detection)
+                    gst_structure_free(s);
+        table.clear();
+    }
+};
+
+TEST_F(TileMergerTest, MergesSeamDuplicates) {
+    TestElement element("tile_merger_test");
+    TileMerger merger(0.5);
+
+    // Object cut by the seam in the left tile, found whole in the right one. Another object is only in the left tile
+    InferenceFrames left = {createTile(element, 0, 0)};
+    TensorsTable left_table = {{createDetection(0.45, 0.5, 0.6), createDetection(0.1, 0.2, 0.9)}};
+    merger.merge(left_table, FramesWrapper(left));
+    EXPECT_TRUE(left_table[0].empty());
+
+    InferenceFrames right = {createTile(element, 0, 1)};
+    TensorsTable right_table = {{createDetection(0.45, 0.55, 0.8)}};
+    merger.merge(right_table, FramesWrapper(right));
+    EXPECT_EQ(confidences(right_table[0]), (std::vector<double>{0.9, 0.8}));
+
+    freeTable(right_table);
+}
+
+TEST_F(TileMergerTest, KeepsInterleavedFramesApart) {
+    TestElement first("first");
+    TestElement second("second");
+    TileMerger merger(0.5);
+
+    // Tiles of two frames and of the same frame number of another element come in one batch
+    InferenceFrames frames = {createTile(first, 0, 0), createTile(first, 1, 0), createTile(second, 0, 0)};
+    TensorsTable table = {{createDetection(0.1, 0.2, 0.5)}, {createDetection(0.1, 0.2, 0.6)},
+                          {createDetection(0.1, 0.2, 0.7)}};
+    merger.merge(table, FramesWrapper(frames));
+
+    frames = {createTile(first, 1, 1), createTile(second, 0, 1), createTile(first, 0, 1)};
+    table = {{}, {createDetection(0.6, 0.7, 0.3)}, {}};
+    merger.merge(table, FramesWrapper(frames));
+    EXPECT_EQ(confidences(table[0]), (std::vector<double>{0.6}));
+    EXPECT_EQ(confidences(table[1]), (std::vector<double>{0.7, 0.3}));
+    EXPECT_EQ(confidences(table[2]), (std::vector<double>{0.5}));
+
+    freeTable(table);
+}
+
+TEST_F(TileMergerTest, DropsFailedFrame) {
+    TestElement element("tile_merger_test");
+    TileMerger merger(0.5);
+
+    InferenceFrames left = {createTile(element, 0, 0)};
+    TensorsTable left_table = {{createDetection(0.1, 0.2, 0.9)}};
+    merger.merge(left_table, FramesWrapper(left));
+
+    // Inference of the right tile failed: the frame gets no detections and is not kept
+    merger.discard(FramesWrapper(InferenceFrames{createTile(element, 0, 1)}));
+
+    // Frame number starts over after failed frame, e.g. on stream restart
+    left_table = {{createDetection(0.1, 0.2, 0.4)}};
+    merger.merge(left_table, FramesWrapper(left));
+    InferenceFrames right = {createTile(element, 0, 1)};
+    TensorsTable right_table = {{}};
+    merger.merge(right_table, FramesWrapper(right));
+    EXPECT_EQ(confidences(right_table[0]), (std::vector<double>{0.4}));
+
+    freeTable(right_table);
+}
+
+TEST_F(TileMergerTest, DropsDetectionsOfTilesAfterFailure) {
+    TestElement element("tile_merger_test");
+    TileMerger merger(0.5);
+
+    merger.discard(FramesWrapper(InferenceFrames{createTile(element, 0, 0)}));
+
+    InferenceFrames right = {createTile(element, 0, 1)};
+    TensorsTable right_table = {{createDetection(0.6, 0.7, 0.9)}};
+    merger.merge(right_table, FramesWrapper(right));
+    EXPECT_TRUE(right_table[0].empty());
+}
+
+TEST_F(TileMergerTest, ClearDropsPendingFrames) {
+    TestElement element("tile_merger_test");
+    TileMerger merger(0.5);
+
+    InferenceFrames left = {createTile(element, 0, 0)};
+    TensorsTable left_table = {{createDetection(0.1, 0.2, 0.9)}};
+    merger.merge(left_table, FramesWrapper(left));
+    merger.clear();
+
+    // Right tile of the frame after flush starts a new frame instead of completing the dropped one
+    InferenceFrames right = {createTile(element, 0, 1)};
+    TensorsTable right_table = {{createDetection(0.6, 0.7, 0.8)}};
+    merger.merge(right_table, FramesWrapper(right));
+    EXPECT_TRUE(right_table[0].empty());
+
+    left_table = {{}};
+    merger.merge(left_table, FramesWrapper(left));
+    EXPECT_EQ(confidences(left_table[0]), (std::vector<double>{0.8}));
+
+    freeTable(left_table);
+}
+
+} // namespace
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "gvarealsense_pcd.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr guint WIDTH = 64;
+constexpr guint HEIGHT = 48;
+constexpr float DEPTH_SCALE = 0.001f;
+
+struct SyntheticFrames {
+    DepthIntrinsics intrinsics = {WIDTH, HEIGHT, 60.0f, 62.0f, 31.5f, 23.5f};
+    std::vector<guint16> depth = std::vector<guint16>(WIDTH * HEIGHT);
+    std::vector<guint8> rgb = std::vector<guint8>(WIDTH * HEIGHT * 3);
+
+    SyntheticFrames() {
+        // Tilted plane with holes (zero depth) and color gradient
+        for (guint v = 0; v < HEIGHT; ++v) {
+            for (guint u = 0; u < WIDTH; ++u) {
+                const guint i = v * WIDTH + u;
+                depth[i] = (u + v) % 11 == 0 ? 0 : static_cast<guint16>(800 + 5 * u + 3 * v);
+                rgb[3 * i] = static_cast<guint8>(4 * u);
+                rgb[3 * i + 1] = static_cast<guint8>(5 * v);
+                rgb[3 * i + 2] = static_cast<guint8>(u ^ v);
+            }
+        }
+    }
+
+    std::vector<PointXYZRGB> deproject() const {
+        std::vector<PointXYZRGB> points(WIDTH * HEIGHT);
+        GvaRealSensePcd::deprojectDepth(depth.data(), WIDTH * sizeof(guint16), DEPTH_SCALE, intrinsics, rgb.data(),
+                                        WIDTH * 3, points.data());
+        return points;
+    }
+};
+
+void expectSamePoints(const std::vector<PointXYZRGB> &actual, const std::vector<PointXYZRGB> &expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_FLOAT_EQ(actual[i].x, expected[i].x) << "point " << i;
+        ASSERT_FLOAT_EQ(actual[i].y, expected[i].y) << "point " << i;
+        ASSERT_FLOAT_EQ(actual[i].z, expected[i].z) << "point " << i;
+        ASSERT_EQ(actual[i].r, expected[i].r) << "point " << i;
+        ASSERT_EQ(actual[i].g, expected[i].g) << "point " << i;
+        ASSERT_EQ(actual[i].b, expected[i].b) << "point " << i;
+    }
+}
+
+std::vector<guint8> build(const std::vector<PointXYZRGB> &points, PcdDataFormat format) {
+    std::vector<guint8> pcd(GvaRealSensePcd::getMaxPcdSize(points.size(), format));
+    pcd.resize(GvaRealSensePcd::buildPcd(points.data(), points.size(), format, pcd.data()));
+    return pcd;
+}
+
+} // namespace
+
+TEST(RealSensePcdTest, DeprojectionFollowsPinholeModel) {
+    const SyntheticFrames frames;
+    const std::vector<PointXYZRGB> points = frames.deproject();
+
+    const guint u = 40, v = 10;
+    const PointXYZRGB &point = points[v * WIDTH + u];
+    const float z = frames.depth[v * WIDTH + u] * DEPTH_SCALE;
+    EXPECT_FLOAT_EQ(point.z, z);
+    EXPECT_FLOAT_EQ(point.x, z * (u - frames.intrinsics.ppx) / frames.intrinsics.fx);
+    EXPECT_FLOAT_EQ(point.y, z * (v - frames.intrinsics.ppy) / frames.intrinsics.fy);
+    EXPECT_EQ(point.r, 4 * u);
+    EXPECT_EQ(point.g, 5 * v);
+    EXPECT_EQ(point.b, u ^ v);
+
+    // Pixel without depth
+    const PointXYZRGB &hole = points[0];
+    EXPECT_EQ(hole.x, 0.0f);
+    EXPECT_EQ(hole.y, 0.0f);
+    EXPECT_EQ(hole.z, 0.0f);
+}
+
+TEST(RealSensePcdTest, DeprojectionWithoutColorGivesBlackPoints) {
+    const SyntheticFrames frames;
+    std::vector<PointXYZRGB> points(WIDTH * HEIGHT);
+    GvaRealSensePcd::deprojectDepth(frames.depth.data(), WIDTH * sizeof(guint16), DEPTH_SCALE, frames.intrinsics,
+                                    nullptr, 0, points.data());
+
+    for (const auto &point : points) {
+        ASSERT_EQ(point.r, 0);
+        ASSERT_EQ(point.g, 0);
+        ASSERT_EQ(point.b, 0);
+    }
+}
+
+TEST(RealSensePcdTest, BinaryDataIsPointRecords) {
+    const std::vector<PointXYZRGB> points = SyntheticFrames().deproject();
+    const std::vector<guint8> pcd = build(points, PcdDataFormat::Binary);
+
+    const std::string header = GvaRealSensePcd::getPcdHeader(points.size(), points.size(), PcdDataFormat::Binary);
+    ASSERT_EQ(pcd.size(), header.size() + points.size() * sizeof(PointXYZRGB));
+    EXPECT_EQ(std::string(pcd.begin(), pcd.begin() + header.size()), header);
+    EXPECT_EQ(std::memcmp(pcd.data() + header.size(), points.data(), points.size() * sizeof(PointXYZRGB)), 0);
+}
+
+TEST(RealSensePcdTest, CompressedDataIsSmaller) {
+    const std::vector<PointXYZRGB> points = SyntheticFrames().deproject();
+
+    EXPECT_LT(build(points, PcdDataFormat::BinaryCompressed).size(), build(points, PcdDataFormat::Binary).size());
+}
+
+class RealSensePcdRoundTripTest : public testing::TestWithParam<PcdDataFormat> {};
+
+TEST_P(RealSensePcdRoundTripTest, BufferRoundTrip) {
+    const std::vector<PointXYZRGB> points = SyntheticFrames().deproject();
+    const std::vector<guint8> pcd = build(points, GetParam());
+
+    expectSamePoints(GvaRealSensePcd::readBuffer(pcd.data(), pcd.size()), points);
+}
+
+TEST_P(RealSensePcdRoundTripTest, FileRoundTrip) {
+    const std::vector<PointXYZRGB> points = SyntheticFrames().deproject();
+    gchar *path = g_build_filename(g_get_tmp_dir(), "test_realsense_pcd.pcd", NULL);
+    const std::string filename = path;
+    g_free(path);
+
+    GvaRealSensePcd::writeFile(filename, points, GetParam());
+    const std::vector<PointXYZRGB> read_points = GvaRealSensePcd::readFile(filename);
+    std::remove(filename.c_str());
+
+    expectSamePoints(read_points, points);
+}
+
+INSTANTIATE_TEST_SUITE_P(Formats, RealSensePcdRoundTripTest,
+                         testing::Values(PcdDataFormat::Ascii, PcdDataFormat::Binary,
+                                         PcdDataFormat::BinaryCompressed));
+
+TEST(RealSensePcdTest, ReadsPackedRgbField) {
+    // Layout written by PCL for pcl::PointXYZRGB
+    const std::string pcd = "# .PCD v0.7 - Point Cloud Data file format\n"
+                            "VERSION 0.7\n"
+                            "FIELDS x y z rgb\n"
+                            "SIZE 4 4 4 4\n"
+                            "TYPE F F F U\n"
+                            "COUNT 1 1 1 1\n"
+                            "WIDTH 2\n"
+                            "HEIGHT 1\n"
+                            "VIEWPOINT 0 0 0 1 0 0 0\n"
+                            "POINTS 2\n"
+                            "DATA ascii\n"
+                            "0.5 -1 2 16711680\n"
+                            "nan nan nan 258\n";
+
+    const std::vector<PointXYZRGB> points =
+        GvaRealSensePcd::readBuffer(reinterpret_cast<const guint8 *>(pcd.data()), pcd.size());
+
+    ASSERT_EQ(points.size(), 2u);
+    EXPECT_FLOAT_EQ(points[0].x, 0.5f);
+    EXPECT_FLOAT_EQ(points[0].y, -1.0f);
+    EXPECT_FLOAT_EQ(points[0].z, 2.0f);
+    EXPECT_EQ(points[0].r, 255);
+    EXPECT_EQ(points[0].g, 0);
+    EXPECT_EQ(points[0].b, 0);
+    EXPECT_EQ(points[1].g, 1);
+    EXPECT_EQ(points[1].b, 2);
+}
+
+TEST(RealSensePcdTest, CorruptedCompressedDataThrows) {
+    const std::vector<PointXYZRGB> points = SyntheticFrames().deproject();
+    std::vector<guint8> pcd = build(points, PcdDataFormat::BinaryCompressed);
+    pcd.resize(pcd.size() / 2);
+
+    EXPECT_THROW(GvaRealSensePcd::readBuffer(pcd.data(), pcd.size()), std::runtime_error);
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::RealSensePcd from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "region_signature.h"
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr int WIDTH = 320;
+constexpr int HEIGHT = 240;
+
+// Gray gradient image with 3 bytes per pixel, like BGR
+std::vector<uint8_t> makeImage() {
+    std::vector<uint8_t> image(WIDTH * HEIGHT * 3);
+    for (int y = 0; y < HEIGHT; ++y)
+        for (int x = 0; x < WIDTH; ++x)
+            for (int c = 0; c < 3; ++c)
+                image[(y * WIDTH + x) * 3 + c] = static_cast<uint8_t>((x + y) / 2);
+    return image;
+}
+
+RegionSignature::Signature compute(const std::vector<uint8_t> &image, int x, int y, int w, int h) {
+    // Green component of BGR pixels
+    return RegionSignature::compute(image.data() + 1, WIDTH * 3, 3, x, y, w, h);
+}
+
+void fill(std::vector<uint8_t> &image, int x, int y, int w, int h, uint8_t value) {
+    for (int row = y; row < y + h; ++row)
+        for (int column = x; column < x + w; ++column)
+            image[(row * WIDTH + column) * 3 + 1] = value;
+}
+
+} // namespace
+
+TEST(RegionSignature, same_region_matches) {
+    const auto image = makeImage();
+    EXPECT_TRUE(RegionSignature::matches(compute(image, 40, 30, 100, 80), compute(image, 40, 30, 100, 80)));
+}
+
+TEST(RegionSignature, box_jitter_is_tolerated) {
+    const auto image = makeImage();
+    const auto signature = compute(image, 40, 30, 100, 80);
+    EXPECT_TRUE(RegionSignature::matches(signature, compute(image, 41, 30, 100, 81)));
+    EXPECT_FALSE(RegionSignature::matches(signature, compute(image, 50, 30, 100, 80)));
+    EXPECT_FALSE(RegionSignature::matches(signature, compute(image, 40, 30, 120, 80)));
+}
+
+TEST(RegionSignature, content_change_is_detected) {
+    auto image = makeImage();
+    const auto signature = compute(image, 40, 30, 100, 80);
+
+    // Noise-like change of a few pixels doesn't change mean luma of cells
+    fill(image, 60, 50, 1, 1, 255);
+    EXPECT_TRUE(RegionSignature::matches(signature, compute(image, 40, 30, 100, 80)));
+
+    // Change of one cell of the grid is detected
+    fill(image, 40, 30, 13, 10, 255);
+    EXPECT_FALSE(RegionSignature::matches(signature, compute(image, 40, 30, 100, 80)));
+}
+
+TEST(RegionSignature, region_smaller_than_grid) {
+    auto image = makeImage();
+    const auto signature = compute(image, 10, 10, 3, 2);
+    EXPECT_TRUE(RegionSignature::matches(signature, compute(image, 10, 10, 3, 2)));
+
+    fill(image, 10, 10, 3, 2, 255);
+    EXPECT_FALSE(RegionSignature::matches(signature, compute(image, 10, 10, 3, 2)));
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::RegionSignature from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "request_scheduler.h"
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int stream_a;
+int stream_b;
+int stream_c;
+int holder;
+
+struct Request {
+    std::string name;
+    const void *stream;
+    unsigned weight;
+    uint64_t deadline_ns;
+};
+
+// Queues requests one by one while the turn is held, then returns order in which they were served
+std::vector<std::string> serve(RequestScheduler &scheduler, const std::vector<Request> &requests) {
+    std::vector<std::string> order;
+    std::mutex order_mutex;
+
+    scheduler.Acquire(&holder, 1, 0);
+    std::vector<std::thread> threads;
+    for (const auto &request : requests) {
+        threads.emplace_back([&scheduler, &order, &order_mutex, request] {
+            RequestScheduler::Turn turn(scheduler, request.stream, request.weight, request.deadline_ns);
+            std::lock_guard<std::mutex> lock(order_mutex);
+            order.push_back(request.name);
+        });
+        while (scheduler.GetWaitingCount() < threads.size())
+            std::this_thread::yield();
+    }
+    scheduler.Release();
+
+    for (auto &thread : threads)
+        thread.join();
+    return order;
+}
+
+} // namespace
+
+TEST(RequestScheduler, policy_names) {
+    EXPECT_EQ(RequestScheduler::PolicyFromString("fifo"), RequestScheduler::Policy::Fifo);
+    EXPECT_EQ(RequestScheduler::PolicyFromString("round-robin"), RequestScheduler::Policy::RoundRobin);
+    EXPECT_EQ(RequestScheduler::PolicyFromString("weighted-fair"), RequestScheduler::Policy::WeightedFair);
+    EXPECT_EQ(RequestScheduler::PolicyFromString("deadline"), RequestScheduler::Policy::EarliestDeadline);
+    EXPECT_THROW(RequestScheduler::PolicyFromString("latency"), std::invalid_argument);
+}
+
+TEST(RequestScheduler, fifo_serves_in_arrival_order) {
+    RequestScheduler scheduler(RequestScheduler::Policy::Fifo);
+    auto order = serve(scheduler, {{"a1", &stream_a, 1, 0},
+                                   {"a2", &stream_a, 1, 0},
+                                   {"b1", &stream_b, 1, 0},
+                                   {"a3", &stream_a, 1, 0}});
+    EXPECT_EQ(order, std::vector<std::string>({"a1", "a2", "b1", "a3"}));
+}
+
+TEST(RequestScheduler, round_robin_alternates_streams) {
+    RequestScheduler scheduler(RequestScheduler::Policy::RoundRobin);
+    auto order = serve(scheduler, {{"a1", &stream_a, 1, 0},
+                                   {"a2", &stream_a, 1, 0},
+                                   {"a3", &stream_a, 1, 0},
+                                   {"b1", &stream_b, 1, 0},
+                                   {"c1", &stream_c, 1, 0},
+                                   {"b2", &stream_b, 1, 0}});
+    EXPECT_EQ(order, std::vector<std::string>({"a1", "b1", "c1", "a2", "b2", "a3"}));
+}
+
+TEST(RequestScheduler, weighted_fair_follows_weights) {
+    RequestScheduler scheduler(RequestScheduler::Policy::WeightedFair);
+    std::vector<Request> requests;
+    for (int i = 1; i <= 6; i++)
+        requests.push_back({"a" + std::to_string(i), &stream_a, 3, 0});
+    for (int i = 1; i <= 2; i++)
+        requests.push_back({"b" + std::to_string(i), &stream_b, 1, 0});
+
+    // Stream a gets three requests for each request of stream b
+    auto order = serve(scheduler, requests);
+    EXPECT_EQ(order, std::vector<std::string>({"a1", "b1", "a2", "a3", "a4", "b2", "a5", "a6"}));
+}
+
+TEST(RequestScheduler, deadline_serves_earliest_first) {
+    RequestScheduler scheduler(RequestScheduler::Policy::EarliestDeadline);
+    auto order = serve(scheduler, {{"a1", &stream_a, 1, 300},
+                                   {"b1", &stream_b, 1, 100},
+                                   {"c1", &stream_c, 1, 200},
+                                   {"b2", &stream_b, 1, 400},
+                                   {"a2", &stream_a, 1, 150}});
+    // Request of one stream isn't served before earlier request of the same stream
+    EXPECT_EQ(order, std::vector<std::string>({"b1", "c1", "a1", "a2", "b2"}));
+}
+
+TEST(RequestScheduler, wait_time_per_stream) {
+    RequestScheduler scheduler(RequestScheduler::Policy::Fifo);
+    EXPECT_EQ(scheduler.GetWaitStats(&stream_a).requests, 0u);
+
+    auto turn_a = std::make_unique<RequestScheduler::Turn>(scheduler, &stream_a, 1, 0);
+    turn_a->RequestObtained();
+    std::thread waiter([&scheduler] {
+        RequestScheduler::Turn turn(scheduler, &stream_b, 1, 0);
+        // Turn holder then waits for free request, which counts as wait of the stream too
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        turn.RequestObtained();
+    });
+    while (scheduler.GetWaitingCount() == 0)
+        std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    turn_a.reset();
+    waiter.join();
+
+    const auto stats_a = scheduler.GetWaitStats(&stream_a);
+    const auto stats_b = scheduler.GetWaitStats(&stream_b);
+    EXPECT_EQ(stats_a.requests, 1u);
+    EXPECT_EQ(stats_b.requests, 1u);
+    EXPECT_GE(stats_b.max_ns, 30000000u);
+    EXPECT_EQ(stats_b.total_ns, stats_b.max_ns);
+    EXPECT_LT(stats_a.max_ns, stats_b.max_ns);
+}
+
+TEST(RequestScheduler, first_in_line_waits_for_request) {
+    RequestScheduler scheduler(RequestScheduler::Policy::Fifo);
+    {
+        RequestScheduler::Turn turn(scheduler, &stream_a, 1, 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        turn.RequestObtained();
+    }
+    EXPECT_GE(scheduler.GetWaitStats(&stream_a).max_ns, 10000000u);
+}
+
+TEST(RequestScheduler, removed_stream_starts_from_scratch) {
+    RequestScheduler scheduler(RequestScheduler::Policy::RoundRobin);
+    {
+        RequestScheduler::Turn turn(scheduler, &stream_a, 1, 0);
+        turn.RequestObtained();
+    }
+    ASSERT_EQ(scheduler.GetWaitStats(&stream_a).requests, 1u);
+
+    scheduler.RemoveStream(&stream_a);
+    EXPECT_EQ(scheduler.GetWaitStats(&stream_a).requests, 0u);
+    // Other streams are kept
+    {
+        RequestScheduler::Turn turn(scheduler, &stream_b, 1, 0);
+        turn.RequestObtained();
+    }
+    scheduler.RemoveStream(&stream_a);
+    EXPECT_EQ(scheduler.GetWaitStats(&stream_b).requests, 1u);
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::RequestScheduler from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
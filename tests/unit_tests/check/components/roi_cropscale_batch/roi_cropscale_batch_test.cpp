@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "batch_split.h"
+#include "roi_split.h"
+
+#include <dlstreamer/base/dictionary.h>
+#include <dlstreamer/cpu/context.h>
+#include <dlstreamer/cpu/tensor.h>
+#include <dlstreamer/gst/frame.h>
+#include <dlstreamer/image_metadata.h>
+#include <dlstreamer/opencv/elements/roi_cropscale_batch.h>
+
+#include <gst/check/gstharness.h>
+#include <gtest/gtest.h>
+#include <opencv2/core.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace dlstreamer;
+
+namespace {
+
+constexpr int FRAME_SIZE = 64;
+constexpr int ROI_SIZE = 16;
+constexpr int SLOT_SIZE = 8;
+constexpr int BATCH_SIZE = 4;
+
+// In pipeline application context maps GStreamer buffers to CPU, here input frame is already on CPU
+class CPUAppContext : public CPUContext {
+  public:
+    MemoryMapperPtr get_mapper(const ContextPtr &input_context, const ContextPtr &output_context) override {
+        if (input_context && output_context && input_context->memory_type() == MemoryType::CPU &&
+            output_context->memory_type() == MemoryType::CPU)
+            return std::make_shared<BaseMemoryMapper>(input_context, output_context);
+        return CPUContext::get_mapper(input_context, output_context);
+    }
+};
+
+cv::Scalar roi_color(int index) {
+    return cv::Scalar(10 * (index + 1), 20 * (index + 1), 30 * (index + 1));
+}
+
+cv::Rect roi_rect(int index) {
+    return cv::Rect((index % 4) * ROI_SIZE, (index / 4) * ROI_SIZE + 8, ROI_SIZE, ROI_SIZE);
+}
+
+std::unique_ptr<Transform> create_roi_cropscale_batch(bool planar) {
+    auto params = std::make_shared<BaseDictionary>();
+    std::unique_ptr<Transform> transform(
+        dynamic_cast<Transform *>(roi_cropscale_batch.create(params, std::make_shared<CPUAppContext>())));
+    std::vector<size_t> shape = planar ? std::vector<size_t>{BATCH_SIZE, 3, SLOT_SIZE, SLOT_SIZE}
+                                       : std::vector<size_t>{BATCH_SIZE, SLOT_SIZE, SLOT_SIZE, 3};
+    transform->set_output_info(FrameInfo(MediaType::Tensors, MemoryType::CPU, {TensorInfo(shape, DataType::UInt8)}));
+    return transform;
+}
+
+// BGR frame with num_rois detections, each ROI filled with its own color
+FramePtr create_frame(cv::Mat &image, int num_rois) {
+    image = cv::Mat(FRAME_SIZE, FRAME_SIZE, CV_8UC3, cv::Scalar(255, 255, 255));
+    TensorInfo frame_info({FRAME_SIZE, FRAME_SIZE, 3}, DataType::UInt8);
+    auto frame_tensor = std::make_shared<CPUTensor>(frame_info, image.data);
+    auto frame = std::make_shared<BaseFrame>(MediaType::Image, static_cast<Format>(ImageFormat::BGR),
+                                             TensorVector{frame_tensor});
+    for (int i = 0; i < num_rois; i++) {
+        cv::Rect rect = roi_rect(i);
+        image(rect).setTo(roi_color(i));
+
+        TensorInfo region_info({ROI_SIZE, ROI_SIZE, 3}, DataType::UInt8);
+        auto region_tensor = std::make_shared<CPUTensor>(region_info, nullptr);
+        region_tensor->set_handle(tensor::key::offset_x, rect.x);
+        region_tensor->set_handle(tensor::key::offset_y, rect.y);
+        auto region = std::make_shared<BaseFrame>(MediaType::Image, static_cast<Format>(ImageFormat::BGR),
+                                                  TensorVector{region_tensor});
+        auto detection_meta = region->metadata().add(DetectionMetadata::name);
+        DetectionMetadata(detection_meta).init(0, 0, 1, 1);
+        detection_meta->set(DetectionMetadata::key::id, 100 + i);
+        frame->add_region(region);
+    }
+    return frame;
+}
+
+// Checks batch holding num_rois ROIs of frame starting from first_roi
+void check_batch(FramePtr dst, int first_roi, int num_rois, bool planar, bool last_batch) {
+    ASSERT_NE(dst, nullptr);
+    const uint8_t *data = dst->tensor(0)->data<uint8_t>();
+    const size_t slot_size = SLOT_SIZE * SLOT_SIZE * 3;
+    for (int i = 0; i < BATCH_SIZE; i++) {
+        cv::Scalar color = i < num_rois ? roi_color(first_roi + i) : cv::Scalar(0, 0, 0);
+        for (int c = 0; c < 3; c++) {
+            for (int p = 0; p < SLOT_SIZE * SLOT_SIZE; p++) {
+                size_t offset = i * slot_size + (planar ? c * SLOT_SIZE * SLOT_SIZE + p : p * 3 + c);
+                ASSERT_EQ(data[offset], color[c]) << "slot " << i << ", channel " << c << ", pixel " << p;
+            }
+        }
+    }
+
+    std::vector<DictionaryPtr> affine_metas;
+    std::vector<DictionaryPtr> source_metas;
+    for (auto &meta : dst->metadata()) {
+        if (meta->name() == AffineTransformInfoMetadata::name)
+            affine_metas.push_back(meta);
+        else if (meta->name() == SourceIdentifierMetadata::name)
+            source_metas.push_back(meta);
+    }
+    ASSERT_EQ(affine_metas.size(), static_cast<size_t>(num_rois));
+    ASSERT_EQ(source_metas.size(), static_cast<size_t>(num_rois));
+    for (int i = 0; i < num_rois; i++) {
+        cv::Rect rect = roi_rect(first_roi + i);
+        auto matrix = AffineTransformInfoMetadata(affine_metas[i]).matrix();
+        ASSERT_EQ(matrix.size(), 6u);
+        ASSERT_DOUBLE_EQ(matrix[0], static_cast<double>(ROI_SIZE) / FRAME_SIZE);
+        ASSERT_DOUBLE_EQ(matrix[2], static_cast<double>(rect.x) / FRAME_SIZE);
+        ASSERT_DOUBLE_EQ(matrix[4], static_cast<double>(ROI_SIZE) / FRAME_SIZE);
+        ASSERT_DOUBLE_EQ(matrix[5], static_cast<double>(rect.y) / FRAME_SIZE);
+
+        SourceIdentifierMetadata source_meta(source_metas[i]);
+        ASSERT_EQ(source_meta.batch_index(), i);
+        ASSERT_EQ(source_meta.roi_id(), 100 + first_roi + i);
+        ASSERT_EQ(source_metas[i]->get<bool>(SourceIdentifierMetadata::key::last_roi), last_batch && i == num_rois - 1);
+    }
+}
+
+// Pushes batch of num_rois ROIs as roi_cropscale_batch outputs it and checks buffers pushed by batch_split
+void check_batch_split(int num_rois, bool last_batch) {
+    GstElement *element = GST_ELEMENT(g_object_new(GST_TYPE_TENSOR_SPLIT_BATCH, nullptr));
+    gst_object_ref_sink(element);
+    GstHarness *harness = gst_harness_new_with_element(element, "sink", "src");
+    gst_harness_set_src_caps_str(harness, "application/x-batch");
+
+    // Metadata as roi_cropscale_batch attaches it: affine and source metas in order of batch items, no stream_id
+    GstBuffer *buffer = gst_buffer_new_allocate(nullptr, 16, nullptr);
+    {
+        GSTFrame frame(buffer, FrameInfo());
+        for (int i = 0; i < num_rois; i++) {
+            AffineTransformInfoMetadata(frame.metadata().add(AffineTransformInfoMetadata::name))
+                .set_matrix({1, 0, static_cast<double>(i), 0, 1, 0});
+            auto source_meta = frame.metadata().add(SourceIdentifierMetadata::name);
+            source_meta->set(SourceIdentifierMetadata::key::batch_index, i);
+            source_meta->set(SourceIdentifierMetadata::key::roi_id, 100 + i);
+            source_meta->set(SourceIdentifierMetadata::key::last_roi, last_batch && i == num_rois - 1);
+        }
+    }
+    ASSERT_EQ(gst_harness_push(harness, buffer), GST_FLOW_OK);
+    ASSERT_EQ(gst_harness_buffers_received(harness), static_cast<guint>(num_rois));
+
+    for (int i = 0; i < num_rois; i++) {
+        GstBuffer *out = gst_harness_pull(harness);
+        ASSERT_NE(out, nullptr);
+        ASSERT_EQ(GST_BUFFER_FLAG_IS_SET(out, DLS_BUFFER_FLAG_LAST_ROI_ON_FRAME) != 0, last_batch && i == num_rois - 1);
+
+        std::vector<DictionaryPtr> affine_metas;
+        std::vector<DictionaryPtr> source_metas;
+        {
+            GSTFrame frame(out, FrameInfo());
+            for (auto &meta : frame.metadata()) {
+                if (meta->name() == AffineTransformInfoMetadata::name)
+                    affine_metas.push_back(meta);
+                else if (meta->name() == SourceIdentifierMetadata::name)
+                    source_metas.push_back(meta);
+            }
+        }
+        ASSERT_EQ(affine_metas.size(), 1u);
+        ASSERT_EQ(source_metas.size(), 1u);
+        ASSERT_DOUBLE_EQ(AffineTransformInfoMetadata(affine_metas[0]).matrix()[2], static_cast<double>(i));
+        ASSERT_EQ(SourceIdentifierMetadata(source_metas[0]).batch_index(), i);
+        ASSERT_EQ(SourceIdentifierMetadata(source_metas[0]).roi_id(), 100 + i);
+        gst_buffer_unref(out);
+    }
+
+    gst_harness_teardown(harness);
+    gst_object_unref(element);
+}
+
+} // namespace
+
+TEST(RoiCropscaleBatchTest, rois_are_placed_into_slots_nchw) {
+    auto transform = create_roi_cropscale_batch(true);
+    cv::Mat image;
+    auto src = create_frame(image, 3);
+    check_batch(transform->process(src), 0, 3, true, true);
+    ASSERT_EQ(transform->process(src), nullptr);
+}
+
+TEST(RoiCropscaleBatchTest, rois_are_placed_into_slots_nhwc) {
+    auto transform = create_roi_cropscale_batch(false);
+    cv::Mat image;
+    auto src = create_frame(image, 2);
+    check_batch(transform->process(src), 0, 2, false, true);
+    ASSERT_EQ(transform->process(src), nullptr);
+}
+
+TEST(RoiCropscaleBatchTest, frame_without_rois_is_skipped) {
+    auto transform = create_roi_cropscale_batch(true);
+    cv::Mat image;
+    ASSERT_EQ(transform->process(create_frame(image, 0)), nullptr);
+}
+
+TEST(RoiCropscaleBatchTest, more_rois_than_batch_size_are_split_into_batches) {
+    auto transform = create_roi_cropscale_batch(true);
+    cv::Mat image;
+    auto src = create_frame(image, BATCH_SIZE + 2);
+    check_batch(transform->process(src), 0, BATCH_SIZE, true, false);
+    check_batch(transform->process(src), BATCH_SIZE, 2, true, true);
+    ASSERT_EQ(transform->process(src), nullptr);
+
+    // next frame starts from its first ROI
+    cv::Mat next_image;
+    check_batch(transform->process(create_frame(next_image, 1)), 0, 1, true, true);
+}
+
+TEST(RoiCropscaleBatchTest, batch_split_pushes_one_buffer_per_roi) {
+    check_batch_split(3, true);
+}
+
+TEST(RoiCropscaleBatchTest, batch_split_marks_only_last_batch_of_frame) {
+    check_batch_split(BATCH_SIZE, false);
+}
@@ -0,0 +1,55 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "shape_buckets.h"
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using ShapeBuckets::Bucket;
+
+TEST(ShapeBuckets, parse_list) {
+    auto buckets = ShapeBuckets::parse("32x32, 64x32 ,128x48");
+    ASSERT_EQ(buckets.size(), 3u);
+    EXPECT_EQ(buckets[0], (Bucket{32, 32}));
+    EXPECT_EQ(buckets[1], (Bucket{64, 32}));
+    EXPECT_EQ(buckets[2], (Bucket{128, 48}));
+
+    EXPECT_TRUE(ShapeBuckets::parse("").empty());
+}
+
+TEST(ShapeBuckets, parse_rejects_invalid_sizes) {
+    EXPECT_THROW(ShapeBuckets::parse("32"), std::invalid_argument);
+    EXPECT_THROW(ShapeBuckets::parse("32x"), std::invalid_argument);
+    EXPECT_THROW(ShapeBuckets::parse("0x32"), std::invalid_argument);
+    EXPECT_THROW(ShapeBuckets::parse("-32x32"), std::invalid_argument);
+    EXPECT_THROW(ShapeBuckets::parse("32x32px"), std::invalid_argument);
+    EXPECT_THROW(ShapeBuckets::parse("32x32,abc"), std::invalid_argument);
+}
+
+TEST(ShapeBuckets, select_smallest_fitting_bucket) {
+    const std::vector<Bucket> buckets = {{128, 32}, {32, 32}, {64, 32}, {64, 64}};
+    EXPECT_EQ(ShapeBuckets::select(buckets, 20, 10), 1u);
+    EXPECT_EQ(ShapeBuckets::select(buckets, 32, 32), 1u);
+    EXPECT_EQ(ShapeBuckets::select(buckets, 50, 20), 2u);
+    EXPECT_EQ(ShapeBuckets::select(buckets, 100, 30), 0u);
+    EXPECT_EQ(ShapeBuckets::select(buckets, 40, 60), 3u);
+}
+
+TEST(ShapeBuckets, select_largest_if_nothing_fits) {
+    const std::vector<Bucket> buckets = {{32, 32}, {128, 32}, {64, 64}};
+    EXPECT_EQ(ShapeBuckets::select(buckets, 200, 20), 1u);
+    EXPECT_EQ(ShapeBuckets::select(buckets, 300, 300), 1u);
+    EXPECT_THROW(ShapeBuckets::select({}, 10, 10), std::invalid_argument);
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::ShapeBuckets from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
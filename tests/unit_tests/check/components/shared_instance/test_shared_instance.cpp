@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "dlstreamer/base/pool.h"
+#include "shared_instance.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace dlstreamer;
+
+namespace {
+
+constexpr int NUM_THREADS = 8;
+
+class FakeElement : public Element {
+  public:
+    bool init() override {
+        return true;
+    }
+    ContextPtr get_context(MemoryType) noexcept override {
+        return nullptr;
+    }
+};
+
+SharedInstance::InstanceId make_id(const std::string &shared_instance_id) {
+    SharedInstance::InstanceId id;
+    id.name = "fake_element";
+    id.shared_instance_id = shared_instance_id;
+    return id;
+}
+
+} // namespace
+
+TEST(SharedInstance, same_id_is_initialized_once) {
+    SharedInstance shared;
+    const auto id = make_id("model");
+    std::atomic<int> init_count{0};
+    std::vector<ElementPtr> elements(NUM_THREADS);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; i++) {
+        threads.emplace_back([&, i] {
+            elements[i] = shared.init_or_reuse(id, std::make_shared<FakeElement>(), [&] {
+                init_count++;
+                // model compilation, other threads with the same id wait for it
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            });
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(init_count, 1);
+    for (const auto &element : elements)
+        EXPECT_EQ(element, elements[0]);
+}
+
+TEST(SharedInstance, different_ids_are_initialized_in_parallel) {
+    SharedInstance shared;
+    std::atomic<int> in_init{0};
+    std::atomic<int> max_in_init{0};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; i++) {
+        threads.emplace_back([&, i] {
+            shared.init_or_reuse(make_id("model" + std::to_string(i)), std::make_shared<FakeElement>(), [&] {
+                int current = ++in_init;
+                int max = max_in_init;
+                while (current > max && !max_in_init.compare_exchange_weak(max, current)) {
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                in_init--;
+            });
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_GT(max_in_init, 1);
+}
+
+TEST(SharedInstance, clean_up_releases_unused_elements) {
+    SharedInstance shared;
+    const auto id = make_id("model");
+    std::weak_ptr<Element> weak;
+    {
+        ElementPtr element = shared.init_or_reuse(id, std::make_shared<FakeElement>(), nullptr);
+        weak = element;
+        shared.clean_up();
+        EXPECT_FALSE(weak.expired());
+    }
+    shared.clean_up();
+    EXPECT_TRUE(weak.expired());
+
+    // next element with the same id is initialized again
+    int init_count = 0;
+    shared.init_or_reuse(id, std::make_shared<FakeElement>(), [&] { init_count++; });
+    EXPECT_EQ(init_count, 1);
+}
+
+TEST(Pool, waiters_wake_up_on_release) {
+    std::atomic<int> allocations{0};
+    Pool<std::shared_ptr<int>> pool(
+        [&] {
+            allocations++;
+            return std::make_shared<int>(0);
+        },
+        [](std::shared_ptr<int> &object) { return object.use_count() == 1; }, 1);
+
+    auto held = pool.get_or_create();
+    std::atomic<int> served{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; i++) {
+        threads.emplace_back([&] {
+            auto object = pool.get_or_create();
+            // single object of pool is used by one caller at a time
+            (*object)++;
+            served++;
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(served, 0);
+
+    held.reset();
+    for (auto &thread : threads)
+        thread.join();
+
+    EXPECT_EQ(served, NUM_THREADS);
+    EXPECT_EQ(allocations, 1);
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(*pool.get_or_create(), NUM_THREADS);
+}
+
+TEST(Pool, returned_object_may_outlive_pool) {
+    std::shared_ptr<int> object;
+    {
+        Pool<std::shared_ptr<int>> pool([] { return std::make_shared<int>(42); },
+                                        [](std::shared_ptr<int> &object) { return object.use_count() == 1; });
+        object = pool.get_or_create();
+    }
+    EXPECT_EQ(*object, 42);
+    object.reset();
+}
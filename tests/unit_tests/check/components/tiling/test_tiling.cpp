@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "tiling.h"
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <vector>
+
+using Tiling::Detection;
+using Tiling::Rect;
+
+namespace {
+
+Detection detection(double x_min, double y_min, double x_max, double y_max, double confidence, size_t tile,
+                    int label_id = 0) {
+    Detection d;
+    d.x_min = x_min;
+    d.y_min = y_min;
+    d.x_max = x_max;
+    d.y_max = y_max;
+    d.confidence = confidence;
+    d.tile = tile;
+    d.label_id = label_id;
+    return d;
+}
+
+} // namespace
+
+TEST(Tiling, tiles_cover_frame_with_overlap) {
+    const auto tiles = Tiling::makeTiles(1920, 1080, 640, 640, 0.25);
+    // Stride 480: x at 0, 480, 960, 1280 (aligned to border), y at 0, 440 (aligned to border)
+    ASSERT_EQ(tiles.size(), 8u);
+    EXPECT_EQ(tiles[0].x, 0u);
+    EXPECT_EQ(tiles[1].x, 480u);
+    EXPECT_EQ(tiles[2].x, 960u);
+    EXPECT_EQ(tiles[3].x, 1280u);
+    EXPECT_EQ(tiles[4].y, 440u);
+    for (const Rect &tile : tiles) {
+        EXPECT_EQ(tile.w, 640u);
+        EXPECT_EQ(tile.h, 640u);
+        EXPECT_LE(tile.x + tile.w, 1920u);
+        EXPECT_LE(tile.y + tile.h, 1080u);
+    }
+}
+
+TEST(Tiling, tile_larger_than_frame) {
+    const auto tiles = Tiling::makeTiles(320, 240, 640, 640, 0.2);
+    ASSERT_EQ(tiles.size(), 1u);
+    EXPECT_EQ(tiles[0].w, 320u);
+    EXPECT_EQ(tiles[0].h, 240u);
+
+    EXPECT_TRUE(Tiling::makeTiles(0, 240, 640, 640, 0.2).empty());
+}
+
+TEST(Tiling, intersects) {
+    Rect tile;
+    tile.x = 100;
+    tile.y = 100;
+    tile.w = 100;
+    tile.h = 100;
+    Rect motion = tile;
+    motion.x = 199;
+    EXPECT_TRUE(Tiling::intersects(tile, motion));
+    motion.x = 200;
+    EXPECT_FALSE(Tiling::intersects(tile, motion));
+}
+
+TEST(Tiling, merge_cut_box_into_full_box) {
+    // Object on the seam: tile 0 sees the full box, tile 1 sees the part inside it
+    const std::vector<Detection> detections = {detection(0.40, 0.10, 0.50, 0.30, 0.9, 0),
+                                               detection(0.45, 0.10, 0.50, 0.30, 0.6, 1),
+                                               detection(0.70, 0.70, 0.80, 0.80, 0.8, 1)};
+    EXPECT_EQ(Tiling::mergeSeamDuplicates(detections, 0.5), std::vector<bool>({true, false, true}));
+}
+
+TEST(Tiling, merge_keeps_same_tile_and_other_labels) {
+    const std::vector<Detection> detections = {detection(0.40, 0.10, 0.50, 0.30, 0.9, 0),
+                                               detection(0.42, 0.10, 0.50, 0.30, 0.8, 0),
+                                               detection(0.42, 0.10, 0.50, 0.30, 0.7, 1, 1)};
+    EXPECT_EQ(Tiling::mergeSeamDuplicates(detections, 0.5), std::vector<bool>({true, true, true}));
+}
+
+int main(int argc, char *argv[]) {
+    std::cout << "Running Components::Tiling from " << __FILE__ << std::endl;
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "inference_backend/logger.h"
+#include "inference_backend/trace_recorder.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+nlohmann::json toJson(const TraceRecorder &recorder) {
+    std::stringstream trace;
+    recorder.WriteChromeTrace(trace);
+    return nlohmann::json::parse(trace.str());
+}
+
+// Complete events only, first element of trace is process metadata
+std::vector<nlohmann::json> spans(const nlohmann::json &trace) {
+    std::vector<nlohmann::json> result;
+    for (const auto &event : trace)
+        if (event["ph"] == "X")
+            result.push_back(event);
+    return result;
+}
+
+void tracedFunction() {
+    ITT_TASK(__FUNCTION__);
+}
+
+} // namespace
+
+TEST(TraceRecorderTest, EventsHaveStreamFrameAndDuration) {
+    TraceRecorder recorder("", 16);
+    recorder.Enable();
+    const uint32_t stream = recorder.RegisterStream("camera-1");
+
+    TraceRecorder::Context context;
+    context.stream = stream;
+    context.frame = 42;
+    recorder.Record("decode", nullptr, 1000, 3500, context);
+    recorder.Record("convert", "caller", 4000, 4001, TraceRecorder::Context());
+
+    const auto events = spans(toJson(recorder));
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0]["name"], "decode");
+    EXPECT_DOUBLE_EQ(events[0]["ts"].get<double>(), 1.0);
+    EXPECT_DOUBLE_EQ(events[0]["dur"].get<double>(), 2.5);
+    EXPECT_EQ(events[0]["args"]["stream"], "camera-1");
+    EXPECT_EQ(events[0]["args"]["frame"], 42);
+    EXPECT_EQ(events[1]["args"]["detail"], "caller");
+    EXPECT_FALSE(events[1]["args"].contains("frame"));
+    EXPECT_EQ(recorder.RegisterStream("camera-1"), stream);
+}
+
+TEST(TraceRecorderTest, RingBufferKeepsLatestEvents) {
+    TraceRecorder recorder("", 4);
+    recorder.Enable();
+    const char *names[] = {"e0", "e1", "e2", "e3", "e4", "e5"};
+    for (uint64_t i = 0; i < 6; ++i)
+        recorder.Record(names[i], nullptr, i * 1000, i * 1000 + 1, TraceRecorder::Context());
+
+    const auto events = spans(toJson(recorder));
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events.front()["name"], "e2");
+    EXPECT_EQ(events.back()["name"], "e5");
+
+    recorder.Clear();
+    EXPECT_TRUE(spans(toJson(recorder)).empty());
+}
+
+TEST(TraceRecorderTest, ThreadsHaveOwnBuffers) {
+    TraceRecorder recorder("", 8);
+    recorder.Enable();
+    std::thread worker([&recorder] { recorder.Record("worker", nullptr, 10, 20, TraceRecorder::Context()); });
+    worker.join();
+    recorder.Record("main", nullptr, 30, 40, TraceRecorder::Context());
+
+    const auto events = spans(toJson(recorder));
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_NE(events[0]["tid"], events[1]["tid"]);
+}
+
+TEST(TraceRecorderTest, TaskUsesThreadFrameContext) {
+    TraceRecorder &recorder = TraceRecorder::Instance();
+    recorder.Clear();
+    recorder.Enable();
+    const uint32_t stream = recorder.RegisterStream("stream");
+    {
+        TraceFrameScope frame_scope(stream, 7);
+        tracedFunction();
+    }
+    tracedFunction();
+    recorder.Disable();
+    tracedFunction();
+
+    const auto events = spans(toJson(recorder));
+    recorder.Clear();
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0]["name"], "tracedFunction");
+    EXPECT_EQ(events[0]["args"]["frame"], 7);
+    EXPECT_EQ(events[0]["args"]["stream"], "stream");
+    EXPECT_FALSE(events[1]["args"].contains("frame"));
+}
+
+TEST(TraceRecorderTest, RecordersOfProcessAppendToOneFile) {
+    const std::string path = "trace_recorder_test.json";
+    {
+        std::ofstream stale(path);
+        stale << "[{\"stale\":true}\n]\n";
+    }
+    {
+        TraceRecorder first(path, 8);
+        first.Record("first", nullptr, 1000, 2000, TraceRecorder::Context());
+        TraceRecorder second(path, 8);
+        second.Record("second", nullptr, 3000, 4000, TraceRecorder::Context());
+        ASSERT_TRUE(first.Flush());
+        // second is flushed on destruction
+    }
+
+    std::ifstream file(path);
+    const auto trace = nlohmann::json::parse(file);
+    const auto events = spans(trace);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0]["name"], "first");
+    EXPECT_EQ(events[1]["name"], "second");
+    EXPECT_FALSE(trace[0].contains("stale"));
+    std::remove(path.c_str());
+}
+
+TEST(TraceRecorderTest, FlushOnStopAppendsOnlyNewEvents) {
+    const std::string path = "trace_recorder_flush_test.json";
+    std::remove(path.c_str());
+    {
+        TraceRecorder recorder(path, 8);
+        recorder.Record("first_pipeline", nullptr, 1000, 2000, TraceRecorder::Context());
+        ASSERT_TRUE(recorder.Flush());
+        {
+            // Trace is complete after each flush
+            std::ifstream file(path);
+            EXPECT_EQ(spans(nlohmann::json::parse(file)).size(), 1u);
+        }
+        recorder.Record("second_pipeline", nullptr, 3000, 4000, TraceRecorder::Context());
+        ASSERT_TRUE(recorder.Flush());
+        // Nothing new to write on destruction
+    }
+
+    std::ifstream file(path);
+    const auto events = spans(nlohmann::json::parse(file));
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0]["name"], "first_pipeline");
+    EXPECT_EQ(events[1]["name"], "second_pipeline");
+    std::remove(path.c_str());
+}
+
+TEST(TraceRecorderTest, FlushDropsBuffersOfExitedThreads) {
+    const std::string path = "trace_recorder_exited_test.json";
+    std::remove(path.c_str());
+    {
+        TraceRecorder recorder(path, 8);
+        std::thread worker([&recorder] { recorder.Record("worker", nullptr, 1000, 2000, TraceRecorder::Context()); });
+        worker.join();
+        EXPECT_EQ(recorder.GetBufferCount(), 1u);
+        ASSERT_TRUE(recorder.Flush());
+        EXPECT_EQ(recorder.GetBufferCount(), 0u);
+
+        // Buffer of running thread is kept
+        recorder.Record("main", nullptr, 3000, 4000, TraceRecorder::Context());
+        ASSERT_TRUE(recorder.Flush());
+        EXPECT_EQ(recorder.GetBufferCount(), 1u);
+    }
+
+    std::ifstream file(path);
+    const auto events = spans(nlohmann::json::parse(file));
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0]["name"], "worker");
+    EXPECT_EQ(events[1]["name"], "main");
+    std::remove(path.c_str());
+}
@@ -0,0 +1,16 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <gst/check/gstcheck.h>
+
+GTEST_API_ int main(int argc, char **argv) {
+    std::cout << "Running Components::WritableBufferTest from " << __FILE__ << std::endl;
+    testing::InitGoogleTest(&argc, argv);
+    gst_check_init(&argc, &argv);
+    return RUN_ALL_TESTS();
+}
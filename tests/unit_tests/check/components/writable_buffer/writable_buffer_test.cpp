@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "gva_utils.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr gsize BUFFER_SIZE = 64;
+
+GstBuffer *createBufferWithRoi(GstMemoryFlags memory_flags) {
+    GstBuffer *buffer = gst_buffer_new();
+    GstMemory *memory = gst_allocator_alloc(nullptr, BUFFER_SIZE, nullptr);
+    GST_MINI_OBJECT_FLAG_SET(memory, memory_flags);
+    gst_buffer_append_memory(buffer, memory);
+    GST_BUFFER_PTS(buffer) = 42;
+    gst_buffer_add_video_region_of_interest_meta(buffer, "label", 1, 2, 3, 4);
+    return buffer;
+}
+
+guint countRois(GstBuffer *buffer) {
+    guint count = 0;
+    gpointer state = nullptr;
+    while (GST_VIDEO_REGION_OF_INTEREST_META_ITERATE(buffer, &state))
+        ++count;
+    return count;
+}
+
+} // namespace
+
+TEST(WritableBufferTest, WritableBufferIsKept) {
+    GstBuffer *buffer = createBufferWithRoi(static_cast<GstMemoryFlags>(0));
+    GstBuffer *original = buffer;
+    const GvaWritableBufferStats before = gva_buffer_writable_stats();
+
+    gva_buffer_make_metadata_writable(&buffer, __func__);
+
+    const GvaWritableBufferStats after = gva_buffer_writable_stats();
+    EXPECT_EQ(buffer, original);
+    EXPECT_EQ(after.metadata_copies, before.metadata_copies);
+    EXPECT_EQ(after.deep_copies, before.deep_copies);
+    gst_buffer_unref(buffer);
+}
+
+TEST(WritableBufferTest, SharedBufferGetsMetadataCopySharingMemory) {
+    GstBuffer *original = createBufferWithRoi(static_cast<GstMemoryFlags>(0));
+    // Reference held by other branch of the pipeline
+    GstBuffer *buffer = gst_buffer_ref(original);
+    const GvaWritableBufferStats before = gva_buffer_writable_stats();
+
+    gva_buffer_make_metadata_writable(&buffer, __func__);
+
+    const GvaWritableBufferStats after = gva_buffer_writable_stats();
+    ASSERT_NE(buffer, original);
+    EXPECT_TRUE(gst_buffer_is_writable(buffer));
+    EXPECT_EQ(gst_buffer_peek_memory(buffer, 0), gst_buffer_peek_memory(original, 0));
+    EXPECT_EQ(GST_BUFFER_PTS(buffer), GST_BUFFER_PTS(original));
+    EXPECT_EQ(countRois(buffer), 1u);
+    EXPECT_EQ(after.metadata_copies, before.metadata_copies + 1);
+    EXPECT_EQ(after.deep_copies, before.deep_copies);
+
+    // Metas added to the copy don't show up in the buffer of other branch
+    gst_buffer_add_video_region_of_interest_meta(buffer, "label", 5, 6, 7, 8);
+    EXPECT_EQ(countRois(buffer), 2u);
+    EXPECT_EQ(countRois(original), 1u);
+
+    gst_buffer_unref(buffer);
+    gst_buffer_unref(original);
+}
+
+TEST(WritableBufferTest, UnshareableMemoryIsCopied) {
+    GstBuffer *original = createBufferWithRoi(GST_MEMORY_FLAG_NO_SHARE);
+    GstBuffer *buffer = gst_buffer_ref(original);
+    const GvaWritableBufferStats before = gva_buffer_writable_stats();
+
+    gva_buffer_make_metadata_writable(&buffer, __func__);
+
+    const GvaWritableBufferStats after = gva_buffer_writable_stats();
+    ASSERT_NE(buffer, original);
+    EXPECT_NE(gst_buffer_peek_memory(buffer, 0), gst_buffer_peek_memory(original, 0));
+    EXPECT_EQ(countRois(buffer), 1u);
+    EXPECT_EQ(after.deep_copies, before.deep_copies + 1);
+    EXPECT_EQ(after.metadata_copies, before.metadata_copies);
+
+    gst_buffer_unref(buffer);
+    gst_buffer_unref(original);
+}
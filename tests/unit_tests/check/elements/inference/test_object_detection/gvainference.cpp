@@ -81,6 +81,18 @@ GST_START_TEST(test_obj_detection_inference_cpu) {
 
 GST_END_TEST;
 
+// Model is loaded in background after caps negotiation, element waits for it on the first buffer
+GST_START_TEST(test_obj_detection_inference_async_model_load) {
+    g_print("Starting test: test_obj_detection_inference_async_model_load\n");
+    char model_path[MAX_STR_PATH_SIZE];
+    ExitStatus status = get_model_path(model_path, MAX_STR_PATH_SIZE, cpu_test_data[0].model_name.c_str(), "FP32");
+    ck_assert(status == EXIT_STATUS_SUCCESS);
+    run_test("gvadetect", VIDEO_CAPS_TEMPLATE_STRING, cpu_test_data[0].resolution, &srctemplate, &sinktemplate,
+             setup_inbuffer, check_outbuffer, &cpu_test_data[0], "model", model_path, "async-model-load", TRUE, NULL);
+}
+
+GST_END_TEST;
+
 TestData gpu_test_data[] = {
     {"inference_test_files/car_2.jpg", "vehicle-license-plate-detection-barrier-0106", {640, 480}},
     {"inference_test_files/car_1.png", "vehicle-detection-adas-0002", {640, 480}},
@@ -116,6 +128,7 @@ static Suite *inference_suite(void) {
 
     suite_add_tcase(s, tc_chain);
     tcase_add_test(tc_chain, test_obj_detection_inference_cpu);
+    tcase_add_test(tc_chain, test_obj_detection_inference_async_model_load);
     tcase_add_test(tc_chain, test_obj_detection_inference_gpu);
 
     return s;
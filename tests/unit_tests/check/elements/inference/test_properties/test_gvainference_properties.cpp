@@ -63,6 +63,28 @@ GST_START_TEST(test_nireq_property_less_zero) {
 
 GST_END_TEST;
 
+GST_START_TEST(test_max_inference_interval_property_zero) {
+    g_print("Starting test: test_max_inference_interval_property_zero\n");
+    GValue prop_value = G_VALUE_INIT;
+    g_value_init(&prop_value, G_TYPE_UINT);
+    g_value_set_uint(&prop_value, 0);
+
+    check_property_default_if_invalid_value(plugin_name, "max-inference-interval", prop_value);
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_post_proc_threads_property_above_max) {
+    g_print("Starting test: test_post_proc_threads_property_above_max\n");
+    GValue prop_value = G_VALUE_INIT;
+    g_value_init(&prop_value, G_TYPE_UINT);
+    g_value_set_uint(&prop_value, 65);
+
+    check_property_default_if_invalid_value(plugin_name, "post-proc-threads", prop_value);
+}
+
+GST_END_TEST;
+
 GST_START_TEST(test_qos_property_str_trash) {
     g_print("Starting test: test_qos_property_str_trash\n");
     GValue prop_value = G_VALUE_INIT;
@@ -83,6 +105,8 @@ static Suite *inference_properties_testing_suite(void) {
     // tcase_add_test(tc_chain, test_model_proc_property_invalid_path);
     tcase_add_test(tc_chain, test_batch_size_property_less_zero);
     tcase_add_test(tc_chain, test_nireq_property_less_zero);
+    tcase_add_test(tc_chain, test_max_inference_interval_property_zero);
+    tcase_add_test(tc_chain, test_post_proc_threads_property_above_max);
     tcase_add_test(tc_chain, test_qos_property_str_trash);
 
     return s;
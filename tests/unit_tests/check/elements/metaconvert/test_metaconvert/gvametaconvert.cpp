@@ -11,6 +11,8 @@
 #include "glib.h"
 #include "gst/analytics/analytics.h"
 #include "gst/check/internal-check.h"
+#include "gva_binary_format.h"
+#include "gva_binary_meta.h"
 #include "gva_json_meta.h"
 #include "region_of_interest.h"
 #include "test_utils.h"
@@ -216,6 +218,41 @@ void check_outbuffer(GstBuffer *outbuffer, gpointer user_data) {
     }
 }
 
+void check_binary_outbuffer(GstBuffer *outbuffer, gpointer user_data) {
+    TestData *test_data = static_cast<TestData *>(user_data);
+    ck_assert_msg(test_data != NULL, "Passed data is not TestData");
+    ck_assert_msg(GST_GVA_JSON_META_GET(outbuffer) == NULL, "Unexpected JSON meta in binary mode");
+    GstGVABinaryMeta *meta = GST_GVA_BINARY_META_GET(outbuffer);
+    ck_assert_msg(meta != NULL, "No binary meta found");
+    ck_assert_msg(meta->message != NULL, "No message in binary meta");
+
+    gsize size = 0;
+    const uint8_t *data = static_cast<const uint8_t *>(g_bytes_get_data(meta->message, &size));
+    dlstreamer::binary_meta::Frame frame;
+    size_t consumed = dlstreamer::binary_meta::Reader::read_record(data, size, frame);
+    ck_assert_msg(consumed == size, "Expected exactly one record, consumed %zu of %zu bytes", consumed, size);
+
+    ck_assert(frame.width && *frame.width == test_data->resolution.width);
+    ck_assert(frame.height && *frame.height == test_data->resolution.height);
+    ck_assert(frame.timestamp && *frame.timestamp == 0);
+    ck_assert(frame.source && *frame.source == "test_src");
+    ck_assert(frame.tags && *frame.tags == "{\"tag_key\":\"tag_val\"}");
+
+    ck_assert_msg(frame.objects.size() == 1, "Expected one object, got %zu", frame.objects.size());
+    const auto &object = frame.objects[0];
+    ck_assert(object.detection.has_value());
+    ck_assert(object.detection->confidence.has_value());
+    ck_assert_msg(fabs(*object.detection->confidence - test_data->box.confidence) < 1e-6,
+                  "Unexpected detection confidence %f", *object.detection->confidence);
+    ck_assert(fabs(object.detection->x_min - test_data->box.x_min) < 1e-6);
+    ck_assert(fabs(object.detection->y_max - test_data->box.y_max) < 1e-6);
+    ck_assert(object.detection->label_id && *object.detection->label_id == test_data->box.label_id);
+
+    ck_assert_msg(object.tensors.size() == 1, "Expected one object tensor, got %zu", object.tensors.size());
+    ck_assert(object.tensors[0].data_size == sizeof(test_data->buffer));
+    ck_assert(memcmp(object.tensors[0].data, test_data->buffer, sizeof(test_data->buffer)) == 0);
+}
+
 TestData test_data[] = {
     {{640, 480}, {0.29375, 0.54375, 0.40625, 0.94167, 0.8, 0, 0}, {0x7c, 0x94, 0x06, 0x3f, 0x09, 0xd7, 0xf2, 0x3e}}};
 
@@ -251,6 +288,19 @@ GST_START_TEST(test_metaconvert_all) {
 
 GST_END_TEST;
 
+GST_START_TEST(test_metaconvert_binary) {
+    g_print("Starting test: test_metaconvert_binary\n");
+
+    for (int i = 0; i < G_N_ELEMENTS(test_data); i++) {
+        test_data[i].ignore_detections = false;
+        run_test("gvametaconvert", VIDEO_CAPS_TEMPLATE_STRING, test_data[i].resolution, &srctemplate, &sinktemplate,
+                 setup_inbuffer, check_binary_outbuffer, &test_data[i], "format", GST_GVA_METACONVERT_BINARY,
+                 "add-tensor-data", TRUE, "tags", "{\"tag_key\":\"tag_val\"}", "source", "test_src", NULL);
+    }
+}
+
+GST_END_TEST;
+
 static Suite *metaconvert_suite(void) {
     Suite *s = suite_create("metaconvert");
     TCase *tc_chain = tcase_create("general");
@@ -258,6 +308,7 @@ static Suite *metaconvert_suite(void) {
     suite_add_tcase(s, tc_chain);
     tcase_add_test(tc_chain, test_metaconvert_no_detections);
     tcase_add_test(tc_chain, test_metaconvert_all);
+    tcase_add_test(tc_chain, test_metaconvert_binary);
 #ifdef AUDIO
     tcase_add_test(tc_chain, test_metaconvert_audio);
 #endif
@@ -13,6 +13,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <vector>
+
 #define STUB_METHOD(method, ret, ...)                                                                                  \
     ret method(__VA_ARGS__) final {                                                                                    \
         throw std::runtime_error("The stub for '" #method " (" #__VA_ARGS__ ") "                                       \
@@ -31,6 +34,8 @@
 
 using namespace RdKafka;
 
+static const gchar *TEST_MESSAGE = "TEST MESSAGE";
+
 class MockMessage : public Message {
   public:
     MOCK_CONST_METHOD0(errstr, std::string());
@@ -94,10 +99,38 @@ class MockProducer : public Producer {
         if (conf) {
             EXPECT_EQ(conf->get(mock->dr_msg_cb), Conf::CONF_OK) << "Expected dr_msg_cb set in RdKafka::Conf";
             EXPECT_EQ(conf->get(mock->event_cb), Conf::CONF_OK) << "Expected event_cb set in RdKafka::Conf";
+            conf->get("linger.ms", mock->linger_ms);
+            conf->get("batch.size", mock->batch_size);
+            conf->get("enable.idempotence", mock->enable_idempotence);
         }
         return mock;
     }
 
+    // Zero-copy produce records messages like a local broker would, so tests can inspect keys and payloads
+    struct ProducedMessage {
+        int32_t partition;
+        int msgflags;
+        void *payload;
+        size_t len;
+        std::string key;
+        void *msg_opaque;
+    };
+
+    ErrorCode produce(Topic *, int32_t partition, int msgflags, void *payload, size_t len, const void *key,
+                      size_t key_len, void *msg_opaque) final {
+        if (produce_result != ERR_NO_ERROR)
+            return produce_result;
+        produced.push_back({partition, msgflags, payload, len,
+                            key ? std::string(static_cast<const char *>(key), key_len) : std::string(), msg_opaque});
+        return ERR_NO_ERROR;
+    }
+
+    std::vector<ProducedMessage> produced;
+    ErrorCode produce_result = ERR_NO_ERROR;
+    std::string linger_ms;
+    std::string batch_size;
+    std::string enable_idempotence;
+
     ~MockProducer() final = default;
 
     MOCK_METHOD7(produce, ErrorCode(Topic *topic, int32_t partition, int msgflags, void *payload, size_t len,
@@ -108,15 +141,15 @@ class MockProducer : public Producer {
     MOCK_METHOD0(outq_len, int());
     MOCK_CONST_METHOD1(fatal_error, ErrorCode(std::string &errstr));
 
+    MOCK_METHOD1(purge, ErrorCode(int purge_flags));
+
     // STUBS
-    STUB_METHOD(produce, ErrorCode, Topic *, int32_t, int, void *, size_t, const void *, size_t, void *);
     STUB_METHOD(produce, ErrorCode, const std::string, int32_t, int, void *, size_t, const void *, size_t, int64_t,
                 void *);
     STUB_METHOD(produce, ErrorCode, const std::string, int32_t, int, void *, size_t, const void *, size_t, int64_t,
                 RdKafka::Headers *, void *);
     STUB_METHOD(produce, ErrorCode, Topic *, int32_t, const std::vector<char> *, const std::vector<char> *, void *);
 
-    STUB_METHOD(purge, ErrorCode, int);
     STUB_METHOD(init_transactions, Error *, int);
     STUB_METHOD(begin_transaction, Error *, );
     STUB_METHOD(send_offsets_to_transaction, Error *, const std::vector<TopicPartition *> &,
@@ -222,7 +255,8 @@ TEST_F(GvaMetaPublishKafkaImplFixture, test_start_stop) {
 
 TEST_F(GvaMetaPublishKafkaImplFixture, test_start_fail) {
     EXPECT_FALSE(inst_fail->start()) << "Expected failed start since producer is not created";
-    EXPECT_FALSE(inst_fail->publish("TEST MESSAGE")) << "Expected failed publish since producer is not created";
+    EXPECT_FALSE(inst_fail->publish(TEST_MESSAGE, strlen(TEST_MESSAGE)))
+        << "Expected failed publish since producer is not created";
     EXPECT_TRUE(inst_fail->stop());
 }
 
@@ -230,7 +264,7 @@ TEST_F(GvaMetaPublishKafkaImplFixture, test_produce) {
     ASSERT_TRUE(inst->start());
     auto mock = inst->get_mock_producer();
     EXPECT_CALL(*mock, produce).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
-    EXPECT_TRUE(inst->publish("TEST MESSAGE"));
+    EXPECT_TRUE(inst->publish(TEST_MESSAGE, strlen(TEST_MESSAGE)));
     EXPECT_CALL(*mock, flush).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
     EXPECT_TRUE(inst->stop());
 }
@@ -243,7 +277,8 @@ TEST_F(GvaMetaPublishKafkaImplFixture, test_produce_fail) {
         err = "Produce failed by test";
         return ErrorCode::ERR__FAIL;
     }));
-    EXPECT_FALSE(inst->publish("TEST MESSAGE")) << "Expected failed 'publish' because 'produce' returns error";
+    EXPECT_FALSE(inst->publish(TEST_MESSAGE, strlen(TEST_MESSAGE)))
+        << "Expected failed 'publish' because 'produce' returns error";
     EXPECT_CALL(*mock, flush).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
     EXPECT_TRUE(inst->stop());
 }
@@ -298,6 +333,160 @@ TEST_F(GvaMetaPublishKafkaImplFixture, test_error_callback) {
         << "Expected incremented 'connection_attempt' counter because event is an error";
 }
 
+namespace {
+
+const char TEST_PAYLOAD[] = "{\"objects\":[]}";
+
+// Returns message which sets 'released' flag when the last reference is dropped
+GBytes *new_tracked_message(bool &released) {
+    released = false;
+    return g_bytes_new_with_free_func(TEST_PAYLOAD, sizeof(TEST_PAYLOAD) - 1,
+                                      [](gpointer released) { *static_cast<bool *>(released) = true; }, &released);
+}
+
+void set_enum_property(GvaMetaPublishKafkaImplMocked &inst, guint prop_id, gint value) {
+    GValue gvalue = G_VALUE_INIT;
+    g_value_init(&gvalue, GST_TYPE_GVA_METAPUBLISH_KEY_MODE);
+    g_value_set_enum(&gvalue, value);
+    EXPECT_TRUE(inst.set_property(prop_id, &gvalue));
+    g_value_unset(&gvalue);
+}
+
+void set_uint_property(GvaMetaPublishKafkaImplMocked &inst, guint prop_id, guint value) {
+    GValue gvalue = G_VALUE_INIT;
+    g_value_init(&gvalue, G_TYPE_UINT);
+    g_value_set_uint(&gvalue, value);
+    EXPECT_TRUE(inst.set_property(prop_id, &gvalue));
+    g_value_unset(&gvalue);
+}
+
+void set_string_property(GvaMetaPublishKafkaImplMocked &inst, guint prop_id, const gchar *value) {
+    GValue gvalue = G_VALUE_INIT;
+    g_value_init(&gvalue, G_TYPE_STRING);
+    g_value_set_string(&gvalue, value);
+    EXPECT_TRUE(inst.set_property(prop_id, &gvalue));
+    g_value_unset(&gvalue);
+}
+
+} // namespace
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_batching_config) {
+    set_uint_property(*inst, PROP_LINGER_MS, 20);
+    set_uint_property(*inst, PROP_BATCH_SIZE, 65536);
+    set_enum_property(*inst, PROP_KEY_MODE, GVA_META_PUBLISH_KEY_STREAM_ID);
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    EXPECT_EQ(mock->linger_ms, "20");
+    EXPECT_EQ(mock->batch_size, "65536");
+    EXPECT_EQ(mock->enable_idempotence, "true") << "Expected idempotent producer to keep order of keyed messages";
+    EXPECT_TRUE(inst->stop());
+}
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_publish_bytes_keyed_by_stream_id) {
+    set_enum_property(*inst, PROP_KEY_MODE, GVA_META_PUBLISH_KEY_STREAM_ID);
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+
+    bool released[3];
+    const char *streams[3] = {"camera-1", "camera-2", "camera-1"};
+    for (int i = 0; i < 3; i++) {
+        GBytes *message = new_tracked_message(released[i]);
+        EXPECT_TRUE(inst->publish_bytes(message, streams[i]));
+        g_bytes_unref(message);
+        EXPECT_FALSE(released[i]) << "Expected payload to be kept by producer until delivery report";
+    }
+
+    ASSERT_EQ(mock->produced.size(), 3u);
+    for (int i = 0; i < 3; i++) {
+        const auto &produced = mock->produced[i];
+        EXPECT_EQ(produced.key, streams[i]);
+        EXPECT_EQ(produced.partition, Topic::PARTITION_UA) << "Expected partition to be selected by key";
+        EXPECT_EQ(produced.msgflags & (Producer::MSG_COPY | Producer::MSG_FREE), 0)
+            << "Expected payload to be handed over without copy";
+        EXPECT_EQ(produced.len, sizeof(TEST_PAYLOAD) - 1);
+    }
+
+    // Broker acknowledges messages, delivery reports release payloads and update statistics
+    for (int i = 0; i < 3; i++) {
+        MockMessage message;
+        EXPECT_CALL(message, err).WillRepeatedly(::testing::Return(ErrorCode::ERR_NO_ERROR));
+        EXPECT_CALL(message, msg_opaque).WillRepeatedly(::testing::Return(mock->produced[i].msg_opaque));
+        EXPECT_CALL(message, latency).WillRepeatedly(::testing::Return((i + 1) * 1000));
+        mock->dr_msg_cb->dr_cb(message);
+        EXPECT_TRUE(released[i]) << "Expected payload released after delivery report";
+    }
+
+    GstStructure *stats = inst->get_stats();
+    guint64 delivered = 0;
+    gdouble latency_avg = 0, latency_max = 0;
+    EXPECT_TRUE(gst_structure_get_uint64(stats, "delivered", &delivered));
+    EXPECT_TRUE(gst_structure_get_double(stats, "latency-avg", &latency_avg));
+    EXPECT_TRUE(gst_structure_get_double(stats, "latency-max", &latency_max));
+    gst_structure_free(stats);
+    EXPECT_EQ(delivered, 3u);
+    EXPECT_DOUBLE_EQ(latency_avg, 2.0);
+    EXPECT_DOUBLE_EQ(latency_max, 3.0);
+
+    EXPECT_TRUE(inst->stop());
+}
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_publish_bytes_not_keyed_by_default) {
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    bool released;
+    GBytes *message = new_tracked_message(released);
+    EXPECT_TRUE(inst->publish_bytes(message, "camera-1"));
+    g_bytes_unref(message);
+    ASSERT_EQ(mock->produced.size(), 1u);
+    EXPECT_TRUE(mock->produced[0].key.empty());
+    EXPECT_TRUE(mock->enable_idempotence.empty() || mock->enable_idempotence == "false");
+
+    MockMessage report;
+    EXPECT_CALL(report, err).WillRepeatedly(::testing::Return(ErrorCode::ERR_NO_ERROR));
+    EXPECT_CALL(report, msg_opaque).WillRepeatedly(::testing::Return(mock->produced[0].msg_opaque));
+    mock->dr_msg_cb->dr_cb(report);
+    EXPECT_TRUE(released);
+    EXPECT_TRUE(inst->stop());
+}
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_publish_bytes_fail_releases_payload) {
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    mock->produce_result = ErrorCode::ERR__QUEUE_FULL;
+    EXPECT_CALL(*mock, fatal_error).Times(1).WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
+
+    bool released;
+    GBytes *message = new_tracked_message(released);
+    EXPECT_FALSE(inst->publish_bytes(message, nullptr));
+    g_bytes_unref(message);
+    EXPECT_TRUE(released) << "Expected payload released when producer rejects message";
+    EXPECT_TRUE(inst->stop());
+}
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_produce_custom_key) {
+    set_enum_property(*inst, PROP_KEY_MODE, GVA_META_PUBLISH_KEY_CUSTOM);
+    set_string_property(*inst, PROP_KEY, "camera-7");
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    EXPECT_CALL(*mock, produce(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_,
+                               ::testing::Pointee(std::string("camera-7")), ::testing::_))
+        .Times(1)
+        .WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
+    EXPECT_TRUE(inst->publish(TEST_MESSAGE, strlen(TEST_MESSAGE)));
+    EXPECT_TRUE(inst->stop());
+}
+
+TEST_F(GvaMetaPublishKafkaImplFixture, test_stop_purges_undelivered) {
+    ASSERT_TRUE(inst->start());
+    auto mock = inst->get_mock_producer();
+    EXPECT_CALL(*mock, flush).Times(1).WillOnce(::testing::Return(ErrorCode::ERR__TIMED_OUT));
+    EXPECT_CALL(*mock, outq_len).Times(1).WillOnce(::testing::Return(2));
+    EXPECT_CALL(*mock, purge(Producer::PURGE_QUEUE | Producer::PURGE_INFLIGHT))
+        .Times(1)
+        .WillOnce(::testing::Return(ErrorCode::ERR_NO_ERROR));
+    EXPECT_TRUE(inst->stop());
+}
+
 GTEST_API_ int main(int argc, char **argv) {
     std::cout << "Running metapublsh kafka test " << argv[0] << std::endl;
     testing::InitGoogleTest(&argc, argv);
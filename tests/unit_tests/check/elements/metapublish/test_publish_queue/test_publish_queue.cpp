@@ -0,0 +1,321 @@
+/*******************************************************************************
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <publish_queue.hpp>
+#include <test_common.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Stand-in for MQTT broker: accepts payloads while it is up and acknowledges them on request
+class FakeBroker {
+  public:
+    bool send(const std::string &payload, uint64_t &id) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_up)
+            return false;
+        id = ++_last_id;
+        _received.push_back(payload);
+        _pending.push_back(id);
+        return true;
+    }
+
+    void set_up(bool up) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _up = up;
+    }
+
+    void ack_all(PublishQueue &queue) {
+        std::vector<uint64_t> pending;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            pending.swap(_pending);
+        }
+        for (auto id : pending)
+            queue.on_complete(id, true);
+    }
+
+    std::vector<std::string> received() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _received;
+    }
+
+  private:
+    std::mutex _mutex;
+    bool _up = true;
+    uint64_t _last_id = 0;
+    std::vector<std::string> _received;
+    std::vector<uint64_t> _pending;
+};
+
+PublishQueue::SendFunction make_sender(FakeBroker &broker) {
+    return [&broker](const std::string &payload, uint64_t &id) { return broker.send(payload, id); };
+}
+
+// Acknowledges everything broker received until all messages are published or timeout expires
+void drain(FakeBroker &broker, PublishQueue &queue, uint64_t messages) {
+    for (int i = 0; i < 500 && queue.stats().published < messages; i++) {
+        broker.ack_all(queue);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+std::string message(int i) {
+    return "{\"frame\":" + std::to_string(i) + "}";
+}
+
+std::string joined(int first, int last) {
+    std::string result;
+    for (int i = first; i <= last; i++)
+        result += (i == first ? "" : "\n") + message(i);
+    return result;
+}
+
+} // namespace
+
+GST_START_TEST(test_publish_queue_coalescing) {
+    g_print("Starting test: test_publish_queue_coalescing\n");
+    FakeBroker broker;
+    PublishQueue::Config config;
+    config.batch_size = 3;
+    config.batch_timeout_ms = 20;
+    PublishQueue queue(config, make_sender(broker));
+    ck_assert(queue.start());
+    queue.set_connected(true);
+
+    for (int i = 0; i < 7; i++)
+        ck_assert(queue.push(message(i)));
+    drain(broker, queue, 7);
+    queue.stop(std::chrono::milliseconds(100));
+
+    auto received = broker.received();
+    // Last payload is incomplete and is published by timeout
+    ck_assert_uint_eq(received.size(), 3);
+    ck_assert_str_eq(received[0].c_str(), joined(0, 2).c_str());
+    ck_assert_str_eq(received[1].c_str(), joined(3, 5).c_str());
+    ck_assert_str_eq(received[2].c_str(), message(6).c_str());
+    auto stats = queue.stats();
+    ck_assert_uint_eq(stats.published, 7);
+    ck_assert_uint_eq(stats.dropped, 0);
+    ck_assert_uint_eq(stats.inflight, 0);
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_inflight_window) {
+    g_print("Starting test: test_publish_queue_inflight_window\n");
+    FakeBroker broker;
+    PublishQueue::Config config;
+    config.max_inflight = 2;
+    PublishQueue queue(config, make_sender(broker));
+    ck_assert(queue.start());
+    queue.set_connected(true);
+
+    for (int i = 0; i < 5; i++)
+        queue.push(message(i));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // Broker doesn't acknowledge, so only max_inflight payloads are sent
+    ck_assert_uint_eq(broker.received().size(), 2);
+    ck_assert_uint_eq(queue.stats().inflight, 2);
+    ck_assert_uint_eq(queue.stats().queue_depth, 3);
+
+    drain(broker, queue, 5);
+    queue.stop(std::chrono::milliseconds(100));
+    ck_assert_uint_eq(broker.received().size(), 5);
+    ck_assert_uint_eq(queue.stats().published, 5);
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_outage_drop_oldest) {
+    g_print("Starting test: test_publish_queue_outage_drop_oldest\n");
+    FakeBroker broker;
+    broker.set_up(false);
+    PublishQueue::Config config;
+    config.max_queue_size = 4;
+    config.drop_policy = GVA_META_PUBLISH_DROP_OLDEST;
+    PublishQueue queue(config, make_sender(broker));
+    queue.set_connected(false);
+    ck_assert(queue.start());
+
+    // Pushing doesn't block while broker is unavailable
+    for (int i = 0; i < 10; i++)
+        queue.push(message(i));
+    auto stats = queue.stats();
+    ck_assert_uint_eq(stats.queue_depth, 4);
+    ck_assert_uint_eq(stats.dropped, 6);
+
+    broker.set_up(true);
+    queue.set_connected(true);
+    drain(broker, queue, 4);
+    queue.stop(std::chrono::milliseconds(100));
+
+    auto received = broker.received();
+    ck_assert_uint_eq(received.size(), 4);
+    for (int i = 0; i < 4; i++)
+        ck_assert_str_eq(received[i].c_str(), message(6 + i).c_str());
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_outage_drop_newest) {
+    g_print("Starting test: test_publish_queue_outage_drop_newest\n");
+    FakeBroker broker;
+    PublishQueue::Config config;
+    config.max_queue_size = 4;
+    config.drop_policy = GVA_META_PUBLISH_DROP_NEWEST;
+    PublishQueue queue(config, make_sender(broker));
+    queue.set_connected(false);
+    ck_assert(queue.start());
+
+    for (int i = 0; i < 4; i++)
+        ck_assert(queue.push(message(i)));
+    ck_assert(!queue.push(message(4)));
+
+    queue.set_connected(true);
+    drain(broker, queue, 4);
+    queue.stop(std::chrono::milliseconds(100));
+
+    auto received = broker.received();
+    ck_assert_uint_eq(received.size(), 4);
+    ck_assert_str_eq(received[0].c_str(), message(0).c_str());
+    ck_assert_uint_eq(queue.stats().dropped, 1);
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_spill_file) {
+    g_print("Starting test: test_publish_queue_spill_file\n");
+    FakeBroker broker;
+    broker.set_up(false);
+    PublishQueue::Config config;
+    config.max_queue_size = 2;
+    config.spill_file = "publish_queue_spill.bin";
+    PublishQueue queue(config, make_sender(broker));
+    ck_assert(queue.start());
+    queue.set_connected(true);
+
+    for (int i = 0; i < 10; i++)
+        ck_assert(queue.push(message(i)));
+    // Broker rejects messages until it is up, payloads are retried after RETRY_INTERVAL
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto stats = queue.stats();
+    ck_assert_uint_eq(stats.dropped, 0);
+    ck_assert_uint_ge(stats.failed, 1);
+    ck_assert_uint_eq(stats.queue_depth + stats.spilled, 10);
+
+    broker.set_up(true);
+    drain(broker, queue, 10);
+    queue.stop(std::chrono::milliseconds(100));
+
+    auto received = broker.received();
+    ck_assert_uint_eq(received.size(), 10);
+    for (int i = 0; i < 10; i++)
+        ck_assert_str_eq(received[i].c_str(), message(i).c_str());
+    std::remove(config.spill_file.c_str());
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_starts_disconnected) {
+    g_print("Starting test: test_publish_queue_starts_disconnected\n");
+    FakeBroker broker;
+    PublishQueue queue(PublishQueue::Config(), make_sender(broker));
+    ck_assert(queue.start());
+
+    ck_assert(queue.push(message(0)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // Nothing is sent before client reports connection
+    ck_assert_uint_eq(broker.received().size(), 0);
+    ck_assert_uint_eq(queue.stats().failed, 0);
+
+    queue.set_connected(true);
+    drain(broker, queue, 1);
+    queue.stop(std::chrono::milliseconds(100));
+    ck_assert_uint_eq(queue.stats().published, 1);
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_retry_backoff) {
+    g_print("Starting test: test_publish_queue_retry_backoff\n");
+    FakeBroker broker;
+    broker.set_up(false);
+    PublishQueue queue(PublishQueue::Config(), make_sender(broker));
+    ck_assert(queue.start());
+    queue.set_connected(true);
+    ck_assert(queue.push(message(0)));
+
+    // Attempts at 0, 0.5 and 1.5 s; fixed interval would make the fourth one at 1.5 s already
+    std::this_thread::sleep_for(std::chrono::milliseconds(1750));
+    auto failed = queue.stats().failed;
+    ck_assert_uint_ge(failed, 2);
+    ck_assert_uint_le(failed, 3);
+
+    // Reconnection retries right away
+    broker.set_up(true);
+    queue.set_connected(true);
+    drain(broker, queue, 1);
+    queue.stop(std::chrono::milliseconds(100));
+    ck_assert_uint_eq(queue.stats().published, 1);
+}
+
+GST_END_TEST;
+
+GST_START_TEST(test_publish_queue_spill_file_max_size) {
+    g_print("Starting test: test_publish_queue_spill_file_max_size\n");
+    FakeBroker broker;
+    PublishQueue::Config config;
+    config.max_queue_size = 1;
+    config.spill_file = "publish_queue_spill_max_size.bin";
+    // Room for two spilled payloads of one message each
+    config.max_spill_size = 2 * (message(0).size() + 32);
+    PublishQueue queue(config, make_sender(broker));
+    ck_assert(queue.start());
+
+    for (int i = 0; i < 6; i++)
+        queue.push(message(i));
+    auto stats = queue.stats();
+    ck_assert_uint_eq(stats.queue_depth, 1);
+    ck_assert_uint_eq(stats.spilled, 2);
+    ck_assert_uint_eq(stats.dropped, 3);
+
+    queue.set_connected(true);
+    drain(broker, queue, 3);
+    queue.stop(std::chrono::milliseconds(100));
+
+    // Memory queue keeps the first payload, spill file the newest ones
+    auto received = broker.received();
+    ck_assert_uint_eq(received.size(), 3);
+    ck_assert_str_eq(received[0].c_str(), message(0).c_str());
+    ck_assert_str_eq(received[1].c_str(), message(4).c_str());
+    ck_assert_str_eq(received[2].c_str(), message(5).c_str());
+    std::remove(config.spill_file.c_str());
+}
+
+GST_END_TEST;
+
+static Suite *publish_queue_testing_suite(void) {
+    Suite *s = suite_create("publish_queue_testing");
+    TCase *tc_chain = tcase_create("general");
+
+    suite_add_tcase(s, tc_chain);
+    tcase_add_test(tc_chain, test_publish_queue_coalescing);
+    tcase_add_test(tc_chain, test_publish_queue_inflight_window);
+    tcase_add_test(tc_chain, test_publish_queue_outage_drop_oldest);
+    tcase_add_test(tc_chain, test_publish_queue_outage_drop_newest);
+    tcase_add_test(tc_chain, test_publish_queue_spill_file);
+    tcase_add_test(tc_chain, test_publish_queue_starts_disconnected);
+    tcase_add_test(tc_chain, test_publish_queue_retry_backoff);
+    tcase_add_test(tc_chain, test_publish_queue_spill_file_max_size);
+
+    return s;
+}
+
+GST_CHECK_MAIN(publish_queue_testing);
@@ -48,3 +48,16 @@ class MyClassVaapi:
 def process_frame(frame):
     print("Function: process_frame")
     return True
+
+
+def process_batch(frames):
+    print("Function: process_batch: {} frames".format(len(frames)))
+    for frame in frames:
+        with frame.planes() as planes:
+            print("Function: process_batch: {} planes".format(len(planes)))
+    # drop every second frame
+    return [index % 2 == 0 for index in range(len(frames))]
+
+
+def process_batch_wrong_size(frames):
+    return [True]
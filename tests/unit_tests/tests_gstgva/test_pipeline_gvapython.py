@@ -48,5 +48,27 @@ class TestGvaPythonParameters(unittest.TestCase):
                 actual_result.append(False)
         pipeline_runner.assertEqual(expected_result, actual_result)
 
+BATCH_PIPELINE_TEMPLATE = "videotestsrc num-buffers=10 ! video/x-raw,format=NV12,width=64,height=48 ! " \
+    "gvapython module={} {} ! fakesink"
+
+class TestGvaPythonBatch(unittest.TestCase):
+    def test_gvapython_batch_pipeline(self):
+        pipeline_runner = TestGenericPipelineRunner()
+        additional_args = [
+            ["function=process_batch", "batch-size=4"],
+            ["function=process_batch", "batch-size=1"],
+            ["function=process_batch_wrong_size", "batch-size=4"]
+        ]
+        expected_result = [True, False, False]
+        actual_result = []
+        for args in additional_args:
+            try:
+                pipeline_runner.set_pipeline(BATCH_PIPELINE_TEMPLATE.format(MODULE_PATH, " ".join(args)))
+                pipeline_runner.run_pipeline()
+                actual_result.append(True)
+            except Exception as e:
+                actual_result.append(False)
+        pipeline_runner.assertEqual(expected_result, actual_result)
+
 if __name__ == "__main__":
     unittest.main()
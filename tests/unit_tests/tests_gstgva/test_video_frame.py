@@ -143,6 +143,41 @@ class VideoFrameTestCase(unittest.TestCase):
         for test_messageage in messages:
             self.assertEqual(test_messageage, "some_message")
 
+    def test_regions_array(self):
+        self.assertEqual(len(self.video_frame_nv12.regions_array()), 0)
+
+        self.video_frame_nv12.add_region(10, 20, 30, 40, "dog", 0.5)
+        self.video_frame_nv12.add_region(50, 60, 70, 80, "bicycle", 0.75)
+        regions = self.video_frame_nv12.regions_array()
+        self.assertEqual(len(regions), 2)
+        self.assertEqual(list(regions["x"]), [10, 50])
+        self.assertEqual(list(regions["h"]), [40, 80])
+        self.assertEqual(list(regions["label"]), ["dog", "bicycle"])
+        np.testing.assert_allclose(regions["confidence"], [0.5, 0.75])
+        self.assertEqual(list(regions["id"]), [region.region_id() for region in self.video_frame_nv12.regions()])
+
+    def test_planes(self):
+        info = self.video_info_nv12
+        buffer = Gst.Buffer.new_allocate(None, info.size, None)
+        frame = va.VideoFrame(buffer, info)
+        with frame.planes(Gst.MapFlags.WRITE) as planes:
+            self.assertEqual(len(planes), 2)
+            self.assertEqual(planes[0].shape, (1080, 1920, 1))
+            self.assertEqual(planes[1].shape, (540, 960, 2))
+            planes[0][0, 0, 0] = 3
+            planes[1][0, 0] = [7, 9]
+
+        # planes are views of buffer data
+        with frame.data() as data:
+            self.assertEqual(data[0, 0, 0], 3)
+            self.assertEqual(list(data[1080, 0:2, 0]), [7, 9])
+
+        info = self.video_info_bgrx
+        buffer = Gst.Buffer.new_allocate(None, info.size, None)
+        with va.VideoFrame(buffer, info).planes() as planes:
+            self.assertEqual(len(planes), 1)
+            self.assertEqual(planes[0].shape, (1080, 1920, 4))
+
     def test_data(self):
         info_list = [self.video_info_nv12, self.video_info_i420, self.video_info_bgrx]
         for info in info_list: